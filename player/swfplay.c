@@ -89,7 +89,7 @@ main (int argc, char *argv[])
   GError *error = NULL;
   gboolean use_image = FALSE, no_sound = FALSE;
   gboolean trace = FALSE, no_scripts = FALSE;
-  gboolean redraws = FALSE, gc = FALSE;
+  gboolean redraws = FALSE, gc = FALSE, profile = FALSE;
   char *variables = NULL;
   GtkWidget *window;
   SwfdecURL *url;
@@ -100,6 +100,7 @@ main (int argc, char *argv[])
     { "max-runtime", 0, 0, G_OPTION_ARG_INT, &max_runtime, "maximum time scripts run before aborting the player", "SECS" },
     { "no-scripts", 0, 0, G_OPTION_ARG_NONE, &no_scripts, "don't execute scripts affecting the application", NULL },
     { "no-sound", 'n', 0, G_OPTION_ARG_NONE, &no_sound, "don't play sound", NULL },
+    { "profile", 0, 0, G_OPTION_ARG_NONE, &profile, "print statistics about executed scripts when exiting", NULL },
     { "redraws", 'r', 0, G_OPTION_ARG_NONE, &redraws, "show redraw regions", NULL },
     { "speed", 0, 0, G_OPTION_ARG_INT, &speed, "replay speed (will deactivate sound)", "PERCENT" },
     { "trace", 't', 0, G_OPTION_ARG_NONE, &trace, "print trace output to stdout", NULL },
@@ -136,6 +137,8 @@ main (int argc, char *argv[])
     g_object_set (player, "memory-until-gc", (gulong) 0, NULL);
   if (trace)
     g_signal_connect (player, "trace", G_CALLBACK (print_trace), NULL);
+  if (profile)
+    swfdec_as_context_start_profile (SWFDEC_AS_CONTEXT (player));
   swfdec_gtk_player_set_speed (SWFDEC_GTK_PLAYER (player), speed / 100.);
 
   if (no_sound)
@@ -160,6 +163,11 @@ main (int argc, char *argv[])
   if (g_main_loop_is_running (loop))
     g_main_loop_run (loop);
 
+  if (profile) {
+    char *dump = swfdec_as_context_dump_profile (SWFDEC_AS_CONTEXT (player));
+    g_print ("%s", dump);
+    g_free (dump);
+  }
   g_object_unref (player);
   g_main_loop_unref (loop);
   loop = NULL;
@@ -74,7 +74,7 @@ main (int argc, char **argv)
 
   g_print ("/* This file is autogenerated, do not edit! */\n\n");
   for (i = 1; i < argc; i++) {
-    if (!g_file_get_contents (argv[1], &contents, NULL, &error)) {
+    if (!g_file_get_contents (argv[i], &contents, NULL, &error)) {
       g_printerr ("Error: %s\n", error->message);
       g_error_free (error);
       error = NULL;
@@ -24,6 +24,7 @@
 #include "swfdec_amf.h"
 #include "swfdec_as_array.h"
 #include "swfdec_as_date.h"
+#include "swfdec_as_internal.h"
 #include "swfdec_as_strings.h"
 #include "swfdec_debug.h"
 
@@ -70,7 +71,7 @@ swfdec_amf_parse_properties (SwfdecAsContext *context, SwfdecBits *bits, SwfdecA
 
     if (!swfdec_amf_parse_string (context, bits, &val))
       return FALSE;
-    name = SWFDEC_AS_VALUE_GET_STRING (val);
+    name = SWFDEC_AS_VALUE_GET_FLAT_STRING (val);
     type = swfdec_bits_get_u8 (bits);
     if (type == SWFDEC_AMF_END_OBJECT)
       break;
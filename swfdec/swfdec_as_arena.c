@@ -0,0 +1,134 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "swfdec_as_arena.h"
+#include "swfdec_debug.h"
+
+/* An arena hands out the small blocks of memory the script engine uses for
+ * its garbage-collected values and variables. Memory is taken from big chunks
+ * by bumping a pointer. Released blocks are put on a free list per size and
+ * reused by the next allocation of the same size. The chunks themselves are
+ * only given back when the arena is freed together with its context. */
+
+#define SWFDEC_AS_ARENA_CHUNK_SIZE (64 * 1024)
+#define SWFDEC_AS_ARENA_N_CLASSES (SWFDEC_AS_ARENA_MAX_SIZE / SWFDEC_AS_ARENA_ALIGN)
+
+#define SWFDEC_AS_ARENA_SIZE_CLASS(size) (((size) - 1) / SWFDEC_AS_ARENA_ALIGN)
+
+typedef struct _SwfdecAsArenaBlock SwfdecAsArenaBlock;
+struct _SwfdecAsArenaBlock {
+  SwfdecAsArenaBlock *	next;		/* next free block of the same size */
+};
+
+struct _SwfdecAsArena {
+  SwfdecAsArenaBlock *	free[SWFDEC_AS_ARENA_N_CLASSES]; /* released blocks per size class */
+  guint8 *		cur;		/* start of unused memory in the current chunk */
+  guint8 *		end;		/* end of the current chunk */
+  GSList *		chunks;		/* all chunks allocated by this arena */
+};
+
+SwfdecAsArena *
+swfdec_as_arena_new (void)
+{
+  return g_slice_new0 (SwfdecAsArena);
+}
+
+void
+swfdec_as_arena_free (SwfdecAsArena *arena)
+{
+  GSList *walk;
+
+  g_return_if_fail (arena != NULL);
+
+  for (walk = arena->chunks; walk; walk = walk->next) {
+    g_free (walk->data);
+  }
+  g_slist_free (arena->chunks);
+  g_slice_free (SwfdecAsArena, arena);
+}
+
+/**
+ * swfdec_as_arena_alloc:
+ * @arena: the arena to allocate from
+ * @size: number of bytes to allocate, at most %SWFDEC_AS_ARENA_MAX_SIZE
+ *
+ * Allocates a block of zeroed memory from @arena. The memory is aligned to
+ * %SWFDEC_AS_ARENA_ALIGN bytes.
+ *
+ * Returns: the new block of memory
+ **/
+gpointer
+swfdec_as_arena_alloc (SwfdecAsArena *arena, gsize size)
+{
+  SwfdecAsArenaBlock *block;
+  guint klass;
+
+  g_return_val_if_fail (arena != NULL, NULL);
+  g_return_val_if_fail (size > 0 && size <= SWFDEC_AS_ARENA_MAX_SIZE, NULL);
+
+  klass = SWFDEC_AS_ARENA_SIZE_CLASS (size);
+  block = arena->free[klass];
+  if (block) {
+    arena->free[klass] = block->next;
+  } else {
+    size = (klass + 1) * SWFDEC_AS_ARENA_ALIGN;
+    if (arena->cur + size > arena->end) {
+      /* the rest of the old chunk is lost, but it's less than one block */
+      SWFDEC_LOG ("allocating new arena chunk");
+      arena->cur = g_malloc (SWFDEC_AS_ARENA_CHUNK_SIZE);
+      arena->end = arena->cur + SWFDEC_AS_ARENA_CHUNK_SIZE;
+      arena->chunks = g_slist_prepend (arena->chunks, arena->cur);
+    }
+    block = (SwfdecAsArenaBlock *) arena->cur;
+    arena->cur += size;
+  }
+  memset (block, 0, (klass + 1) * SWFDEC_AS_ARENA_ALIGN);
+
+  return block;
+}
+
+/**
+ * swfdec_as_arena_release:
+ * @arena: the arena @mem was allocated from
+ * @mem: memory allocated with swfdec_as_arena_alloc()
+ * @size: the size that was passed to swfdec_as_arena_alloc()
+ *
+ * Returns @mem to @arena so it can be reused by later allocations.
+ **/
+void
+swfdec_as_arena_release (SwfdecAsArena *arena, gpointer mem, gsize size)
+{
+  SwfdecAsArenaBlock *block;
+  guint klass;
+
+  g_return_if_fail (arena != NULL);
+  g_return_if_fail (mem != NULL);
+  g_return_if_fail (size > 0 && size <= SWFDEC_AS_ARENA_MAX_SIZE);
+
+  klass = SWFDEC_AS_ARENA_SIZE_CLASS (size);
+  block = mem;
+  block->next = arena->free[klass];
+  arena->free[klass] = block;
+}
@@ -0,0 +1,45 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_AS_ARENA_H_
+#define _SWFDEC_AS_ARENA_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* all memory handed out by an arena is aligned to this */
+#define SWFDEC_AS_ARENA_ALIGN 8
+/* bigger allocations must not use the arena */
+#define SWFDEC_AS_ARENA_MAX_SIZE 256
+
+typedef struct _SwfdecAsArena SwfdecAsArena;
+
+SwfdecAsArena *	swfdec_as_arena_new		(void);
+void		swfdec_as_arena_free		(SwfdecAsArena *	arena);
+
+gpointer	swfdec_as_arena_alloc		(SwfdecAsArena *	arena,
+						 gsize			size);
+void		swfdec_as_arena_release		(SwfdecAsArena *	arena,
+						 gpointer		mem,
+						 gsize			size);
+
+
+G_END_DECLS
+#endif
@@ -179,6 +179,9 @@ swfdec_as_array_remove_range (SwfdecAsObject *object, gint32 start_index,
   if (num == 0)
     return;
 
+  if (swfdec_as_object_remove_elements (object, start_index, num))
+    return;
+
   // to avoid foreach loop, use special case when removing just one variable
   if (num == 1) {
     swfdec_as_object_delete_variable (object, 
@@ -231,8 +234,10 @@ swfdec_as_array_move_range (SwfdecAsObject *object, gint32 from_index,
   if (num == 0 || from_index == to_index)
     return;
 
-  swfdec_as_object_foreach_rename (object, swfdec_as_array_foreach_move_range,
-      &fdata);
+  if (!swfdec_as_object_move_elements (object, from_index, num, to_index)) {
+    swfdec_as_object_foreach_rename (object, swfdec_as_array_foreach_move_range,
+	&fdata);
+  }
 
   // only changes length if it becomes bigger, not if it becomes smaller
   if (to_index + num > swfdec_as_array_get_length (object))
@@ -253,6 +258,8 @@ swfdec_as_array_set_range_with_flags (SwfdecAsObject *object,
   g_return_if_fail (num == 0 || value != NULL);
 
   for (i = 0; i < num; i++) {
+    if (swfdec_as_object_set_element (object, start_index + i, &value[i], flags))
+      continue;
     var = swfdec_as_integer_to_string (object->context, start_index + i);
     swfdec_as_object_set_variable_and_flags (object, var, &value[i], flags);
   }
@@ -404,6 +411,9 @@ swfdec_as_array_get_value (SwfdecAsObject *array, gint32 idx,
   g_assert (idx >= 0);
   g_assert (value != NULL);
 
+  if (swfdec_as_object_get_element (array, idx, value))
+    return;
+
   var = swfdec_as_integer_to_string (array->context, idx);
   swfdec_as_object_get_variable (array, var, value);
 }
@@ -426,6 +436,9 @@ swfdec_as_array_set_value (SwfdecAsObject *array, gint32 idx,
   g_assert (array != NULL);
   g_assert (idx >= 0);
 
+  if (swfdec_as_object_set_element (array, idx, value, 0))
+    return;
+
   var = swfdec_as_integer_to_string (array->context, idx);
   swfdec_as_object_set_variable (array, var, value);
 }
@@ -475,8 +488,20 @@ swfdec_as_array_append_array_range (SwfdecAsObject *array_to,
 
   swfdec_as_array_set_length_object (fdata.object_to,
       fdata.offset + fdata.num);
-  swfdec_as_object_foreach (object_from,
-      swfdec_as_array_foreach_append_array_range, &fdata);
+  if (object_from->dense) {
+    SwfdecAsValue *value;
+    gint32 i, end;
+
+    end = MIN ((guint) start_index + num, object_from->n_elements);
+    for (i = start_index; i < end; i++) {
+      value = swfdec_as_object_peek_element (object_from, i);
+      if (value)
+	swfdec_as_array_set_value (array_to, fdata.offset + (i - start_index), value);
+    }
+  } else {
+    swfdec_as_object_foreach (object_from,
+	swfdec_as_array_foreach_append_array_range, &fdata);
+  }
 }
 
 static void
@@ -508,6 +533,7 @@ swfdec_as_array_new (SwfdecAsContext *context)
 
   ret = swfdec_as_object_new (context, NULL);
   ret->array = TRUE;
+  swfdec_as_object_use_elements (ret);
   swfdec_as_object_set_constructor_by_name (ret, SWFDEC_AS_STR_Array, NULL);
 
   swfdec_as_array_set_length_object (ret, 0);
@@ -542,8 +568,7 @@ swfdec_as_array_join (SwfdecAsContext *cx, SwfdecAsObject *object, guint argc,
     str = swfdec_as_value_to_string (cx, val);
     string = g_string_new (str);
     for (i = 1; i < swfdec_as_array_get_length (object); i++) {
-      var = swfdec_as_integer_to_string (cx, i);
-      swfdec_as_object_get_variable (object, var, &val);
+      swfdec_as_array_get_value (object, i, &val);
       var = swfdec_as_value_to_string (cx, val);
       g_string_append (string, sep);
       g_string_append (string, var);
@@ -567,7 +592,7 @@ swfdec_as_array_toString (SwfdecAsContext *cx, SwfdecAsObject *object,
   swfdec_as_array_join (cx, object, 0, NULL, ret);
 }
 
-SWFDEC_AS_NATIVE (252, 1, swfdec_as_array_do_push)
+SWFDEC_AS_FAST_NATIVE (252, 1, swfdec_as_array_do_push)
 void
 swfdec_as_array_do_push (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -602,10 +627,18 @@ swfdec_as_array_do_pop (SwfdecAsContext *cx, SwfdecAsObject *object,
   if (length == 0)
     return;
 
-  var = swfdec_as_integer_to_string (object->context, length - 1);
-  swfdec_as_object_get_variable (object, var, ret);
-
-  swfdec_as_object_delete_variable (object, var);
+  // dense elements are removed directly, the named variable functions handle
+  // everything else including negative lengths
+  var = NULL;
+  if (!swfdec_as_object_get_element (object, length - 1, ret)) {
+    var = swfdec_as_integer_to_string (object->context, length - 1);
+    swfdec_as_object_get_variable (object, var, ret);
+  }
+  if (length < 0 || !swfdec_as_object_remove_elements (object, length - 1, 1)) {
+    if (var == NULL)
+      var = swfdec_as_integer_to_string (object->context, length - 1);
+    swfdec_as_object_delete_variable (object, var);
+  }
 
   // if Array, the length is reduced by one
   // else the length is not reduced at all, but the variable is still deleted
@@ -698,8 +731,10 @@ swfdec_as_array_reverse (SwfdecAsContext *cx, SwfdecAsObject *object,
     return;
 
   length = swfdec_as_array_get_length (object);
-  swfdec_as_object_foreach_rename (object, swfdec_as_array_foreach_reverse,
-      &length);
+  if (!swfdec_as_object_reverse_elements (object, length)) {
+    swfdec_as_object_foreach_rename (object, swfdec_as_array_foreach_reverse,
+	&length);
+  }
 
   SWFDEC_AS_VALUE_SET_OBJECT (ret, object);
 }
@@ -711,7 +746,6 @@ swfdec_as_array_concat (SwfdecAsContext *cx, SwfdecAsObject *object,
 {
   guint j;
   SwfdecAsObject *array_new;
-  const char *var;
 
   if (object == NULL || object->movie)
     return;
@@ -729,8 +763,8 @@ swfdec_as_array_concat (SwfdecAsContext *cx, SwfdecAsObject *object,
     }
     else
     {
-      var = swfdec_as_integer_to_string (cx, swfdec_as_array_get_length (array_new));
-      swfdec_as_object_set_variable (array_new, var, &argv[j]);
+      swfdec_as_array_set_value (array_new,
+	  swfdec_as_array_get_length (array_new), &argv[j]);
     }
   }
 
@@ -1041,7 +1075,6 @@ swfdec_as_array_do_sort (SwfdecAsContext *cx, SwfdecAsObject *object,
   SortCollectData collect_data;
   SortCompareData compare_data;
   gint32 i, length;
-  const char *var;
   SwfdecAsObject *target;
   SwfdecAsValue val;
   SortOption options_;
@@ -1084,8 +1117,17 @@ swfdec_as_array_do_sort (SwfdecAsContext *cx, SwfdecAsObject *object,
   collect_data.length = length;
   collect_data.array = array;
 
-  swfdec_as_object_foreach (object, swfdec_as_array_foreach_sort_collect,
+  if (object->dense) {
+    SwfdecAsValue *value;
+    for (i = 0; (guint) i < MIN ((guint) length, object->n_elements); i++) {
+      value = swfdec_as_object_peek_element (object, i);
+      if (value && !SWFDEC_AS_VALUE_IS_UNDEFINED (*value))
+	array[i].value = *value;
+    }
+  } else {
+    swfdec_as_object_foreach (object, swfdec_as_array_foreach_sort_collect,
 	&collect_data);
+  }
 
   // sort the array
   compare_data.context = cx;
@@ -1142,12 +1184,12 @@ swfdec_as_array_do_sort (SwfdecAsContext *cx, SwfdecAsObject *object,
 	entry->index_ == (descending ? length - i - 1 : i))
       continue;
 
-    var = swfdec_as_integer_to_string (cx, (descending ? length - i - 1 : i));
     if (options[0] & SORT_OPTION_RETURNINDEXEDARRAY) {
       val = swfdec_as_value_from_integer (cx, entry->index_);
-      swfdec_as_object_set_variable (target, var, &val);
+      swfdec_as_array_set_value (target, descending ? length - i - 1 : i, &val);
     } else {
-      swfdec_as_object_set_variable (target, var, &entry->value);
+      swfdec_as_array_set_value (target, descending ? length - i - 1 : i, 
+	  &entry->value);
     }
   }
 
@@ -1283,6 +1325,7 @@ swfdec_as_array_construct (SwfdecAsContext *cx, SwfdecAsObject *object,
   }
   swfdec_as_object_set_relay (object, NULL);
   object->array = TRUE;
+  swfdec_as_object_use_elements (object);
 
   if (argc == 1 && SWFDEC_AS_VALUE_IS_NUMBER (argv[0])) {
     int l = swfdec_as_value_to_integer (cx, argv[0]);
@@ -0,0 +1,271 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec_as_cloner.h"
+#include "swfdec_as_context.h"
+#include "swfdec_as_internal.h"
+#include "swfdec_as_object.h"
+#include "swfdec_as_relay.h"
+#include "swfdec_debug.h"
+
+/* A cloner copies a graph of script objects inside a context. It is used to
+ * restore the global objects of a sandbox from a snapshot instead of running
+ * the initialization scripts again. Every object reachable from the source is
+ * copied exactly once, references between the objects are rewritten to point
+ * to the copies. Strings and numbers are immutable, so they are shared.
+ *
+ * Objects with a relay can only be copied if the relay's class implements the
+ * clone vfunc. If anything in the graph cannot be copied, the cloner fails 
+ * and the caller has to create the objects in another way. */
+
+struct _SwfdecAsCloner {
+  SwfdecAsContext *	context;	/* context we clone in */
+  GHashTable *		objects;	/* source object => copied object */
+  GHashTable *		relays;		/* source relay => relay to use instead */
+  GQueue *		todo;		/* pairs of source and copied object waiting for their variables */
+  gboolean		failed;		/* TRUE if something could not be cloned */
+};
+
+SwfdecAsCloner *
+swfdec_as_cloner_new (SwfdecAsContext *context)
+{
+  SwfdecAsCloner *cloner;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+
+  cloner = g_slice_new0 (SwfdecAsCloner);
+  cloner->context = context;
+  cloner->objects = g_hash_table_new (g_direct_hash, g_direct_equal);
+  cloner->relays = g_hash_table_new (g_direct_hash, g_direct_equal);
+  cloner->todo = g_queue_new ();
+
+  return cloner;
+}
+
+void
+swfdec_as_cloner_free (SwfdecAsCloner *cloner)
+{
+  g_return_if_fail (cloner != NULL);
+
+  g_hash_table_destroy (cloner->objects);
+  g_hash_table_destroy (cloner->relays);
+  g_queue_free (cloner->todo);
+  g_slice_free (SwfdecAsCloner, cloner);
+}
+
+SwfdecAsContext *
+swfdec_as_cloner_get_context (SwfdecAsCloner *cloner)
+{
+  g_return_val_if_fail (cloner != NULL, NULL);
+
+  return cloner->context;
+}
+
+/**
+ * swfdec_as_cloner_fail:
+ * @cloner: a #SwfdecAsCloner
+ *
+ * Marks the copy as failed. This is used by clone vfuncs of relays that 
+ * cannot copy their current state.
+ **/
+void
+swfdec_as_cloner_fail (SwfdecAsCloner *cloner)
+{
+  g_return_if_fail (cloner != NULL);
+
+  cloner->failed = TRUE;
+}
+
+/**
+ * swfdec_as_cloner_add_relay:
+ * @cloner: a #SwfdecAsCloner
+ * @source: a relay referenced by the source objects
+ * @dest: the relay the copies should reference instead
+ *
+ * Makes the copied objects reference @dest wherever the source objects 
+ * referenced @source. Relays that are not attached to an object and have not
+ * been added here are referenced unchanged.
+ **/
+void
+swfdec_as_cloner_add_relay (SwfdecAsCloner *cloner, SwfdecAsRelay *source,
+    SwfdecAsRelay *dest)
+{
+  g_return_if_fail (cloner != NULL);
+  g_return_if_fail (SWFDEC_IS_AS_RELAY (source));
+  g_return_if_fail (SWFDEC_IS_AS_RELAY (dest));
+
+  g_hash_table_insert (cloner->relays, source, dest);
+}
+
+static void
+swfdec_as_cloner_push (SwfdecAsCloner *cloner, SwfdecAsObject *source,
+    SwfdecAsObject *dest)
+{
+  g_hash_table_insert (cloner->objects, source, dest);
+  g_queue_push_tail (cloner->todo, source);
+  g_queue_push_tail (cloner->todo, dest);
+}
+
+/**
+ * swfdec_as_cloner_map_object:
+ * @cloner: a #SwfdecAsCloner
+ * @source: an object from the source graph
+ *
+ * Gets the copy of @source, creating it if it doesn't exist yet. The 
+ * variables of a newly created copy are filled in later.
+ *
+ * Returns: the copy of @source
+ **/
+SwfdecAsObject *
+swfdec_as_cloner_map_object (SwfdecAsCloner *cloner, SwfdecAsObject *source)
+{
+  SwfdecAsObject *dest;
+
+  g_return_val_if_fail (cloner != NULL, NULL);
+  g_return_val_if_fail (source != NULL, NULL);
+
+  dest = g_hash_table_lookup (cloner->objects, source);
+  if (dest)
+    return dest;
+
+  dest = swfdec_as_object_new_empty (cloner->context);
+  swfdec_as_cloner_push (cloner, source, dest);
+  if (source->relay) {
+    SwfdecAsRelayClass *klass = SWFDEC_AS_RELAY_GET_CLASS (source->relay);
+    SwfdecAsRelay *relay = klass->clone ? klass->clone (source->relay, cloner) : NULL;
+
+    if (relay == NULL) {
+      SWFDEC_INFO ("cannot clone objects with a %s relay", 
+	  G_OBJECT_TYPE_NAME (source->relay));
+      cloner->failed = TRUE;
+    } else {
+      g_hash_table_insert (cloner->relays, source->relay, relay);
+      swfdec_as_object_set_relay (dest, relay);
+    }
+  }
+
+  return dest;
+}
+
+/**
+ * swfdec_as_cloner_map_relay:
+ * @cloner: a #SwfdecAsCloner
+ * @source: a relay referenced from the source graph or %NULL
+ *
+ * Gets the relay that should be referenced instead of @source. This is the 
+ * relay of the copied object for relays that are attached to an object.
+ *
+ * Returns: the relay to reference instead of @source
+ **/
+gpointer
+swfdec_as_cloner_map_relay (SwfdecAsCloner *cloner, gpointer source)
+{
+  SwfdecAsRelay *relay;
+  SwfdecAsObject *object;
+
+  g_return_val_if_fail (cloner != NULL, NULL);
+  g_return_val_if_fail (source == NULL || SWFDEC_IS_AS_RELAY (source), NULL);
+
+  if (source == NULL)
+    return NULL;
+  relay = g_hash_table_lookup (cloner->relays, source);
+  if (relay)
+    return relay;
+  relay = source;
+  if (relay->relay == NULL)
+    return relay;
+
+  object = swfdec_as_cloner_map_object (cloner, relay->relay);
+  if (object->relay == NULL) {
+    cloner->failed = TRUE;
+    return relay;
+  }
+  return object->relay;
+}
+
+/**
+ * swfdec_as_cloner_map_value:
+ * @cloner: a #SwfdecAsCloner
+ * @source: a value from the source graph
+ *
+ * Gets the value to use for @source in the copy.
+ *
+ * Returns: the value to use for the copy
+ **/
+SwfdecAsValue
+swfdec_as_cloner_map_value (SwfdecAsCloner *cloner, SwfdecAsValue source)
+{
+  SwfdecAsValue dest;
+
+  g_return_val_if_fail (cloner != NULL, SWFDEC_AS_VALUE_UNDEFINED);
+
+  if (!SWFDEC_AS_VALUE_IS_OBJECT (source))
+    return source;
+
+  SWFDEC_AS_VALUE_SET_OBJECT (&dest, 
+      swfdec_as_cloner_map_object (cloner, SWFDEC_AS_VALUE_GET_OBJECT (source)));
+  return dest;
+}
+
+/**
+ * swfdec_as_cloner_copy:
+ * @cloner: a #SwfdecAsCloner
+ * @source: the object to copy
+ * @dest: the object to copy to
+ *
+ * Copies the variables of @source and all objects reachable from it into 
+ * @dest. @dest must not contain any variables yet. References to @source 
+ * will reference @dest in the copy.
+ *
+ * Returns: %TRUE if the whole graph could be copied. If %FALSE is returned,
+ *          all variables have been removed from @dest again.
+ **/
+gboolean
+swfdec_as_cloner_copy (SwfdecAsCloner *cloner, SwfdecAsObject *source,
+    SwfdecAsObject *dest)
+{
+  g_return_val_if_fail (cloner != NULL, FALSE);
+  g_return_val_if_fail (source != NULL, FALSE);
+  g_return_val_if_fail (dest != NULL, FALSE);
+  g_return_val_if_fail (g_hash_table_lookup (cloner->objects, source) == NULL, FALSE);
+
+  swfdec_as_cloner_push (cloner, source, dest);
+  while (!cloner->failed && !g_queue_is_empty (cloner->todo)) {
+    SwfdecAsObject *from = g_queue_pop_head (cloner->todo);
+    SwfdecAsObject *to = g_queue_pop_head (cloner->todo);
+    if (!swfdec_as_object_clone_variables (to, from, cloner))
+      cloner->failed = TRUE;
+  }
+  if (!cloner->failed)
+    return TRUE;
+
+  /* the other copies are garbage now and will be collected */
+  g_queue_clear (cloner->todo);
+  swfdec_as_object_delete_all_variables (dest);
+  dest->prototype = NULL;
+  dest->prototype_flags = 0;
+  g_slist_free (dest->interfaces);
+  dest->interfaces = NULL;
+  return FALSE;
+}
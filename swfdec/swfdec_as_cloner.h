@@ -0,0 +1,49 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef _SWFDEC_AS_CLONER_H_
+#define _SWFDEC_AS_CLONER_H_
+
+#include <swfdec/swfdec_as_types.h>
+
+G_BEGIN_DECLS
+
+SwfdecAsCloner *	swfdec_as_cloner_new		(SwfdecAsContext *	context);
+void			swfdec_as_cloner_free		(SwfdecAsCloner *	cloner);
+
+void			swfdec_as_cloner_add_relay	(SwfdecAsCloner *	cloner,
+							 SwfdecAsRelay *	source,
+							 SwfdecAsRelay *	dest);
+gboolean		swfdec_as_cloner_copy		(SwfdecAsCloner *	cloner,
+							 SwfdecAsObject *	source,
+							 SwfdecAsObject *	dest);
+void			swfdec_as_cloner_fail		(SwfdecAsCloner *	cloner);
+
+SwfdecAsContext *	swfdec_as_cloner_get_context	(SwfdecAsCloner *	cloner);
+SwfdecAsObject *	swfdec_as_cloner_map_object	(SwfdecAsCloner *	cloner,
+							 SwfdecAsObject *	source);
+gpointer		swfdec_as_cloner_map_relay	(SwfdecAsCloner *	cloner,
+							 gpointer		source);
+SwfdecAsValue		swfdec_as_cloner_map_value	(SwfdecAsCloner *	cloner,
+							 SwfdecAsValue		source);
+
+
+G_END_DECLS
+#endif
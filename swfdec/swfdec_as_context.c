@@ -25,6 +25,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "swfdec_as_context.h"
+#include "swfdec_as_arena.h"
 #include "swfdec_as_array.h"
 #include "swfdec_as_frame_internal.h"
 #include "swfdec_as_function.h"
@@ -35,7 +36,11 @@
 #include "swfdec_as_movie_value.h"
 #include "swfdec_as_native_function.h"
 #include "swfdec_as_object.h"
+#include "swfdec_as_profile.h"
+#include "swfdec_as_shape.h"
 #include "swfdec_as_stack.h"
+#include "swfdec_as_string.h"
+#include "swfdec_as_string_table.h"
 #include "swfdec_as_strings.h"
 #include "swfdec_as_types.h"
 #include "swfdec_constant_pool.h"
@@ -103,6 +108,17 @@
  * usually called the "root set". For any reachable object, the object's mark
  * function is called so that the object in turn can mark all objects it can 
  * reach itself. Marking is done via functions described below.
+ *
+ * Freeing the unreachable objects can take a lot longer than marking the 
+ * reachable ones. When the #SwfdecAsContext:gc-incremental property is set,
+ * swfdec_as_context_maybe_gc() only marks and then frees garbage in small 
+ * steps every time it is called, so that no single call takes too long. Note
+ * that only freeing is incremental. Marking still happens all at once, so 
+ * the step that starts a collection takes as long as marking all reachable 
+ * values. The pauses caused by the garbage collector can be inspected using 
+ * the #SwfdecAsContext:gc-last-pause, #SwfdecAsContext:gc-max-pause and 
+ * #SwfdecAsContext:gc-total-pause properties. The maximum pause is usually
+ * the time it took to mark.
  */
 
 /*** GTK-DOC ***/
@@ -278,16 +294,32 @@ swfdec_as_context_remove_gc_objects (SwfdecAsContext *context)
   }
 }
 
+/* A string created by concatenating left and right. Ropes live in the strings
+ * list, but are not interned. */
+typedef struct {
+  SwfdecAsStringValue *	next;
+  gsize			length;		/* length of the string | SWFDEC_AS_STRING_VALUE_ROPE */
+  SwfdecAsContext *	context;	/* context the rope belongs to */
+  SwfdecAsStringValue *	left;		/* first part or NULL once flattened */
+  SwfdecAsStringValue *	right;		/* second part or NULL once flattened */
+  const char *		flat;		/* interned contents or NULL if not flattened yet */
+} SwfdecAsStringRope;
+
 static void
 swfdec_as_context_collect_string (SwfdecAsContext *context, gpointer gc)
 {
   SwfdecAsStringValue *string;
 
   string = gc;
-  if (!g_hash_table_remove (context->interned_strings, string->string)) {
-    g_assert_not_reached ();
+  if (SWFDEC_AS_STRING_VALUE_IS_ROPE (string)) {
+    swfdec_as_gcable_free (context, gc, sizeof (SwfdecAsStringRope));
+    return;
   }
-  swfdec_as_gcable_free (context, gc, sizeof (SwfdecAsStringValue) + string->length + 1);
+  /* the string table was swept already */
+  if (!SWFDEC_AS_STRING_VALUE_IS_ASCII (string))
+    swfdec_as_str_free_index (context, string);
+  swfdec_as_gcable_free (context, gc, sizeof (SwfdecAsStringValue) + 
+      SWFDEC_AS_STRING_VALUE_LENGTH (string) + 1);
 }
 
 static void
@@ -308,13 +340,119 @@ swfdec_as_context_collect_pools (gpointer mem, gpointer pool, gpointer cx)
   return swfdec_constant_pool_collect (pool);
 }
 
+/* Garbage is swept in phases: objects first, so shapes never refer to
+ * collected strings, then strings, numbers and movies. When the sweep starts,
+ * all lists are moved to the sweep state, so gcables allocated while sweeping
+ * are never looked at. */
+enum {
+  SWFDEC_AS_SWEEP_OBJECTS,
+  SWFDEC_AS_SWEEP_STRINGS,
+  SWFDEC_AS_SWEEP_NUMBERS,
+  SWFDEC_AS_SWEEP_MOVIES,
+  SWFDEC_AS_SWEEP_DONE
+};
+
+typedef struct {
+  guint			phase;		/* list that is currently being swept */
+  SwfdecAsGcable *	pending[SWFDEC_AS_SWEEP_DONE]; /* gcables that still need to be checked */
+} SwfdecAsContextSweep;
+
+static gpointer *
+swfdec_as_context_get_gcables (SwfdecAsContext *context, guint phase)
+{
+  switch (phase) {
+    case SWFDEC_AS_SWEEP_OBJECTS:
+      return &context->objects;
+    case SWFDEC_AS_SWEEP_STRINGS:
+      return &context->strings;
+    case SWFDEC_AS_SWEEP_NUMBERS:
+      return &context->numbers;
+    case SWFDEC_AS_SWEEP_MOVIES:
+      return &context->movies;
+    default:
+      g_assert_not_reached ();
+      return NULL;
+  }
+}
+
+static const SwfdecAsGcableDestroyNotify swfdec_as_context_sweep_notify[SWFDEC_AS_SWEEP_DONE] = {
+  (SwfdecAsGcableDestroyNotify) swfdec_as_object_free,
+  swfdec_as_context_collect_string,
+  swfdec_as_context_collect_double,
+  swfdec_as_context_collect_movie
+};
+
+/* must be called right after marking */
+static void
+swfdec_as_context_start_sweep (SwfdecAsContext *context)
+{
+  SwfdecAsContextSweep *sweep;
+  gpointer *list;
+  guint i;
+
+  g_assert (context->gc_sweep == NULL);
+
+  SWFDEC_INFO (">> starting incremental sweep");
+  /* these are few and cannot be swept incrementally */
+  swfdec_as_context_remove_gc_objects (context);
+  g_hash_table_foreach_remove (context->constant_pools, 
+      swfdec_as_context_collect_pools, context);
+  /* garbage strings must not be found by lookups while they wait for being
+   * swept, so remove them from the string table right away */
+  swfdec_as_string_table_sweep (context->interned_strings);
+
+  sweep = g_slice_new (SwfdecAsContextSweep);
+  sweep->phase = SWFDEC_AS_SWEEP_OBJECTS;
+  for (i = 0; i < SWFDEC_AS_SWEEP_DONE; i++) {
+    list = swfdec_as_context_get_gcables (context, i);
+    sweep->pending[i] = *list;
+    *list = NULL;
+  }
+  context->gc_sweep = sweep;
+}
+
+/* sweeps at most budget gcables and returns TRUE if the sweep is done */
+static gboolean
+swfdec_as_context_sweep (SwfdecAsContext *context, guint budget)
+{
+  SwfdecAsContextSweep *sweep = context->gc_sweep;
+  gpointer *list;
+
+  g_assert (sweep != NULL);
+
+  while (sweep->phase < SWFDEC_AS_SWEEP_DONE && budget > 0) {
+    list = swfdec_as_context_get_gcables (context, sweep->phase);
+    *list = swfdec_as_gcable_collect_some (context, *list, 
+	&sweep->pending[sweep->phase], swfdec_as_context_sweep_notify[sweep->phase], 
+	&budget);
+    if (sweep->pending[sweep->phase] == NULL)
+      sweep->phase++;
+  }
+  if (sweep->phase < SWFDEC_AS_SWEEP_DONE)
+    return FALSE;
+
+  g_slice_free (SwfdecAsContextSweep, sweep);
+  context->gc_sweep = NULL;
+  SWFDEC_INFO (">> done with incremental sweep");
+  return TRUE;
+}
+
+static void
+swfdec_as_context_finish_sweep (SwfdecAsContext *context)
+{
+  if (context->gc_sweep)
+    swfdec_as_context_sweep (context, G_MAXUINT);
+}
+
 static void
 swfdec_as_context_collect (SwfdecAsContext *context)
 {
   /* NB: This functions is called without GC from swfdec_as_context_dispose */
+  g_assert (context->gc_sweep == NULL);
   SWFDEC_INFO (">> collecting garbage");
   
   swfdec_as_context_remove_gc_objects (context);
+  swfdec_as_string_table_sweep (context->interned_strings);
 
   context->objects = swfdec_as_gcable_collect (context, context->objects,
       (SwfdecAsGcableDestroyNotify) swfdec_as_object_free);
@@ -350,6 +488,34 @@ swfdec_as_string_mark (const char *string)
     SWFDEC_AS_GCABLE_SET_FLAG (value, SWFDEC_AS_GC_MARK);
 }
 
+/* ropes can get very deep, so don't recurse */
+static void
+swfdec_as_string_rope_mark (SwfdecAsStringRope *rope)
+{
+  SwfdecAsStringValue *value = (SwfdecAsStringValue *) rope;
+  GSList *todo = NULL;
+
+  for (;;) {
+    if (!SWFDEC_AS_GCABLE_FLAG_IS_SET (value, SWFDEC_AS_GC_ROOT | SWFDEC_AS_GC_MARK)) {
+      SWFDEC_AS_GCABLE_SET_FLAG (value, SWFDEC_AS_GC_MARK);
+      if (SWFDEC_AS_STRING_VALUE_IS_ROPE (value)) {
+	rope = (SwfdecAsStringRope *) value;
+	if (rope->flat)
+	  swfdec_as_string_mark (rope->flat);
+	if (rope->left) {
+	  todo = g_slist_prepend (todo, rope->right);
+	  value = rope->left;
+	  continue;
+	}
+      }
+    }
+    if (todo == NULL)
+      break;
+    value = todo->data;
+    todo = g_slist_delete_link (todo, todo);
+  }
+}
+
 /**
  * swfdec_as_value_mark:
  * @value: a #SwfdecAsValue
@@ -373,6 +539,11 @@ swfdec_as_value_mark (SwfdecAsValue *value)
 
   switch (type) {
     case SWFDEC_AS_TYPE_STRING:
+      if (SWFDEC_AS_STRING_VALUE_IS_ROPE (gcable)) {
+	swfdec_as_string_rope_mark ((SwfdecAsStringRope *) gcable);
+	break;
+      }
+      /* fall through */
     case SWFDEC_AS_TYPE_NUMBER:
       SWFDEC_AS_GCABLE_SET_FLAG (gcable, SWFDEC_AS_GC_MARK);
       break;
@@ -406,6 +577,34 @@ swfdec_as_context_mark_constant_pools (gpointer key, gpointer value, gpointer un
   }
 }
 
+static void
+swfdec_as_context_mark_suspended (gpointer data, gpointer unused)
+{
+  SwfdecAsFrame *frame = data;
+  guint i;
+
+  if (frame->function)
+    swfdec_gc_object_mark (frame->function);
+  swfdec_as_value_mark (&frame->thisp);
+  if (frame->super)
+    swfdec_gc_object_mark (frame->super);
+  if (frame->super_thisp)
+    swfdec_as_object_mark (frame->super_thisp);
+  if (frame->super_reference)
+    swfdec_as_object_mark (frame->super_reference);
+  g_slist_foreach (frame->scope_chain, (GFunc) swfdec_as_object_mark, NULL);
+  if (frame->target)
+    swfdec_gc_object_mark (frame->target);
+  if (frame->original_target)
+    swfdec_gc_object_mark (frame->original_target);
+  if (frame->activation)
+    swfdec_as_object_mark (frame->activation);
+  for (i = 0; i < frame->n_registers; i++)
+    swfdec_as_value_mark (&frame->registers[i]);
+  for (i = 0; i < frame->n_saved_stack; i++)
+    swfdec_as_value_mark (&frame->saved_stack[i]);
+}
+
 static void
 swfdec_as_context_do_mark (SwfdecAsContext *context)
 {
@@ -415,6 +614,43 @@ swfdec_as_context_do_mark (SwfdecAsContext *context)
   if (context->exception)
     swfdec_as_value_mark (&context->exception_value);
   g_hash_table_foreach (context->constant_pools, swfdec_as_context_mark_constant_pools, NULL);
+  if (context->build_arguments)
+    swfdec_gc_object_mark (context->build_arguments);
+  if (context->build_super)
+    swfdec_gc_object_mark (context->build_super);
+  /* suspended frames aren't on the frame stack anymore */
+  g_slist_foreach (context->suspended, swfdec_as_context_mark_suspended, NULL);
+}
+
+static void
+swfdec_as_context_mark (SwfdecAsContext *context)
+{
+  SwfdecAsContextClass *klass;
+
+  SWFDEC_INFO ("invoking the garbage collector");
+  /* the caches don't keep their strings alive */
+  swfdec_action_clear_target_paths (context);
+  klass = SWFDEC_AS_CONTEXT_GET_CLASS (context);
+  g_assert (klass->mark);
+  klass->mark (context);
+  context->memory_since_gc = 0;
+  context->gc_runs++;
+}
+
+static void
+swfdec_as_context_end_pause (SwfdecAsContext *context, const GTimeVal *start)
+{
+  GTimeVal now;
+  glong pause;
+
+  g_get_current_time (&now);
+  pause = (now.tv_sec - start->tv_sec) * G_USEC_PER_SEC + now.tv_usec - start->tv_usec;
+  /* the clock might have been set back */
+  pause = MAX (pause, 0);
+  context->gc_last_pause = pause;
+  context->gc_max_pause = MAX (context->gc_max_pause, (gulong) pause);
+  context->gc_total_pause += pause;
+  SWFDEC_LOG ("GC paused for %ldus", pause);
 }
 
 /**
@@ -429,7 +665,7 @@ swfdec_as_context_do_mark (SwfdecAsContext *context)
 void
 swfdec_as_context_gc (SwfdecAsContext *context)
 {
-  SwfdecAsContextClass *klass;
+  GTimeVal start;
 
   g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
   g_return_if_fail (context->frame == NULL);
@@ -437,12 +673,11 @@ swfdec_as_context_gc (SwfdecAsContext *context)
 
   if (context->state == SWFDEC_AS_CONTEXT_ABORTED)
     return;
-  SWFDEC_INFO ("invoking the garbage collector");
-  klass = SWFDEC_AS_CONTEXT_GET_CLASS (context);
-  g_assert (klass->mark);
-  klass->mark (context);
+  g_get_current_time (&start);
+  swfdec_as_context_finish_sweep (context);
+  swfdec_as_context_mark (context);
   swfdec_as_context_collect (context);
-  context->memory_since_gc = 0;
+  swfdec_as_context_end_pause (context, &start);
 }
 
 static gboolean
@@ -458,17 +693,110 @@ swfdec_as_context_needs_gc (SwfdecAsContext *context)
  * Calls the garbage collector if necessary. It's a good idea to call this
  * function regularly instead of swfdec_as_context_gc() as it only does collect
  * garage as needed. For example, #SwfdecPlayer calls this function after every
- * frame advancement.
+ * frame advancement. If the #SwfdecAsContext:gc-incremental property is set,
+ * this function also continues freeing garbage found by a previous call. 
+ * Marking is not incremental, it is always done by the call that starts a
+ * collection.
  **/
 void
 swfdec_as_context_maybe_gc (SwfdecAsContext *context)
 {
+  GTimeVal start;
+
   g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
   g_return_if_fail (context->state == SWFDEC_AS_CONTEXT_RUNNING);
   g_return_if_fail (context->frame == NULL);
 
-  if (swfdec_as_context_needs_gc (context))
+  if (!swfdec_as_context_needs_gc (context)) {
+    if (context->gc_sweep) {
+      g_get_current_time (&start);
+      swfdec_as_context_sweep (context, context->gc_sweep_budget);
+      swfdec_as_context_end_pause (context, &start);
+    }
+    return;
+  }
+
+  if (!context->gc_incremental) {
     swfdec_as_context_gc (context);
+    return;
+  }
+  g_get_current_time (&start);
+  swfdec_as_context_finish_sweep (context);
+  swfdec_as_context_mark (context);
+  swfdec_as_context_start_sweep (context);
+  swfdec_as_context_sweep (context, context->gc_sweep_budget);
+  swfdec_as_context_end_pause (context, &start);
+}
+
+/*** PROFILING ***/
+
+/**
+ * swfdec_as_context_start_profile:
+ * @context: a #SwfdecAsContext
+ *
+ * Starts collecting statistics about the scripts executed by @context. For 
+ * every script, the number of calls and the time spent executing it are 
+ * recorded. The number of times each action is executed is counted, too.
+ * Statistics from a previous run of the profiler are discarded. Use 
+ * swfdec_as_context_dump_profile() to get the results.
+ **/
+void
+swfdec_as_context_start_profile (SwfdecAsContext *context)
+{
+  SwfdecAsProfile *profile;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+
+  if (context->profile == NULL)
+    context->profile = swfdec_as_profile_new ();
+  profile = context->profile;
+  if (profile->running)
+    return;
+  swfdec_as_profile_reset (profile);
+  profile->running = TRUE;
+}
+
+/**
+ * swfdec_as_context_stop_profile:
+ * @context: a #SwfdecAsContext
+ *
+ * Stops collecting statistics that were started with 
+ * swfdec_as_context_start_profile(). The statistics collected so far are 
+ * kept until the profiler is started again.
+ **/
+void
+swfdec_as_context_stop_profile (SwfdecAsContext *context)
+{
+  SwfdecAsProfile *profile;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+
+  profile = context->profile;
+  if (profile)
+    profile->running = FALSE;
+}
+
+/**
+ * swfdec_as_context_dump_profile:
+ * @context: a #SwfdecAsContext
+ *
+ * Formats the statistics collected by the profiler in a human-readable way.
+ * Scripts are sorted by exclusive time, that is the time spent in a script
+ * without the time spent in the scripts it called. Actions are sorted by the
+ * number of times they were executed.
+ *
+ * Returns: a new string containing the profile or %NULL if the profiler was
+ *          never started. Free with g_free() after use.
+ **/
+char *
+swfdec_as_context_dump_profile (SwfdecAsContext *context)
+{
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+
+  if (context->profile == NULL)
+    return NULL;
+
+  return swfdec_as_profile_dump (context->profile);
 }
 
 /*** SWFDEC_AS_CONTEXT ***/
@@ -483,7 +811,14 @@ enum {
   PROP_DEBUGGER,
   PROP_RANDOM_SEED,
   PROP_ABORTED,
-  PROP_UNTIL_GC
+  PROP_UNTIL_GC,
+  PROP_THREADED,
+  PROP_GC_INCREMENTAL,
+  PROP_GC_SWEEP_BUDGET,
+  PROP_GC_RUNS,
+  PROP_GC_LAST_PAUSE,
+  PROP_GC_MAX_PAUSE,
+  PROP_GC_TOTAL_PAUSE
 };
 
 G_DEFINE_TYPE (SwfdecAsContext, swfdec_as_context, G_TYPE_OBJECT)
@@ -505,6 +840,27 @@ swfdec_as_context_get_property (GObject *object, guint param_id, GValue *value,
     case PROP_UNTIL_GC:
       g_value_set_ulong (value, (gulong) context->memory_until_gc);
       break;
+    case PROP_THREADED:
+      g_value_set_boolean (value, context->threaded);
+      break;
+    case PROP_GC_INCREMENTAL:
+      g_value_set_boolean (value, context->gc_incremental);
+      break;
+    case PROP_GC_SWEEP_BUDGET:
+      g_value_set_uint (value, context->gc_sweep_budget);
+      break;
+    case PROP_GC_RUNS:
+      g_value_set_uint (value, context->gc_runs);
+      break;
+    case PROP_GC_LAST_PAUSE:
+      g_value_set_ulong (value, context->gc_last_pause);
+      break;
+    case PROP_GC_MAX_PAUSE:
+      g_value_set_ulong (value, context->gc_max_pause);
+      break;
+    case PROP_GC_TOTAL_PAUSE:
+      g_value_set_uint64 (value, context->gc_total_pause);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
       break;
@@ -527,6 +883,15 @@ swfdec_as_context_set_property (GObject *object, guint param_id, const GValue *v
     case PROP_UNTIL_GC:
       context->memory_until_gc = g_value_get_ulong (value);
       break;
+    case PROP_THREADED:
+      context->threaded = g_value_get_boolean (value);
+      break;
+    case PROP_GC_INCREMENTAL:
+      context->gc_incremental = g_value_get_boolean (value);
+      break;
+    case PROP_GC_SWEEP_BUDGET:
+      context->gc_sweep_budget = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
       break;
@@ -538,11 +903,14 @@ swfdec_as_context_dispose (GObject *object)
 {
   SwfdecAsContext *context = SWFDEC_AS_CONTEXT (object);
 
+  swfdec_as_context_drop_suspended (context, NULL);
   while (context->stack)
     swfdec_as_stack_pop_segment (context);
+  swfdec_as_stack_clear_registers (context);
   /* We need to make sure there's no exception here. Otherwise collecting 
    * frames that are inside a try block will assert */
   swfdec_as_context_catch (context, NULL);
+  swfdec_as_context_finish_sweep (context);
   swfdec_as_context_collect (context);
   if (context->memory != 0) {
     g_critical ("%zu bytes of memory left over\n", context->memory);
@@ -550,14 +918,24 @@ swfdec_as_context_dispose (GObject *object)
   g_assert (context->strings == NULL);
   g_assert (context->numbers == NULL);
   g_assert (g_hash_table_size (context->constant_pools) == 0);
+  g_assert (g_hash_table_size (context->string_indexes) == 0);
   g_assert (context->gc_objects == 0);
   g_hash_table_destroy (context->constant_pools);
-  g_hash_table_destroy (context->interned_strings);
+  g_hash_table_destroy (context->string_indexes);
+  swfdec_as_string_table_free (context->interned_strings);
+  g_assert (((SwfdecAsShape *) context->empty_shape)->refcount == 1);
+  swfdec_as_shape_unref (context->empty_shape);
+  swfdec_as_arena_free (context->arena);
+  context->arena = NULL;
   g_rand_free (context->rand);
   if (context->debugger) {
     g_object_unref (context->debugger);
     context->debugger = NULL;
   }
+  if (context->profile) {
+    swfdec_as_profile_free (context->profile);
+    context->profile = NULL;
+  }
 
   G_OBJECT_CLASS (swfdec_as_context_parent_class)->dispose (object);
 }
@@ -585,6 +963,34 @@ swfdec_as_context_class_init (SwfdecAsContextClass *klass)
       g_param_spec_ulong ("memory-until-gc", "memory until gc", 
 	  "amount of bytes that need to be allocated before garbage collection triggers",
 	  0, G_MAXULONG, 8 * 1024 * 1024, G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+  g_object_class_install_property (object_class, PROP_THREADED,
+      g_param_spec_boolean ("threaded", "threaded", 
+	  "execute scripts using pre-decoded instructions instead of decoding every action",
+	  TRUE, G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+  g_object_class_install_property (object_class, PROP_GC_INCREMENTAL,
+      g_param_spec_boolean ("gc-incremental", "gc incremental", 
+	  "free garbage in small steps during swfdec_as_context_maybe_gc() calls, marking is still done in one step",
+	  TRUE, G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+  g_object_class_install_property (object_class, PROP_GC_SWEEP_BUDGET,
+      g_param_spec_uint ("gc-sweep-budget", "gc sweep budget", 
+	  "number of garbage-collected values to check per incremental step",
+	  1, G_MAXUINT, 4096, G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+  g_object_class_install_property (object_class, PROP_GC_RUNS,
+      g_param_spec_uint ("gc-runs", "gc runs", 
+	  "number of times the garbage collector was run",
+	  0, G_MAXUINT, 0, G_PARAM_READABLE));
+  g_object_class_install_property (object_class, PROP_GC_LAST_PAUSE,
+      g_param_spec_ulong ("gc-last-pause", "gc last pause", 
+	  "time in microseconds the last garbage collection step took",
+	  0, G_MAXULONG, 0, G_PARAM_READABLE));
+  g_object_class_install_property (object_class, PROP_GC_MAX_PAUSE,
+      g_param_spec_ulong ("gc-max-pause", "gc max pause", 
+	  "time in microseconds the longest garbage collection step took",
+	  0, G_MAXULONG, 0, G_PARAM_READABLE));
+  g_object_class_install_property (object_class, PROP_GC_TOTAL_PAUSE,
+      g_param_spec_uint64 ("gc-total-pause", "gc total pause", 
+	  "time in microseconds spent collecting garbage",
+	  0, G_MAXUINT64, 0, G_PARAM_READABLE));
 
   /**
    * SwfdecAsContext::trace:
@@ -608,11 +1014,15 @@ swfdec_as_context_init (SwfdecAsContext *context)
 
   context->version = G_MAXUINT;
 
-  context->interned_strings = g_hash_table_new (g_str_hash, g_str_equal);
+  context->interned_strings = swfdec_as_string_table_new ();
   context->constant_pools = g_hash_table_new (g_direct_hash, g_direct_equal);
+  context->string_indexes = g_hash_table_new (g_direct_hash, g_direct_equal);
+  context->empty_shape = swfdec_as_shape_new_empty ();
+  context->arena = swfdec_as_arena_new ();
 
   for (s = swfdec_as_strings; s->next; s++) {
-    g_hash_table_insert (context->interned_strings, (gpointer) s->string, (gpointer) s);
+    swfdec_as_string_table_insert (context->interned_strings, (SwfdecAsStringValue *) s,
+	swfdec_as_string_table_hash (s->string, SWFDEC_AS_STRING_VALUE_LENGTH (s)));
   }
   context->rand = g_rand_new ();
   g_get_current_time (&context->start_time);
@@ -621,14 +1031,18 @@ swfdec_as_context_init (SwfdecAsContext *context)
 /*** STRINGS ***/
 
 static const char *
-swfdec_as_context_create_string (SwfdecAsContext *context, const char *string, gsize len)
+swfdec_as_context_create_string (SwfdecAsContext *context, const char *string, 
+    gsize len, guint hash)
 {
   SwfdecAsStringValue *new;
+  gsize i;
 
   new = swfdec_as_gcable_alloc (context, sizeof (SwfdecAsStringValue) + len + 1);
-  new->length = len;
-  memcpy (new->string, string, new->length + 1);
-  g_hash_table_insert (context->interned_strings, new->string, new);
+  for (i = 0; i < len && !(string[i] & 0x80); i++);
+  new->length = len | (i == len ? SWFDEC_AS_STRING_VALUE_ASCII : 0);
+  memcpy (new->string, string, len);
+  new->string[len] = '\0';
+  swfdec_as_string_table_insert (context->interned_strings, new, hash);
   SWFDEC_AS_GCABLE_SET_NEXT (new, context->strings);
   context->strings = new;
 
@@ -648,19 +1062,42 @@ swfdec_as_context_create_string (SwfdecAsContext *context, const char *string, g
  **/
 const char *
 swfdec_as_context_get_string (SwfdecAsContext *context, const char *string)
+{
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+  g_return_val_if_fail (string != NULL, NULL);
+
+  return swfdec_as_context_get_string_len (context, string, strlen (string));
+}
+
+/**
+ * swfdec_as_context_get_string_len:
+ * @context: a #SwfdecAsContext
+ * @string: a string that is not garbage-collected, it need not be 
+ *          NUL-terminated
+ * @len: number of bytes in @string
+ *
+ * Gets the garbage-collected version of the first @len bytes of @string. This
+ * is the same as swfdec_as_context_get_string(), but doesn't need to look for
+ * the end of @string.
+ *
+ * Returns: the garbage-collected version of @string
+ **/
+const char *
+swfdec_as_context_get_string_len (SwfdecAsContext *context, const char *string,
+    gsize len)
 {
   const SwfdecAsStringValue *ret;
-  gsize len;
+  guint hash;
 
   g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
   g_return_val_if_fail (string != NULL, NULL);
 
-  ret = g_hash_table_lookup (context->interned_strings, string);
+  hash = swfdec_as_string_table_hash (string, len);
+  ret = swfdec_as_string_table_lookup (context->interned_strings, string, len, hash);
   if (ret)
     return ret->string;
 
-  len = strlen (string);
-  return swfdec_as_context_create_string (context, string, len);
+  return swfdec_as_context_create_string (context, string, len, hash);
 }
 
 /**
@@ -687,6 +1124,125 @@ swfdec_as_context_give_string (SwfdecAsContext *context, char *string)
   return ret;
 }
 
+/* Concatenations shorter than this are interned right away, longer ones are
+ * kept as ropes until somebody looks at their contents. */
+#define SWFDEC_AS_ROPE_MIN_LENGTH 128
+
+/**
+ * swfdec_as_context_concat_strings:
+ * @context: a #SwfdecAsContext
+ * @left: a string value
+ * @right: a string value
+ *
+ * Concatenates the two strings. This is the same as swfdec_as_str_concat(),
+ * but long results are not copied. Instead a rope referencing both parts is
+ * created that is flattened when its contents are looked at via 
+ * SWFDEC_AS_VALUE_GET_FLAT_STRING() or swfdec_as_value_to_string(). So 
+ * concatenating in a loop is not quadratic.
+ *
+ * Returns: a string value containing the concatenation of @left and @right
+ **/
+SwfdecAsValue
+swfdec_as_context_concat_strings (SwfdecAsContext *context, SwfdecAsValue left,
+    SwfdecAsValue right)
+{
+  SwfdecAsStringValue *l, *r;
+  SwfdecAsStringRope *rope;
+  gsize llen, rlen;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), SWFDEC_AS_VALUE_FROM_STRING (SWFDEC_AS_STR_EMPTY));
+  g_return_val_if_fail (SWFDEC_AS_VALUE_IS_STRING (left), SWFDEC_AS_VALUE_FROM_STRING (SWFDEC_AS_STR_EMPTY));
+  g_return_val_if_fail (SWFDEC_AS_VALUE_IS_STRING (right), SWFDEC_AS_VALUE_FROM_STRING (SWFDEC_AS_STR_EMPTY));
+
+  l = SWFDEC_AS_VALUE_GET_VALUE (left);
+  r = SWFDEC_AS_VALUE_GET_VALUE (right);
+  llen = SWFDEC_AS_STRING_VALUE_LENGTH (l);
+  rlen = SWFDEC_AS_STRING_VALUE_LENGTH (r);
+  if (llen == 0)
+    return right;
+  if (rlen == 0)
+    return left;
+
+  if (llen + rlen < SWFDEC_AS_ROPE_MIN_LENGTH) {
+    /* ropes are always longer, so both strings are flat */
+    char buf[SWFDEC_AS_ROPE_MIN_LENGTH];
+
+    memcpy (buf, l->string, llen);
+    memcpy (buf + llen, r->string, rlen);
+    return SWFDEC_AS_VALUE_FROM_STRING (swfdec_as_context_get_string_len (context, buf, llen + rlen));
+  }
+
+  rope = swfdec_as_gcable_alloc (context, sizeof (SwfdecAsStringRope));
+  rope->length = (llen + rlen) | SWFDEC_AS_STRING_VALUE_ROPE;
+  rope->context = context;
+  rope->left = l;
+  rope->right = r;
+  rope->flat = NULL;
+  SWFDEC_AS_GCABLE_SET_NEXT (rope, context->strings);
+  context->strings = rope;
+
+  return SWFDEC_AS_VALUE_COMBINE (rope, SWFDEC_AS_TYPE_STRING);
+}
+
+/**
+ * swfdec_as_string_value_flatten:
+ * @value: a string value that is a rope
+ *
+ * Computes the contents of a rope created by concatenating strings. You 
+ * should not need to call this function, SWFDEC_AS_VALUE_GET_FLAT_STRING() 
+ * does it for you.
+ *
+ * Returns: the garbage-collected string for the contents of @value
+ **/
+const char *
+swfdec_as_string_value_flatten (SwfdecAsStringValue *value)
+{
+  SwfdecAsStringRope *rope = (SwfdecAsStringRope *) value;
+  GPtrArray *todo;
+  const char *s;
+  char *buf;
+  gsize len, pos;
+
+  g_return_val_if_fail (SWFDEC_AS_STRING_VALUE_IS_ROPE (value), value->string);
+
+  if (rope->flat)
+    return rope->flat;
+
+  len = pos = SWFDEC_AS_STRING_VALUE_LENGTH (value);
+  buf = g_malloc (len);
+  /* fill the buffer from the back, so left-leaning ropes - the result of 
+   * appending in a loop - only need a tiny stack */
+  todo = g_ptr_array_new ();
+  g_ptr_array_add (todo, rope->left);
+  g_ptr_array_add (todo, rope->right);
+  while (todo->len > 0) {
+    value = g_ptr_array_remove_index_fast (todo, todo->len - 1);
+    if (SWFDEC_AS_STRING_VALUE_IS_ROPE (value)) {
+      SwfdecAsStringRope *part = (SwfdecAsStringRope *) value;
+      if (part->flat == NULL) {
+	g_ptr_array_add (todo, part->left);
+	g_ptr_array_add (todo, part->right);
+	continue;
+      }
+      s = part->flat;
+    } else {
+      s = value->string;
+    }
+    pos -= SWFDEC_AS_STRING_VALUE_LENGTH (value);
+    memcpy (buf + pos, s, SWFDEC_AS_STRING_VALUE_LENGTH (value));
+  }
+  g_ptr_array_free (todo, TRUE);
+  g_assert (pos == 0);
+
+  rope->flat = swfdec_as_context_get_string_len (rope->context, buf, len);
+  g_free (buf);
+  /* let the parts be collected */
+  rope->left = NULL;
+  rope->right = NULL;
+
+  return rope->flat;
+}
+
 /**
  * swfdec_as_context_is_constructing:
  * @context: a #SwfdecAsConstruct
@@ -812,6 +1368,8 @@ swfdec_as_context_return (SwfdecAsContext *context, SwfdecAsValue *return_value)
   g_return_if_fail (context->frame != NULL);
 
   frame = context->frame;
+  /* needs the arguments, so do it before they're popped */
+  swfdec_as_frame_capture (context, frame);
 
   /* save return value in case it was on the stack somewhere */
   if (frame->construct) {
@@ -871,6 +1429,175 @@ swfdec_as_context_return (SwfdecAsContext *context, SwfdecAsValue *return_value)
   swfdec_as_frame_free (context, frame);
 }
 
+/*** SUSPENDING ***/
+
+static gboolean
+swfdec_as_context_check_yield (SwfdecAsContext *context)
+{
+  SwfdecAsContextClass *klass = SWFDEC_AS_CONTEXT_GET_CLASS (context);
+
+  if (klass->check_yield == NULL)
+    return FALSE;
+  return klass->check_yield (context);
+}
+
+/* Suspends the frame if it's resumable and the context wants scripts to 
+ * yield. This is only possible for the bottommost frame, as the frames below
+ * it live on the C stack. Returns TRUE if the frame was suspended. */
+static gboolean
+swfdec_as_context_suspend (SwfdecAsContext *context, SwfdecAsFrame *frame)
+{
+  SwfdecAsValue *registers;
+
+  if (!frame->resumable || frame != context->frame || frame->next != NULL ||
+      context->state != SWFDEC_AS_CONTEXT_RUNNING || context->exception ||
+      (frame->blocks && frame->blocks->len > 0) || context->stack->next != NULL ||
+      frame->stack_begin < &context->stack->elements[0] ||
+      frame->stack_begin > context->cur)
+    return FALSE;
+  if (!swfdec_as_context_check_yield (context))
+    return FALSE;
+
+  SWFDEC_DEBUG ("suspending script %s", frame->script->name);
+  frame->n_saved_stack = context->cur - frame->stack_begin;
+  frame->saved_stack = g_memdup (frame->stack_begin, 
+      frame->n_saved_stack * sizeof (SwfdecAsValue));
+  context->cur = frame->stack_begin;
+  if (frame->n_registers) {
+    registers = g_memdup (frame->registers, 
+	frame->n_registers * sizeof (SwfdecAsValue));
+    swfdec_as_stack_free_registers (context, frame->registers, frame->n_registers);
+    frame->registers = registers;
+  }
+  context->frame = NULL;
+  context->call_depth--;
+  context->base = &context->stack->elements[0];
+  frame->suspended = TRUE;
+  context->suspended = g_slist_append (context->suspended, frame);
+  return TRUE;
+}
+
+static void
+swfdec_as_context_free_suspended (SwfdecAsContext *context, SwfdecAsFrame *frame)
+{
+  context->suspended = g_slist_remove (context->suspended, frame);
+  g_free (frame->saved_stack);
+  g_free (frame->registers);
+  frame->registers = NULL;
+  frame->n_registers = 0;
+  swfdec_as_frame_free (context, frame);
+  g_slice_free (SwfdecAsFrame, frame);
+}
+
+/**
+ * swfdec_as_context_resume:
+ * @context: a #SwfdecAsContext that is not executing any code
+ * @frame: a frame from the list of suspended frames of @context
+ *
+ * Continues executing a frame that was suspended because the context 
+ * requested it via the check_yield vfunc. The frame will either complete
+ * or be suspended again.
+ **/
+void
+swfdec_as_context_resume (SwfdecAsContext *context, SwfdecAsFrame *frame)
+{
+  SwfdecAsValue *registers;
+  guint i;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+  g_return_if_fail (context->frame == NULL);
+  g_return_if_fail (frame != NULL);
+  g_return_if_fail (frame->suspended);
+
+  SWFDEC_DEBUG ("resuming script %s", frame->script->name);
+  context->suspended = g_slist_remove (context->suspended, frame);
+  frame->suspended = FALSE;
+  frame->stack_begin = context->cur;
+  context->base = frame->stack_begin;
+  context->frame = frame;
+  context->call_depth++;
+  if (frame->n_registers) {
+    registers = frame->registers;
+    frame->registers = swfdec_as_stack_alloc_registers (context, frame->n_registers);
+    memcpy (frame->registers, registers, frame->n_registers * sizeof (SwfdecAsValue));
+    g_free (registers);
+  }
+  swfdec_as_stack_ensure_free (context, frame->n_saved_stack);
+  for (i = 0; i < frame->n_saved_stack; i++)
+    *swfdec_as_stack_push (context) = frame->saved_stack[i];
+  g_free (frame->saved_stack);
+  frame->saved_stack = NULL;
+  frame->n_saved_stack = 0;
+
+  swfdec_as_context_run (context);
+  if (!frame->suspended) {
+    swfdec_as_stack_pop (context);
+    g_slice_free (SwfdecAsFrame, frame);
+  }
+}
+
+/**
+ * swfdec_as_context_drop_suspended:
+ * @context: a #SwfdecAsContext
+ * @target: the target of the frames to drop or %NULL for all frames
+ *
+ * Removes suspended frames without running them to completion. This is 
+ * necessary when their target goes away.
+ **/
+void
+swfdec_as_context_drop_suspended (SwfdecAsContext *context, SwfdecMovie *target)
+{
+  SwfdecAsFrame *frame;
+  GSList *walk;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+
+  walk = context->suspended;
+  while (walk) {
+    frame = walk->data;
+    walk = walk->next;
+    if (target == NULL || frame->target == target)
+      swfdec_as_context_free_suspended (context, frame);
+  }
+}
+
+/* dispatching for the threaded interpreter */
+#ifdef __GNUC__
+#define SWFDEC_AS_DISPATCH(op) G_STMT_START { \
+  static const void *dispatch_table[] = { \
+    [SWFDEC_SCRIPT_OP_EXEC] = &&op_exec, \
+    [SWFDEC_SCRIPT_OP_LEAN] = &&op_lean, \
+    [SWFDEC_SCRIPT_OP_SKIP] = &&op_skip, \
+    [SWFDEC_SCRIPT_OP_JUMP] = &&op_jump, \
+    [SWFDEC_SCRIPT_OP_IF] = &&op_if, \
+    [SWFDEC_SCRIPT_OP_EXIT] = &&op_invalid, \
+    [SWFDEC_SCRIPT_OP_INVALID] = &&op_invalid \
+  }; \
+  goto *dispatch_table[op]; \
+} G_STMT_END
+#else
+#define SWFDEC_AS_DISPATCH(op) G_STMT_START { \
+  switch (op) { \
+    case SWFDEC_SCRIPT_OP_EXEC: goto op_exec; \
+    case SWFDEC_SCRIPT_OP_LEAN: goto op_lean; \
+    case SWFDEC_SCRIPT_OP_SKIP: goto op_skip; \
+    case SWFDEC_SCRIPT_OP_JUMP: goto op_jump; \
+    case SWFDEC_SCRIPT_OP_IF: goto op_if; \
+    case SWFDEC_SCRIPT_OP_EXIT: \
+    case SWFDEC_SCRIPT_OP_INVALID: \
+    default: goto op_invalid; \
+  } \
+} G_STMT_END
+#endif
+
+/* continue with the instruction at frame->pc, use the slow path if there is none */
+#define SWFDEC_AS_RELOAD() G_STMT_START { \
+  pc = frame->pc; \
+  insn = swfdec_script_lookup_instruction (script, pc); \
+  if (insn == NULL) \
+    goto interpret; \
+} G_STMT_END
+
 /**
  * swfdec_as_context_run:
  * @context: a #SwfdecAsContext
@@ -889,6 +1616,7 @@ swfdec_as_context_run (SwfdecAsContext *context)
   SwfdecAsFrame *frame;
   SwfdecScript *script;
   const SwfdecActionSpec *spec;
+  const SwfdecScriptInstruction *insn, *next;
   const guint8 *startpc, *pc, *endpc, *nextpc, *exitpc;
 #ifndef G_DISABLE_ASSERT
   SwfdecAsValue *check;
@@ -898,6 +1626,9 @@ swfdec_as_context_run (SwfdecAsContext *context)
   guint original_version;
   void (* step) (SwfdecAsDebugger *debugger, SwfdecAsContext *context);
   gboolean check_block; /* some opcodes avoid a scope check */
+  gboolean lean; /* the script is verified and its stack is reserved */
+  SwfdecAsProfileCall profile_call;
+  gulong *action_counts; /* per-action counters of the profiler or NULL */
 
   g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
   g_return_if_fail (context->frame != NULL);
@@ -907,6 +1638,12 @@ swfdec_as_context_run (SwfdecAsContext *context)
   /* setup data */
   frame = context->frame;
   original_version = context->version;
+  if (context->profile) {
+    swfdec_as_profile_enter (context->profile, frame->script, &profile_call);
+  } else {
+    profile_call.script = NULL;
+  }
+  action_counts = profile_call.script ? ((SwfdecAsProfile *) context->profile)->actions : NULL;
 
   /* sanity checks */
   if (context->state == SWFDEC_AS_CONTEXT_ABORTED)
@@ -933,7 +1670,164 @@ swfdec_as_context_run (SwfdecAsContext *context)
   exitpc = script->exit;
   pc = frame->pc;
   check_block = TRUE;
+  lean = FALSE;
+
+  /* The threaded interpreter executes the pre-decoded instructions of the 
+   * script. It behaves exactly like the loop below, which it falls back to 
+   * whenever the pc leaves the decoded instructions. The debugger always uses
+   * the loop below, as it needs to be able to modify the pc at every step. */
+  if (!context->threaded || step != NULL)
+    goto interpret;
+  SWFDEC_AS_RELOAD ();
+  /* Verified scripts know their maximum stack depth, so if we start at the 
+   * beginning, we can reserve the stack once and skip checking it for every 
+   * instruction marked lean. */
+  if (script->verified && pc == script->main && 
+      context->cur == frame->stack_begin) {
+    swfdec_as_stack_ensure_free (context, script->max_stack);
+    lean = context->cur == frame->stack_begin;
+  }
 
+threaded:
+  if (context->state >= SWFDEC_AS_CONTEXT_ABORTED)
+    goto error;
+  if (context->exception) {
+    swfdec_as_frame_handle_exception (context, frame);
+    if (frame != context->frame)
+      goto out;
+    SWFDEC_AS_RELOAD ();
+    goto threaded;
+  }
+  if (insn->op == SWFDEC_SCRIPT_OP_EXIT) {
+    swfdec_as_context_return (context, NULL);
+    goto out;
+  }
+  if (lean && !script->blocks)
+    check_block = FALSE;
+  while (check_block && (insn->pc < frame->block_start || insn->pc >= frame->block_end)) {
+    SWFDEC_LOG ("code exited block");
+    swfdec_as_frame_pop_block (frame, context);
+    if (frame != context->frame)
+      goto out;
+    SWFDEC_AS_RELOAD ();
+    if (context->exception)
+      break;
+  }
+  if (context->exception)
+    goto threaded;
+  SWFDEC_AS_DISPATCH (insn->op);
+
+op_exec:
+  spec = insn->spec;
+  if (spec->remove > 0) {
+    if (spec->add > spec->remove)
+      swfdec_as_stack_ensure_free (context, spec->add - spec->remove);
+    swfdec_as_stack_ensure_size (context, spec->remove);
+  } else {
+    if (spec->add > 0)
+      swfdec_as_stack_ensure_free (context, spec->add);
+  }
+exec:
+  if (context->state > SWFDEC_AS_CONTEXT_RUNNING) {
+    SWFDEC_WARNING ("context not running anymore, aborting");
+    goto error;
+  }
+  if (action_counts)
+    action_counts[insn->action]++;
+#ifndef G_DISABLE_ASSERT
+  check = (spec->add >= 0 && spec->remove >= 0) ? context->cur + spec->add - spec->remove : NULL;
+#endif
+  pc = insn->pc;
+  frame->insn = (SwfdecScriptInstruction *) insn;
+  spec->exec (context, insn->action, insn->data, insn->len);
+  if (frame->pc == pc) {
+    next = insn + 1;
+    frame->pc = next->pc;
+    check_block = TRUE;
+  } else {
+    if (frame->pc < pc) {
+      if (!swfdec_as_context_check_continue (context))
+	goto error;
+      if (swfdec_as_context_suspend (context, frame))
+	goto out;
+    }
+    next = frame->pc == insn->target_pc ? insn->target : NULL;
+    check_block = FALSE;
+  }
+  if (frame != context->frame)
+    goto out;
+#ifndef G_DISABLE_ASSERT
+  if (check != NULL && check != context->cur) {
+    g_error ("action %s was supposed to change the stack by %d (+%d -%d), but it changed by %td",
+	spec->name, spec->add - spec->remove, spec->add, spec->remove,
+	context->cur - check + spec->add - spec->remove);
+  }
+#endif
+  if (next == NULL)
+    SWFDEC_AS_RELOAD ();
+  else
+    insn = next;
+  goto threaded;
+
+op_lean:
+  if (!lean)
+    goto op_exec;
+  spec = insn->spec;
+  goto exec;
+
+op_skip:
+  SWFDEC_WARNING ("cannot interpret action %3u 0x%02X %s for version %u, skipping it", insn->action,
+      insn->action, insn->spec->name ? insn->spec->name : "Unknown", script->version);
+  insn++;
+  frame->pc = insn->pc;
+  check_block = TRUE;
+  goto threaded;
+
+op_if:
+  swfdec_as_stack_ensure_size (context, 1);
+  if (context->state > SWFDEC_AS_CONTEXT_RUNNING) {
+    SWFDEC_WARNING ("context not running anymore, aborting");
+    goto error;
+  }
+  if (action_counts)
+    action_counts[SWFDEC_AS_ACTION_IF]++;
+  if (!swfdec_as_value_to_boolean (context, *swfdec_as_stack_peek (context, 1))) {
+    swfdec_as_stack_pop (context);
+    insn++;
+    frame->pc = insn->pc;
+    check_block = TRUE;
+    goto threaded;
+  }
+  swfdec_as_stack_pop (context);
+  goto jump;
+
+op_jump:
+  if (context->state > SWFDEC_AS_CONTEXT_RUNNING) {
+    SWFDEC_WARNING ("context not running anymore, aborting");
+    goto error;
+  }
+  if (action_counts)
+    action_counts[SWFDEC_AS_ACTION_JUMP]++;
+jump:
+  frame->pc = insn->target_pc;
+  if (insn->target_pc < insn->pc) {
+    if (!swfdec_as_context_check_continue (context))
+      goto error;
+    if (swfdec_as_context_suspend (context, frame))
+      goto out;
+  }
+  check_block = FALSE;
+  if (insn->target == NULL)
+    SWFDEC_AS_RELOAD ();
+  else
+    insn = insn->target;
+  goto threaded;
+
+op_invalid:
+  pc = insn->pc;
+  /* fall through */
+interpret:
+  frame->insn = NULL;
   while (context->state < SWFDEC_AS_CONTEXT_ABORTED) {
     if (context->exception) {
       swfdec_as_frame_handle_exception (context, frame);
@@ -1020,6 +1914,8 @@ swfdec_as_context_run (SwfdecAsContext *context)
     check = (spec->add >= 0 && spec->remove >= 0) ? context->cur + spec->add - spec->remove : NULL;
 #endif
     /* execute action */
+    if (action_counts)
+      action_counts[action]++;
     spec->exec (context, action, data, len);
     /* adapt the pc if the action did not, otherwise, leave it alone */
     /* FIXME: do this via flag? */
@@ -1027,9 +1923,11 @@ swfdec_as_context_run (SwfdecAsContext *context)
       frame->pc = pc = nextpc;
       check_block = TRUE;
     } else {
-      if (frame->pc < pc &&
-	  !swfdec_as_context_check_continue (context)) {
-	goto error;
+      if (frame->pc < pc) {
+	if (!swfdec_as_context_check_continue (context))
+	  goto error;
+	if (swfdec_as_context_suspend (context, frame))
+	  goto out;
       }
       pc = frame->pc;
       check_block = FALSE;
@@ -1052,6 +1950,8 @@ error:
   if (context->frame == frame)
     swfdec_as_context_return (context, NULL);
 out:
+  if (profile_call.script)
+    swfdec_as_profile_leave (context->profile, &profile_call);
   context->version = original_version;
   return;
 }
@@ -1104,7 +2004,7 @@ swfdec_as_context_ASSetPropFlags (SwfdecAsContext *cx, SwfdecAsObject *object,
   }
 
   if (SWFDEC_AS_VALUE_IS_NULL (argv[1])) {
-    swfdec_as_object_foreach (obj, swfdec_as_context_ASSetPropFlags_foreach, flags);
+    swfdec_as_object_foreach_flags (obj, swfdec_as_context_ASSetPropFlags_foreach, flags);
   } else {
     char **split =
       g_strsplit (swfdec_as_value_to_string (cx, argv[1]), ",", -1);
@@ -1117,7 +2017,7 @@ swfdec_as_context_ASSetPropFlags (SwfdecAsContext *cx, SwfdecAsObject *object,
   }
 }
 
-SWFDEC_AS_NATIVE (200, 19, swfdec_as_context_isFinite)
+SWFDEC_AS_FAST_NATIVE (200, 19, swfdec_as_context_isFinite)
 void
 swfdec_as_context_isFinite (SwfdecAsContext *cx, SwfdecAsObject *object, 
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *retval)
@@ -1131,7 +2031,7 @@ swfdec_as_context_isFinite (SwfdecAsContext *cx, SwfdecAsObject *object,
   SWFDEC_AS_VALUE_SET_BOOLEAN (retval, isfinite (d) ? TRUE : FALSE);
 }
 
-SWFDEC_AS_NATIVE (200, 18, swfdec_as_context_isNaN)
+SWFDEC_AS_FAST_NATIVE (200, 18, swfdec_as_context_isNaN)
 void
 swfdec_as_context_isNaN (SwfdecAsContext *cx, SwfdecAsObject *object, 
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *retval)
@@ -52,17 +52,33 @@ struct _SwfdecAsContext {
 
   /* GC properties */
   gsize			memory_until_gc;/* amount of memory allocations that trigger a GC */
+  gboolean		gc_incremental;	/* sweep garbage in small steps instead of all at once */
+  guint			gc_sweep_budget;/* number of gcables to check per incremental step */
 
   /* bookkeeping for GC */
   gsize			memory;		/* total memory currently in use */
   gsize			memory_since_gc;/* memory allocated since last GC run */
-  GHashTable *		interned_strings;/* string => memory mapping the context manages */
+  gpointer		interned_strings;/* SwfdecAsStringTable of all interned strings */
   gpointer		gc_objects;	/* all SwfdecGcObjects the context manages */
   gpointer		objects;	/* all objects the context manages */
   gpointer		strings;	/* all strings the context manages */
   gpointer		numbers;	/* all numbers the context manages */
   gpointer		movies;		/* all movies the context manages */
   GHashTable *		constant_pools;	/* memory address => SwfdecConstantPool for all gc'ed pools */
+  GHashTable *		target_paths;	/* GC'd string => parsed target path or NULL */
+  GHashTable *		slash_paths;	/* GC'd string => parsed slash path or NULL */
+  GHashTable *		string_indexes;	/* SwfdecAsStringValue => character index of non-ASCII strings */
+  gpointer		empty_shape;	/* SwfdecAsShape all new objects start with */
+  guint			prototype_epoch;/* changed whenever an object used as prototype changes */
+  guint			movie_epoch;	/* changed whenever the display list or the name of a movie changes */
+  gpointer		gc_sweep;	/* state of the incremental sweep in progress or NULL */
+  gpointer		arena;		/* SwfdecAsArena used for allocating small gcables and variables */
+
+  /* GC statistics */
+  guint			gc_runs;	/* number of garbage collections started */
+  gulong		gc_last_pause;	/* duration of the last GC pause in microseconds */
+  gulong		gc_max_pause;	/* longest GC pause in microseconds */
+  guint64		gc_total_pause;	/* sum of all GC pauses in microseconds */
 
   /* execution state */
   unsigned int	      	version;	/* currently active version */
@@ -70,15 +86,21 @@ struct _SwfdecAsContext {
   SwfdecAsFrame *	frame;		/* topmost stack frame */
   gboolean		exception;	/* whether we are throwing an exception */
   SwfdecAsValue		exception_value; /* value of the exception being thrown, can be anything including undefined */
+  gboolean		threaded;	/* use pre-decoded instructions for running scripts */
+  GSList *		suspended;	/* frames that ran out of time and wait to be resumed */
 
   /* stack */
   SwfdecAsValue	*	base;		/* stack base */
   SwfdecAsValue	*	end;		/* end of stack */
   SwfdecAsValue	*	cur;		/* pointer to current top of stack */
   SwfdecAsStack *	stack;		/* current stack */
+  gpointer		registers;	/* chunk the registers of frames are allocated from */
+  gpointer		build_arguments;/* SwfdecAsFunction building arguments objects or NULL */
+  gpointer		build_super;	/* SwfdecAsFunction building super objects or NULL */
 
   /* debugging */
   SwfdecAsDebugger *	debugger;	/* debugger (or NULL if none) */
+  gpointer		profile;	/* SwfdecAsProfile collecting statistics or NULL if never started */
 };
 
 struct _SwfdecAsContextClass {
@@ -91,6 +113,8 @@ struct _SwfdecAsContextClass {
 						 GTimeVal *		tv);
   /* overwrite if you want to abort on infinite loops */
   gboolean		(* check_continue)	(SwfdecAsContext *	context);
+  /* overwrite if you want resumable scripts to pause and continue later */
+  gboolean		(* check_yield)		(SwfdecAsContext *	context);
 };
 
 GType		swfdec_as_context_get_type	(void);
@@ -127,6 +151,10 @@ void		swfdec_as_string_mark		(const char *		string);
 void		swfdec_as_context_gc		(SwfdecAsContext *	context);
 void		swfdec_as_context_maybe_gc	(SwfdecAsContext *	context);
 
+void		swfdec_as_context_start_profile	(SwfdecAsContext *	context);
+void		swfdec_as_context_stop_profile	(SwfdecAsContext *	context);
+char *		swfdec_as_context_dump_profile	(SwfdecAsContext *	context);
+
 
 G_END_DECLS
 #endif
@@ -234,6 +234,9 @@ swfdec_as_frame_push_block (SwfdecAsFrame *frame, const guint8 *start,
 
   frame->block_start = start;
   frame->block_end = end;
+  /* most frames never push a block, so only create the array when needed */
+  if (frame->blocks == NULL)
+    frame->blocks = g_array_new (FALSE, FALSE, sizeof (SwfdecAsFrameBlock));
   g_array_append_val (frame->blocks, block);
 }
 
@@ -245,7 +248,7 @@ swfdec_as_frame_pop_block (SwfdecAsFrame *frame, SwfdecAsContext *cx)
   SwfdecAsFrameBlock *block;
 
   g_return_if_fail (frame != NULL);
-  g_return_if_fail (frame->blocks->len > 0);
+  g_return_if_fail (frame->blocks != NULL && frame->blocks->len > 0);
 
   block = &g_array_index (frame->blocks, SwfdecAsFrameBlock, frame->blocks->len - 1);
   func = block->func;
@@ -269,16 +272,17 @@ void
 swfdec_as_frame_free (SwfdecAsContext *context, SwfdecAsFrame *frame)
 {
   /* pop blocks while state is intact */
-  while (frame->blocks->len > 0)
+  while (frame->blocks && frame->blocks->len > 0)
     swfdec_as_frame_pop_block (frame, context);
 
   /* clean up */
-  g_slice_free1 (sizeof (SwfdecAsValue) * frame->n_registers, frame->registers);
+  swfdec_as_stack_free_registers (context, frame->registers, frame->n_registers);
   if (frame->constant_pool) {
     swfdec_constant_pool_unref (frame->constant_pool);
     frame->constant_pool = NULL;
   }
-  g_array_free (frame->blocks, TRUE);
+  if (frame->blocks)
+    g_array_free (frame->blocks, TRUE);
   g_slist_free (frame->scope_chain);
   if (frame->script) {
     swfdec_script_unref (frame->script);
@@ -298,7 +302,7 @@ swfdec_as_frame_init (SwfdecAsFrame *frame, SwfdecAsContext *context, SwfdecScri
   SWFDEC_DEBUG ("new frame for function %s", script->name);
   frame->pc = script->main;
   frame->n_registers = script->n_registers;
-  frame->registers = g_slice_alloc0 (sizeof (SwfdecAsValue) * frame->n_registers);
+  frame->registers = swfdec_as_stack_alloc_registers (context, frame->n_registers);
   if (script->constant_pool) {
     frame->constant_pool = swfdec_constant_pool_new (context, 
 	script->constant_pool, script->version);
@@ -314,7 +318,6 @@ swfdec_as_frame_init_native (SwfdecAsFrame *frame, SwfdecAsContext *context)
   g_return_if_fail (frame != NULL);
   g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
   
-  frame->blocks = g_array_new (FALSE, FALSE, sizeof (SwfdecAsFrameBlock));
   frame->block_end = (gpointer) -1;
   frame->stack_begin = context->cur;
   context->base = frame->stack_begin;
@@ -348,6 +351,50 @@ swfdec_as_frame_set_this (SwfdecAsFrame *frame, SwfdecAsObject *thisp)
   SWFDEC_AS_VALUE_SET_COMPOSITE (&frame->thisp, thisp);
 }
 
+/**
+ * swfdec_as_frame_get_property_cache:
+ * @frame: a #SwfdecAsFrame
+ *
+ * Gets the property cache of the action @frame currently executes. The cache
+ * is created on first use.
+ *
+ * Returns: the property cache or %NULL if the action isn't executed by the 
+ *          threaded interpreter
+ **/
+SwfdecAsPropertyCache *
+swfdec_as_frame_get_property_cache (SwfdecAsFrame *frame)
+{
+  SwfdecScriptInstruction *insn;
+
+  g_return_val_if_fail (frame != NULL, NULL);
+
+  insn = frame->insn;
+  if (insn == NULL || insn->pc != frame->pc)
+    return NULL;
+  if (insn->cache == NULL)
+    insn->cache = swfdec_as_property_cache_new ();
+  return insn->cache;
+}
+
+/* looks up variable on one object of the scope chain, remembering the result
+ * in the cache of the current action */
+static gboolean
+swfdec_as_frame_get_scope_variable (SwfdecAsPropertyCache *cache, 
+    SwfdecAsObject *object, const char *variable, SwfdecAsValue *value)
+{
+  if (swfdec_as_property_cache_get (cache, object, variable, value))
+    return TRUE;
+  if (swfdec_as_property_cache_lacks (cache, object, variable))
+    return FALSE;
+  if (swfdec_as_object_get_variable (object, variable, value)) {
+    swfdec_as_property_cache_add (cache, object, variable);
+    return TRUE;
+  } else {
+    swfdec_as_property_cache_add_missing (cache, object, variable);
+    return FALSE;
+  }
+}
+
 /**
  * swfdec_as_frame_get_variable_and_flags:
  * @frame: a #SwfdecAsFrame
@@ -375,6 +422,30 @@ swfdec_as_frame_get_variable_and_flags (SwfdecAsContext *cx, SwfdecAsFrame *fram
   g_return_val_if_fail (frame != NULL, NULL);
   g_return_val_if_fail (variable != NULL, NULL);
 
+  /* Actions resolving the same names over and over again remember for every
+   * object in the scope chain if it contains the variable. So the walk can 
+   * skip to the object that resolved the variable last time. */
+  if (value != NULL && flags == NULL && pobject == NULL) {
+    SwfdecAsPropertyCache *cache = swfdec_as_frame_get_property_cache (frame);
+    if (cache != NULL) {
+      for (walk = frame->scope_chain; walk; walk = walk->next) {
+	if (swfdec_as_frame_get_scope_variable (cache, walk->data, variable, value))
+	  return walk->data;
+      }
+      target = swfdec_as_frame_get_target (frame);
+      if (target) {
+	SwfdecAsObject *object = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (target));
+	if (swfdec_as_frame_get_scope_variable (cache, object, variable, value))
+	  return object;
+      }
+      if (cx->version > 4 && swfdec_as_frame_get_scope_variable (cache, 
+	    cx->global, variable, value))
+	return cx->global;
+      SWFDEC_AS_VALUE_SET_UNDEFINED (value);
+      return NULL;
+    }
+  }
+
   for (walk = frame->scope_chain; walk; walk = walk->next) {
     if (swfdec_as_object_get_variable_and_flags (walk->data, variable, value, 
 	  flags, pobject))
@@ -490,6 +561,291 @@ swfdec_as_frame_set_target (SwfdecAsFrame *frame, SwfdecMovie *target)
   }
 }
 
+/*** ARGUMENTS AND SUPER ***/
+
+/* Most functions never look at their arguments or super object, so these are
+ * only created when used. The activation object gets lazy variables for them,
+ * that are built by functions shared by all frames. As long as the frame is 
+ * running, they are built from the frame itself. If the activation object 
+ * escapes - because a function was defined in its scope or it was passed as 
+ * this object - it can outlive its frame. In that case everything needed for 
+ * building them is copied into a record when the frame returns. The record is
+ * an object scripts never see, its elements are laid out as below. */
+
+enum {
+  SWFDEC_AS_FRAME_RECORD_CALLEE,
+  SWFDEC_AS_FRAME_RECORD_CALLER,
+  SWFDEC_AS_FRAME_RECORD_SUPER_THIS,
+  SWFDEC_AS_FRAME_RECORD_SUPER_REFERENCE,
+  SWFDEC_AS_FRAME_RECORD_N_ARGUMENTS,
+  SWFDEC_AS_FRAME_RECORD_ARGUMENTS
+};
+
+static void
+swfdec_as_frame_get_caller (SwfdecAsFrame *frame, SwfdecAsValue *val)
+{
+  SwfdecAsFrame *next;
+
+  next = frame->next;
+  while (next != NULL && (next->function == NULL ||
+      SWFDEC_IS_AS_NATIVE_FUNCTION (next->function))) {
+    next = next->next;
+  }
+  if (next != NULL) {
+    SWFDEC_AS_VALUE_SET_OBJECT (val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (next->function)));
+  } else {
+    SWFDEC_AS_VALUE_SET_NULL (val);
+  }
+}
+
+static void
+swfdec_as_frame_get_callee (SwfdecAsFrame *frame, SwfdecAsValue *val)
+{
+  if (frame->function != NULL) {
+    SWFDEC_AS_VALUE_SET_OBJECT (val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (frame->function)));
+  } else {
+    SWFDEC_AS_VALUE_SET_NULL (val);
+  }
+}
+
+static SwfdecAsObject *
+swfdec_as_frame_arguments_new (SwfdecAsContext *context, const SwfdecAsValue *caller,
+    const SwfdecAsValue *callee)
+{
+  SwfdecAsObject *args;
+
+  args = swfdec_as_array_new (context);
+  swfdec_as_object_set_variable_and_flags (args, SWFDEC_AS_STR_caller, caller,
+      SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+  swfdec_as_object_set_variable_and_flags (args, SWFDEC_AS_STR_callee, callee,
+      SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+  return args;
+}
+
+static SwfdecAsObject *
+swfdec_as_frame_create_arguments (SwfdecAsContext *context, SwfdecAsFrame *frame)
+{
+  SwfdecAsObject *args;
+  SwfdecAsValue caller, callee;
+  const SwfdecAsValue *cur;
+  SwfdecAsStackIterator iter;
+
+  swfdec_as_frame_get_caller (frame, &caller);
+  swfdec_as_frame_get_callee (frame, &callee);
+  args = swfdec_as_frame_arguments_new (context, &caller, &callee);
+  for (cur = swfdec_as_stack_iterator_init_arguments (&iter, context, frame); cur != NULL;
+      cur = swfdec_as_stack_iterator_next (&iter)) {
+    swfdec_as_array_push (args, cur);
+  }
+
+  return args;
+}
+
+static void
+swfdec_as_frame_get_super (SwfdecAsFrame *frame, SwfdecAsValue *val)
+{
+  if (frame->super_thisp) {
+    if (frame->super == NULL) {
+      frame->super = swfdec_as_super_new (frame->super_thisp->context,
+	  frame->super_thisp, frame->super_reference);
+    }
+    frame->super_thisp = NULL;
+    frame->super_reference = NULL;
+  }
+  if (frame->super) {
+    SWFDEC_AS_VALUE_SET_OBJECT (val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (frame->super)));
+  } else {
+    SWFDEC_AS_VALUE_SET_UNDEFINED (val);
+  }
+}
+
+static SwfdecAsObject *
+swfdec_as_frame_create_record (SwfdecAsContext *context, SwfdecAsFrame *frame,
+    gboolean arguments, gboolean super)
+{
+  SwfdecAsObject *record;
+  SwfdecAsValue val;
+  const SwfdecAsValue *cur;
+  SwfdecAsStackIterator iter;
+  gint32 i;
+
+  record = swfdec_as_object_new_empty (context);
+  swfdec_as_object_use_elements (record);
+  if (arguments) {
+    swfdec_as_frame_get_callee (frame, &val);
+    swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_CALLEE, &val);
+    swfdec_as_frame_get_caller (frame, &val);
+    swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_CALLER, &val);
+  }
+  if (super) {
+    SWFDEC_AS_VALUE_SET_OBJECT (&val, frame->super_thisp);
+    swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_SUPER_THIS, &val);
+    SWFDEC_AS_VALUE_SET_OBJECT (&val, frame->super_reference);
+    swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_SUPER_REFERENCE, &val);
+    frame->super_thisp = NULL;
+    frame->super_reference = NULL;
+  }
+  i = 0;
+  if (arguments) {
+    for (cur = swfdec_as_stack_iterator_init_arguments (&iter, context, frame); cur != NULL;
+	cur = swfdec_as_stack_iterator_next (&iter)) {
+      val = *cur;
+      swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_ARGUMENTS + i, &val);
+      i++;
+    }
+  }
+  val = swfdec_as_value_from_integer (context, i);
+  swfdec_as_array_set_value (record, SWFDEC_AS_FRAME_RECORD_N_ARGUMENTS, &val);
+
+  return record;
+}
+
+/* finds the running or suspended frame using activation */
+static SwfdecAsFrame *
+swfdec_as_frame_find (SwfdecAsContext *cx, SwfdecAsObject *activation)
+{
+  SwfdecAsFrame *frame;
+  GSList *walk;
+
+  for (frame = cx->frame; frame; frame = frame->next) {
+    if (frame->activation == activation)
+      return frame;
+  }
+  for (walk = cx->suspended; walk; walk = walk->next) {
+    for (frame = walk->data; frame; frame = frame->next) {
+      if (frame->activation == activation)
+	return frame;
+    }
+  }
+  return NULL;
+}
+
+static SwfdecAsObject *
+swfdec_as_frame_get_record (guint argc, SwfdecAsValue *argv)
+{
+  if (argc == 0 || !SWFDEC_AS_VALUE_IS_OBJECT (argv[0]))
+    return NULL;
+  return SWFDEC_AS_VALUE_GET_OBJECT (argv[0]);
+}
+
+static void
+swfdec_as_frame_build_arguments (SwfdecAsContext *cx, SwfdecAsObject *object,
+    guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
+{
+  SwfdecAsObject *record, *args;
+  SwfdecAsValue caller, callee, val;
+  SwfdecAsFrame *frame;
+  gint32 i, n;
+
+  record = swfdec_as_frame_get_record (argc, argv);
+  if (record == NULL) {
+    frame = swfdec_as_frame_find (cx, object);
+    if (frame == NULL) {
+      SWFDEC_ERROR ("no frame to build arguments from");
+      return;
+    }
+    SWFDEC_AS_VALUE_SET_OBJECT (ret, swfdec_as_frame_create_arguments (cx, frame));
+    return;
+  }
+
+  swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_CALLER, &caller);
+  swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_CALLEE, &callee);
+  args = swfdec_as_frame_arguments_new (cx, &caller, &callee);
+  swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_N_ARGUMENTS, &val);
+  n = swfdec_as_value_to_integer (cx, val);
+  for (i = 0; i < n; i++) {
+    swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_ARGUMENTS + i, &val);
+    swfdec_as_array_push (args, &val);
+  }
+  SWFDEC_AS_VALUE_SET_OBJECT (ret, args);
+}
+
+static void
+swfdec_as_frame_build_super (SwfdecAsContext *cx, SwfdecAsObject *object,
+    guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
+{
+  SwfdecAsObject *record;
+  SwfdecAsValue thisp, ref;
+  SwfdecAsSuper *super;
+  SwfdecAsFrame *frame;
+
+  record = swfdec_as_frame_get_record (argc, argv);
+  if (record == NULL) {
+    frame = swfdec_as_frame_find (cx, object);
+    if (frame == NULL) {
+      SWFDEC_ERROR ("no frame to build super from");
+      return;
+    }
+    swfdec_as_frame_get_super (frame, ret);
+    return;
+  }
+
+  swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_SUPER_THIS, &thisp);
+  swfdec_as_array_get_value (record, SWFDEC_AS_FRAME_RECORD_SUPER_REFERENCE, &ref);
+  if (!SWFDEC_AS_VALUE_IS_OBJECT (thisp))
+    return;
+  super = swfdec_as_super_new (cx, SWFDEC_AS_VALUE_GET_OBJECT (thisp), 
+      SWFDEC_AS_VALUE_IS_OBJECT (ref) ? SWFDEC_AS_VALUE_GET_OBJECT (ref) : NULL);
+  if (super)
+    SWFDEC_AS_VALUE_SET_OBJECT (ret, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (super)));
+}
+
+/**
+ * swfdec_as_frame_escape:
+ * @frame: a #SwfdecAsFrame
+ *
+ * Marks the activation object of @frame as reachable from outside the frame,
+ * so swfdec_as_frame_capture() keeps what is needed to build its arguments and
+ * super object after @frame returned.
+ **/
+void
+swfdec_as_frame_escape (SwfdecAsFrame *frame)
+{
+  g_return_if_fail (frame != NULL);
+
+  if (frame->activation)
+    frame->escaped = TRUE;
+}
+
+/**
+ * swfdec_as_frame_capture:
+ * @context: the context @frame runs in
+ * @frame: a frame that is about to return
+ *
+ * Makes sure the arguments and super object of @frame can still be built from
+ * its activation object once @frame is gone. This only does work if the 
+ * activation object escaped the frame, see swfdec_as_frame_escape().
+ **/
+void
+swfdec_as_frame_capture (SwfdecAsContext *context, SwfdecAsFrame *frame)
+{
+  SwfdecAsValue record;
+  gboolean arguments, super;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+  g_return_if_fail (frame != NULL);
+
+  if (!frame->escaped || context->state == SWFDEC_AS_CONTEXT_ABORTED)
+    return;
+  frame->escaped = FALSE;
+  arguments = context->build_arguments != NULL && frame->script != NULL &&
+      !(frame->script->flags & (SWFDEC_SCRIPT_SUPPRESS_ARGS | SWFDEC_SCRIPT_PRELOAD_ARGS));
+  super = context->build_super != NULL && frame->super_thisp != NULL;
+  if (!arguments && !super)
+    return;
+
+  SWFDEC_AS_VALUE_SET_OBJECT (&record, 
+      swfdec_as_frame_create_record (context, frame, arguments, super));
+  if (arguments) {
+    swfdec_as_object_set_lazy_data (frame->activation, SWFDEC_AS_STR_arguments,
+	context->build_arguments, &record);
+  }
+  if (super) {
+    swfdec_as_object_set_lazy_data (frame->activation, SWFDEC_AS_STR_super,
+	context->build_super, &record);
+  }
+}
+
 void
 swfdec_as_frame_preload (SwfdecAsContext *context, SwfdecAsFrame *frame)
 {
@@ -497,6 +853,7 @@ swfdec_as_frame_preload (SwfdecAsContext *context, SwfdecAsFrame *frame)
   guint i, current_reg = 1;
   SwfdecScript *script;
   SwfdecAsValue val;
+  gboolean lazy_super;
   const SwfdecAsValue *cur;
   SwfdecAsStackIterator iter;
 
@@ -511,37 +868,10 @@ swfdec_as_frame_preload (SwfdecAsContext *context, SwfdecAsFrame *frame)
   object = frame->activation;
   frame->scope_chain = g_slist_prepend (frame->scope_chain, object);
 
-  /* create arguments and super object if necessary */
-  if ((script->flags & (SWFDEC_SCRIPT_PRELOAD_ARGS | SWFDEC_SCRIPT_SUPPRESS_ARGS)) != SWFDEC_SCRIPT_SUPPRESS_ARGS) {
-    SwfdecAsFrame *next;
-    args = swfdec_as_array_new (context);
-    for (cur = swfdec_as_stack_iterator_init_arguments (&iter, context, frame); cur != NULL;
-	cur = swfdec_as_stack_iterator_next (&iter)) {
-      swfdec_as_array_push (args, cur);
-    }
-
-    next = frame->next;
-    while (next != NULL && (next->function == NULL ||
-	SWFDEC_IS_AS_NATIVE_FUNCTION (next->function))) {
-      next = next->next;
-    }
-    if (next != NULL) {
-      SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (next->function)));
-    } else {
-      SWFDEC_AS_VALUE_SET_NULL (&val);
-    }
-    swfdec_as_object_set_variable_and_flags (args, SWFDEC_AS_STR_caller, &val,
-	SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
-
-    if (frame->function != NULL) {
-      SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (frame->function)));
-    } else {
-      SWFDEC_AS_VALUE_SET_NULL (&val);
-    }
-    swfdec_as_object_set_variable_and_flags (args, SWFDEC_AS_STR_callee, &val,
-	SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+  /* the arguments object must be the same in the register and the variable */
+  if (script->flags & SWFDEC_SCRIPT_PRELOAD_ARGS) {
+    args = swfdec_as_frame_create_arguments (context, frame);
   } else {
-    /* silence gcc */
     args = NULL;
   }
 
@@ -549,17 +879,33 @@ swfdec_as_frame_preload (SwfdecAsContext *context, SwfdecAsFrame *frame)
   if (!(script->flags & SWFDEC_SCRIPT_SUPPRESS_THIS)) {
     swfdec_as_object_set_variable (object, SWFDEC_AS_STR_this, &frame->thisp);
   }
+  lazy_super = !(script->flags & (SWFDEC_SCRIPT_SUPPRESS_SUPER | SWFDEC_SCRIPT_PRELOAD_SUPER)) &&
+      frame->super_thisp != NULL && context->version > 5;
   if (!(script->flags & SWFDEC_SCRIPT_SUPPRESS_ARGS)) {
-    SWFDEC_AS_VALUE_SET_OBJECT (&val, args);
-    swfdec_as_object_set_variable (object, SWFDEC_AS_STR_arguments, &val);
+    if (args) {
+      SWFDEC_AS_VALUE_SET_OBJECT (&val, args);
+      swfdec_as_object_set_variable (object, SWFDEC_AS_STR_arguments, &val);
+    } else {
+      if (context->build_arguments == NULL) {
+	context->build_arguments = swfdec_as_native_function_new_bare (context,
+	    SWFDEC_AS_STR_arguments, swfdec_as_frame_build_arguments);
+      }
+      swfdec_as_object_add_lazy_variable_function (object, SWFDEC_AS_STR_arguments,
+	  context->build_arguments, NULL, 0);
+    }
   }
   if (!(script->flags & SWFDEC_SCRIPT_SUPPRESS_SUPER)) {
-    if (frame->super) {
-      SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (frame->super)));
+    if (!lazy_super) {
+      swfdec_as_frame_get_super (frame, &val);
+      swfdec_as_object_set_variable (object, SWFDEC_AS_STR_super, &val);
     } else {
-      SWFDEC_AS_VALUE_SET_UNDEFINED (&val);
+      if (context->build_super == NULL) {
+	context->build_super = swfdec_as_native_function_new_bare (context,
+	    SWFDEC_AS_STR_super, swfdec_as_frame_build_super);
+      }
+      swfdec_as_object_add_lazy_variable_function (object, SWFDEC_AS_STR_super,
+	  context->build_super, NULL, 0);
     }
-    swfdec_as_object_set_variable (object, SWFDEC_AS_STR_super, &val);
   }
 
   /* set and preload argument variables */
@@ -593,12 +939,7 @@ swfdec_as_frame_preload (SwfdecAsContext *context, SwfdecAsFrame *frame)
     SWFDEC_AS_VALUE_SET_OBJECT (&frame->registers[current_reg++], args);
   }
   if (script->flags & SWFDEC_SCRIPT_PRELOAD_SUPER && current_reg < script->n_registers) {
-    if (frame->super) {
-      SWFDEC_AS_VALUE_SET_OBJECT (&frame->registers[current_reg++], 
-	  swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (frame->super)));
-    } else {
-      SWFDEC_AS_VALUE_SET_UNDEFINED (&frame->registers[current_reg++]);
-    }
+    swfdec_as_frame_get_super (frame, &frame->registers[current_reg++]);
   }
   if (script->flags & SWFDEC_SCRIPT_PRELOAD_ROOT && current_reg < script->n_registers) {
     if (!swfdec_as_frame_get_variable (context, frame, SWFDEC_AS_STR__root, &frame->registers[current_reg])) {
@@ -639,7 +980,7 @@ swfdec_as_frame_handle_exception (SwfdecAsContext *cx, SwfdecAsFrame *frame)
   g_return_if_fail (cx->exception);
 
   /* pop blocks in the hope that we are inside a Try block */
-  while (cx->exception && frame->blocks->len) {
+  while (cx->exception && frame->blocks && frame->blocks->len) {
     swfdec_as_frame_pop_block (frame, cx);
   }
   /* no Try blocks caught it, exit frame */
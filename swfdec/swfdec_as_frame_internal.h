@@ -34,6 +34,8 @@ struct _SwfdecAsFrame {
   SwfdecAsFunction *	function;	/* function we're executing or NULL if toplevel */
   SwfdecAsValue		thisp;		/* this object in current frame or undefined if none */
   SwfdecAsSuper *	super;		/* super object in current frame or NULL if none */
+  SwfdecAsObject *	super_thisp;	/* this object to create the super object for on demand or NULL */
+  SwfdecAsObject *	super_reference;/* object the super object created on demand references */
   gboolean		construct;	/* TRUE if this is the constructor for thisp */
   SwfdecAsValue *	return_value;	/* pointer to where to store the return value */
   guint			argc;		/* number of arguments */
@@ -47,11 +49,19 @@ struct _SwfdecAsFrame {
   SwfdecMovie *		target;		/* target to use as last object in scope chain or for SetVariable */
   SwfdecMovie *		original_target;/* original target (used when resetting target) */
   SwfdecAsObject *	activation;	/* activation object or NULL if the frame takes no local variables */
+  gboolean		escaped;	/* TRUE if the activation object may outlive the frame */
   SwfdecAsValue *	registers;	/* the registers */
   guint			n_registers;	/* number of allocated registers */
   SwfdecConstantPool *	constant_pool;	/* constant pool currently in use */
   SwfdecAsValue *	stack_begin;	/* beginning of stack */
   const guint8 *	pc;		/* program counter on stack */
+  SwfdecScriptInstruction *insn;	/* instruction being executed by the threaded interpreter or NULL */
+  /* suspending */
+  gboolean		resumable;	/* TRUE if the frame may be suspended when running out of time */
+  gboolean		suspended;	/* TRUE while the frame waits in the context's suspended list */
+  SwfdecAsValue *	saved_stack;	/* stack of the frame while it is suspended */
+  guint			n_saved_stack;	/* number of values in saved_stack */
+  double		runtime;	/* msecs the frame ran before it was suspended */
   /* native function */
 };
 
@@ -67,6 +77,9 @@ void		swfdec_as_frame_set_this	(SwfdecAsFrame *	frame,
 						 SwfdecAsObject *	thisp);
 void		swfdec_as_frame_preload		(SwfdecAsContext *	context,
 						 SwfdecAsFrame *	frame);
+void		swfdec_as_frame_escape		(SwfdecAsFrame *	frame);
+void		swfdec_as_frame_capture		(SwfdecAsContext *	context,
+						 SwfdecAsFrame *	frame);
 
 #define swfdec_as_frame_get_variable(cx, frame, variable, value) \
   swfdec_as_frame_get_variable_and_flags (cx, frame, variable, value, NULL, NULL)
@@ -23,6 +23,7 @@
 
 #include "swfdec_as_gcable.h"
 
+#include "swfdec_as_arena.h"
 #include "swfdec_as_context.h"
 
 gpointer
@@ -35,6 +36,10 @@ swfdec_as_gcable_alloc (SwfdecAsContext *context, gsize size)
   g_return_val_if_fail (size > sizeof (SwfdecAsGcable), NULL);
 
   swfdec_as_context_use_mem (context, size);
+  /* the arena aligns properly already */
+  if (size <= SWFDEC_AS_ARENA_MAX_SIZE)
+    return swfdec_as_arena_alloc (context->arena, size);
+
   mem = g_slice_alloc0 (size);
   if (G_LIKELY ((GPOINTER_TO_SIZE (mem) & SWFDEC_AS_GC_FLAG_MASK) == 0))
     return mem;
@@ -65,6 +70,10 @@ swfdec_as_gcable_free (SwfdecAsContext *context, gpointer mem, gsize size)
 
   gc = mem;
   swfdec_as_context_unuse_mem (context, size);
+  if (size <= SWFDEC_AS_ARENA_MAX_SIZE) {
+    swfdec_as_arena_release (context->arena, mem, size);
+    return;
+  }
   if (G_UNLIKELY (SWFDEC_AS_GCABLE_FLAG_IS_SET (gc, SWFDEC_AS_GC_ALIGN))) {
     mem = ((guint8 *) mem) - ((guint8 *) mem)[-1];
     size += SWFDEC_AS_GC_FLAG_MASK;
@@ -106,3 +115,34 @@ swfdec_as_gcable_collect (SwfdecAsContext *context, SwfdecAsGcable *gc,
   return gc;
 }
 
+/* Checks at most *budget gcables from the list in *pending. Unmarked ones are
+ * freed, the others are prepended to @gc with their mark removed. This is
+ * used to sweep lists incrementally: *pending is updated to point to the 
+ * gcables that still need checking and the new head of @gc is returned. */
+SwfdecAsGcable *
+swfdec_as_gcable_collect_some (SwfdecAsContext *context, SwfdecAsGcable *gc,
+    SwfdecAsGcable **pending, SwfdecAsGcableDestroyNotify notify, guint *budget)
+{
+  SwfdecAsGcable *cur, *next;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+  g_return_val_if_fail (pending != NULL, gc);
+  g_return_val_if_fail (budget != NULL, gc);
+
+  cur = *pending;
+  while (cur && *budget > 0) {
+    next = SWFDEC_AS_GCABLE_NEXT (cur);
+    if (SWFDEC_AS_GCABLE_FLAG_IS_SET (cur, SWFDEC_AS_GC_MARK | SWFDEC_AS_GC_ROOT)) {
+      SWFDEC_AS_GCABLE_UNSET_FLAG (cur, SWFDEC_AS_GC_MARK);
+      SWFDEC_AS_GCABLE_SET_NEXT (cur, gc);
+      gc = cur;
+    } else {
+      notify (context, cur);
+    }
+    cur = next;
+    (*budget)--;
+  }
+  *pending = cur;
+
+  return gc;
+}
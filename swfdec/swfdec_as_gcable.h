@@ -54,6 +54,11 @@ void		swfdec_as_gcable_free		(SwfdecAsContext *	context,
 SwfdecAsGcable *swfdec_as_gcable_collect	(SwfdecAsContext *	context,
 						 SwfdecAsGcable *	gc,
 						 SwfdecAsGcableDestroyNotify notify);
+SwfdecAsGcable *swfdec_as_gcable_collect_some	(SwfdecAsContext *	context,
+						 SwfdecAsGcable *	gc,
+						 SwfdecAsGcable **	pending,
+						 SwfdecAsGcableDestroyNotify notify,
+						 guint *		budget);
 
 
 G_END_DECLS
@@ -33,12 +33,38 @@ G_BEGIN_DECLS
  */
 #define SWFDEC_AS_NATIVE(x, y, func) void func (SwfdecAsContext *cx, \
     SwfdecAsObject *object, guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret);
+/* Fast natives are called without setting up a frame, they get their 
+ * arguments directly from the stack. So they must not look at the current 
+ * frame - like swfdec_as_context_is_constructing() or resolving movies by 
+ * path does - and must not push to the stack themselves. Calling into scripts
+ * - like converting values via valueOf or toString or setting variables with
+ * setters - is fine though: the frames for those start above the arguments,
+ * so argv stays valid and is marked as part of the calling frame's stack. */
+#define SWFDEC_AS_FAST_NATIVE(x, y, func) SWFDEC_AS_NATIVE (x, y, func)
 
 #define SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT 256
 
+/* swfdec_as_string_value.h */
+/* Strings created by concatenation may be ropes that only get flattened into
+ * an interned string when their contents are needed. Ropes have the topmost
+ * bit of their length set. */
+#define SWFDEC_AS_STRING_VALUE_ROPE ((gsize) 1 << (GLIB_SIZEOF_SIZE_T * 8 - 1))
+#define SWFDEC_AS_STRING_VALUE_IS_ROPE(value) (((SwfdecAsStringValue *) (value))->length & SWFDEC_AS_STRING_VALUE_ROPE)
+/* flat strings that only contain ASCII characters have this bit set */
+#define SWFDEC_AS_STRING_VALUE_ASCII ((gsize) 1 << (GLIB_SIZEOF_SIZE_T * 8 - 2))
+#define SWFDEC_AS_STRING_VALUE_IS_ASCII(value) (((SwfdecAsStringValue *) (value))->length & SWFDEC_AS_STRING_VALUE_ASCII)
+/* the length in bytes */
+#define SWFDEC_AS_STRING_VALUE_LENGTH(value) (((SwfdecAsStringValue *) (value))->length & \
+    ~(SWFDEC_AS_STRING_VALUE_ROPE | SWFDEC_AS_STRING_VALUE_ASCII))
+
 /* swfdec_as_types.h */
 #define SWFDEC_AS_TYPE_IS_GCABLE(type) ((type) & 4)
 
+/* like SWFDEC_AS_VALUE_GET_STRING(), but flattens ropes */
+#define SWFDEC_AS_VALUE_GET_FLAT_STRING(val) (SWFDEC_AS_STRING_VALUE_IS_ROPE (SWFDEC_AS_VALUE_GET_VALUE (val)) ? \
+    swfdec_as_string_value_flatten (SWFDEC_AS_VALUE_GET_VALUE (val)) : \
+    (const char *) ((SwfdecAsStringValue *) SWFDEC_AS_VALUE_GET_VALUE (val))->string)
+
 #define SWFDEC_AS_VALUE_IS_COMPOSITE(val) (SWFDEC_AS_VALUE_GET_TYPE (val) >= SWFDEC_AS_TYPE_OBJECT)
 #define SWFDEC_AS_VALUE_IS_PRIMITIVE(val) (!SWFDEC_AS_VALUE_IS_COMPOSITE(val))
 /* FIXME: ugly macro */
@@ -70,6 +96,10 @@ gboolean	swfdec_as_context_check_continue (SwfdecAsContext *	context);
 void		swfdec_as_context_return	(SwfdecAsContext *	context,
 						 SwfdecAsValue *	return_value);
 void		swfdec_as_context_run		(SwfdecAsContext *	context);
+void		swfdec_as_context_resume	(SwfdecAsContext *	context,
+						 SwfdecAsFrame *	frame);
+void		swfdec_as_context_drop_suspended (SwfdecAsContext *	context,
+						 SwfdecMovie *		target);
 void		swfdec_as_context_run_init_script (SwfdecAsContext *	context,
 						 const guint8 *		data,
 						 gsize			length,
@@ -77,6 +107,13 @@ void		swfdec_as_context_run_init_script (SwfdecAsContext *	context,
 void		swfdec_as_context_gc_alloc	(SwfdecAsContext *	context,
 						 gsize			size);
 #define swfdec_as_context_gc_new(context,type) ((type *)swfdec_as_context_gc_alloc ((context), sizeof (type)))
+const char *	swfdec_as_context_get_string_len (SwfdecAsContext *	context,
+						 const char *		string,
+						 gsize			len);
+SwfdecAsValue	swfdec_as_context_concat_strings (SwfdecAsContext *	context,
+						 SwfdecAsValue		left,
+						 SwfdecAsValue		right);
+const char *	swfdec_as_string_value_flatten	(SwfdecAsStringValue *	value);
 
 /* swfdec_as_object.c */
 typedef SwfdecAsVariableForeach SwfdecAsVariableForeachRemove;
@@ -85,6 +122,8 @@ typedef const char *(* SwfdecAsVariableForeachRename) (SwfdecAsObject *object,
 
 void		swfdec_as_object_free		(SwfdecAsContext *	context,
 						 SwfdecAsObject *	object);
+void		swfdec_as_object_run_resumable	(SwfdecAsObject *	object,
+						 SwfdecScript *		script);
 SwfdecAsValue *	swfdec_as_object_peek_variable	(SwfdecAsObject *       object,
 						 const char *		name);
 guint		swfdec_as_object_foreach_remove	(SwfdecAsObject *       object,
@@ -93,6 +132,9 @@ guint		swfdec_as_object_foreach_remove	(SwfdecAsObject *       object,
 void		swfdec_as_object_foreach_rename	(SwfdecAsObject *       object,
 						 SwfdecAsVariableForeachRename func,
 						 gpointer		data);
+gboolean	swfdec_as_object_foreach_flags	(SwfdecAsObject *       object,
+						 SwfdecAsVariableForeach func,
+						 gpointer		data);
 
 void		swfdec_as_object_init_context	(SwfdecAsContext *	context);
 void		swfdec_as_object_decode		(SwfdecAsObject *	obj,
@@ -102,6 +144,70 @@ void		swfdec_as_object_add_native_variable (SwfdecAsObject *	object,
 						 const char *		variable,
 						 SwfdecAsNative		get,
 						 SwfdecAsNative		set);
+void		swfdec_as_object_add_lazy_variable (SwfdecAsObject *	object,
+						 const char *		variable,
+						 SwfdecAsNative		build,
+						 guint			default_flags);
+void		swfdec_as_object_add_lazy_variable_function
+						(SwfdecAsObject *	object,
+						 const char *		variable,
+						 SwfdecAsFunction *	build,
+						 const SwfdecAsValue *	data,
+						 guint			default_flags);
+gboolean	swfdec_as_object_set_lazy_data	(SwfdecAsObject *	object,
+						 const char *		variable,
+						 SwfdecAsFunction *	build,
+						 const SwfdecAsValue *	data);
+gboolean	swfdec_as_object_clone_variables (SwfdecAsObject *	dest,
+						 SwfdecAsObject *	source,
+						 SwfdecAsCloner *	cloner);
+void		swfdec_as_object_use_elements	(SwfdecAsObject *	object);
+SwfdecAsValue *	swfdec_as_object_peek_element	(SwfdecAsObject *	object,
+						 gint32			idx);
+gboolean	swfdec_as_object_get_element	(SwfdecAsObject *	object,
+						 gint32			idx,
+						 SwfdecAsValue *	value);
+gboolean	swfdec_as_object_set_element	(SwfdecAsObject *	object,
+						 gint32			idx,
+						 const SwfdecAsValue *	value,
+						 guint			default_flags);
+gboolean	swfdec_as_object_remove_elements (SwfdecAsObject *	object,
+						 gint32			start,
+						 gint32			num);
+gboolean	swfdec_as_object_move_elements	(SwfdecAsObject *	object,
+						 gint32			from,
+						 gint32			num,
+						 gint32			to);
+gboolean	swfdec_as_object_reverse_elements (SwfdecAsObject *	object,
+						 gint32			length);
+
+typedef struct _SwfdecAsPropertyCache SwfdecAsPropertyCache;
+SwfdecAsPropertyCache *
+		swfdec_as_property_cache_new	(void);
+void		swfdec_as_property_cache_free	(SwfdecAsPropertyCache *cache);
+gboolean	swfdec_as_property_cache_get	(SwfdecAsPropertyCache *cache,
+						 SwfdecAsObject *	object,
+						 const char *		name,
+						 SwfdecAsValue *	value);
+gboolean	swfdec_as_property_cache_set	(SwfdecAsPropertyCache *cache,
+						 SwfdecAsObject *	object,
+						 const char *		name,
+						 const SwfdecAsValue *	value);
+void		swfdec_as_property_cache_add	(SwfdecAsPropertyCache *cache,
+						 SwfdecAsObject *	object,
+						 const char *		name);
+gboolean	swfdec_as_property_cache_lacks	(SwfdecAsPropertyCache *cache,
+						 SwfdecAsObject *	object,
+						 const char *		name);
+void		swfdec_as_property_cache_add_missing
+						(SwfdecAsPropertyCache *cache,
+						 SwfdecAsObject *	object,
+						 const char *		name);
+
+/* swfdec_as_frame.c */
+SwfdecAsPropertyCache *
+		swfdec_as_frame_get_property_cache
+						(SwfdecAsFrame *	frame);
 
 /* swfdec_as_native_function.h */
 SwfdecAsFunction *
@@ -109,6 +215,9 @@ SwfdecAsFunction *
 						(SwfdecAsContext *	context,
 						 const char *		name,
 						 SwfdecAsNative		native);
+void		swfdec_as_native_function_set_fast
+						(SwfdecAsFunction *	function,
+						 gboolean		fast);
 
 /* swfdec_as_array.h */
 void		swfdec_as_array_remove_range	(SwfdecAsObject *	object,
@@ -167,7 +167,7 @@ swfdec_value_to_frame (SwfdecAsContext *cx, SwfdecSpriteMovie *movie, SwfdecAsVa
   if (movie->sprite == NULL)
     return 0;
   if (SWFDEC_AS_VALUE_IS_STRING (*val)) {
-    const char *name = SWFDEC_AS_VALUE_GET_STRING (*val);
+    const char *name = SWFDEC_AS_VALUE_GET_FLAT_STRING (*val);
     double d;
     if (strchr (name, ':')) {
       SWFDEC_ERROR ("FIXME: handle targets");
@@ -403,11 +403,13 @@ swfdec_action_push (SwfdecAsContext *cx, guint action, const guint8 *data, guint
 
 /* NB: name must be GC'd */
 static SwfdecAsObject *
-super_special_movie_lookup_magic (SwfdecAsContext *cx, SwfdecAsObject *o, const char *name)
+super_special_movie_lookup_magic (SwfdecAsContext *cx, SwfdecAsObject *o, const char *name,
+    gboolean *display_list)
 {
   SwfdecAsValue val;
 
   if (o == NULL) {
+    *display_list = FALSE;
     o = swfdec_as_frame_get_variable (cx, cx->frame, name, NULL);
     if (o == NULL)
       return NULL;
@@ -417,6 +419,7 @@ super_special_movie_lookup_magic (SwfdecAsContext *cx, SwfdecAsObject *o, const
     if (ret)
       return swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (ret));
   }
+  *display_list = FALSE;
   if (!swfdec_as_object_get_variable (o, name, &val))
     return NULL;
   if (!SWFDEC_AS_VALUE_IS_COMPOSITE (val))
@@ -424,66 +427,195 @@ super_special_movie_lookup_magic (SwfdecAsContext *cx, SwfdecAsObject *o, const
   return SWFDEC_AS_VALUE_GET_COMPOSITE (val);
 }
 
+/*** TARGET PATHS ***/
+
+/* Scripts tend to use the same target paths over and over again, so paths 
+ * are only split into their components once and the result is kept in a 
+ * cache indexed by the GC'd path. If resolving a path only looked at the
+ * display list, the resulting object is remembered together with the movie 
+ * epoch and the version of the context, so resolving it again is just a hash
+ * lookup. The caches are cleared whenever the garbage collector runs, as they
+ * don't keep the strings alive. */
+
+typedef struct _SwfdecAsTargetPath SwfdecAsTargetPath;
+struct _SwfdecAsTargetPath {
+  gboolean		valid;		/* FALSE if the path can never resolve */
+  gboolean		root;		/* the path starts at the root movie */
+  /* last resolution, only valid if it did not look at any variables */
+  SwfdecAsObject *	start;		/* object the path was resolved from or NULL */
+  SwfdecAsObject *	result;		/* object the path resolved to */
+  guint			epoch;		/* movie epoch at the time of resolving */
+  guint			version;	/* version used for resolving, it decides case sensitivity */
+  guint			n_names;	/* number of components */
+  const char *		names[1];	/* GC'd names of the components, NULL for ".." */
+};
+
+static SwfdecAsTargetPath *
+swfdec_as_target_path_new (GPtrArray *names)
+{
+  SwfdecAsTargetPath *path;
+
+  path = g_malloc0 (sizeof (SwfdecAsTargetPath) + 
+      MAX (names->len, 1) * sizeof (const char *) - sizeof (const char *));
+  path->valid = TRUE;
+  path->n_names = names->len;
+  if (names->len)
+    memcpy (path->names, names->pdata, names->len * sizeof (const char *));
+  return path;
+}
+
+static SwfdecAsTargetPath *
+swfdec_as_target_path_lookup (GHashTable **table, const char *key)
+{
+  if (*table == NULL) {
+    *table = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, g_free);
+    return NULL;
+  }
+  return g_hash_table_lookup (*table, key);
+}
+
 static SwfdecAsObject *
-swfdec_action_get_movie_by_slash_path (SwfdecAsContext *cx, const char *path)
+swfdec_as_target_path_get_cached (SwfdecAsContext *cx, SwfdecAsTargetPath *path, 
+    SwfdecAsObject *start)
+{
+  if (path->start == start && start != NULL && path->epoch == cx->movie_epoch &&
+      path->version == cx->version)
+    return path->result;
+  return NULL;
+}
+
+static SwfdecAsObject *
+swfdec_as_target_path_set_cached (SwfdecAsContext *cx, SwfdecAsTargetPath *path, 
+    SwfdecAsObject *start, SwfdecAsObject *result, gboolean display_list)
+{
+  if (display_list && result != NULL) {
+    path->start = start;
+    path->result = result;
+    path->epoch = cx->movie_epoch;
+    path->version = cx->version;
+  } else {
+    path->start = NULL;
+  }
+  return result;
+}
+
+/**
+ * swfdec_action_clear_target_paths:
+ * @cx: a #SwfdecAsContext
+ *
+ * Clears the caches of parsed target paths. This must be called before the
+ * garbage collector frees any strings.
+ **/
+void
+swfdec_action_clear_target_paths (SwfdecAsContext *cx)
+{
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (cx));
+
+  if (cx->target_paths) {
+    g_hash_table_destroy (cx->target_paths);
+    cx->target_paths = NULL;
+  }
+  if (cx->slash_paths) {
+    g_hash_table_destroy (cx->slash_paths);
+    cx->slash_paths = NULL;
+  }
+}
+
+/* NB: path must be GC'd */
+static SwfdecAsTargetPath *
+swfdec_action_parse_slash_path (SwfdecAsContext *cx, const char *key)
 {
+  SwfdecAsTargetPath *path;
+  GPtrArray *names;
+  const char *s = key;
+  gboolean valid = TRUE;
+
+  path = swfdec_as_target_path_lookup (&cx->slash_paths, key);
+  if (path)
+    return path;
+
+  names = g_ptr_array_new ();
+  if (*s == '/')
+    s++;
+  while (*s) {
+    char *slash = strchr (s, '/');
+    if (slash) {
+      if (slash == s) {
+	valid = FALSE;
+	break;
+      }
+      g_ptr_array_add (names, (gpointer) swfdec_as_context_get_string_len (cx, s, slash - s));
+      s = slash + 1;
+    } else {
+      g_ptr_array_add (names, (gpointer) swfdec_as_context_get_string (cx, s));
+      s += strlen (s);
+    }
+  }
+  path = swfdec_as_target_path_new (names);
+  path->valid = valid;
+  path->root = *key == '/';
+  g_ptr_array_free (names, TRUE);
+  g_hash_table_insert (cx->slash_paths, (gpointer) key, path);
+  return path;
+}
+
+/* NB: path must be GC'd */
+static SwfdecAsObject *
+swfdec_action_get_movie_by_slash_path (SwfdecAsContext *cx, const char *s)
+{
+  SwfdecAsTargetPath *path;
   SwfdecMovie *movie;
-  SwfdecAsObject *o;
+  SwfdecAsObject *o, *start;
+  gboolean display_list = TRUE;
+  guint i;
 
   movie = swfdec_as_frame_get_target (cx->frame);
   if (movie == NULL)
     return NULL;
-  if (*path == '/') {
+  path = swfdec_action_parse_slash_path (cx, s);
+  /* paths with empty parts like "a//b" don't look up anything */
+  if (!path->valid)
+    return NULL;
+  if (path->root)
     movie = swfdec_movie_get_root (movie);
-    path++;
-  }
-  o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
-  while (*path) {
-    char *slash = strchr (path, '/');
-    const char *name;
-    if (slash) {
-      if (slash == path)
-	return NULL;
-      name = swfdec_as_context_give_string (cx, g_strndup (path, slash - path));
-      path = slash + 1;
-    } else {
-      name = swfdec_as_context_get_string (cx, path);
-      path += strlen (path);
-    }
-    o = super_special_movie_lookup_magic (cx, o, name);
+  start = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
+  o = swfdec_as_target_path_get_cached (cx, path, start);
+  if (o)
+    return o;
+
+  o = start;
+  for (i = 0; i < path->n_names; i++) {
+    o = super_special_movie_lookup_magic (cx, o, path->names[i], &display_list);
     if (o == NULL || !o->movie)
       return NULL;
   }
-  return o;
+  return swfdec_as_target_path_set_cached (cx, path, start, o, display_list);
 }
 
-SwfdecAsObject *
-swfdec_action_lookup_object (SwfdecAsContext *cx, SwfdecAsObject *o, const char *path, const char *end)
+static SwfdecAsTargetPath *
+swfdec_action_parse_path (SwfdecAsContext *cx, const char *path, const char *end)
 {
-  gboolean dot_allowed = TRUE;
-  const char *start;
+  SwfdecAsTargetPath *ret;
+  gboolean dot_allowed = TRUE, root = FALSE;
+  const char *start, *key;
+  GPtrArray *names;
 
-  if (path == end) {
-    if (o == NULL) {
-      SwfdecMovie *movie = swfdec_as_frame_get_target (cx->frame);
-      if (movie)
-	o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
-    }
-    return o;
+  /* the parser peeks at the character after end in this case */
+  if (end[-1] == ':' && end[0] == '/')
+    key = NULL;
+  else
+    key = swfdec_as_context_get_string_len (cx, path, end - path);
+  if (key) {
+    ret = swfdec_as_target_path_lookup (&cx->target_paths, key);
+    if (ret)
+      return ret;
   }
 
+  names = g_ptr_array_new ();
   if (path[0] == '/') {
-    if (o == NULL) {
-      SwfdecMovie *movie = swfdec_as_frame_get_target (cx->frame);
-      if (movie) {
-	movie = swfdec_movie_get_root (movie);
-	o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
-      } else {
-	return NULL;
-      }
-    }
     path++;
     dot_allowed = FALSE;
+    root = TRUE;
   }
   while (path < end) {
     for (start = path; path < end; path++) {
@@ -508,12 +640,67 @@ swfdec_action_lookup_object (SwfdecAsContext *cx, SwfdecAsObject *o, const char
       break;
     }
 
-    /* parse variable */
     if (start[0] == '.' && start[1] == '.' && start + 2 == path) {
+      /* ".." goes back to parent */
+      g_ptr_array_add (names, NULL);
+    } else {
+      g_ptr_array_add (names, (gpointer) swfdec_as_context_get_string_len (cx, start, path - start));
+    }
+    if (path - start < 127)
+      path++;
+  }
+
+  ret = swfdec_as_target_path_new (names);
+  ret->root = root;
+  g_ptr_array_free (names, TRUE);
+  if (key)
+    g_hash_table_insert (cx->target_paths, (gpointer) key, ret);
+  return ret;
+}
+
+SwfdecAsObject *
+swfdec_action_lookup_object (SwfdecAsContext *cx, SwfdecAsObject *o, const char *s, const char *end)
+{
+  SwfdecAsTargetPath *path;
+  SwfdecAsObject *start, *result;
+  gboolean display_list = TRUE;
+  guint i;
+
+  if (s == end) {
+    if (o == NULL) {
+      SwfdecMovie *movie = swfdec_as_frame_get_target (cx->frame);
+      if (movie)
+	o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
+    }
+    return o;
+  }
+
+  path = swfdec_action_parse_path (cx, s, end);
+  if (path->root) {
+    if (o == NULL) {
+      SwfdecMovie *movie = swfdec_as_frame_get_target (cx->frame);
+      if (movie) {
+	movie = swfdec_movie_get_root (movie);
+	o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
+      } else {
+	return NULL;
+      }
+    }
+  }
+  /* without a start object, the first component is looked up in the scope 
+   * chain */
+  start = o;
+  result = swfdec_as_target_path_get_cached (cx, path, start);
+  if (result)
+    return result;
+
+  for (i = 0; i < path->n_names; i++) {
+    if (path->names[i] == NULL) {
       SwfdecMovie *movie;
       /* ".." goes back to parent */
       if (o == NULL) {
 	GSList *walk;
+	display_list = FALSE;
 	for (walk = cx->frame->scope_chain; walk; walk = walk->next) {
 	  o = walk->data;
 	  if (o->movie) {
@@ -535,16 +722,13 @@ swfdec_action_lookup_object (SwfdecAsContext *cx, SwfdecAsObject *o, const char
 	return NULL;
       o = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie));
     } else {
-      o = super_special_movie_lookup_magic (cx, o, 
-	      swfdec_as_context_give_string (cx, g_strndup (start, path - start)));
+      o = super_special_movie_lookup_magic (cx, o, path->names[i], &display_list);
       if (o == NULL)
 	return NULL;
     }
-    if (path - start < 127)
-      path++;
   }
 
-  return o;
+  return swfdec_as_target_path_set_cached (cx, path, start, o, display_list);
 }
 
 /* FIXME: this function belongs into swfdec_movie.c */
@@ -642,6 +826,14 @@ swfdec_action_get_movie_by_path (SwfdecAsContext *cx, const char *path,
   }
 }
 
+/* returns the property cache for the action currently executed or NULL if
+ * the action isn't executed by the threaded interpreter */
+static SwfdecAsPropertyCache *
+swfdec_action_get_cache (SwfdecAsContext *cx)
+{
+  return swfdec_as_frame_get_property_cache (cx->frame);
+}
+
 static void
 swfdec_action_get_variable (SwfdecAsContext *cx, guint action, const guint8 *data, guint len)
 {
@@ -659,6 +851,7 @@ swfdec_action_get_variable (SwfdecAsContext *cx, guint action, const guint8 *dat
 	SWFDEC_AS_VALUE_SET_MOVIE (val, SWFDEC_MOVIE (object->relay));
       }
     } else {
+      /* the frame caches where it found the variable */
       swfdec_as_frame_get_variable (cx, cx->frame, swfdec_as_context_get_string (cx, s), val);
     }
   } else {
@@ -742,14 +935,43 @@ swfdec_action_set_property (SwfdecAsContext *cx, guint action, const guint8 *dat
   swfdec_as_stack_pop_n (cx, 3);
 }
 
+/* returns the element index a value refers to or -1 if it doesn't refer to 
+ * one */
+static gint32
+swfdec_action_value_to_index (SwfdecAsValue value)
+{
+  double d;
+
+  if (!SWFDEC_AS_VALUE_IS_NUMBER (value))
+    return -1;
+  d = SWFDEC_AS_VALUE_GET_NUMBER (value);
+  if (!(d >= 0 && d <= G_MAXINT32) || d != (gint32) d)
+    return -1;
+  return d;
+}
+
 static void
 swfdec_action_get_member (SwfdecAsContext *cx, guint action, const guint8 *data, guint len)
 {
   SwfdecAsObject *object = swfdec_as_value_to_object (cx, *swfdec_as_stack_peek (cx, 2));
   if (object) {
+    SwfdecAsPropertyCache *cache;
     const char *name;
+    gint32 idx;
+
+    idx = swfdec_action_value_to_index (*swfdec_as_stack_peek (cx, 1));
+    if (idx >= 0 && swfdec_as_object_get_element (object, idx, swfdec_as_stack_peek (cx, 2))) {
+      swfdec_as_stack_pop (cx);
+      return;
+    }
+    cache = swfdec_action_get_cache (cx);
     name = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 1));
-    swfdec_as_object_get_variable (object, name, swfdec_as_stack_peek (cx, 2));
+    if (cache == NULL) {
+      swfdec_as_object_get_variable (object, name, swfdec_as_stack_peek (cx, 2));
+    } else if (!swfdec_as_property_cache_get (cache, object, name, swfdec_as_stack_peek (cx, 2)) &&
+	swfdec_as_object_get_variable (object, name, swfdec_as_stack_peek (cx, 2))) {
+      swfdec_as_property_cache_add (cache, object, name);
+    }
 #ifdef SWFDEC_WARN_MISSING_PROPERTIES
     if (SWFDEC_AS_VALUE_IS_UNDEFINED (*swfdec_as_stack_peek (cx, 2))) {
 	SWFDEC_WARNING ("no variable named %s:%s", 
@@ -765,11 +987,29 @@ swfdec_action_get_member (SwfdecAsContext *cx, guint action, const guint8 *data,
 static void
 swfdec_action_set_member (SwfdecAsContext *cx, guint action, const guint8 *data, guint len)
 {
-  const char *name = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 2));
+  const char *name;
+  gint32 idx;
+
+  /* converting numbers to strings has no side effects, so it can be delayed */
+  idx = swfdec_action_value_to_index (*swfdec_as_stack_peek (cx, 2));
+  if (idx < 0)
+    name = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 2));
+  else
+    name = NULL;
   if (SWFDEC_AS_VALUE_IS_COMPOSITE (*swfdec_as_stack_peek (cx, 3))) {
     SwfdecAsObject *o = SWFDEC_AS_VALUE_GET_COMPOSITE (*swfdec_as_stack_peek (cx, 3));
-    if (o)
-      swfdec_as_object_set_variable (o, name, swfdec_as_stack_peek (cx, 1));
+    if (o && (idx < 0 ||
+	  !swfdec_as_object_set_element (o, idx, swfdec_as_stack_peek (cx, 1), 0))) {
+      SwfdecAsPropertyCache *cache = swfdec_action_get_cache (cx);
+      if (name == NULL)
+	name = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 2));
+      if (cache == NULL) {
+	swfdec_as_object_set_variable (o, name, swfdec_as_stack_peek (cx, 1));
+      } else if (!swfdec_as_property_cache_set (cache, o, name, swfdec_as_stack_peek (cx, 1))) {
+	swfdec_as_object_set_variable (o, name, swfdec_as_stack_peek (cx, 1));
+	swfdec_as_property_cache_add (cache, o, name);
+      }
+    }
   }
   swfdec_as_stack_pop_n (cx, 3);
 }
@@ -844,6 +1084,9 @@ swfdec_action_call_function (SwfdecAsContext *cx, guint action, const guint8 *da
   fun = swfdec_as_stack_peek (cx, 1);
   obj = swfdec_as_frame_get_variable (cx, frame, name, fun);
   if (obj) {
+    /* the called function gets the activation object as this */
+    if (obj == frame->activation)
+      swfdec_as_frame_escape (frame);
     SWFDEC_AS_VALUE_SET_COMPOSITE (thisp, obj);
   } else {
     SWFDEC_AS_VALUE_SET_NULL (thisp);
@@ -881,7 +1124,7 @@ swfdec_action_call_method (SwfdecAsContext *cx, guint action, const guint8 *data
     }
   } else {
     if (SWFDEC_AS_VALUE_IS_STRING (*val))
-      name = SWFDEC_AS_VALUE_GET_STRING (*val);
+      name = SWFDEC_AS_VALUE_GET_FLAT_STRING (*val);
     else
       name = "???";
     SWFDEC_AS_VALUE_SET_NULL (swfdec_as_stack_peek (cx, 3));
@@ -954,6 +1197,15 @@ swfdec_action_binary (SwfdecAsContext *cx, guint action, const guint8 *data, gui
   *swfdec_as_stack_peek (cx, 1) = swfdec_as_value_from_number (cx, l);
 }
 
+/* like swfdec_as_value_to_string(), but doesn't flatten ropes */
+static SwfdecAsValue
+swfdec_action_to_string_value (SwfdecAsContext *cx, SwfdecAsValue value)
+{
+  if (SWFDEC_AS_VALUE_IS_STRING (value))
+    return value;
+  return SWFDEC_AS_VALUE_FROM_STRING (swfdec_as_value_to_string (cx, value));
+}
+
 static void
 swfdec_action_add2_to_primitive (SwfdecAsValue *value)
 {
@@ -978,6 +1230,14 @@ swfdec_action_add2 (SwfdecAsContext *cx, guint action, const guint8 *data, guint
 
   rval = swfdec_as_stack_peek (cx, 1);
   lval = swfdec_as_stack_peek (cx, 2);
+  /* fast path: adding two integers can neither call into scripts nor
+   * overflow a double */
+  if (SWFDEC_AS_VALUE_IS_INT (*lval) && SWFDEC_AS_VALUE_IS_INT (*rval)) {
+    double d = (double) SWFDEC_AS_VALUE_GET_INT (*lval) + SWFDEC_AS_VALUE_GET_INT (*rval);
+    swfdec_as_stack_pop (cx);
+    *swfdec_as_stack_peek (cx, 1) = swfdec_as_value_from_number (cx, d);
+    return;
+  }
   rtmp = *rval;
   ltmp = *lval;
   swfdec_action_add2_to_primitive (&rtmp);
@@ -988,12 +1248,12 @@ swfdec_action_add2 (SwfdecAsContext *cx, guint action, const guint8 *data, guint
     lval = &ltmp;
 
   if (SWFDEC_AS_VALUE_IS_STRING (*lval) || SWFDEC_AS_VALUE_IS_STRING (*rval)) {
-    const char *lstr, *rstr;
-    lstr = swfdec_as_value_to_string (cx, *lval);
-    rstr = swfdec_as_value_to_string (cx, *rval);
-    lstr = swfdec_as_str_concat (cx, lstr, rstr);
+    SwfdecAsValue lstr, rstr;
+    lstr = swfdec_action_to_string_value (cx, *lval);
+    rstr = swfdec_action_to_string_value (cx, *rval);
+    lstr = swfdec_as_context_concat_strings (cx, lstr, rstr);
     swfdec_as_stack_pop (cx);
-    SWFDEC_AS_VALUE_SET_STRING (swfdec_as_stack_peek (cx, 1), lstr);
+    *swfdec_as_stack_peek (cx, 1) = lstr;
   } else {
     double d, d2;
     d = swfdec_as_value_to_number (cx, *lval);
@@ -1043,8 +1303,8 @@ swfdec_action_new_comparison (SwfdecAsContext *cx, guint action, const guint8 *d
   /* if both are strings, compare strings */
   if (SWFDEC_AS_VALUE_IS_STRING (*rval) &&
       SWFDEC_AS_VALUE_IS_STRING (*lval)) {
-    const char *ls = SWFDEC_AS_VALUE_GET_STRING (*lval);
-    const char *rs = SWFDEC_AS_VALUE_GET_STRING (*rval);
+    const char *ls = SWFDEC_AS_VALUE_GET_FLAT_STRING (*lval);
+    const char *rs = SWFDEC_AS_VALUE_GET_FLAT_STRING (*rval);
     int cmp;
     if (ls == SWFDEC_AS_STR_EMPTY) {
       cmp = rs == SWFDEC_AS_STR_EMPTY ? 0 : 1;
@@ -1114,6 +1374,13 @@ swfdec_action_decrement (SwfdecAsContext *cx, guint action, const guint8 *data,
   SwfdecAsValue *val;
 
   val = swfdec_as_stack_peek (cx, 1);
+  if (SWFDEC_AS_VALUE_IS_INT (*val)) {
+    int i = SWFDEC_AS_VALUE_GET_INT (*val);
+    if (i != G_MININT32 && SWFDEC_AS_VALUE_INT_FITS (i - 1)) {
+      *val = SWFDEC_AS_VALUE_FROM_INT (i - 1);
+      return;
+    }
+  }
   *val = swfdec_as_value_from_number (cx, swfdec_as_value_to_number (cx, *val) - 1);
 }
 
@@ -1123,6 +1390,13 @@ swfdec_action_increment (SwfdecAsContext *cx, guint action, const guint8 *data,
   SwfdecAsValue *val;
 
   val = swfdec_as_stack_peek (cx, 1);
+  if (SWFDEC_AS_VALUE_IS_INT (*val)) {
+    int i = SWFDEC_AS_VALUE_GET_INT (*val);
+    if (i != G_MAXINT32 && SWFDEC_AS_VALUE_INT_FITS (i + 1)) {
+      *val = SWFDEC_AS_VALUE_FROM_INT (i + 1);
+      return;
+    }
+  }
   *val = swfdec_as_value_from_number (cx, swfdec_as_value_to_number (cx, *val) + 1);
 }
 
@@ -1281,12 +1555,11 @@ swfdec_action_get_url2 (SwfdecAsContext *cx, guint action, const guint8 *data, g
 static void
 swfdec_action_string_add (SwfdecAsContext *cx, guint action, const guint8 *data, guint len)
 {
-  const char *lval, *rval;
+  SwfdecAsValue lval, rval;
 
-  rval = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 1));
-  lval = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 2));
-  lval = swfdec_as_str_concat (cx, lval, rval);
-  SWFDEC_AS_VALUE_SET_STRING (swfdec_as_stack_peek (cx, 2), lval);
+  rval = swfdec_action_to_string_value (cx, *swfdec_as_stack_peek (cx, 1));
+  lval = swfdec_action_to_string_value (cx, *swfdec_as_stack_peek (cx, 2));
+  *swfdec_as_stack_peek (cx, 2) = swfdec_as_context_concat_strings (cx, lval, rval);
   swfdec_as_stack_pop (cx);
 }
 
@@ -1350,7 +1623,7 @@ swfdec_action_string_extract (SwfdecAsContext *cx, guint action, const guint8 *d
   start = swfdec_as_value_to_integer (cx, *swfdec_as_stack_peek (cx, 2));
   s = swfdec_as_value_to_string (cx, *swfdec_as_stack_peek (cx, 3));
   swfdec_as_stack_pop_n (cx, 2);
-  left = g_utf8_strlen (s, -1);
+  left = swfdec_as_str_n_chars (cx, s);
   if (start > left) {
     SWFDEC_AS_VALUE_SET_STRING (swfdec_as_stack_peek (cx, 1), SWFDEC_AS_STR_EMPTY);
     return;
@@ -1375,7 +1648,7 @@ swfdec_action_string_length (SwfdecAsContext *cx, guint action, const guint8 *da
 
   v = swfdec_as_stack_peek (cx, 1);
   s = swfdec_as_value_to_string (cx, *v);
-  *v = swfdec_as_value_from_integer (cx, g_utf8_strlen (s, -1));  
+  *v = swfdec_as_value_from_integer (cx, swfdec_as_str_n_chars (cx, s));
 }
 
 static void
@@ -1450,7 +1723,7 @@ swfdec_action_equals2_5 (SwfdecAsContext *cx, guint action, const guint8 *data,
 
   /* compare strings */
   if (ltype == SWFDEC_AS_TYPE_STRING && rtype == SWFDEC_AS_TYPE_STRING) {
-    cond = SWFDEC_AS_VALUE_GET_STRING (ltmp) == SWFDEC_AS_VALUE_GET_STRING (rtmp);
+    cond = SWFDEC_AS_VALUE_GET_FLAT_STRING (ltmp) == SWFDEC_AS_VALUE_GET_FLAT_STRING (rtmp);
     goto out;
   }
 
@@ -1533,7 +1806,7 @@ swfdec_action_equals2_6 (SwfdecAsContext *cx, guint action, const guint8 *data,
 
   /* compare strings */
   if (ltype == SWFDEC_AS_TYPE_STRING && rtype == SWFDEC_AS_TYPE_STRING) {
-    cond = SWFDEC_AS_VALUE_GET_STRING (*lval) == SWFDEC_AS_VALUE_GET_STRING (*rval);
+    cond = SWFDEC_AS_VALUE_GET_FLAT_STRING (*lval) == SWFDEC_AS_VALUE_GET_FLAT_STRING (*rval);
     goto out;
   }
 
@@ -1571,7 +1844,13 @@ swfdec_action_strict_equals (SwfdecAsContext *cx, guint action, const guint8 *da
   rval = swfdec_as_stack_peek (cx, 1);
   lval = swfdec_as_stack_peek (cx, 2);
 
-  if (SWFDEC_AS_VALUE_GET_TYPE (*rval) != SWFDEC_AS_VALUE_GET_TYPE (*lval)) {
+  if (SWFDEC_AS_VALUE_IS_NUMBER (*rval) && SWFDEC_AS_VALUE_IS_NUMBER (*lval)) {
+    /* integers and doubles are both numbers */
+    double l, r;
+    r = SWFDEC_AS_VALUE_GET_NUMBER (*rval);
+    l = SWFDEC_AS_VALUE_GET_NUMBER (*lval);
+    cond = (l == r) || (isnan (l) && isnan (r));
+  } else if (SWFDEC_AS_VALUE_GET_TYPE (*rval) != SWFDEC_AS_VALUE_GET_TYPE (*lval)) {
     cond = FALSE;
   } else {
     switch (SWFDEC_AS_VALUE_GET_TYPE (*rval)) {
@@ -1582,16 +1861,8 @@ swfdec_action_strict_equals (SwfdecAsContext *cx, guint action, const guint8 *da
       case SWFDEC_AS_TYPE_BOOLEAN:
 	cond = SWFDEC_AS_VALUE_GET_BOOLEAN (*rval) == SWFDEC_AS_VALUE_GET_BOOLEAN (*lval);
 	break;
-      case SWFDEC_AS_TYPE_NUMBER:
-	{
-	  double l, r;
-	  r = SWFDEC_AS_VALUE_GET_NUMBER (*rval);
-	  l = SWFDEC_AS_VALUE_GET_NUMBER (*lval);
-	  cond = (l == r) || (isnan (l) && isnan (r));
-	}
-	break;
       case SWFDEC_AS_TYPE_STRING:
-	cond = SWFDEC_AS_VALUE_GET_STRING (*rval) == SWFDEC_AS_VALUE_GET_STRING (*lval);
+	cond = SWFDEC_AS_VALUE_GET_FLAT_STRING (*rval) == SWFDEC_AS_VALUE_GET_FLAT_STRING (*lval);
 	break;
       case SWFDEC_AS_TYPE_OBJECT:
 	cond = SWFDEC_AS_VALUE_GET_OBJECT (*lval) == SWFDEC_AS_VALUE_GET_OBJECT (*rval);
@@ -1600,6 +1871,7 @@ swfdec_action_strict_equals (SwfdecAsContext *cx, guint action, const guint8 *da
 	cond = SWFDEC_AS_VALUE_GET_MOVIE (*lval) == SWFDEC_AS_VALUE_GET_MOVIE (*rval);
 	break;
       case SWFDEC_AS_TYPE_INT:
+      case SWFDEC_AS_TYPE_NUMBER:
       default:
 	g_assert_not_reached ();
 	cond = FALSE;
@@ -1895,7 +2167,7 @@ swfdec_action_define_function (SwfdecAsContext *cx, guint action,
      * it will contain the name this function will soon be assigned to.
      */
     if (SWFDEC_AS_VALUE_IS_STRING (*swfdec_as_stack_peek (cx, 1)))
-      name = SWFDEC_AS_VALUE_GET_STRING (*swfdec_as_stack_peek (cx, 1));
+      name = SWFDEC_AS_VALUE_GET_FLAT_STRING (*swfdec_as_stack_peek (cx, 1));
   }
   if (name == NULL)
     name = "unnamed_function";
@@ -1917,6 +2189,7 @@ swfdec_action_define_function (SwfdecAsContext *cx, guint action,
   if (cx->version > 5) {
     /* FIXME: or original target? */
     fun = swfdec_as_script_function_new (cx, frame->original_target, frame->scope_chain, script);
+    swfdec_as_frame_escape (frame);
   } else {
     fun = swfdec_as_script_function_new (cx, frame->original_target, NULL, script);
   }
@@ -2152,6 +2425,7 @@ swfdec_action_type_of (SwfdecAsContext *cx, guint action, const guint8 *data, gu
 
   val = *swfdec_as_stack_pop (cx);
   switch (SWFDEC_AS_VALUE_GET_TYPE (val)) {
+    case SWFDEC_AS_TYPE_INT:
     case SWFDEC_AS_TYPE_NUMBER:
       type = SWFDEC_AS_STR_number;
       break;
@@ -2188,7 +2462,6 @@ swfdec_action_type_of (SwfdecAsContext *cx, guint action, const guint8 *data, gu
 	}
       }
       break;
-    case SWFDEC_AS_TYPE_INT:
     default:
       g_assert_not_reached ();
       type = SWFDEC_AS_STR_EMPTY;
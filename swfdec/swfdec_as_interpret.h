@@ -145,6 +145,7 @@ SwfdecAsObject *	swfdec_action_lookup_object	(SwfdecAsContext *	cx,
 							 SwfdecAsObject *	o,
 							 const char *		path,
 							 const char *		end);
+void			swfdec_action_clear_target_paths (SwfdecAsContext *	cx);
 
 G_END_DECLS
 #endif
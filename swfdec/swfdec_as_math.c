@@ -49,30 +49,30 @@ swfdec_as_math_ ## name (SwfdecAsContext *cx, SwfdecAsObject *object, \
   *ret = swfdec_as_value_from_number (cx, d); \
 }
 
-SWFDEC_AS_NATIVE (200, 16, swfdec_as_math_acos)
+SWFDEC_AS_FAST_NATIVE (200, 16, swfdec_as_math_acos)
 MATH_FUN (acos)
-SWFDEC_AS_NATIVE (200, 15, swfdec_as_math_asin)
+SWFDEC_AS_FAST_NATIVE (200, 15, swfdec_as_math_asin)
 MATH_FUN (asin)
-SWFDEC_AS_NATIVE (200, 14, swfdec_as_math_atan)
+SWFDEC_AS_FAST_NATIVE (200, 14, swfdec_as_math_atan)
 MATH_FUN (atan)
-SWFDEC_AS_NATIVE (200, 13, swfdec_as_math_ceil)
+SWFDEC_AS_FAST_NATIVE (200, 13, swfdec_as_math_ceil)
 MATH_FUN (ceil)
-SWFDEC_AS_NATIVE (200, 4, swfdec_as_math_cos)
+SWFDEC_AS_FAST_NATIVE (200, 4, swfdec_as_math_cos)
 MATH_FUN (cos)
-SWFDEC_AS_NATIVE (200, 7, swfdec_as_math_exp)
+SWFDEC_AS_FAST_NATIVE (200, 7, swfdec_as_math_exp)
 MATH_FUN (exp)
-SWFDEC_AS_NATIVE (200, 12, swfdec_as_math_floor)
+SWFDEC_AS_FAST_NATIVE (200, 12, swfdec_as_math_floor)
 MATH_FUN (floor)
-SWFDEC_AS_NATIVE (200, 8, swfdec_as_math_log)
+SWFDEC_AS_FAST_NATIVE (200, 8, swfdec_as_math_log)
 MATH_FUN (log)
-SWFDEC_AS_NATIVE (200, 3, swfdec_as_math_sin)
+SWFDEC_AS_FAST_NATIVE (200, 3, swfdec_as_math_sin)
 MATH_FUN (sin)
-SWFDEC_AS_NATIVE (200, 9, swfdec_as_math_sqrt)
+SWFDEC_AS_FAST_NATIVE (200, 9, swfdec_as_math_sqrt)
 MATH_FUN (sqrt)
-SWFDEC_AS_NATIVE (200, 6, swfdec_as_math_tan)
+SWFDEC_AS_FAST_NATIVE (200, 6, swfdec_as_math_tan)
 MATH_FUN (tan)
 
-SWFDEC_AS_NATIVE (200, 0, swfdec_as_math_abs)
+SWFDEC_AS_FAST_NATIVE (200, 0, swfdec_as_math_abs)
 void
 swfdec_as_math_abs (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -85,7 +85,7 @@ swfdec_as_math_abs (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, fabs (d));
 }
 
-SWFDEC_AS_NATIVE (200, 5, swfdec_as_math_atan2)
+SWFDEC_AS_FAST_NATIVE (200, 5, swfdec_as_math_atan2)
 void
 swfdec_as_math_atan2 (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -98,7 +98,7 @@ swfdec_as_math_atan2 (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, atan2 (y, x));
 }
 
-SWFDEC_AS_NATIVE (200, 2, swfdec_as_math_max)
+SWFDEC_AS_FAST_NATIVE (200, 2, swfdec_as_math_max)
 void
 swfdec_as_math_max (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -115,7 +115,7 @@ swfdec_as_math_max (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, isnan (x) || isnan (y) ? NAN : MAX (x, y));
 }
 
-SWFDEC_AS_NATIVE (200, 1, swfdec_as_math_min)
+SWFDEC_AS_FAST_NATIVE (200, 1, swfdec_as_math_min)
 void
 swfdec_as_math_min (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -132,7 +132,7 @@ swfdec_as_math_min (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, isnan (x) || isnan (y) ? NAN : MIN (x, y));
 }
 
-SWFDEC_AS_NATIVE (200, 17, swfdec_as_math_pow)
+SWFDEC_AS_FAST_NATIVE (200, 17, swfdec_as_math_pow)
 void
 swfdec_as_math_pow (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -145,7 +145,7 @@ swfdec_as_math_pow (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, isfinite (x) ? pow (x, y): NAN);
 }
 
-SWFDEC_AS_NATIVE (200, 11, swfdec_as_math_random)
+SWFDEC_AS_FAST_NATIVE (200, 11, swfdec_as_math_random)
 void
 swfdec_as_math_random (SwfdecAsContext *cx, SwfdecAsObject *object, 
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -158,7 +158,7 @@ swfdec_as_math_random (SwfdecAsContext *cx, SwfdecAsObject *object,
   *ret = swfdec_as_value_from_number (cx, g_rand_double (cx->rand));
 }
 
-SWFDEC_AS_NATIVE (200, 10, swfdec_as_math_round)
+SWFDEC_AS_FAST_NATIVE (200, 10, swfdec_as_math_round)
 void
 swfdec_as_math_round (SwfdecAsContext *cx, SwfdecAsObject *object, 
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
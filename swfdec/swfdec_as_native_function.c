@@ -22,6 +22,7 @@
 #endif
 
 #include "swfdec_as_native_function.h"
+#include "swfdec_as_cloner.h"
 #include "swfdec_as_context.h"
 #include "swfdec_as_frame_internal.h"
 #include "swfdec_as_internal.h"
@@ -52,6 +53,52 @@
 
 G_DEFINE_TYPE (SwfdecAsNativeFunction, swfdec_as_native_function, SWFDEC_TYPE_AS_FUNCTION)
 
+/* Fast natives run on the stack of the calling frame. The arguments are
+ * reversed in place, so they can be passed as argv without copying. Returns
+ * FALSE if the function needs to be called the normal way. */
+static gboolean
+swfdec_as_native_function_call_fast (SwfdecAsNativeFunction *native, 
+    SwfdecAsObject *thisp, guint n_args, const SwfdecAsValue *args, 
+    SwfdecAsValue *return_value)
+{
+  SwfdecAsContext *cx = swfdec_gc_object_get_context (native);
+  SwfdecAsValue rval = SWFDEC_AS_VALUE_UNDEFINED;
+  SwfdecAsValue *argv, tmp;
+  guint i;
+
+  /* the debugger wants to see all frames */
+  if (cx->debugger || cx->frame == NULL)
+    return FALSE;
+
+  if (n_args == 0 || args != NULL) {
+    /* FIXME FIXME FIXME: no casting here please! */
+    argv = (SwfdecAsValue *) args;
+  } else {
+    if (n_args > (guint) (cx->cur - cx->base))
+      return FALSE;
+    argv = cx->cur - n_args;
+    for (i = 0; i < n_args / 2; i++) {
+      tmp = argv[i];
+      argv[i] = argv[n_args - 1 - i];
+      argv[n_args - 1 - i] = tmp;
+    }
+  }
+
+  if (thisp)
+    thisp = swfdec_as_object_resolve (thisp);
+  native->native (cx, thisp, n_args, argv, &rval);
+
+  if (args == NULL)
+    swfdec_as_stack_pop_n (cx, n_args);
+  if (return_value) {
+    *return_value = rval;
+  } else {
+    swfdec_as_stack_ensure_free (cx, 1);
+    *swfdec_as_stack_push (cx) = rval;
+  }
+  return TRUE;
+}
+
 static void
 swfdec_as_native_function_call (SwfdecAsFunction *function, SwfdecAsObject *thisp, 
     gboolean construct, SwfdecAsObject *super_reference, guint n_args, 
@@ -65,6 +112,10 @@ swfdec_as_native_function_call (SwfdecAsFunction *function, SwfdecAsObject *this
 
   g_assert (native->name);
 
+  if (native->fast && !construct && 
+      swfdec_as_native_function_call_fast (native, thisp, n_args, args, return_value))
+    return;
+
   swfdec_as_frame_init_native (&frame, cx);
   frame.construct = construct;
   frame.function = function;
@@ -127,14 +178,36 @@ swfdec_as_native_function_dispose (GObject *object)
   G_OBJECT_CLASS (swfdec_as_native_function_parent_class)->dispose (object);
 }
 
+static SwfdecAsRelay *
+swfdec_as_native_function_clone (SwfdecAsRelay *relay, SwfdecAsCloner *cloner)
+{
+  SwfdecAsNativeFunction *native = SWFDEC_AS_NATIVE_FUNCTION (relay);
+  SwfdecAsNativeFunction *fun;
+
+  /* subclasses might have more data */
+  if (G_OBJECT_TYPE (relay) != SWFDEC_TYPE_AS_NATIVE_FUNCTION)
+    return NULL;
+
+  fun = g_object_new (SWFDEC_TYPE_AS_NATIVE_FUNCTION, "context", 
+      swfdec_as_cloner_get_context (cloner), NULL);
+  fun->native = native->native;
+  fun->name = g_strdup (native->name);
+  fun->fast = native->fast;
+
+  return SWFDEC_AS_RELAY (fun);
+}
+
 static void
 swfdec_as_native_function_class_init (SwfdecAsNativeFunctionClass *klass)
 {
   GObjectClass *object_class = G_OBJECT_CLASS (klass);
+  SwfdecAsRelayClass *relay_class = SWFDEC_AS_RELAY_CLASS (klass);
   SwfdecAsFunctionClass *function_class = SWFDEC_AS_FUNCTION_CLASS (klass);
 
   object_class->dispose = swfdec_as_native_function_dispose;
 
+  relay_class->clone = swfdec_as_native_function_clone;
+
   function_class->call = swfdec_as_native_function_call;
 }
 
@@ -193,6 +266,24 @@ swfdec_as_native_function_new_bare (SwfdecAsContext *context, const char *name,
   return SWFDEC_AS_FUNCTION (fun);
 }
 
+/**
+ * swfdec_as_native_function_set_fast:
+ * @function: a #SwfdecAsNativeFunction
+ * @fast: %TRUE to call the function without a frame
+ *
+ * Marks @function as a fast native. Fast natives don't get a frame set up 
+ * when called, but run on the stack of the calling frame. This is only 
+ * useful for small functions that are called very often. See 
+ * SWFDEC_AS_FAST_NATIVE() for what such functions must not do.
+ **/
+void
+swfdec_as_native_function_set_fast (SwfdecAsFunction *function, gboolean fast)
+{
+  g_return_if_fail (SWFDEC_IS_AS_NATIVE_FUNCTION (function));
+
+  SWFDEC_AS_NATIVE_FUNCTION (function)->fast = fast;
+}
+
 /**
  * SWFDEC_AS_CHECK:
  * @type: required type of this object or 0 for ignoring
@@ -42,6 +42,7 @@ struct _SwfdecAsNativeFunction {
 
   SwfdecAsNative	native;		/* native call or NULL when script */
   char *		name;		/* function name */
+  gboolean		fast;		/* call without setting up a frame */
 };
 
 struct _SwfdecAsNativeFunctionClass {
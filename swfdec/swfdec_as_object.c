@@ -26,12 +26,15 @@
 
 #include "swfdec_as_object.h"
 
+#include "swfdec_as_arena.h"
 #include "swfdec_as_array.h"
+#include "swfdec_as_cloner.h"
 #include "swfdec_as_context.h"
 #include "swfdec_as_frame_internal.h"
 #include "swfdec_as_internal.h"
 #include "swfdec_as_native_function.h"
 #include "swfdec_as_relay.h"
+#include "swfdec_as_shape.h"
 #include "swfdec_as_stack.h"
 #include "swfdec_as_string.h"
 #include "swfdec_as_strings.h"
@@ -179,7 +182,230 @@ swfdec_as_object_free_property (gpointer key, gpointer value, gpointer data)
   SwfdecAsObject *object = data;
 
   swfdec_as_context_unuse_mem (object->context, sizeof (SwfdecAsVariable));
-  g_slice_free (SwfdecAsVariable, value);
+  swfdec_as_arena_release (object->context->arena, value, sizeof (SwfdecAsVariable));
+}
+
+/*** SLOTS ***/
+
+/* Objects store their variables either in slots described by a shape, or - 
+ * for objects with lots of variables or after deleting variables - in a hash
+ * table. The slots only contain pointers to the variables, as lots of code 
+ * relies on a variable not moving while calling into scripts. */
+
+#define SWFDEC_AS_OBJECT_SLOT(object, i) ((SwfdecAsVariable *) (object)->slots[i])
+#define SWFDEC_AS_OBJECT_N_SLOTS(object) (((SwfdecAsShape *) (object)->shape)->n_slots)
+
+/* Property caches remember lookups on prototypes. To keep them valid, every 
+ * change to an object used as a prototype must call this */
+#define SWFDEC_AS_OBJECT_CHANGED(object) G_STMT_START { \
+  if ((object)->inherited) \
+    (object)->context->prototype_epoch++; \
+} G_STMT_END
+
+static void
+swfdec_as_object_free_slots (SwfdecAsObject *object)
+{
+  guint i;
+
+  for (i = 0; i < SWFDEC_AS_OBJECT_N_SLOTS (object); i++) {
+    swfdec_as_object_free_property (NULL, SWFDEC_AS_OBJECT_SLOT (object, i), object);
+  }
+  g_free (object->slots);
+  object->slots = NULL;
+  swfdec_as_shape_unref (object->shape);
+  object->shape = NULL;
+}
+
+/* switch object to store its variables in a hash table */
+static void
+swfdec_as_object_make_dictionary (SwfdecAsObject *object)
+{
+  SwfdecAsShape *shape = object->shape;
+
+  if (shape == NULL)
+    return;
+
+  object->properties = g_hash_table_new (g_direct_hash, g_direct_equal);
+  for (; shape->parent; shape = shape->parent) {
+    g_hash_table_insert (object->properties, (gpointer) shape->name, 
+	object->slots[shape->n_slots - 1]);
+  }
+  g_free (object->slots);
+  object->slots = NULL;
+  swfdec_as_shape_unref (object->shape);
+  object->shape = NULL;
+}
+
+/* append a variable in a new slot, object must be using slots */
+static void
+swfdec_as_object_add_slot (SwfdecAsObject *object, const char *name, 
+    SwfdecAsVariable *var)
+{
+  SwfdecAsShape *shape;
+  guint n;
+
+  n = SWFDEC_AS_OBJECT_N_SLOTS (object);
+  shape = swfdec_as_shape_add (object->shape, name);
+  swfdec_as_shape_unref (object->shape);
+  object->shape = shape;
+  /* grow slots in powers of two */
+  if (n == 0)
+    object->slots = g_new (gpointer, 4);
+  else if (n >= 4 && (n & (n - 1)) == 0)
+    object->slots = g_renew (gpointer, object->slots, 2 * n);
+  object->slots[n] = var;
+}
+
+/*** ELEMENTS ***/
+
+/* Objects used as arrays store the variables named "0", "1", ... in a vector
+ * of elements, so they can be accessed by index without creating a string 
+ * for the name. Nonexisting elements are NULL. Like slots, the vector only 
+ * contains pointers to the variables. When a script creates an index far 
+ * away from the other elements, the object stops using elements and stores
+ * all its variables in slots or the hash table. */
+
+#define SWFDEC_AS_OBJECT_ELEMENT(object, i) ((SwfdecAsVariable *) (object)->elements[i])
+/* maximum number of holes to create when adding an element */
+#define SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP 64
+
+#define SWFDEC_AS_VARIABLE_VERSION_MASK (SWFDEC_AS_VARIABLE_VERSION_6_UP | \
+    SWFDEC_AS_VARIABLE_VERSION_NOT_6 | SWFDEC_AS_VARIABLE_VERSION_7_UP | \
+    SWFDEC_AS_VARIABLE_VERSION_8_UP | SWFDEC_AS_VARIABLE_VERSION_9_UP)
+
+/* internal flag for variables that are built on first access, the getter of
+ * such a variable is the function building the value */
+#define SWFDEC_AS_VARIABLE_LAZY (1 << 16)
+
+/* returns the index if variable is the name of an element or -1 otherwise */
+static gint32
+swfdec_as_object_variable_to_index (const char *variable)
+{
+  guint64 idx;
+
+  if (*variable < '1' || *variable > '9')
+    return (variable[0] == '0' && variable[1] == '\0') ? 0 : -1;
+
+  idx = 0;
+  do {
+    if (*variable < '0' || *variable > '9')
+      return -1;
+    idx = 10 * idx + (*variable - '0');
+    if (idx > G_MAXINT32)
+      return -1;
+    variable++;
+  } while (*variable);
+
+  return idx;
+}
+
+static guint
+swfdec_as_object_elements_allocated (guint n_elements)
+{
+  guint size;
+
+  if (n_elements == 0)
+    return 0;
+  for (size = 4; size < n_elements; size <<= 1);
+  return size;
+}
+
+static void
+swfdec_as_object_resize_elements (SwfdecAsObject *object, guint n_elements)
+{
+  guint old_size, new_size;
+
+  old_size = swfdec_as_object_elements_allocated (object->n_elements);
+  new_size = swfdec_as_object_elements_allocated (n_elements);
+  if (new_size == 0) {
+    g_free (object->elements);
+    object->elements = NULL;
+  } else if (old_size != new_size) {
+    object->elements = g_renew (gpointer, object->elements, new_size);
+  }
+  if (n_elements > object->n_elements) {
+    memset (object->elements + object->n_elements, 0, 
+	(n_elements - object->n_elements) * sizeof (gpointer));
+  }
+  object->n_elements = n_elements;
+}
+
+/* removes holes at the end of the elements */
+static void
+swfdec_as_object_trim_elements (SwfdecAsObject *object)
+{
+  guint n = object->n_elements;
+
+  while (n > 0 && object->elements[n - 1] == NULL)
+    n--;
+  swfdec_as_object_resize_elements (object, n);
+}
+
+static void
+swfdec_as_object_free_elements (SwfdecAsObject *object)
+{
+  guint i;
+
+  for (i = 0; i < object->n_elements; i++) {
+    if (object->elements[i])
+      swfdec_as_object_free_property (NULL, object->elements[i], object);
+  }
+  swfdec_as_object_resize_elements (object, 0);
+}
+
+/* creates a new element, object must be dense and idx must be close enough */
+static SwfdecAsVariable *
+swfdec_as_object_add_element (SwfdecAsObject *object, guint idx, guint flags)
+{
+  SwfdecAsVariable *var;
+
+  g_assert (idx < object->n_elements + SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP);
+
+  swfdec_as_context_use_mem (object->context, sizeof (SwfdecAsVariable));
+  var = swfdec_as_arena_alloc (object->context->arena, sizeof (SwfdecAsVariable));
+  var->flags = flags;
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  if (idx >= object->n_elements)
+    swfdec_as_object_resize_elements (object, idx + 1);
+  g_assert (object->elements[idx] == NULL);
+  object->elements[idx] = var;
+  return var;
+}
+
+/* put variable into slots or properties */
+static void
+swfdec_as_object_insert_variable (SwfdecAsObject *object, const char *variable,
+    SwfdecAsVariable *var)
+{
+  if (object->shape &&
+      SWFDEC_AS_OBJECT_N_SLOTS (object) >= SWFDEC_AS_SHAPE_MAX_SLOTS)
+    swfdec_as_object_make_dictionary (object);
+  if (object->shape) {
+    swfdec_as_object_add_slot (object, variable, var);
+  } else {
+    g_hash_table_insert (object->properties, (gpointer) variable, var);
+  }
+}
+
+/* switch object to store its elements as normal variables */
+static void
+swfdec_as_object_make_sparse (SwfdecAsObject *object)
+{
+  guint i;
+
+  if (!object->dense)
+    return;
+
+  for (i = 0; i < object->n_elements; i++) {
+    if (object->elements[i] == NULL)
+      continue;
+    swfdec_as_object_insert_variable (object, 
+	swfdec_as_integer_to_string (object->context, i), object->elements[i]);
+    object->elements[i] = NULL;
+  }
+  swfdec_as_object_resize_elements (object, 0);
+  object->dense = FALSE;
+  object->indexed = TRUE;
 }
 
 void
@@ -191,8 +417,14 @@ swfdec_as_object_free (SwfdecAsContext *context, SwfdecAsObject *object)
       klass->remove (context->debugger, context, object);
   }
 
-  g_hash_table_foreach (object->properties, swfdec_as_object_free_property, object);
-  g_hash_table_destroy (object->properties);
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  if (object->shape) {
+    swfdec_as_object_free_slots (object);
+  } else {
+    g_hash_table_foreach (object->properties, swfdec_as_object_free_property, object);
+    g_hash_table_destroy (object->properties);
+  }
+  swfdec_as_object_free_elements (object);
 
   if (object->watches) {
     g_hash_table_foreach_steal (object->watches, swfdec_as_object_steal_watches, object);
@@ -204,18 +436,23 @@ swfdec_as_object_free (SwfdecAsContext *context, SwfdecAsObject *object)
 }
 
 static void
-swfdec_as_object_mark_property (gpointer key, gpointer value, gpointer unused)
+swfdec_as_object_mark_variable (SwfdecAsVariable *var)
 {
-  SwfdecAsVariable *var = value;
-
-  swfdec_as_string_mark (key);
   if (var->get) {
     swfdec_gc_object_mark (var->get);
     if (var->set)
       swfdec_gc_object_mark (var->set);
-  } else {
-    swfdec_as_value_mark (&var->value);
   }
+  /* lazy variables keep the data for building them in their value */
+  if (var->get == NULL || (var->flags & SWFDEC_AS_VARIABLE_LAZY))
+    swfdec_as_value_mark (&var->value);
+}
+
+static void
+swfdec_as_object_mark_property (gpointer key, gpointer value, gpointer unused)
+{
+  swfdec_as_string_mark (key);
+  swfdec_as_object_mark_variable (value);
 }
 
 static void
@@ -247,7 +484,22 @@ swfdec_as_object_mark (SwfdecAsObject *object)
 
   if (object->prototype)
     swfdec_as_object_mark (object->prototype);
-  g_hash_table_foreach (object->properties, swfdec_as_object_mark_property, NULL);
+  if (object->shape) {
+    guint i;
+    swfdec_as_shape_mark (object->shape);
+    for (i = 0; i < SWFDEC_AS_OBJECT_N_SLOTS (object); i++) {
+      swfdec_as_object_mark_variable (SWFDEC_AS_OBJECT_SLOT (object, i));
+    }
+  } else {
+    g_hash_table_foreach (object->properties, swfdec_as_object_mark_property, NULL);
+  }
+  if (object->elements) {
+    guint i;
+    for (i = 0; i < object->n_elements; i++) {
+      if (object->elements[i])
+	swfdec_as_object_mark_variable (SWFDEC_AS_OBJECT_ELEMENT (object, i));
+    }
+  }
   if (object->watches)
     g_hash_table_foreach (object->watches, swfdec_as_object_mark_watch, NULL);
   if (object->relay)
@@ -267,28 +519,138 @@ swfdec_as_variable_name_is_valid (const char *name)
   return name != SWFDEC_AS_STR_EMPTY;
 }
 
+/* looks up a variable without building it, only use for looking at flags */
 static SwfdecAsVariable *
-swfdec_as_object_hash_lookup (SwfdecAsObject *object, const char *variable)
+swfdec_as_object_hash_peek (SwfdecAsObject *object, const char *variable)
 {
-  SwfdecAsVariable *var = g_hash_table_lookup (object->properties, variable);
+  SwfdecAsVariable *var;
+
+  if (object->dense) {
+    gint32 idx = swfdec_as_object_variable_to_index (variable);
+    if (idx >= 0) {
+      return (guint) idx < object->n_elements ? 
+	SWFDEC_AS_OBJECT_ELEMENT (object, idx) : NULL;
+    }
+  }
+
+  if (object->shape) {
+    SwfdecAsShape *shape;
+    int slot = swfdec_as_shape_lookup (object->shape, variable);
+
+    if (slot >= 0)
+      return SWFDEC_AS_OBJECT_SLOT (object, slot);
+    if (object->context->version >= 7)
+      return NULL;
+    for (shape = object->shape; shape->parent; shape = shape->parent) {
+      if (g_ascii_strcasecmp (shape->name, variable) == 0)
+	return SWFDEC_AS_OBJECT_SLOT (object, shape->n_slots - 1);
+    }
+    return NULL;
+  }
 
+  var = g_hash_table_lookup (object->properties, variable);
   if (var || object->context->version >= 7)
     return var;
   var = g_hash_table_find (object->properties, swfdec_as_object_lookup_case_insensitive, (gpointer) variable);
   return var;
 }
 
+/*** LAZY VARIABLES ***/
+
+/* Variables added with swfdec_as_object_add_lazy_variable() only contain a 
+ * function to compute their value. The value is built the first time the 
+ * variable is looked up, so objects that are expensive to create and are 
+ * rarely used - like most native classes - only cost memory when a script
+ * actually uses them. Looking at flags or deleting such a variable does not
+ * build it. Until then, the value of the variable holds data for the function
+ * building it. */
+
+static void
+swfdec_as_object_build_variable (SwfdecAsObject *object, 
+    SwfdecAsVariable *var)
+{
+  SwfdecAsFunction *build = var->get;
+  SwfdecAsValue data = var->value;
+  SwfdecAsValue value = SWFDEC_AS_VALUE_UNDEFINED;
+
+  g_assert (var->flags & SWFDEC_AS_VARIABLE_LAZY);
+
+  var->flags &= ~SWFDEC_AS_VARIABLE_LAZY;
+  var->get = NULL;
+  SWFDEC_AS_VALUE_SET_UNDEFINED (&var->value);
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  swfdec_as_function_call (build, object, 1, &data, &value);
+  var->value = value;
+}
+
+static gboolean
+swfdec_as_variable_is_lazy (gpointer key, gpointer value, gpointer unused)
+{
+  SwfdecAsVariable *var = value;
+
+  return var->flags & SWFDEC_AS_VARIABLE_LAZY;
+}
+
+/* builds all lazy variables of object, for code accessing the storage directly */
+static void
+swfdec_as_object_build_all_variables (SwfdecAsObject *object)
+{
+  SwfdecAsVariable *var;
+  guint i;
+
+  /* building a variable may add variables to object, so start over every time */
+  while (object->lazy) {
+    var = NULL;
+    if (object->shape) {
+      for (i = 0; i < SWFDEC_AS_OBJECT_N_SLOTS (object); i++) {
+	if (SWFDEC_AS_OBJECT_SLOT (object, i)->flags & SWFDEC_AS_VARIABLE_LAZY) {
+	  var = SWFDEC_AS_OBJECT_SLOT (object, i);
+	  break;
+	}
+      }
+    } else {
+      var = g_hash_table_find (object->properties, swfdec_as_variable_is_lazy, NULL);
+    }
+    if (var == NULL) {
+      object->lazy = FALSE;
+      break;
+    }
+    swfdec_as_object_build_variable (object, var);
+  }
+}
+
+static SwfdecAsVariable *
+swfdec_as_object_hash_lookup (SwfdecAsObject *object, const char *variable)
+{
+  SwfdecAsVariable *var;
+
+  var = swfdec_as_object_hash_peek (object, variable);
+  if (var && (var->flags & SWFDEC_AS_VARIABLE_LAZY))
+    swfdec_as_object_build_variable (object, var);
+  return var;
+}
+
 static SwfdecAsVariable *
 swfdec_as_object_hash_create (SwfdecAsObject *object, const char *variable, guint flags)
 {
   SwfdecAsVariable *var;
+  gint32 idx;
 
   if (!swfdec_as_variable_name_is_valid (variable))
     return NULL;
+  idx = swfdec_as_object_variable_to_index (variable);
+  if (idx >= 0) {
+    if (object->dense && 
+	(guint) idx < object->n_elements + SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP)
+      return swfdec_as_object_add_element (object, idx, flags);
+    swfdec_as_object_make_sparse (object);
+    object->indexed = TRUE;
+  }
   swfdec_as_context_use_mem (object->context, sizeof (SwfdecAsVariable));
-  var = g_slice_new0 (SwfdecAsVariable);
+  var = swfdec_as_arena_alloc (object->context->arena, sizeof (SwfdecAsVariable));
   var->flags = flags;
-  g_hash_table_insert (object->properties, (gpointer) variable, var);
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  swfdec_as_object_insert_variable (object, variable, var);
 
   return var;
 }
@@ -488,11 +850,25 @@ swfdec_as_object_foreach_remove (SwfdecAsObject *object, SwfdecAsVariableForeach
     gpointer data)
 {
   ForeachRemoveData fdata = { object, func, data };
+  guint i, removed;
 
   g_return_val_if_fail (object != NULL, 0);
   g_return_val_if_fail (func != NULL, 0);
 
-  return g_hash_table_foreach_remove (object->properties,
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  removed = 0;
+  for (i = 0; i < object->n_elements; i++) {
+    SwfdecAsVariable *var = SWFDEC_AS_OBJECT_ELEMENT (object, i);
+    if (var && func (object, swfdec_as_integer_to_string (object->context, i),
+	  &var->value, var->flags, data)) {
+      object->elements[i] = NULL;
+      swfdec_as_object_free_property (NULL, var, object);
+      removed++;
+    }
+  }
+  swfdec_as_object_trim_elements (object);
+  swfdec_as_object_make_dictionary (object);
+  return removed + g_hash_table_foreach_remove (object->properties,
       swfdec_as_object_hash_foreach_remove, &fdata);
 }
 
@@ -511,6 +887,8 @@ swfdec_as_object_hash_foreach_rename (gpointer key, gpointer value, gpointer dat
   const char *key_new;
 
   key_new = fdata->func (fdata->object, key, &var->value, var->flags, fdata->data);
+  if (key_new && swfdec_as_object_variable_to_index (key_new) >= 0)
+    fdata->object->indexed = TRUE;
   if (key_new) {
     g_hash_table_insert (fdata->properties_new, (gpointer) key_new, var);
   } else {
@@ -539,6 +917,9 @@ swfdec_as_object_foreach_rename (SwfdecAsObject *object, SwfdecAsVariableForeach
   g_return_if_fail (object != NULL);
   g_return_if_fail (func != NULL);
 
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  swfdec_as_object_make_sparse (object);
+  swfdec_as_object_make_dictionary (object);
   fdata.properties_new = g_hash_table_new (g_direct_hash, g_direct_equal);
   g_hash_table_foreach_remove (object->properties, swfdec_as_object_hash_foreach_rename, &fdata);
   g_hash_table_destroy (object->properties);
@@ -588,7 +969,7 @@ swfdec_as_object_new (SwfdecAsContext *context, ...)
   
   object = swfdec_as_gcable_new (context, SwfdecAsObject);
   object->context = context;
-  object->properties = g_hash_table_new (g_direct_hash, g_direct_equal);
+  object->shape = swfdec_as_shape_ref (context->empty_shape);
   SWFDEC_AS_GCABLE_SET_NEXT ((SwfdecAsGcable *) object, context->objects);
   context->objects = object;
   if (context->debugger) {
@@ -695,6 +1076,7 @@ swfdec_as_object_set_variable_and_flags (SwfdecAsObject *object,
   } else {
     if (var->flags & SWFDEC_AS_VARIABLE_CONSTANT)
       return;
+    SWFDEC_AS_OBJECT_CHANGED (object);
     // remove the flags that could make this variable hidden
     if (context->version == 6) {
       // version 6, so let's forget SWFDEC_AS_VARIABLE_VERSION_7_UP flag, oops!
@@ -759,8 +1141,10 @@ swfdec_as_object_set_variable_and_flags (SwfdecAsObject *object,
   }
 
   if (variable == SWFDEC_AS_STR___proto__) {
+    SWFDEC_AS_OBJECT_CHANGED (object);
     if (SWFDEC_AS_VALUE_IS_OBJECT (*value)) {
       object->prototype = SWFDEC_AS_VALUE_GET_OBJECT (*value);
+      object->prototype->inherited = TRUE;
       object->prototype_flags = var->flags;
     } else {
       object->prototype = NULL;
@@ -989,7 +1373,7 @@ swfdec_as_object_has_variable (SwfdecAsObject *object, const char *variable)
   g_return_val_if_fail (object != NULL, FALSE);
   
   for (i = 0; i <= SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT && object != NULL; i++) {
-    var = swfdec_as_object_hash_lookup (object, variable);
+    var = swfdec_as_object_hash_peek (object, variable);
     if (var) {
       /* FIXME: propflags? */
       return object;
@@ -1017,6 +1401,46 @@ swfdec_as_object_delete_variable (SwfdecAsObject *object, const char *variable)
   g_return_val_if_fail (object != NULL, FALSE);
   g_return_val_if_fail (variable != NULL, FALSE);
 
+  if (object->dense) {
+    gint32 idx = swfdec_as_object_variable_to_index (variable);
+    if (idx >= 0) {
+      if ((guint) idx >= object->n_elements ||
+	  (var = SWFDEC_AS_OBJECT_ELEMENT (object, idx)) == NULL)
+	return SWFDEC_AS_DELETE_NOT_FOUND;
+      if (var->flags & SWFDEC_AS_VARIABLE_PERMANENT)
+	return SWFDEC_AS_DELETE_NOT_DELETED;
+      SWFDEC_AS_OBJECT_CHANGED (object);
+      object->elements[idx] = NULL;
+      swfdec_as_object_free_property (NULL, var, object);
+      swfdec_as_object_trim_elements (object);
+      return SWFDEC_AS_DELETE_DELETED;
+    }
+  }
+
+  if (object->shape) {
+    SwfdecAsShape *shape = object->shape;
+    int slot = swfdec_as_shape_lookup (shape, variable);
+    if (slot < 0)
+      return SWFDEC_AS_DELETE_NOT_FOUND;
+    var = SWFDEC_AS_OBJECT_SLOT (object, slot);
+    if (var->flags & SWFDEC_AS_VARIABLE_PERMANENT)
+      return SWFDEC_AS_DELETE_NOT_DELETED;
+    SWFDEC_AS_OBJECT_CHANGED (object);
+    if ((guint) slot + 1 == shape->n_slots) {
+      /* removing the last variable just goes back to the previous shape */
+      object->shape = swfdec_as_shape_ref (shape->parent);
+      swfdec_as_shape_unref (shape);
+      swfdec_as_object_free_property (NULL, var, object);
+      /* swfdec_as_object_add_slot() allocates new slots for empty shapes */
+      if (SWFDEC_AS_OBJECT_N_SLOTS (object) == 0) {
+	g_free (object->slots);
+	object->slots = NULL;
+      }
+      return SWFDEC_AS_DELETE_DELETED;
+    }
+    swfdec_as_object_make_dictionary (object);
+  }
+
   var = g_hash_table_lookup (object->properties, variable);
   if (var == NULL)
     return SWFDEC_AS_DELETE_NOT_FOUND;
@@ -1025,6 +1449,7 @@ swfdec_as_object_delete_variable (SwfdecAsObject *object, const char *variable)
 
   // Note: We won't remove object->prototype, even if __proto__ is deleted
 
+  SWFDEC_AS_OBJECT_CHANGED (object);
   swfdec_as_object_free_property (NULL, var, object);
   if (!g_hash_table_remove (object->properties, variable)) {
     g_assert_not_reached ();
@@ -1043,8 +1468,16 @@ swfdec_as_object_delete_all_variables (SwfdecAsObject *object)
 {
   g_return_if_fail (object != NULL);
 
-  g_hash_table_foreach (object->properties, swfdec_as_object_free_property, object);
-  g_hash_table_remove_all (object->properties);
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  if (object->shape) {
+    swfdec_as_object_free_slots (object);
+  } else {
+    g_hash_table_foreach (object->properties, swfdec_as_object_free_property, object);
+    g_hash_table_destroy (object->properties);
+    object->properties = NULL;
+  }
+  swfdec_as_object_free_elements (object);
+  object->shape = swfdec_as_shape_ref (object->context->empty_shape);
 }
 
 /**
@@ -1064,11 +1497,12 @@ swfdec_as_object_set_variable_flags (SwfdecAsObject *object,
   g_return_if_fail (object != NULL);
   g_return_if_fail (variable != NULL);
 
-  var = swfdec_as_object_hash_lookup (object, variable);
+  var = swfdec_as_object_hash_peek (object, variable);
   if (var == NULL)
     return;
 
-  var->flags |= flags;
+  var->flags |= flags & ~SWFDEC_AS_VARIABLE_LAZY;
+  SWFDEC_AS_OBJECT_CHANGED (object);
 
   if (variable == SWFDEC_AS_STR___proto__)
     object->prototype_flags = var->flags;
@@ -1093,11 +1527,12 @@ swfdec_as_object_unset_variable_flags (SwfdecAsObject *object,
   g_return_if_fail (object != NULL);
   g_return_if_fail (variable != NULL);
 
-  var = swfdec_as_object_hash_lookup (object, variable);
+  var = swfdec_as_object_hash_peek (object, variable);
   if (var == NULL)
     return;
 
-  var->flags &= ~flags;
+  var->flags &= ~(flags & ~SWFDEC_AS_VARIABLE_LAZY);
+  SWFDEC_AS_OBJECT_CHANGED (object);
 
   if (variable == SWFDEC_AS_STR___proto__)
     object->prototype_flags = var->flags;
@@ -1117,6 +1552,29 @@ swfdec_as_object_unset_variable_flags (SwfdecAsObject *object,
 gboolean
 swfdec_as_object_foreach (SwfdecAsObject *object, SwfdecAsVariableForeach func,
     gpointer data)
+{
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (func != NULL, FALSE);
+
+  swfdec_as_object_build_all_variables (object);
+  return swfdec_as_object_foreach_flags (object, func, data);
+}
+
+/**
+ * swfdec_as_object_foreach_flags:
+ * @object: a #SwfdecAsObject
+ * @func: function to call
+ * @data: data to pass to @func
+ *
+ * Like swfdec_as_object_foreach(), but does not build variables added with
+ * swfdec_as_object_add_lazy_variable(). So @func must only look at the names
+ * and flags it gets passed, not at the values.
+ *
+ * Returns: %TRUE if @func always returned %TRUE
+ **/
+gboolean
+swfdec_as_object_foreach_flags (SwfdecAsObject *object, 
+    SwfdecAsVariableForeach func, gpointer data)
 {
   ForeachData fdata = { object, func, data, TRUE };
 
@@ -1124,9 +1582,29 @@ swfdec_as_object_foreach (SwfdecAsObject *object, SwfdecAsVariableForeach func,
   g_return_val_if_fail (func != NULL, FALSE);
 
   /* FIXME: does not do Adobe Flash's order for Enumerate actions */
-  g_hash_table_foreach (object->properties, swfdec_as_object_hash_foreach, &fdata);
-  if (!fdata.retval)
-    return FALSE;
+  if (object->n_elements > 0) {
+    guint i;
+    SwfdecAsVariable *var;
+    for (i = object->n_elements; i > 0; i--) {
+      var = SWFDEC_AS_OBJECT_ELEMENT (object, i - 1);
+      if (var && !func (object, swfdec_as_integer_to_string (object->context, i - 1), 
+	    &var->value, var->flags, data))
+	return FALSE;
+    }
+  }
+  if (object->shape) {
+    SwfdecAsShape *shape;
+    SwfdecAsVariable *var;
+    for (shape = object->shape; shape->parent; shape = shape->parent) {
+      var = SWFDEC_AS_OBJECT_SLOT (object, shape->n_slots - 1);
+      if (!func (object, shape->name, &var->value, var->flags, data))
+	return FALSE;
+    }
+  } else {
+    g_hash_table_foreach (object->properties, swfdec_as_object_hash_foreach, &fdata);
+    if (!fdata.retval)
+      return FALSE;
+  }
 
   if (object->movie) {
     SwfdecMovie *movie = SWFDEC_MOVIE (object->relay);
@@ -1146,69 +1624,792 @@ swfdec_as_object_foreach (SwfdecAsObject *object, SwfdecAsVariableForeach func,
   return TRUE;
 }
 
-/*** SIMPLIFICATIONS ***/
+/*** CLONING ***/
 
-static gboolean
-swfdec_as_object_enumerate_foreach (SwfdecAsObject *object, const char *variable,
-    SwfdecAsValue *value, guint flags, gpointer listp)
+static void
+swfdec_as_object_clone_variable (SwfdecAsVariable *dest, 
+    SwfdecAsVariable *source, SwfdecAsCloner *cloner)
 {
-  GSList **list = listp;
+  if (source->get) {
+    dest->get = swfdec_as_cloner_map_relay (cloner, source->get);
+    dest->set = swfdec_as_cloner_map_relay (cloner, source->set);
+  }
+  if (source->get == NULL || (source->flags & SWFDEC_AS_VARIABLE_LAZY))
+    dest->value = swfdec_as_cloner_map_value (cloner, source->value);
+}
 
-  if (flags & SWFDEC_AS_VARIABLE_HIDDEN)
-    return TRUE;
+static void
+swfdec_as_object_clone_property (SwfdecAsObject *dest, const char *name,
+    SwfdecAsVariable *source, SwfdecAsCloner *cloner)
+{
+  SwfdecAsVariable *var;
 
-  *list = g_slist_remove (*list, variable);
-  *list = g_slist_prepend (*list, (gpointer) variable);
-  return TRUE;
+  var = swfdec_as_object_hash_create (dest, name, source->flags);
+  g_assert (var != NULL);
+  swfdec_as_object_clone_variable (var, source, cloner);
 }
 
 /**
- * swfdec_as_object_enumerate:
- * @object: the object to enumerate
+ * swfdec_as_object_clone_variables:
+ * @dest: a newly created object without variables
+ * @source: the object to copy the variables from
+ * @cloner: the #SwfdecAsCloner to map referenced objects with
  *
- * Enumerates all non-hidden properties of a given object and its prototypes
- * and returns their names as garbage-collected strings in a list. This 
- * function is a special case of swfdec_as_object_foreach().
+ * Copies all variables, the prototype and the interfaces of @source into 
+ * @dest. The variables are created in the same order, so enumerating both
+ * objects gives the same result. Referenced objects are replaced by their 
+ * copies.
  *
- * Returns: a GSList of all properties of the object. You need to 
- *          g_slist_free() the list after use.
+ * Returns: %FALSE if @source contains things that cannot be copied, like 
+ *          watches.
  **/
-GSList *
-swfdec_as_object_enumerate (SwfdecAsObject *object)
+gboolean
+swfdec_as_object_clone_variables (SwfdecAsObject *dest, SwfdecAsObject *source,
+    SwfdecAsCloner *cloner)
 {
+  GSList *walk;
   guint i;
-  GSList *list = NULL;
-  
-  for (i = 0; i < SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT && object; i++) {
-    swfdec_as_object_foreach (object, swfdec_as_object_enumerate_foreach, &list);
-    object = swfdec_as_object_get_prototype (object);
+
+  g_return_val_if_fail (dest != NULL, FALSE);
+  g_return_val_if_fail (source != NULL, FALSE);
+  g_return_val_if_fail (cloner != NULL, FALSE);
+
+  if (source->watches || source->movie || source->super)
+    return FALSE;
+
+  dest->array = source->array;
+  dest->dense = source->dense;
+  dest->indexed = source->indexed;
+  dest->lazy = source->lazy;
+
+  if (source->shape) {
+    SwfdecAsShape *shape;
+    const char **names;
+    guint n = SWFDEC_AS_OBJECT_N_SLOTS (source);
+
+    names = g_new (const char *, n);
+    for (shape = source->shape; shape->parent; shape = shape->parent)
+      names[shape->n_slots - 1] = shape->name;
+    for (i = 0; i < n; i++) {
+      swfdec_as_object_clone_property (dest, names[i],
+	  SWFDEC_AS_OBJECT_SLOT (source, i), cloner);
+    }
+    g_free (names);
+  } else {
+    GHashTableIter iter;
+    gpointer name, var;
+
+    g_hash_table_iter_init (&iter, source->properties);
+    while (g_hash_table_iter_next (&iter, &name, &var)) {
+      swfdec_as_object_clone_property (dest, name, var, cloner);
+    }
   }
-  if (i == 256) {
-    swfdec_as_context_abort (object->context, "Prototype recursion limit exceeded");
-    g_slist_free (list);
-    return NULL;
+
+  /* elements may be further apart than adding them one by one allows */
+  swfdec_as_object_resize_elements (dest, source->n_elements);
+  for (i = 0; i < source->n_elements; i++) {
+    SwfdecAsVariable *var = SWFDEC_AS_OBJECT_ELEMENT (source, i);
+    if (var == NULL)
+      continue;
+    swfdec_as_object_clone_variable (
+	swfdec_as_object_add_element (dest, i, var->flags), var, cloner);
   }
-#if 0
-  list = g_slist_reverse (list);
-#else 
-  /* we force an alphabetical order into the list for now. This is wrong, 
-   * but at least ensures reproducability */
-  list = g_slist_sort (list, (GCompareFunc) strcmp);
-#endif
-  return list;
-}
 
-static void
-swfdec_as_object_do_nothing (SwfdecAsContext *cx, SwfdecAsObject *object,
-    guint argc, SwfdecAsValue *argv, SwfdecAsValue *retval)
-{
+  if (source->prototype)
+    dest->prototype = swfdec_as_cloner_map_object (cloner, source->prototype);
+  dest->prototype_flags = source->prototype_flags;
+  dest->inherited = source->inherited;
+  for (walk = source->interfaces; walk; walk = walk->next) {
+    dest->interfaces = g_slist_prepend (dest->interfaces, 
+	swfdec_as_cloner_map_object (cloner, walk->data));
+  }
+  dest->interfaces = g_slist_reverse (dest->interfaces);
+
+  return TRUE;
 }
 
+/*** ELEMENT ACCESS ***/
+
 /**
- * swfdec_as_object_add_function:
+ * swfdec_as_object_use_elements:
  * @object: a #SwfdecAsObject
- * @name: name of the function. The string does not have to be 
- *        garbage-collected.
+ *
+ * Makes @object store variables with index names in a vector of elements, 
+ * so they can be accessed using the swfdec_as_object_*_element() functions.
+ * This should be used for arrays. If @object already contains index 
+ * variables, nothing happens.
+ **/
+void
+swfdec_as_object_use_elements (SwfdecAsObject *object)
+{
+  g_return_if_fail (object != NULL);
+
+  if (object->dense || object->indexed || object->movie || object->super)
+    return;
+
+  object->dense = TRUE;
+}
+
+/**
+ * swfdec_as_object_peek_element:
+ * @object: a #SwfdecAsObject
+ * @idx: index of the element
+ *
+ * The element version of swfdec_as_object_peek_variable(). The same warnings
+ * apply.
+ *
+ * Returns: a pointer to the value of the element or %NULL if @object doesn't 
+ *          use elements or the element doesn't exist
+ **/
+SwfdecAsValue *
+swfdec_as_object_peek_element (SwfdecAsObject *object, gint32 idx)
+{
+  SwfdecAsVariable *var;
+
+  g_return_val_if_fail (object != NULL, NULL);
+
+  if (!object->dense || idx < 0 || (guint) idx >= object->n_elements)
+    return NULL;
+  var = SWFDEC_AS_OBJECT_ELEMENT (object, idx);
+  return var ? &var->value : NULL;
+}
+
+/**
+ * swfdec_as_object_get_element:
+ * @object: a #SwfdecAsObject
+ * @idx: index of the element
+ * @value: the value to set
+ *
+ * Gets the element @idx of @object if it exists in @object itself. This 
+ * behaves like swfdec_as_object_get_variable() with the index converted to a
+ * string, but doesn't look at prototypes.
+ *
+ * Returns: %TRUE if @value was set, %FALSE if the caller needs to use 
+ *          swfdec_as_object_get_variable()
+ **/
+gboolean
+swfdec_as_object_get_element (SwfdecAsObject *object, gint32 idx, 
+    SwfdecAsValue *value)
+{
+  SwfdecAsVariable *var;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (value != NULL, FALSE);
+
+  if (!object->dense || idx < 0 || (guint) idx >= object->n_elements)
+    return FALSE;
+  var = SWFDEC_AS_OBJECT_ELEMENT (object, idx);
+  if (var == NULL ||
+      !swfdec_as_object_variable_enabled_in_version (var, object->context->version))
+    return FALSE;
+
+  if (var->get) {
+    swfdec_as_function_call (var->get, object, 0, NULL, value);
+  } else {
+    *value = var->value;
+  }
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_set_element:
+ * @object: a #SwfdecAsObject
+ * @idx: index of the element
+ * @value: value to set the element to
+ * @default_flags: flags to use if creating the element
+ *
+ * Sets the element @idx of @object. This behaves like 
+ * swfdec_as_object_set_variable_and_flags() with the index converted to a 
+ * string, but only handles the common cases.
+ *
+ * Returns: %TRUE if the element was set, %FALSE if the caller needs to use
+ *          swfdec_as_object_set_variable_and_flags()
+ **/
+gboolean
+swfdec_as_object_set_element (SwfdecAsObject *object, gint32 idx,
+    const SwfdecAsValue *value, guint default_flags)
+{
+  SwfdecAsContext *context;
+  SwfdecAsVariable *var;
+  SwfdecAsObject *proto;
+  guint i;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (value != NULL, FALSE);
+
+  context = object->context;
+  if (!object->dense || idx < 0 || object->watches || context->debugger ||
+      swfdec_as_context_is_aborted (context))
+    return FALSE;
+
+  if ((guint) idx < object->n_elements && 
+      (var = SWFDEC_AS_OBJECT_ELEMENT (object, idx)) != NULL) {
+    if (var->get ||
+	(var->flags & (SWFDEC_AS_VARIABLE_CONSTANT | SWFDEC_AS_VARIABLE_VERSION_MASK)))
+      return FALSE;
+  } else {
+    if ((guint) idx >= object->n_elements + SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP)
+      return FALSE;
+    /* a getter in the prototypes would have its setter called */
+    proto = swfdec_as_object_get_prototype (object);
+    for (i = 0; proto != NULL; i++) {
+      if (i == SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT || proto->indexed)
+	return FALSE;
+      if (proto->dense && (guint) idx < proto->n_elements &&
+	  proto->elements[idx] != NULL &&
+	  SWFDEC_AS_OBJECT_ELEMENT (proto, idx)->get != NULL)
+	return FALSE;
+      proto = swfdec_as_object_get_prototype (proto);
+    }
+    var = swfdec_as_object_add_element (object, idx, default_flags);
+  }
+  var->value = *value;
+
+  /* same as in swfdec_as_object_set_variable_and_flags() */
+  if (object->array) {
+    SwfdecAsValue tmp;
+    gint32 length;
+    swfdec_as_object_get_variable (object, SWFDEC_AS_STR_length, &tmp);
+    length = swfdec_as_value_to_integer (context, tmp);
+    if (idx >= length) {
+      object->array = FALSE;
+      tmp = swfdec_as_value_from_integer (context, idx + 1);
+      swfdec_as_object_set_variable_and_flags (object, SWFDEC_AS_STR_length, &tmp,
+	  SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+      object->array = TRUE;
+    }
+  }
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_remove_elements:
+ * @object: a #SwfdecAsObject
+ * @start: first index to remove
+ * @num: number of indexes to remove
+ *
+ * Removes all elements from @start to @start + @num - 1 that aren't 
+ * permanent.
+ *
+ * Returns: %TRUE if the elements were removed, %FALSE if @object doesn't use
+ *          elements
+ **/
+gboolean
+swfdec_as_object_remove_elements (SwfdecAsObject *object, gint32 start,
+    gint32 num)
+{
+  SwfdecAsVariable *var;
+  guint i, end;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (start >= 0, FALSE);
+  g_return_val_if_fail (num >= 0, FALSE);
+
+  if (!object->dense)
+    return FALSE;
+
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  end = MIN ((guint) start + num, object->n_elements);
+  for (i = start; i < end; i++) {
+    var = SWFDEC_AS_OBJECT_ELEMENT (object, i);
+    if (var == NULL || (var->flags & SWFDEC_AS_VARIABLE_PERMANENT))
+      continue;
+    object->elements[i] = NULL;
+    swfdec_as_object_free_property (NULL, var, object);
+  }
+  swfdec_as_object_trim_elements (object);
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_move_elements:
+ * @object: a #SwfdecAsObject
+ * @from: first index to move
+ * @num: number of indexes to move
+ * @to: index to move the first element to
+ *
+ * Moves the elements from @from to @from + @num - 1 so that they start at 
+ * @to. Elements at the destination that aren't moved themselves are removed.
+ *
+ * Returns: %TRUE if the elements were moved, %FALSE if the caller needs to 
+ *          rename the variables
+ **/
+gboolean
+swfdec_as_object_move_elements (SwfdecAsObject *object, gint32 from,
+    gint32 num, gint32 to)
+{
+  guint i, n, count;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (from >= 0, FALSE);
+  g_return_val_if_fail (num >= 0, FALSE);
+  g_return_val_if_fail (to >= 0, FALSE);
+
+  if (!object->dense)
+    return FALSE;
+
+  n = object->n_elements;
+  count = (guint) from < n ? MIN ((guint) num, n - from) : 0;
+  if (to + count > n + SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP) {
+    swfdec_as_object_make_sparse (object);
+    return FALSE;
+  }
+
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  /* remove elements that get overwritten */
+  for (i = to; i < MIN ((guint) to + num, n); i++) {
+    if (i >= (guint) from && i < (guint) from + num)
+      continue;
+    if (object->elements[i]) {
+      swfdec_as_object_free_property (NULL, object->elements[i], object);
+      object->elements[i] = NULL;
+    }
+  }
+  if (to + count > n)
+    swfdec_as_object_resize_elements (object, to + count);
+  memmove (object->elements + to, object->elements + from, 
+      count * sizeof (gpointer));
+  /* clear the moved away elements that weren't overwritten */
+  if ((guint) to > (guint) from) {
+    memset (object->elements + from, 0, 
+	(MIN (from + count, (guint) to) - from) * sizeof (gpointer));
+  } else {
+    i = MAX ((guint) from, to + count);
+    if (i < from + count)
+      memset (object->elements + i, 0, (from + count - i) * sizeof (gpointer));
+  }
+  swfdec_as_object_trim_elements (object);
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_reverse_elements:
+ * @object: a #SwfdecAsObject
+ * @length: number of elements to reverse
+ *
+ * Reverses the order of the elements from 0 to @length - 1.
+ *
+ * Returns: %TRUE if the elements were reversed, %FALSE if the caller needs to
+ *          rename the variables
+ **/
+gboolean
+swfdec_as_object_reverse_elements (SwfdecAsObject *object, gint32 length)
+{
+  gpointer tmp;
+  guint i;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+
+  if (!object->dense || length <= 0)
+    return object->dense;
+  if ((guint) length > object->n_elements + SWFDEC_AS_OBJECT_MAX_ELEMENT_GAP) {
+    swfdec_as_object_make_sparse (object);
+    return FALSE;
+  }
+
+  SWFDEC_AS_OBJECT_CHANGED (object);
+  if ((guint) length > object->n_elements)
+    swfdec_as_object_resize_elements (object, length);
+  for (i = 0; i < (guint) length / 2; i++) {
+    tmp = object->elements[i];
+    object->elements[i] = object->elements[length - 1 - i];
+    object->elements[length - 1 - i] = tmp;
+  }
+  swfdec_as_object_trim_elements (object);
+  return TRUE;
+}
+
+/*** PROPERTY CACHES ***/
+
+/* Property caches remember where a variable was found the last time an 
+ * action looked it up, so the next lookup can skip the hash or shape search
+ * and the prototype walk. Entries are keyed on the receiver's shape id. 
+ * Prototype entries are additionally validated against the receiver's 
+ * prototype and the context's prototype epoch, which changes whenever an 
+ * object used as a prototype changes. The variable itself is always checked
+ * again on a hit, so changed flags or getters are honored. 
+ * Lookups that failed are remembered the same way, so walking the scope chain
+ * can skip objects that are known to not contain a variable. As movies also 
+ * resolve the names of their children, those entries are validated against 
+ * the context's movie epoch, too. Movies with the same shape can have 
+ * different children, so these entries only apply to the movie they were 
+ * created for. */
+
+#define SWFDEC_AS_PROPERTY_CACHE_SIZE 4
+/* slot of entries remembering that the variable doesn't exist */
+#define SWFDEC_AS_PROPERTY_CACHE_MISSING (-2)
+
+typedef struct {
+  const char *		name;		/* name of the variable or NULL if unused */
+  gsize			shape_id;	/* id of the receiver's shape */
+  guint			version;	/* version the lookup happened in */
+  int			slot;		/* slot of the variable in the receiver or -1 */
+  /* only used if the variable was found in a prototype */
+  SwfdecAsObject *	prototype;	/* prototype of the receiver */
+  guint			prototype_flags;/* prototype flags of the receiver */
+  guint			epoch;		/* prototype epoch of the context */
+  guint			movie_epoch;	/* movie epoch of the context for missing variables */
+  SwfdecAsObject *	movie;		/* receiver of missing variables if it is a movie */
+  SwfdecAsVariable *	var;		/* the variable that was found */
+} SwfdecAsPropertyCacheEntry;
+
+struct _SwfdecAsPropertyCache {
+  SwfdecAsPropertyCacheEntry	entries[SWFDEC_AS_PROPERTY_CACHE_SIZE];
+  guint				next;		/* entry to replace next */
+};
+
+SwfdecAsPropertyCache *
+swfdec_as_property_cache_new (void)
+{
+  return g_slice_new0 (SwfdecAsPropertyCache);
+}
+
+void
+swfdec_as_property_cache_free (SwfdecAsPropertyCache *cache)
+{
+  g_return_if_fail (cache != NULL);
+
+  g_slice_free (SwfdecAsPropertyCache, cache);
+}
+
+static SwfdecAsPropertyCacheEntry *
+swfdec_as_property_cache_find (SwfdecAsPropertyCache *cache, 
+    SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsShape *shape = object->shape;
+  SwfdecAsPropertyCacheEntry *entry;
+  guint i;
+
+  if (shape == NULL || object->super)
+    return NULL;
+  /* elements aren't described by the shape */
+  if (object->dense && swfdec_as_object_variable_to_index (name) >= 0)
+    return NULL;
+
+  for (i = 0; i < SWFDEC_AS_PROPERTY_CACHE_SIZE; i++) {
+    entry = &cache->entries[i];
+    if (entry->name == name && entry->shape_id == shape->id &&
+	entry->version == object->context->version)
+      return entry;
+  }
+  return NULL;
+}
+
+/**
+ * swfdec_as_property_cache_get:
+ * @cache: a property cache
+ * @object: the object to get the variable from
+ * @name: garbage-collected name of the variable
+ * @value: the value to set
+ *
+ * Tries to get the variable @name from @object using the cache. If the cache
+ * cannot answer the query, nothing happens and %FALSE is returned. In that 
+ * case, the caller needs to use swfdec_as_object_get_variable().
+ *
+ * Returns: %TRUE if the cache contained the variable and @value was set
+ **/
+gboolean
+swfdec_as_property_cache_get (SwfdecAsPropertyCache *cache, 
+    SwfdecAsObject *object, const char *name, SwfdecAsValue *value)
+{
+  SwfdecAsPropertyCacheEntry *entry;
+  SwfdecAsVariable *var;
+
+  entry = swfdec_as_property_cache_find (cache, object, name);
+  if (entry == NULL || entry->slot == SWFDEC_AS_PROPERTY_CACHE_MISSING)
+    return FALSE;
+
+  if (entry->slot >= 0) {
+    var = SWFDEC_AS_OBJECT_SLOT (object, entry->slot);
+  } else {
+    if (entry->prototype != object->prototype ||
+	entry->prototype_flags != object->prototype_flags ||
+	entry->epoch != object->context->prototype_epoch)
+      return FALSE;
+    var = entry->var;
+  }
+  if (!swfdec_as_object_variable_enabled_in_version (var, entry->version) ||
+      (var->flags & SWFDEC_AS_VARIABLE_LAZY))
+    return FALSE;
+
+  if (var->get) {
+    swfdec_as_function_call (var->get, object, 0, NULL, value);
+  } else {
+    *value = var->value;
+  }
+  return TRUE;
+}
+
+/**
+ * swfdec_as_property_cache_set:
+ * @cache: a property cache
+ * @object: the object to set the variable on
+ * @name: garbage-collected name of the variable
+ * @value: the value to set
+ *
+ * Tries to set the variable @name on @object using the cache. This only 
+ * succeeds for plain variables that exist on @object already and don't need
+ * any of the special handling done by swfdec_as_object_set_variable().
+ *
+ * Returns: %TRUE if the variable was set, %FALSE if the caller needs to use 
+ *          swfdec_as_object_set_variable()
+ **/
+gboolean
+swfdec_as_property_cache_set (SwfdecAsPropertyCache *cache,
+    SwfdecAsObject *object, const char *name, const SwfdecAsValue *value)
+{
+  SwfdecAsPropertyCacheEntry *entry;
+  SwfdecAsContext *context;
+  SwfdecAsVariable *var;
+
+  context = object->context;
+  if (object->movie || object->array || object->watches || 
+      context->debugger || name == SWFDEC_AS_STR___proto__ ||
+      swfdec_as_context_is_aborted (context))
+    return FALSE;
+
+  entry = swfdec_as_property_cache_find (cache, object, name);
+  if (entry == NULL || entry->slot < 0)
+    return FALSE;
+
+  var = SWFDEC_AS_OBJECT_SLOT (object, entry->slot);
+  if (var->get || 
+      (var->flags & (SWFDEC_AS_VARIABLE_CONSTANT | SWFDEC_AS_VARIABLE_VERSION_MASK | 
+		     SWFDEC_AS_VARIABLE_LAZY)))
+    return FALSE;
+
+  var->value = *value;
+  return TRUE;
+}
+
+/**
+ * swfdec_as_property_cache_add:
+ * @cache: a property cache
+ * @object: the object the variable was looked up on
+ * @name: garbage-collected name of the variable
+ *
+ * Remembers the location of the variable @name for lookups on @object. This 
+ * is supposed to be called after a regular lookup of the variable succeeded.
+ * Objects and variables that need special treatment are not cached.
+ **/
+void
+swfdec_as_property_cache_add (SwfdecAsPropertyCache *cache,
+    SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsPropertyCacheEntry *entry;
+  SwfdecAsContext *context;
+  SwfdecAsVariable *var;
+  SwfdecAsObject *cur;
+  SwfdecAsShape *shape;
+  int slot;
+  guint i;
+
+  g_return_if_fail (cache != NULL);
+  g_return_if_fail (object != NULL);
+  g_return_if_fail (name != NULL);
+
+  shape = object->shape;
+  if (shape == NULL || object->super ||
+      (object->dense && swfdec_as_object_variable_to_index (name) >= 0))
+    return;
+  context = object->context;
+
+  entry = swfdec_as_property_cache_find (cache, object, name);
+  if (entry == NULL) {
+    entry = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % SWFDEC_AS_PROPERTY_CACHE_SIZE;
+  }
+
+  entry->name = NULL;
+  slot = swfdec_as_shape_lookup (shape, name);
+  if (slot >= 0) {
+    entry->slot = slot;
+    entry->var = NULL;
+    entry->prototype = NULL;
+  } else {
+    /* don't cache case-insensitive matches, movies or hidden variables */
+    if (swfdec_as_object_hash_peek (object, name) || object->movie)
+      return;
+    cur = swfdec_as_object_get_prototype_internal (object);
+    var = NULL;
+    for (i = 0; i < SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT && cur != NULL; i++) {
+      if (cur->movie || cur->super)
+	return;
+      var = swfdec_as_object_hash_lookup (cur, name);
+      if (var != NULL &&
+	  swfdec_as_object_variable_enabled_in_version (var, context->version))
+	break;
+      var = NULL;
+      cur = swfdec_as_object_get_prototype_internal (cur);
+    }
+    if (var == NULL)
+      return;
+    entry->slot = -1;
+    entry->var = var;
+    entry->prototype = object->prototype;
+    entry->prototype_flags = object->prototype_flags;
+    entry->epoch = context->prototype_epoch;
+  }
+  entry->name = name;
+  entry->shape_id = shape->id;
+  entry->version = context->version;
+}
+
+/**
+ * swfdec_as_property_cache_lacks:
+ * @cache: a property cache
+ * @object: the object to look up the variable on
+ * @name: garbage-collected name of the variable
+ *
+ * Checks if the cache knows that looking up @name on @object fails.
+ *
+ * Returns: %TRUE if @object and its prototypes do not contain @name, %FALSE
+ *          if the caller needs to use swfdec_as_object_get_variable()
+ **/
+gboolean
+swfdec_as_property_cache_lacks (SwfdecAsPropertyCache *cache, 
+    SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsPropertyCacheEntry *entry;
+  SwfdecAsContext *context;
+
+  entry = swfdec_as_property_cache_find (cache, object, name);
+  if (entry == NULL || entry->slot != SWFDEC_AS_PROPERTY_CACHE_MISSING)
+    return FALSE;
+
+  context = object->context;
+  return (entry->movie == NULL || entry->movie == object) &&
+      entry->prototype == object->prototype &&
+      entry->prototype_flags == object->prototype_flags &&
+      entry->epoch == context->prototype_epoch &&
+      entry->movie_epoch == context->movie_epoch;
+}
+
+/**
+ * swfdec_as_property_cache_add_missing:
+ * @cache: a property cache
+ * @object: the object the variable was looked up on
+ * @name: garbage-collected name of the variable
+ *
+ * Remembers that @object and its prototypes do not contain the variable 
+ * @name. This is supposed to be called after a regular lookup of the variable
+ * failed. Objects that need special treatment are not cached. If @object is a
+ * movie, the entry only applies to @object itself, as the children of a movie
+ * are not part of its shape. Creating a movie changes the movie epoch, so the
+ * entry cannot match a new movie that reuses the memory of @object.
+ **/
+void
+swfdec_as_property_cache_add_missing (SwfdecAsPropertyCache *cache,
+    SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsPropertyCacheEntry *entry;
+  SwfdecAsContext *context;
+  SwfdecAsObject *cur;
+  guint i;
+
+  g_return_if_fail (cache != NULL);
+  g_return_if_fail (object != NULL);
+  g_return_if_fail (name != NULL);
+
+  context = object->context;
+  if (object->dense && swfdec_as_object_variable_to_index (name) >= 0)
+    return;
+  /* movies resolve some names without looking at their variables */
+  if (object->movie && (name == SWFDEC_AS_STR__global ||
+	swfdec_strncmp (context->version, name, "_level", 6) == 0))
+    return;
+  /* the failed lookup must only depend on shapes, so don't cache hash tables,
+   * prototype movies or __resolve */
+  cur = object;
+  for (i = 0; i < SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT && cur != NULL; i++) {
+    if (cur->shape == NULL || cur->super || (cur->movie && cur != object) ||
+	swfdec_as_object_hash_peek (cur, SWFDEC_AS_STR___resolve))
+      return;
+    cur = swfdec_as_object_get_prototype_internal (cur);
+  }
+  if (cur != NULL)
+    return;
+
+  entry = swfdec_as_property_cache_find (cache, object, name);
+  if (entry == NULL) {
+    entry = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % SWFDEC_AS_PROPERTY_CACHE_SIZE;
+  }
+  entry->name = name;
+  entry->shape_id = ((SwfdecAsShape *) object->shape)->id;
+  entry->version = context->version;
+  entry->slot = SWFDEC_AS_PROPERTY_CACHE_MISSING;
+  entry->var = NULL;
+  entry->prototype = object->prototype;
+  entry->prototype_flags = object->prototype_flags;
+  entry->epoch = context->prototype_epoch;
+  entry->movie_epoch = context->movie_epoch;
+  entry->movie = object->movie ? object : NULL;
+}
+
+/*** SIMPLIFICATIONS ***/
+
+static gboolean
+swfdec_as_object_enumerate_foreach (SwfdecAsObject *object, const char *variable,
+    SwfdecAsValue *value, guint flags, gpointer listp)
+{
+  GSList **list = listp;
+
+  if (flags & SWFDEC_AS_VARIABLE_HIDDEN)
+    return TRUE;
+
+  *list = g_slist_remove (*list, variable);
+  *list = g_slist_prepend (*list, (gpointer) variable);
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_enumerate:
+ * @object: the object to enumerate
+ *
+ * Enumerates all non-hidden properties of a given object and its prototypes
+ * and returns their names as garbage-collected strings in a list. This 
+ * function is a special case of swfdec_as_object_foreach().
+ *
+ * Returns: a GSList of all properties of the object. You need to 
+ *          g_slist_free() the list after use.
+ **/
+GSList *
+swfdec_as_object_enumerate (SwfdecAsObject *object)
+{
+  guint i;
+  GSList *list = NULL;
+  
+  for (i = 0; i < SWFDEC_AS_OBJECT_PROTOTYPE_RECURSION_LIMIT && object; i++) {
+    swfdec_as_object_foreach (object, swfdec_as_object_enumerate_foreach, &list);
+    object = swfdec_as_object_get_prototype (object);
+  }
+  if (i == 256) {
+    swfdec_as_context_abort (object->context, "Prototype recursion limit exceeded");
+    g_slist_free (list);
+    return NULL;
+  }
+#if 0
+  list = g_slist_reverse (list);
+#else 
+  /* we force an alphabetical order into the list for now. This is wrong, 
+   * but at least ensures reproducability */
+  list = g_slist_sort (list, (GCompareFunc) strcmp);
+#endif
+  return list;
+}
+
+static void
+swfdec_as_object_do_nothing (SwfdecAsContext *cx, SwfdecAsObject *object,
+    guint argc, SwfdecAsValue *argv, SwfdecAsValue *retval)
+{
+}
+
+/**
+ * swfdec_as_object_add_function:
+ * @object: a #SwfdecAsObject
+ * @name: name of the function. The string does not have to be 
+ *        garbage-collected.
  * @native: a native function or %NULL to just not do anything
  *
  * Adds @native as a variable named @name to @object. The newly added variable
@@ -1247,31 +2448,67 @@ swfdec_as_object_add_function (SwfdecAsObject *object, const char *name, SwfdecA
  *
  * Executes the given @script with @object as this pointer.
  **/
+static void
+swfdec_as_object_init_frame (SwfdecAsObject *object, SwfdecAsFrame *frame,
+    SwfdecScript *script)
+{
+  SwfdecAsContext *context = object->context;
+
+  swfdec_as_frame_init (frame, context, script);
+  if (object->movie) {
+    frame->target = SWFDEC_MOVIE (object->relay);
+    frame->original_target = frame->target;
+  }
+  swfdec_as_frame_set_this (frame, object);
+  swfdec_as_frame_preload (context, frame);
+  if (object->movie) {
+    frame->activation = NULL;
+  } else {
+    frame->activation = object;
+    frame->scope_chain = g_slist_append (frame->scope_chain, object);
+  }
+}
+
 void
 swfdec_as_object_run (SwfdecAsObject *object, SwfdecScript *script)
 {
   SwfdecAsFrame frame = { NULL, };
-  SwfdecAsContext *context;
 
   g_return_if_fail (object != NULL);
   g_return_if_fail (script != NULL);
 
-  context = object->context;
-  swfdec_as_frame_init (&frame, context, script);
-  if (object->movie) {
-    frame.target = SWFDEC_MOVIE (object->relay);
-    frame.original_target = frame.target;
-  }
-  swfdec_as_frame_set_this (&frame, object);
-  swfdec_as_frame_preload (context, &frame);
-  if (object->movie) {
-    frame.activation = NULL;
-  } else {
-    frame.activation = object;
-    frame.scope_chain = g_slist_append (frame.scope_chain, object);
+  swfdec_as_object_init_frame (object, &frame, script);
+  swfdec_as_context_run (object->context);
+  swfdec_as_stack_pop (object->context);
+}
+
+/**
+ * swfdec_as_object_run_resumable:
+ * @object: a #SwfdecAsObject
+ * @script: script to execute
+ *
+ * Executes the given @script with @object as this pointer like 
+ * swfdec_as_object_run(). If the context asks scripts to yield, the script
+ * may be suspended and put into the context's list of suspended frames 
+ * instead of running to completion. Use swfdec_as_context_resume() to 
+ * continue it.
+ **/
+void
+swfdec_as_object_run_resumable (SwfdecAsObject *object, SwfdecScript *script)
+{
+  SwfdecAsFrame *frame;
+
+  g_return_if_fail (object != NULL);
+  g_return_if_fail (script != NULL);
+
+  frame = g_slice_new0 (SwfdecAsFrame);
+  swfdec_as_object_init_frame (object, frame, script);
+  frame->resumable = TRUE;
+  swfdec_as_context_run (object->context);
+  if (!frame->suspended) {
+    swfdec_as_stack_pop (object->context);
+    g_slice_free (SwfdecAsFrame, frame);
   }
-  swfdec_as_context_run (context);
-  swfdec_as_stack_pop (context);
 }
 
 /**
@@ -1512,6 +2749,104 @@ swfdec_as_object_add_native_variable (SwfdecAsObject *object,
   swfdec_as_object_add_variable (object, variable, get_func, set_func, 0);
 }
 
+/**
+ * swfdec_as_object_add_lazy_variable_function:
+ * @object: a #SwfdecAsObject
+ * @variable: garbage-collected name of the variable to add
+ * @build: function computing the value of the variable
+ * @data: value to pass to @build or %NULL
+ * @default_flags: flags for the variable
+ *
+ * Like swfdec_as_object_add_lazy_variable(), but takes an existing function,
+ * so one function can be shared between many objects. @build gets @data as
+ * its only argument, so it can compute the value without looking at anything
+ * that may be gone by the time the variable is accessed.
+ **/
+void
+swfdec_as_object_add_lazy_variable_function (SwfdecAsObject *object,
+    const char *variable, SwfdecAsFunction *build, const SwfdecAsValue *data,
+    guint default_flags)
+{
+  SwfdecAsVariable *var;
+
+  g_return_if_fail (object != NULL);
+  g_return_if_fail (variable != NULL);
+  g_return_if_fail (swfdec_as_object_variable_to_index (variable) < 0);
+  g_return_if_fail (SWFDEC_IS_AS_FUNCTION (build));
+
+  var = swfdec_as_object_hash_peek (object, variable);
+  if (var == NULL)
+    var = swfdec_as_object_hash_create (object, variable, default_flags);
+  if (var == NULL)
+    return;
+  var->flags |= SWFDEC_AS_VARIABLE_LAZY;
+  var->get = build;
+  var->set = NULL;
+  if (data) {
+    var->value = *data;
+  } else {
+    SWFDEC_AS_VALUE_SET_UNDEFINED (&var->value);
+  }
+  object->lazy = TRUE;
+}
+
+/**
+ * swfdec_as_object_set_lazy_data:
+ * @object: a #SwfdecAsObject
+ * @variable: garbage-collected name of the variable
+ * @build: the function the variable was added with
+ * @data: new value to pass to @build
+ *
+ * Replaces the data of a variable added with 
+ * swfdec_as_object_add_lazy_variable_function() that has not been built yet.
+ * This allows adding the variable cheaply and only collecting what @build 
+ * needs once it's clear the variable can outlive the state it is built from.
+ *
+ * Returns: %TRUE if the variable was still waiting to be built by @build
+ **/
+gboolean
+swfdec_as_object_set_lazy_data (SwfdecAsObject *object, const char *variable,
+    SwfdecAsFunction *build, const SwfdecAsValue *data)
+{
+  SwfdecAsVariable *var;
+
+  g_return_val_if_fail (object != NULL, FALSE);
+  g_return_val_if_fail (variable != NULL, FALSE);
+  g_return_val_if_fail (SWFDEC_IS_AS_FUNCTION (build), FALSE);
+  g_return_val_if_fail (data != NULL, FALSE);
+
+  var = swfdec_as_object_hash_peek (object, variable);
+  if (var == NULL || !(var->flags & SWFDEC_AS_VARIABLE_LAZY) || var->get != build)
+    return FALSE;
+  var->value = *data;
+  return TRUE;
+}
+
+/**
+ * swfdec_as_object_add_lazy_variable:
+ * @object: a #SwfdecAsObject
+ * @variable: garbage-collected name of the variable to add
+ * @build: function computing the value of the variable
+ * @default_flags: flags for the variable
+ *
+ * Adds a variable to @object that gets its value by calling @build with 
+ * @object as this object the first time it is accessed. This is meant for 
+ * native classes and other values that are expensive to create but rarely
+ * used. @object should not be used as an array.
+ **/
+void
+swfdec_as_object_add_lazy_variable (SwfdecAsObject *object,
+    const char *variable, SwfdecAsNative build, guint default_flags)
+{
+  g_return_if_fail (object != NULL);
+  g_return_if_fail (variable != NULL);
+  g_return_if_fail (build != NULL);
+
+  swfdec_as_object_add_lazy_variable_function (object, variable,
+      swfdec_as_native_function_new (object->context, variable, build),
+      NULL, default_flags);
+}
+
 /*** AS CODE ***/
 
 SWFDEC_AS_NATIVE (101, 2, swfdec_as_object_addProperty)
@@ -1557,7 +2892,7 @@ swfdec_as_object_hasOwnProperty (SwfdecAsContext *cx, SwfdecAsObject *object,
   SWFDEC_AS_VALUE_SET_BOOLEAN (retval, FALSE);
   SWFDEC_AS_CHECK (0, NULL, "s", &name);
 
-  if (!(var = swfdec_as_object_hash_lookup (object, name)))
+  if (!(var = swfdec_as_object_hash_peek (object, name)))
     return;
 
   /* This functions only checks NOT 6 flag, and checks it on ALL VERSIONS */
@@ -1582,7 +2917,7 @@ swfdec_as_object_isPropertyEnumerable (SwfdecAsContext *cx,
   SWFDEC_AS_VALUE_SET_BOOLEAN (retval, FALSE);
   SWFDEC_AS_CHECK (0, NULL, "s", &name);
 
-  if (!(var = swfdec_as_object_hash_lookup (object, name)))
+  if (!(var = swfdec_as_object_hash_peek (object, name)))
     return;
 
   if (var->flags & SWFDEC_AS_VARIABLE_HIDDEN)
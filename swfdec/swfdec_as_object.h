@@ -54,9 +54,17 @@ struct _SwfdecAsObject {
   gboolean		array:1;	/* TRUE if object is an array */
   gboolean		super:1;	/* TRUE if object is a super object */
   gboolean		movie:1;	/* TRUE if object is really a MovieClip */
+  gboolean		inherited:1;	/* TRUE if object has been used as a prototype */
+  gboolean		dense:1;	/* TRUE if index variables are stored in elements */
+  gboolean		indexed:1;	/* TRUE if properties or slots may contain index variables */
+  gboolean		lazy:1;		/* TRUE if some variables are only built on first access */
   SwfdecAsObject *	prototype;	/* prototype object (referred to as __proto__) */
   guint			prototype_flags; /* propflags for the prototype object */
-  GHashTable *		properties;	/* string->SwfdecAsVariable mapping or NULL when not in GC */
+  GHashTable *		properties;	/* string->SwfdecAsVariable mapping or NULL when using slots */
+  gpointer		shape;		/* SwfdecAsShape describing the slots or NULL when using properties */
+  gpointer *		slots;		/* SwfdecAsVariables as described by shape */
+  gpointer *		elements;	/* SwfdecAsVariables for indexes or NULL for holes */
+  guint			n_elements;	/* number of elements */
   GHashTable *		watches;	/* string->WatchData mapping or NULL when not watching anything */
   GSList *		interfaces;	/* list of interfaces this object implements */
   SwfdecAsRelay	*	relay;		/* object we relay data to */
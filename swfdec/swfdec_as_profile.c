@@ -0,0 +1,208 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include "swfdec_as_profile.h"
+#include "swfdec_script_internal.h"
+
+/* The profiler collects statistics about script execution without the
+ * overhead of a debugger: swfdec_as_context_run() tells it when a script 
+ * starts and ends and counts the actions it executes. Inclusive time is the
+ * time from calling a script until it returns, exclusive time is the 
+ * inclusive time minus the time spent in scripts it called. Recursive calls
+ * only count towards the inclusive time of the outermost call. */
+
+typedef struct _SwfdecAsProfileScript SwfdecAsProfileScript;
+struct _SwfdecAsProfileScript {
+  SwfdecScript *	script;		/* the script (reference) */
+  gulong		calls;		/* number of times the script was called */
+  guint			active;		/* number of calls currently running */
+  gdouble		inclusive;	/* inclusive time in seconds */
+  gdouble		exclusive;	/* exclusive time in seconds */
+};
+
+static void
+swfdec_as_profile_script_free (gpointer data)
+{
+  SwfdecAsProfileScript *entry = data;
+
+  swfdec_script_unref (entry->script);
+  g_slice_free (SwfdecAsProfileScript, entry);
+}
+
+SwfdecAsProfile *
+swfdec_as_profile_new (void)
+{
+  SwfdecAsProfile *profile = g_slice_new0 (SwfdecAsProfile);
+
+  profile->timer = g_timer_new ();
+  profile->scripts = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+      NULL, swfdec_as_profile_script_free);
+
+  return profile;
+}
+
+void
+swfdec_as_profile_free (SwfdecAsProfile *profile)
+{
+  g_return_if_fail (profile != NULL);
+
+  g_hash_table_destroy (profile->scripts);
+  g_timer_destroy (profile->timer);
+  g_slice_free (SwfdecAsProfile, profile);
+}
+
+void
+swfdec_as_profile_reset (SwfdecAsProfile *profile)
+{
+  g_return_if_fail (profile != NULL);
+
+  /* calls still running belong to the old generation and are ignored */
+  profile->generation++;
+  g_hash_table_remove_all (profile->scripts);
+  profile->child_time = 0;
+  memset (profile->actions, 0, sizeof (profile->actions));
+}
+
+void
+swfdec_as_profile_enter (SwfdecAsProfile *profile, SwfdecScript *script,
+    SwfdecAsProfileCall *call)
+{
+  SwfdecAsProfileScript *entry;
+
+  g_return_if_fail (profile != NULL);
+  g_return_if_fail (script != NULL);
+  g_return_if_fail (call != NULL);
+
+  if (!profile->running) {
+    call->script = NULL;
+    return;
+  }
+  entry = g_hash_table_lookup (profile->scripts, script);
+  if (entry == NULL) {
+    entry = g_slice_new0 (SwfdecAsProfileScript);
+    entry->script = swfdec_script_ref (script);
+    g_hash_table_insert (profile->scripts, script, entry);
+  }
+  entry->calls++;
+  entry->active++;
+  call->script = entry;
+  call->generation = profile->generation;
+  call->start = g_timer_elapsed (profile->timer, NULL);
+  call->child_time = profile->child_time;
+  profile->child_time = 0;
+}
+
+void
+swfdec_as_profile_leave (SwfdecAsProfile *profile, SwfdecAsProfileCall *call)
+{
+  SwfdecAsProfileScript *entry;
+  gdouble elapsed;
+
+  g_return_if_fail (profile != NULL);
+  g_return_if_fail (call != NULL);
+
+  entry = call->script;
+  if (entry == NULL || call->generation != profile->generation)
+    return;
+  elapsed = g_timer_elapsed (profile->timer, NULL) - call->start;
+  entry->active--;
+  if (entry->active == 0)
+    entry->inclusive += elapsed;
+  entry->exclusive += MAX (elapsed - profile->child_time, 0);
+  profile->child_time = call->child_time + elapsed;
+}
+
+static int
+swfdec_as_profile_compare_scripts (gconstpointer a, gconstpointer b)
+{
+  const SwfdecAsProfileScript *sa = *(SwfdecAsProfileScript * const *) a;
+  const SwfdecAsProfileScript *sb = *(SwfdecAsProfileScript * const *) b;
+
+  if (sa->exclusive > sb->exclusive)
+    return -1;
+  if (sa->exclusive < sb->exclusive)
+    return 1;
+  return 0;
+}
+
+static void
+swfdec_as_profile_collect_script (gpointer key, gpointer value, gpointer array)
+{
+  g_ptr_array_add (array, value);
+}
+
+static int
+swfdec_as_profile_compare_actions (gconstpointer a, gconstpointer b, gpointer data)
+{
+  const gulong *actions = data;
+  gulong ca = actions[*(const guint *) a];
+  gulong cb = actions[*(const guint *) b];
+
+  if (ca > cb)
+    return -1;
+  if (ca < cb)
+    return 1;
+  return 0;
+}
+
+char *
+swfdec_as_profile_dump (SwfdecAsProfile *profile)
+{
+  GString *string;
+  GPtrArray *array;
+  guint i, n_actions, actions[256];
+  const char *name;
+
+  g_return_val_if_fail (profile != NULL, NULL);
+
+  string = g_string_new ("");
+  array = g_ptr_array_new ();
+  g_hash_table_foreach (profile->scripts, swfdec_as_profile_collect_script, array);
+  qsort (array->pdata, array->len, sizeof (gpointer), swfdec_as_profile_compare_scripts);
+  g_string_append (string, "     calls  inclusive ms  exclusive ms  script\n");
+  for (i = 0; i < array->len; i++) {
+    SwfdecAsProfileScript *entry = g_ptr_array_index (array, i);
+    g_string_append_printf (string, "%10lu  %12.3f  %12.3f  %s\n", entry->calls,
+	entry->inclusive * 1000, entry->exclusive * 1000, 
+	entry->script->name ? entry->script->name : "(unnamed)");
+  }
+  g_ptr_array_free (array, TRUE);
+
+  n_actions = 0;
+  for (i = 0; i < 256; i++) {
+    if (profile->actions[i])
+      actions[n_actions++] = i;
+  }
+  g_qsort_with_data (actions, n_actions, sizeof (guint), 
+      swfdec_as_profile_compare_actions, profile->actions);
+  g_string_append (string, "\n     count  action\n");
+  for (i = 0; i < n_actions; i++) {
+    name = swfdec_action_get_name (actions[i]);
+    g_string_append_printf (string, "%10lu  0x%02X %s\n", profile->actions[actions[i]],
+	actions[i], name ? name : "Unknown");
+  }
+
+  return g_string_free (string, FALSE);
+}
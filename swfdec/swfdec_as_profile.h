@@ -0,0 +1,60 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_AS_PROFILE_H_
+#define _SWFDEC_AS_PROFILE_H_
+
+#include <swfdec/swfdec_script.h>
+
+G_BEGIN_DECLS
+
+typedef struct _SwfdecAsProfile SwfdecAsProfile;
+typedef struct _SwfdecAsProfileCall SwfdecAsProfileCall;
+
+struct _SwfdecAsProfile {
+  gboolean		running;	/* TRUE if statistics are collected */
+  guint			generation;	/* incremented whenever the statistics are reset */
+  GTimer *		timer;		/* timer all times are taken from */
+  GHashTable *		scripts;	/* SwfdecScript => SwfdecAsProfileScript */
+  gdouble		child_time;	/* time spent in scripts called by the current script */
+  gulong		actions[256];	/* number of times each action was executed */
+};
+
+/* bookkeeping for one invocation of a script, lives on the C stack */
+struct _SwfdecAsProfileCall {
+  gpointer		script;		/* SwfdecAsProfileScript being called or NULL if not profiled */
+  guint			generation;	/* generation of the profile when the call started */
+  gdouble		start;		/* time the call started */
+  gdouble		child_time;	/* child time of the calling script */
+};
+
+SwfdecAsProfile *	swfdec_as_profile_new		(void);
+void			swfdec_as_profile_free		(SwfdecAsProfile *	profile);
+
+void			swfdec_as_profile_reset		(SwfdecAsProfile *	profile);
+void			swfdec_as_profile_enter		(SwfdecAsProfile *	profile,
+							 SwfdecScript *		script,
+							 SwfdecAsProfileCall *	call);
+void			swfdec_as_profile_leave		(SwfdecAsProfile *	profile,
+							 SwfdecAsProfileCall *	call);
+char *			swfdec_as_profile_dump		(SwfdecAsProfile *	profile);
+
+
+G_END_DECLS
+#endif
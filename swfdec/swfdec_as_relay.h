@@ -44,6 +44,10 @@ struct _SwfdecAsRelay {
 struct _SwfdecAsRelayClass {
   /*< private >*/
   SwfdecGcObjectClass	object_class;
+
+  /* create an unattached copy of this relay for an object copied by cloner or NULL */
+  SwfdecAsRelay *	(* clone)			(SwfdecAsRelay *	relay,
+							 SwfdecAsCloner *	cloner);
 };
 
 GType		swfdec_as_relay_get_type	(void);
@@ -22,6 +22,7 @@
 #endif
 
 #include "swfdec_as_script_function.h"
+#include "swfdec_as_cloner.h"
 #include "swfdec_as_context.h"
 #include "swfdec_as_frame_internal.h"
 #include "swfdec_as_internal.h"
@@ -71,14 +72,16 @@ swfdec_as_script_function_call (SwfdecAsFunction *function, SwfdecAsObject *this
   frame.argv = args;
   frame.return_value = return_value;
   frame.construct = construct;
+  /* the super object is only created when the function uses it */
   if (super_reference == NULL) {
     /* don't create a super object */
   } else if (thisp != NULL) {
-    swfdec_as_super_new (&frame, thisp, super_reference);
+    frame.super_thisp = thisp;
+    frame.super_reference = super_reference;
   } else {
     // FIXME: Does the super object really reference the function when thisp is NULL?
-    swfdec_as_super_new (&frame, 
-	swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (function)), super_reference);
+    frame.super_thisp = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (function));
+    frame.super_reference = super_reference;
   }
   swfdec_as_frame_preload (context, &frame);
   swfdec_as_context_run (context);
@@ -116,17 +119,44 @@ swfdec_as_script_function_mark (SwfdecGcObject *object)
   SWFDEC_GC_OBJECT_CLASS (swfdec_as_script_function_parent_class)->mark (object);
 }
 
+static SwfdecAsRelay *
+swfdec_as_script_function_clone (SwfdecAsRelay *relay, SwfdecAsCloner *cloner)
+{
+  SwfdecAsScriptFunction *script = SWFDEC_AS_SCRIPT_FUNCTION (relay);
+  SwfdecAsScriptFunction *fun;
+  GSList *walk;
+
+  /* movies can't be copied, so only functions from init scripts work */
+  if (script->target || script->script == NULL)
+    return NULL;
+
+  fun = g_object_new (SWFDEC_TYPE_AS_SCRIPT_FUNCTION, "context", 
+      swfdec_as_cloner_get_context (cloner), NULL);
+  fun->script = swfdec_script_ref (script->script);
+  for (walk = script->scope_chain; walk; walk = walk->next) {
+    fun->scope_chain = g_slist_prepend (fun->scope_chain,
+	swfdec_as_cloner_map_object (cloner, walk->data));
+  }
+  fun->scope_chain = g_slist_reverse (fun->scope_chain);
+  fun->sandbox = swfdec_as_cloner_map_relay (cloner, script->sandbox);
+
+  return SWFDEC_AS_RELAY (fun);
+}
+
 static void
 swfdec_as_script_function_class_init (SwfdecAsScriptFunctionClass *klass)
 {
   GObjectClass *object_class = G_OBJECT_CLASS (klass);
   SwfdecGcObjectClass *gc_class = SWFDEC_GC_OBJECT_CLASS (klass);
+  SwfdecAsRelayClass *relay_class = SWFDEC_AS_RELAY_CLASS (klass);
   SwfdecAsFunctionClass *function_class = SWFDEC_AS_FUNCTION_CLASS (klass);
 
   object_class->dispose = swfdec_as_script_function_dispose;
 
   gc_class->mark = swfdec_as_script_function_mark;
 
+  relay_class->clone = swfdec_as_script_function_clone;
+
   function_class->call = swfdec_as_script_function_call;
 }
 
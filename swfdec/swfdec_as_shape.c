@@ -0,0 +1,180 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec_as_shape.h"
+#include "swfdec_as_context.h"
+#include "swfdec_debug.h"
+
+/* A shape describes the names of an object's properties and the slot they are
+ * stored in. Objects that had the same properties added in the same order 
+ * share a shape. Shapes form a tree: Every shape is derived from its parent by
+ * adding one property, which is stored in the slot with the highest index.
+ * The tree starts with the empty shape that is owned by the context.
+ *
+ * Shapes are reference counted by the objects using them and by the shapes 
+ * derived from them. The names are garbage-collected strings, they are kept
+ * alive by marking the shape when marking the object. As objects are collected
+ * before strings, shapes never refer to collected strings.
+ */
+
+/* shapes with less slots than this are searched instead of using a table */
+#define SWFDEC_AS_SHAPE_LINEAR_LOOKUP 8
+
+/* Shape ids are used by property caches to identify shapes. Unlike pointers,
+ * they aren't reused when a shape gets freed */
+static gsize swfdec_as_shape_last_id = 0;
+
+SwfdecAsShape *
+swfdec_as_shape_new_empty (void)
+{
+  SwfdecAsShape *shape;
+
+  shape = g_slice_new0 (SwfdecAsShape);
+  shape->refcount = 1;
+  shape->id = ++swfdec_as_shape_last_id;
+
+  return shape;
+}
+
+SwfdecAsShape *
+swfdec_as_shape_ref (SwfdecAsShape *shape)
+{
+  g_return_val_if_fail (shape != NULL, NULL);
+  g_return_val_if_fail (shape->refcount > 0, NULL);
+
+  shape->refcount++;
+  return shape;
+}
+
+void
+swfdec_as_shape_unref (SwfdecAsShape *shape)
+{
+  SwfdecAsShape *parent;
+
+  g_return_if_fail (shape != NULL);
+  g_return_if_fail (shape->refcount > 0);
+
+  while (shape) {
+    shape->refcount--;
+    if (shape->refcount > 0)
+      return;
+
+    /* derived shapes hold a reference, so there can't be any */
+    g_assert (shape->transitions == NULL || g_hash_table_size (shape->transitions) == 0);
+    if (shape->transitions)
+      g_hash_table_destroy (shape->transitions);
+    if (shape->table)
+      g_hash_table_destroy (shape->table);
+    parent = shape->parent;
+    if (parent) {
+      if (!g_hash_table_remove (parent->transitions, shape->name)) {
+	g_assert_not_reached ();
+      }
+    }
+    g_slice_free (SwfdecAsShape, shape);
+    shape = parent;
+  }
+}
+
+/**
+ * swfdec_as_shape_add:
+ * @shape: the shape to derive from
+ * @name: garbage-collected name of the property to add
+ *
+ * Gets the shape describing the slots of @shape plus an additional slot for 
+ * @name. @name must not be part of @shape yet.
+ *
+ * Returns: a reference to the new shape
+ **/
+SwfdecAsShape *
+swfdec_as_shape_add (SwfdecAsShape *shape, const char *name)
+{
+  SwfdecAsShape *child;
+
+  g_return_val_if_fail (shape != NULL, NULL);
+  g_return_val_if_fail (name != NULL, NULL);
+  g_return_val_if_fail (shape->n_slots < SWFDEC_AS_SHAPE_MAX_SLOTS, NULL);
+
+  if (shape->transitions == NULL) {
+    shape->transitions = g_hash_table_new (g_direct_hash, g_direct_equal);
+  } else {
+    child = g_hash_table_lookup (shape->transitions, name);
+    if (child)
+      return swfdec_as_shape_ref (child);
+  }
+
+  child = g_slice_new0 (SwfdecAsShape);
+  child->refcount = 1;
+  child->parent = swfdec_as_shape_ref (shape);
+  child->name = name;
+  child->n_slots = shape->n_slots + 1;
+  child->id = ++swfdec_as_shape_last_id;
+  g_hash_table_insert (shape->transitions, (gpointer) name, child);
+
+  return child;
+}
+
+/**
+ * swfdec_as_shape_lookup:
+ * @shape: the shape to search
+ * @name: garbage-collected name to look for
+ *
+ * Finds the slot used for @name in objects using @shape.
+ *
+ * Returns: the slot or -1 if @name is not part of @shape
+ **/
+int
+swfdec_as_shape_lookup (SwfdecAsShape *shape, const char *name)
+{
+  SwfdecAsShape *walk;
+
+  g_return_val_if_fail (shape != NULL, -1);
+  g_return_val_if_fail (name != NULL, -1);
+
+  if (shape->n_slots < SWFDEC_AS_SHAPE_LINEAR_LOOKUP) {
+    for (walk = shape; walk->parent; walk = walk->parent) {
+      if (walk->name == name)
+	return walk->n_slots - 1;
+    }
+    return -1;
+  }
+
+  if (shape->table == NULL) {
+    shape->table = g_hash_table_new (g_direct_hash, g_direct_equal);
+    for (walk = shape; walk->parent; walk = walk->parent) {
+      g_hash_table_insert (shape->table, (gpointer) walk->name, 
+	  GUINT_TO_POINTER (walk->n_slots));
+    }
+  }
+  return (int) GPOINTER_TO_UINT (g_hash_table_lookup (shape->table, name)) - 1;
+}
+
+void
+swfdec_as_shape_mark (SwfdecAsShape *shape)
+{
+  g_return_if_fail (shape != NULL);
+
+  for (; shape->parent; shape = shape->parent) {
+    swfdec_as_string_mark (shape->name);
+  }
+}
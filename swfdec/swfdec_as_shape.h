@@ -0,0 +1,53 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_AS_SHAPE_H_
+#define _SWFDEC_AS_SHAPE_H_
+
+#include <swfdec/swfdec_as_types.h>
+
+G_BEGIN_DECLS
+
+/* objects with more properties than this use a hash table */
+#define SWFDEC_AS_SHAPE_MAX_SLOTS 64
+
+typedef struct _SwfdecAsShape SwfdecAsShape;
+struct _SwfdecAsShape {
+  SwfdecAsShape *	parent;		/* shape this one was derived from or NULL for the empty shape */
+  const char *		name;		/* garbage-collected name of the last slot or NULL for the empty shape */
+  guint			n_slots;	/* number of slots described by this shape */
+  guint			refcount;	/* objects and derived shapes using this shape */
+  GHashTable *		transitions;	/* name => shape derived by adding name or NULL if none */
+  GHashTable *		table;		/* name => slot + 1 for faster lookups or NULL if not built yet */
+  gsize			id;		/* unique id of this shape, never reused */
+};
+
+SwfdecAsShape *	swfdec_as_shape_new_empty	(void);
+SwfdecAsShape *	swfdec_as_shape_ref		(SwfdecAsShape *	shape);
+void		swfdec_as_shape_unref		(SwfdecAsShape *	shape);
+
+SwfdecAsShape *	swfdec_as_shape_add		(SwfdecAsShape *	shape,
+						 const char *		name);
+int		swfdec_as_shape_lookup		(SwfdecAsShape *	shape,
+						 const char *		name);
+void		swfdec_as_shape_mark		(SwfdecAsShape *	shape);
+
+
+G_END_DECLS
+#endif
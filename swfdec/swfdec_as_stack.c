@@ -174,6 +174,115 @@ swfdec_as_stack_ensure_free (SwfdecAsContext *context, guint n_elements)
     context->cur = context->end - n_elements;
 }
 
+/*** REGISTERS ***/
+
+/* Frames are always freed in the reverse order of their creation, so the 
+ * registers of frames are taken from chunks of memory by bumping a pointer.
+ * Unused chunks are kept around until the context goes away. */
+
+/* big enough for the 256 registers a function may use */
+#define SWFDEC_AS_REGISTER_CHUNK_SIZE 1024
+
+typedef struct _SwfdecAsRegisterChunk SwfdecAsRegisterChunk;
+struct _SwfdecAsRegisterChunk {
+  SwfdecAsRegisterChunk *	prev;		/* chunk that was in use before this one */
+  SwfdecAsRegisterChunk *	next;		/* unused chunk to continue with or NULL */
+  SwfdecAsValue *		cur;		/* first unused register */
+  SwfdecAsValue			registers[SWFDEC_AS_REGISTER_CHUNK_SIZE];
+};
+
+/**
+ * swfdec_as_stack_alloc_registers:
+ * @context: a #SwfdecAsContext
+ * @n_registers: number of registers to allocate
+ *
+ * Allocates registers for a new frame. The registers are initialized to 
+ * undefined. They must be freed with swfdec_as_stack_free_registers() before
+ * registers allocated earlier are freed.
+ *
+ * Returns: the new registers or %NULL if @n_registers is 0
+ **/
+SwfdecAsValue *
+swfdec_as_stack_alloc_registers (SwfdecAsContext *context, guint n_registers)
+{
+  SwfdecAsRegisterChunk *chunk;
+  SwfdecAsValue *ret;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+  g_return_val_if_fail (n_registers <= SWFDEC_AS_REGISTER_CHUNK_SIZE, NULL);
+
+  if (n_registers == 0)
+    return NULL;
+
+  chunk = context->registers;
+  if (chunk == NULL || chunk->cur + n_registers > &chunk->registers[SWFDEC_AS_REGISTER_CHUNK_SIZE]) {
+    SwfdecAsRegisterChunk *next = chunk ? chunk->next : NULL;
+    if (next == NULL) {
+      swfdec_as_context_use_mem (context, sizeof (SwfdecAsRegisterChunk));
+      next = g_slice_new (SwfdecAsRegisterChunk);
+      next->prev = chunk;
+      next->next = NULL;
+      if (chunk)
+	chunk->next = next;
+    }
+    next->cur = next->registers;
+    chunk = next;
+    context->registers = chunk;
+  }
+  ret = chunk->cur;
+  chunk->cur += n_registers;
+  memset (ret, 0, n_registers * sizeof (SwfdecAsValue));
+
+  return ret;
+}
+
+/**
+ * swfdec_as_stack_free_registers:
+ * @context: a #SwfdecAsContext
+ * @registers: registers allocated with swfdec_as_stack_alloc_registers()
+ * @n_registers: number of registers that were allocated
+ *
+ * Frees the registers that were allocated last.
+ **/
+void
+swfdec_as_stack_free_registers (SwfdecAsContext *context, 
+    SwfdecAsValue *registers, guint n_registers)
+{
+  SwfdecAsRegisterChunk *chunk;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+
+  if (n_registers == 0)
+    return;
+
+  chunk = context->registers;
+  g_assert (chunk->cur == registers + n_registers);
+  chunk->cur = registers;
+  if (chunk->cur == chunk->registers && chunk->prev)
+    context->registers = chunk->prev;
+}
+
+/* frees all memory used for registers, no frame may exist anymore */
+void
+swfdec_as_stack_clear_registers (SwfdecAsContext *context)
+{
+  SwfdecAsRegisterChunk *chunk, *next;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (context));
+
+  chunk = context->registers;
+  if (chunk == NULL)
+    return;
+  while (chunk->prev)
+    chunk = chunk->prev;
+  for (; chunk; chunk = next) {
+    next = chunk->next;
+    g_slice_free (SwfdecAsRegisterChunk, chunk);
+    swfdec_as_context_unuse_mem (context, sizeof (SwfdecAsRegisterChunk));
+  }
+  context->registers = NULL;
+}
+
 guint
 swfdec_as_stack_get_size (SwfdecAsContext *context)
 {
@@ -95,6 +95,13 @@ void		swfdec_as_stack_ensure_size	(SwfdecAsContext *	context,
 void		swfdec_as_stack_ensure_free	(SwfdecAsContext *	context,
 						 guint	  		n_elements);
 guint		swfdec_as_stack_get_size	(SwfdecAsContext *	context);
+
+SwfdecAsValue *	swfdec_as_stack_alloc_registers	(SwfdecAsContext *	context,
+						 guint			n_registers);
+void		swfdec_as_stack_free_registers	(SwfdecAsContext *	context,
+						 SwfdecAsValue *	registers,
+						 guint			n_registers);
+void		swfdec_as_stack_clear_registers	(SwfdecAsContext *	context);
 						
 
 G_END_DECLS
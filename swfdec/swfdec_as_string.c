@@ -72,14 +72,216 @@ swfdec_as_string_init (SwfdecAsString *string)
     return; \
 }G_STMT_END
 
-static const char *
-swfdec_as_str_nth_char (const char *s, guint n)
+/*** CHARACTER ACCESS ***/
+
+/* Strings are UTF-8, but scripts index them by character. Strings that only
+ * contain ASCII are flagged when they are created, so they can be indexed 
+ * directly. For other strings, an index is created the first time it is 
+ * needed and kept in the context's string_indexes table. It contains the byte
+ * offset of every SWFDEC_AS_STRING_INDEX_STRIDE'th character and its memory is
+ * accounted to the context. Strings that aren't valid UTF-8 don't get an 
+ * index, because g_utf8_next_char() could skip over their end. They are 
+ * indexed by byte instead. */
+
+#define SWFDEC_AS_STRING_INDEX_STRIDE 32
+
+typedef struct {
+  guint		n_chars;	/* number of characters in the string */
+  guint		offsets[];	/* byte offsets of every SWFDEC_AS_STRING_INDEX_STRIDE'th character */
+} SwfdecAsStringIndex;
+
+/* used as the index of strings that are not valid UTF-8 */
+static SwfdecAsStringIndex swfdec_as_str_invalid_index = { 0, };
+
+#define SWFDEC_AS_STR_VALUE(s) ((SwfdecAsStringValue *) (gpointer) ((guint8 *) (s) - G_STRUCT_OFFSET (SwfdecAsStringValue, string)))
+
+static gsize
+swfdec_as_str_index_size (gsize len)
+{
+  /* there's at most one character per byte */
+  return sizeof (SwfdecAsStringIndex) + 
+      (len / SWFDEC_AS_STRING_INDEX_STRIDE + 1) * sizeof (guint);
+}
+
+/* returns NULL if the string is not valid UTF-8 */
+static SwfdecAsStringIndex *
+swfdec_as_str_get_index (SwfdecAsContext *cx, SwfdecAsStringValue *value)
 {
-  while (*s && n--)
+  SwfdecAsStringIndex *index;
+  const char *s, *end;
+  gsize len, size;
+  guint i;
+
+  index = g_hash_table_lookup (cx->string_indexes, value);
+  if (index == &swfdec_as_str_invalid_index)
+    return NULL;
+  if (index)
+    return index;
+
+  len = SWFDEC_AS_STRING_VALUE_LENGTH (value);
+  if (!g_utf8_validate (value->string, len, NULL)) {
+    g_hash_table_insert (cx->string_indexes, value, &swfdec_as_str_invalid_index);
+    return NULL;
+  }
+  end = value->string + len;
+  size = swfdec_as_str_index_size (len);
+  swfdec_as_context_use_mem (cx, size);
+  index = g_malloc (size);
+  for (s = value->string, i = 0; s < end; s = g_utf8_next_char (s), i++) {
+    if (i % SWFDEC_AS_STRING_INDEX_STRIDE == 0)
+      index->offsets[i / SWFDEC_AS_STRING_INDEX_STRIDE] = s - value->string;
+  }
+  index->n_chars = i;
+  g_hash_table_insert (cx->string_indexes, value, index);
+
+  return index;
+}
+
+/**
+ * swfdec_as_str_free_index:
+ * @cx: the context @value belongs to
+ * @value: a string that is about to be freed
+ *
+ * Frees the character index of @value if it has one.
+ **/
+void
+swfdec_as_str_free_index (SwfdecAsContext *cx, SwfdecAsStringValue *value)
+{
+  SwfdecAsStringIndex *index;
+
+  g_return_if_fail (SWFDEC_IS_AS_CONTEXT (cx));
+  g_return_if_fail (value != NULL);
+
+  index = g_hash_table_lookup (cx->string_indexes, value);
+  if (index == NULL)
+    return;
+
+  g_hash_table_remove (cx->string_indexes, value);
+  if (index == &swfdec_as_str_invalid_index)
+    return;
+  swfdec_as_context_unuse_mem (cx, 
+      swfdec_as_str_index_size (SWFDEC_AS_STRING_VALUE_LENGTH (value)));
+  g_free (index);
+}
+
+/**
+ * swfdec_as_str_n_chars:
+ * @cx: the context @string belongs to
+ * @string: a garbage-collected string
+ *
+ * Computes the number of characters in @string. This is the same as 
+ * g_utf8_strlen(), but takes constant time.
+ *
+ * Returns: the number of characters in @string
+ **/
+guint
+swfdec_as_str_n_chars (SwfdecAsContext *cx, const char *string)
+{
+  SwfdecAsStringValue *value;
+  SwfdecAsStringIndex *index;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (cx), 0);
+  g_return_val_if_fail (string != NULL, 0);
+
+  value = SWFDEC_AS_STR_VALUE (string);
+  if (SWFDEC_AS_STRING_VALUE_IS_ASCII (value))
+    return SWFDEC_AS_STRING_VALUE_LENGTH (value);
+
+  index = swfdec_as_str_get_index (cx, value);
+  if (index == NULL)
+    return SWFDEC_AS_STRING_VALUE_LENGTH (value);
+  return index->n_chars;
+}
+
+/**
+ * swfdec_as_str_nth_char:
+ * @cx: the context @string belongs to
+ * @string: a garbage-collected string
+ * @n: index of the character
+ *
+ * Finds the @n'th character in @string.
+ *
+ * Returns: a pointer to the @n'th character of @string or to its terminating
+ *          NUL if @string is not that long
+ **/
+const char *
+swfdec_as_str_nth_char (SwfdecAsContext *cx, const char *string, guint n)
+{
+  SwfdecAsStringValue *value;
+  SwfdecAsStringIndex *index;
+  const char *s;
+  gsize len;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (cx), NULL);
+  g_return_val_if_fail (string != NULL, NULL);
+
+  value = SWFDEC_AS_STR_VALUE (string);
+  len = SWFDEC_AS_STRING_VALUE_LENGTH (value);
+  if (SWFDEC_AS_STRING_VALUE_IS_ASCII (value))
+    return string + MIN (n, len);
+
+  index = swfdec_as_str_get_index (cx, value);
+  if (index == NULL)
+    return string + MIN (n, len);
+  if (n >= index->n_chars)
+    return string + len;
+  s = string + index->offsets[n / SWFDEC_AS_STRING_INDEX_STRIDE];
+  for (n %= SWFDEC_AS_STRING_INDEX_STRIDE; n > 0; n--)
     s = g_utf8_next_char (s);
+
   return s;
 }
 
+/**
+ * swfdec_as_str_char_offset:
+ * @cx: the context @string belongs to
+ * @string: a garbage-collected string
+ * @pos: a pointer to a character in @string
+ *
+ * Computes the index of the character at @pos. This is the same as
+ * g_utf8_pointer_to_offset(), but doesn't need to look at the whole string.
+ *
+ * Returns: the number of characters in front of @pos
+ **/
+guint
+swfdec_as_str_char_offset (SwfdecAsContext *cx, const char *string, 
+    const char *pos)
+{
+  SwfdecAsStringValue *value;
+  SwfdecAsStringIndex *index;
+  guint offset, i, lo, hi;
+
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (cx), 0);
+  g_return_val_if_fail (string != NULL, 0);
+  g_return_val_if_fail (pos >= string, 0);
+
+  value = SWFDEC_AS_STR_VALUE (string);
+  offset = pos - string;
+  if (SWFDEC_AS_STRING_VALUE_IS_ASCII (value))
+    return offset;
+
+  index = swfdec_as_str_get_index (cx, value);
+  if (index == NULL)
+    return offset;
+  if (index->n_chars == 0)
+    return 0;
+  /* find the last indexed character in front of pos */
+  lo = 0;
+  hi = (index->n_chars - 1) / SWFDEC_AS_STRING_INDEX_STRIDE;
+  while (lo < hi) {
+    i = (lo + hi + 1) / 2;
+    if (index->offsets[i] <= offset)
+      lo = i;
+    else
+      hi = i - 1;
+  }
+  i = lo * SWFDEC_AS_STRING_INDEX_STRIDE;
+  for (string += index->offsets[lo]; string < pos; string = g_utf8_next_char (string))
+    i++;
+
+  return i;
+}
+
 SWFDEC_AS_NATIVE (251, 9, swfdec_as_string_lastIndexOf)
 void
 swfdec_as_string_lastIndexOf (SwfdecAsContext *cx, SwfdecAsObject *object,
@@ -98,23 +300,20 @@ swfdec_as_string_lastIndexOf (SwfdecAsContext *cx, SwfdecAsObject *object,
       *ret = swfdec_as_value_from_integer (cx, -1);
       return;
     }
-    tmp = string;
-    offset++;
-    while (*tmp && offset-- != 0)
-      tmp = g_utf8_next_char (tmp);
+    tmp = swfdec_as_str_nth_char (cx, string, offset + 1);
     len = tmp - string;
   } else {
     len = G_MAXSIZE;
   }
   s = g_strrstr_len (string, len, s);
   if (s) {
-    *ret = swfdec_as_value_from_integer (cx, g_utf8_pointer_to_offset (string, s));
+    *ret = swfdec_as_value_from_integer (cx, swfdec_as_str_char_offset (cx, string, s));
   } else {
     *ret = swfdec_as_value_from_integer (cx, -1);
   }
 }
 
-SWFDEC_AS_NATIVE (251, 8, swfdec_as_string_indexOf)
+SWFDEC_AS_FAST_NATIVE (251, 8, swfdec_as_string_indexOf)
 void
 swfdec_as_string_indexOf (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -129,18 +328,18 @@ swfdec_as_string_indexOf (SwfdecAsContext *cx, SwfdecAsObject *object,
     offset = swfdec_as_value_to_integer (cx, argv[1]);
   if (offset < 0)
     offset = 0;
-  len = g_utf8_strlen (string, -1);
+  len = swfdec_as_str_n_chars (cx, string);
   if (offset < len) {
-    t = strstr (g_utf8_offset_to_pointer (string, offset), s);
+    t = strstr (swfdec_as_str_nth_char (cx, string, offset), s);
   }
   if (t != NULL) {
-    i = g_utf8_pointer_to_offset (string, t);
+    i = swfdec_as_str_char_offset (cx, string, t);
   }
 
   *ret = swfdec_as_value_from_integer (cx, i);
 }
 
-SWFDEC_AS_NATIVE (251, 5, swfdec_as_string_charAt)
+SWFDEC_AS_FAST_NATIVE (251, 5, swfdec_as_string_charAt)
 void
 swfdec_as_string_charAt (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -155,17 +354,17 @@ swfdec_as_string_charAt (SwfdecAsContext *cx, SwfdecAsObject *object,
     SWFDEC_AS_VALUE_SET_STRING (ret, SWFDEC_AS_STR_EMPTY);
     return;
   }
-  s = swfdec_as_str_nth_char (string, i);
+  s = swfdec_as_str_nth_char (cx, string, i);
   if (*s == 0) {
     SWFDEC_AS_VALUE_SET_STRING (ret, SWFDEC_AS_STR_EMPTY);
     return;
   }
-  t = g_utf8_next_char (s);
-  s = swfdec_as_context_give_string (cx, g_strndup (s, t - s));
+  t = swfdec_as_str_nth_char (cx, string, i + 1);
+  s = swfdec_as_context_get_string_len (cx, s, t - s);
   SWFDEC_AS_VALUE_SET_STRING (ret, s);
 }
 
-SWFDEC_AS_NATIVE (251, 6, swfdec_as_string_charCodeAt)
+SWFDEC_AS_FAST_NATIVE (251, 6, swfdec_as_string_charCodeAt)
 void
 swfdec_as_string_charCodeAt (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *ret)
@@ -181,7 +380,7 @@ swfdec_as_string_charCodeAt (SwfdecAsContext *cx, SwfdecAsObject *object,
     *ret = swfdec_as_value_from_number (cx, NAN);
     return;
   }
-  s = swfdec_as_str_nth_char (string, i);
+  s = swfdec_as_str_nth_char (cx, string, i);
   if (*s == 0) {
     if (cx->version > 5) {
       *ret = swfdec_as_value_from_number (cx, NAN);
@@ -190,7 +389,10 @@ swfdec_as_string_charCodeAt (SwfdecAsContext *cx, SwfdecAsObject *object,
     }
     return;
   }
-  c = g_utf8_get_char (s);
+  c = g_utf8_get_char_validated (s, -1);
+  /* strings that aren't valid UTF-8 are indexed by byte */
+  if (c >= (gunichar) -2)
+    c = (guchar) *s;
   *ret = swfdec_as_value_from_number (cx, c);
 }
 
@@ -294,7 +496,7 @@ swfdec_as_string_construct (SwfdecAsContext *cx, SwfdecAsObject *object,
     string->string = s;
     swfdec_as_object_set_relay (object, SWFDEC_AS_RELAY (string));
 
-    val = swfdec_as_value_from_integer (cx, g_utf8_strlen (string->string, -1));
+    val = swfdec_as_value_from_integer (cx, swfdec_as_str_n_chars (cx, string->string));
     swfdec_as_object_set_variable_and_flags (object, SWFDEC_AS_STR_length,
 	&val, SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
 
@@ -457,7 +659,7 @@ swfdec_as_string_slice (SwfdecAsContext *cx, SwfdecAsObject *object,
 
   SWFDEC_AS_STRING_CHECK (&str, "i", &start);
 
-  length = g_utf8_strlen (str, -1);
+  length = swfdec_as_str_n_chars (cx, str);
 
   if (start < 0)
     start += length;
@@ -502,10 +704,9 @@ swfdec_as_str_sub (SwfdecAsContext *cx, const char *str, guint offset, guint len
 {
   const char *end;
 
-  str = g_utf8_offset_to_pointer (str, offset);
-  end = g_utf8_offset_to_pointer (str, len);
-  str = swfdec_as_context_give_string (cx, g_strndup (str, end - str));
-  return str;
+  end = swfdec_as_str_nth_char (cx, str, offset + len);
+  str = swfdec_as_str_nth_char (cx, str, offset);
+  return swfdec_as_context_get_string_len (cx, str, end - str);
 }
 
 SWFDEC_AS_NATIVE (251, 13, swfdec_as_string_substr)
@@ -518,7 +719,7 @@ swfdec_as_string_substr (SwfdecAsContext *cx, SwfdecAsObject *object,
 
   SWFDEC_AS_STRING_CHECK (&string, "i", &from);
 
-  len = g_utf8_strlen (string, -1);
+  len = swfdec_as_str_n_chars (cx, string);
   
   if (argc > 1 && !SWFDEC_AS_VALUE_IS_UNDEFINED (argv[1])) {
     to = swfdec_as_value_to_integer (cx, argv[1]);
@@ -553,7 +754,7 @@ swfdec_as_string_substring (SwfdecAsContext *cx, SwfdecAsObject *object,
 
   SWFDEC_AS_STRING_CHECK (&string, "i", &from);
 
-  len = g_utf8_strlen (string, -1);
+  len = swfdec_as_str_n_chars (cx, string);
   if (argc > 1 && !SWFDEC_AS_VALUE_IS_UNDEFINED (argv[1])) {
     to = swfdec_as_value_to_integer (cx, argv[1]);
   } else {
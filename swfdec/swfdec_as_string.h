@@ -21,6 +21,7 @@
 #define _SWFDEC_AS_STRING_H_
 
 #include <swfdec/swfdec_as_relay.h>
+#include <swfdec/swfdec_as_string_value.h>
 
 G_BEGIN_DECLS
 
@@ -46,6 +47,17 @@ struct _SwfdecAsStringClass {
 
 GType		swfdec_as_string_get_type	(void);
 
+guint		swfdec_as_str_n_chars		(SwfdecAsContext *	cx,
+						 const char *		string);
+const char *	swfdec_as_str_nth_char		(SwfdecAsContext *	cx,
+						 const char *		string,
+						 guint			n);
+guint		swfdec_as_str_char_offset	(SwfdecAsContext *	cx,
+						 const char *		string,
+						 const char *		pos);
+void		swfdec_as_str_free_index	(SwfdecAsContext *	cx,
+						 SwfdecAsStringValue *	value);
+
 const char *	swfdec_as_str_sub		(SwfdecAsContext *	cx,
 						 const char *		str,
 						 guint			offset,
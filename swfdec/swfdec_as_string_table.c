@@ -0,0 +1,232 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+
+#include "swfdec_as_string_table.h"
+#include "swfdec_as_gcable.h"
+#include "swfdec_as_internal.h"
+#include "swfdec_debug.h"
+
+/* The string table is used to intern the strings of a context. It's a hash 
+ * table using open addressing with linear probing. The hash of every string is
+ * kept next to it, so lookups only compare strings when the hash matches and
+ * resizing never needs to rehash a string. Lookups take a length, so callers 
+ * that know it don't need NUL-terminated strings. The table doesn't own the 
+ * strings, but it knows about their GC flags, so garbage can be removed from 
+ * it in one pass after marking. */
+
+#define SWFDEC_AS_STRING_TABLE_MIN_SIZE 1024
+
+typedef struct {
+  guint			hash;		/* hash of the string */
+  SwfdecAsStringValue *	value;		/* the string or NULL if the slot is unused */
+} SwfdecAsStringTableEntry;
+
+struct _SwfdecAsStringTable {
+  SwfdecAsStringTableEntry *	entries;	/* the slots */
+  guint				mask;		/* number of slots - 1, the number of slots is a power of 2 */
+  guint				n_entries;	/* number of used slots */
+};
+
+static SwfdecAsStringTableEntry *
+swfdec_as_string_table_find_free (SwfdecAsStringTable *table, guint hash)
+{
+  guint i;
+
+  for (i = hash & table->mask; table->entries[i].value; i = (i + 1) & table->mask);
+
+  return &table->entries[i];
+}
+
+static void
+swfdec_as_string_table_resize (SwfdecAsStringTable *table, guint size)
+{
+  SwfdecAsStringTableEntry *old;
+  guint i, old_size;
+
+  SWFDEC_LOG ("resizing string table from %u to %u entries", table->mask + 1, size);
+  old = table->entries;
+  old_size = table->mask + 1;
+  table->entries = g_new0 (SwfdecAsStringTableEntry, size);
+  table->mask = size - 1;
+  for (i = 0; i < old_size; i++) {
+    if (old[i].value)
+      *swfdec_as_string_table_find_free (table, old[i].hash) = old[i];
+  }
+  g_free (old);
+}
+
+SwfdecAsStringTable *
+swfdec_as_string_table_new (void)
+{
+  SwfdecAsStringTable *table;
+
+  table = g_slice_new0 (SwfdecAsStringTable);
+  table->entries = g_new0 (SwfdecAsStringTableEntry, SWFDEC_AS_STRING_TABLE_MIN_SIZE);
+  table->mask = SWFDEC_AS_STRING_TABLE_MIN_SIZE - 1;
+
+  return table;
+}
+
+void
+swfdec_as_string_table_free (SwfdecAsStringTable *table)
+{
+  g_return_if_fail (table != NULL);
+
+  g_free (table->entries);
+  g_slice_free (SwfdecAsStringTable, table);
+}
+
+/**
+ * swfdec_as_string_table_hash:
+ * @string: the string to hash, need not be NUL-terminated
+ * @length: number of bytes in @string
+ *
+ * Computes the hash used for looking up @string in a string table.
+ *
+ * Returns: the hash value
+ **/
+guint
+swfdec_as_string_table_hash (const char *string, gsize length)
+{
+  const guchar *s = (const guchar *) string;
+  guint hash = 5381;
+  gsize i;
+
+  for (i = 0; i < length; i++) {
+    hash = (hash << 5) + hash + s[i];
+  }
+
+  return hash;
+}
+
+/**
+ * swfdec_as_string_table_lookup:
+ * @table: a string table
+ * @string: the string to look up, need not be NUL-terminated
+ * @length: number of bytes in @string
+ * @hash: the result of swfdec_as_string_table_hash() for @string
+ *
+ * Looks up the interned version of @string.
+ *
+ * Returns: the string value for @string or %NULL if none was inserted
+ **/
+SwfdecAsStringValue *
+swfdec_as_string_table_lookup (SwfdecAsStringTable *table, const char *string,
+    gsize length, guint hash)
+{
+  SwfdecAsStringTableEntry *entry;
+  guint i;
+
+  g_return_val_if_fail (table != NULL, NULL);
+  g_return_val_if_fail (string != NULL || length == 0, NULL);
+
+  for (i = hash & table->mask; ; i = (i + 1) & table->mask) {
+    entry = &table->entries[i];
+    if (entry->value == NULL)
+      return NULL;
+    if (entry->hash == hash && SWFDEC_AS_STRING_VALUE_LENGTH (entry->value) == length &&
+	memcmp (entry->value->string, string, length) == 0)
+      return entry->value;
+  }
+}
+
+/**
+ * swfdec_as_string_table_insert:
+ * @table: a string table
+ * @value: a string that is not in @table yet
+ * @hash: the result of swfdec_as_string_table_hash() for @value
+ *
+ * Adds @value to @table.
+ **/
+void
+swfdec_as_string_table_insert (SwfdecAsStringTable *table, 
+    SwfdecAsStringValue *value, guint hash)
+{
+  SwfdecAsStringTableEntry *entry;
+
+  g_return_if_fail (table != NULL);
+  g_return_if_fail (value != NULL);
+
+  /* keep the table at most half full, so probe sequences stay short */
+  if (table->n_entries >= (table->mask + 1) / 2)
+    swfdec_as_string_table_resize (table, (table->mask + 1) * 2);
+
+  entry = swfdec_as_string_table_find_free (table, hash);
+  entry->hash = hash;
+  entry->value = value;
+  table->n_entries++;
+}
+
+/**
+ * swfdec_as_string_table_sweep:
+ * @table: a string table
+ *
+ * Removes all strings from @table that are neither marked nor roots. This 
+ * must be called right after marking, before the strings are collected.
+ *
+ * Returns: the number of removed strings
+ **/
+guint
+swfdec_as_string_table_sweep (SwfdecAsStringTable *table)
+{
+  SwfdecAsStringTableEntry entry;
+  guint i, start, size, removed;
+
+  g_return_val_if_fail (table != NULL, 0);
+
+  size = table->mask + 1;
+  removed = 0;
+  for (i = 0; i < size; i++) {
+    SwfdecAsStringValue *value = table->entries[i].value;
+    if (value && !SWFDEC_AS_GCABLE_FLAG_IS_SET (value, 
+	  SWFDEC_AS_GC_MARK | SWFDEC_AS_GC_ROOT)) {
+      table->entries[i].value = NULL;
+      removed++;
+    }
+  }
+  if (removed == 0)
+    return 0;
+  table->n_entries -= removed;
+
+  if (size > SWFDEC_AS_STRING_TABLE_MIN_SIZE && table->n_entries < size / 8) {
+    swfdec_as_string_table_resize (table, size / 2);
+    return removed;
+  }
+
+  /* Removing strings may have broken probe sequences. Put every string back 
+   * into the first free slot of its sequence. Starting after an unused slot 
+   * ensures every run of used slots is handled from its start. */
+  for (start = 0; table->entries[start].value; start++);
+  for (i = 1; i <= size; i++) {
+    SwfdecAsStringTableEntry *slot = &table->entries[(start + i) & table->mask];
+    if (slot->value == NULL)
+      continue;
+    entry = *slot;
+    slot->value = NULL;
+    *swfdec_as_string_table_find_free (table, entry.hash) = entry;
+  }
+
+  return removed;
+}
@@ -0,0 +1,45 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_AS_STRING_TABLE_H_
+#define _SWFDEC_AS_STRING_TABLE_H_
+
+#include <swfdec/swfdec_as_string_value.h>
+
+G_BEGIN_DECLS
+
+typedef struct _SwfdecAsStringTable SwfdecAsStringTable;
+
+SwfdecAsStringTable *	swfdec_as_string_table_new	(void);
+void			swfdec_as_string_table_free	(SwfdecAsStringTable *	table);
+
+guint			swfdec_as_string_table_hash	(const char *		string,
+							 gsize			length);
+SwfdecAsStringValue *	swfdec_as_string_table_lookup	(SwfdecAsStringTable *	table,
+							 const char *		string,
+							 gsize			length,
+							 guint			hash);
+void			swfdec_as_string_table_insert	(SwfdecAsStringTable *	table,
+							 SwfdecAsStringValue *	value,
+							 guint			hash);
+guint			swfdec_as_string_table_sweep	(SwfdecAsStringTable *	table);
+
+
+G_END_DECLS
+#endif
@@ -24,9 +24,12 @@
 #include "swfdec_as_strings.h"
 
 #include "swfdec_as_gcable.h"
+#include "swfdec_as_internal.h"
 
 
-#define SWFDEC_AS_CONSTANT_STRING(str) { GSIZE_TO_POINTER (SWFDEC_AS_GC_ROOT), sizeof (str) - 1, str "\0" },
+/* all constant strings are ASCII */
+#define SWFDEC_AS_CONSTANT_STRING(str) { GSIZE_TO_POINTER (SWFDEC_AS_GC_ROOT), \
+  (sizeof (str) - 1) | SWFDEC_AS_STRING_VALUE_ASCII, str "\0" },
 const SwfdecAsConstantStringValue swfdec_as_strings[] = {
   SWFDEC_AS_CONSTANT_STRING ("")
   SWFDEC_AS_CONSTANT_STRING ("__proto__")
@@ -536,6 +539,10 @@ const SwfdecAsConstantStringValue swfdec_as_strings[] = {
   SWFDEC_AS_CONSTANT_STRING ("Invalid Date")
   SWFDEC_AS_CONSTANT_STRING ("auto")
   SWFDEC_AS_CONSTANT_STRING ("Matrix")
+  SWFDEC_AS_CONSTANT_STRING ("ASSetNative")
+  SWFDEC_AS_CONSTANT_STRING ("ASSetNativeAccessor")
+  SWFDEC_AS_CONSTANT_STRING ("LocalConnection")
+  SWFDEC_AS_CONSTANT_STRING ("filters")
   /* add more here */
   { 0, 0, "" }
 };
@@ -74,34 +74,27 @@ swfdec_as_super_init (SwfdecAsSuper *super)
 {
 }
 
-void
-swfdec_as_super_new (SwfdecAsFrame *frame, SwfdecAsObject *thisp, SwfdecAsObject *ref)
+SwfdecAsSuper *
+swfdec_as_super_new (SwfdecAsContext *context, SwfdecAsObject *thisp, 
+    SwfdecAsObject *ref)
 {
-  SwfdecAsContext *context;
   SwfdecAsObject *object;
   SwfdecAsSuper *super;
 
-  g_return_if_fail (frame != NULL);
-  g_return_if_fail (thisp != NULL);
+  g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), NULL);
+  g_return_val_if_fail (thisp != NULL, NULL);
   
-  if (frame->super != NULL)
-    return;
-  context = thisp->context;
   if (context->version <= 5)
-    return;
+    return NULL;
 
   super = g_object_new (SWFDEC_TYPE_AS_SUPER, "context", context, NULL);
-  frame->super = super;
   super->thisp = swfdec_as_object_resolve (thisp);
-  if (context->version <= 5) {
-    super->object = NULL;
-  } else {
-    super->object = ref;
-  }
+  super->object = ref;
 
   object = swfdec_as_object_new_empty (context);
   object->super = TRUE;
   swfdec_as_object_set_relay (object, SWFDEC_AS_RELAY (super));
+  return super;
 }
 
 SwfdecAsObject *
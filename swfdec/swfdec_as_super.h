@@ -48,7 +48,7 @@ struct _SwfdecAsSuperClass {
 
 GType		swfdec_as_super_get_type	(void);
 
-void		swfdec_as_super_new		(SwfdecAsFrame *	frame,
+SwfdecAsSuper *	swfdec_as_super_new		(SwfdecAsContext *	context,
 						 SwfdecAsObject *	thisp,
 						 SwfdecAsObject *	ref);
 SwfdecAsObject *swfdec_as_super_resolve_property(SwfdecAsSuper *	super,
@@ -64,12 +64,12 @@
  * @SWFDEC_AS_TYPE_UNDEFINED: the special undefined value
  * @SWFDEC_AS_TYPE_NULL: the spaecial null value
  * @SWFDEC_AS_TYPE_BOOLEAN: a boolean value - true or false
- * @SWFDEC_AS_TYPE_INT: reserved value for integers. Should the need arise for
- *                      performance enhancements - especially on embedded 
- *                      devices - it might be useful to implement this type.
- *                      For now, this type will never appear in Swfdec. Using 
- *                      it will cause Swfdec to crash.
- * @SWFDEC_AS_TYPE_NUMBER: a double value - also used for integer numbers
+ * @SWFDEC_AS_TYPE_INT: an integer number stored directly inside the value. 
+ *                      Integers are a more compact representation of numbers
+ *                      and behave like @SWFDEC_AS_TYPE_NUMBER in every respect.
+ *                      Use SWFDEC_AS_VALUE_IS_NUMBER() to check for numbers.
+ * @SWFDEC_AS_TYPE_NUMBER: a double value - used for all numbers that cannot 
+ *                         be represented as integers
  * @SWFDEC_AS_TYPE_STRING: a string. Strings are garbage-collected and unique.
  * @SWFDEC_AS_TYPE_OBJECT: an object - must be of type #SwfdecAsObject
  * @SWFDEC_AS_TYPE_MOVIE: an internal type used only inside #SwfdecPlayer 
@@ -161,12 +161,55 @@
  * Returns: a double. It can be NaN or +-Infinity, but not -0.0
  */
 
+/**
+ * SWFDEC_AS_VALUE_IS_NUMBER:
+ * @val: value to check
+ *
+ * Checks if @val is a number. Note that numbers can be stored either as
+ * immediate integers or as garbage-collected doubles, so don't check the type
+ * of the value directly.
+ *
+ * Returns: %TRUE if @val is a number
+ */
+
+/**
+ * SWFDEC_AS_VALUE_GET_INT:
+ * @val: value to get, the value must be of type %SWFDEC_AS_TYPE_INT
+ *
+ * Gets the integer stored inside @val.
+ *
+ * Returns: the integer
+ */
+
+/**
+ * SWFDEC_AS_VALUE_INT_FITS:
+ * @i: integer to check
+ *
+ * Checks if the integer @i can be stored inside a #SwfdecAsValue without 
+ * allocating memory. On 64bit platforms all 32bit integers fit.
+ *
+ * Returns: %TRUE if SWFDEC_AS_VALUE_FROM_INT() may be used on @i
+ */
+
+/**
+ * SWFDEC_AS_VALUE_FROM_INT:
+ * @i: integer to convert, it must satisfy SWFDEC_AS_VALUE_INT_FITS()
+ *
+ * Converts the given integer to a #SwfdecAsValue. If you don't know if the
+ * integer fits, use swfdec_as_value_from_integer() instead.
+ *
+ * Returns: a SwfdecAsValue representing @i
+ */
+
 /**
  * SWFDEC_AS_VALUE_GET_STRING:
  * @val: value to get, the value must reference a string
  *
  * Gets the string associated with @val. If you are not sure that the value is
- * a string value, consider using swfdec_as_value_to_string() instead.
+ * a string value, consider using swfdec_as_value_to_string() instead. That
+ * function must also be used for values that may be the result of
+ * concatenating strings in a script, their contents are only computed on
+ * demand.
  *
  * Returns: a garbage-collected string.
  */
@@ -237,9 +280,9 @@
  * @cx: The context to use
  * @i: integer value to set
  *
- * Creates a garbage-collected value representing @i and returns it.
- * Currently this function is a macro that calls swfdec_as_value_set_number(),
- * but this may change in future versions of Swfdec.
+ * Creates a value representing @i and returns it. Currently this function is
+ * a macro that calls swfdec_as_value_from_number(), but this may change in 
+ * future versions of Swfdec.
  *
  * Returns: The new value representing @i
  */
@@ -249,7 +292,8 @@
  * @context: The context to use
  * @number: double value to set
  *
- * Creates a garbage-collected value representing @number and returns it.
+ * Creates a value representing @number and returns it. Integral numbers are
+ * stored inside the value, all other numbers are garbage-collected.
  *
  * Returns: The new value representing @number
  */
@@ -261,6 +305,13 @@ swfdec_as_value_from_number (SwfdecAsContext *context,
 
   g_return_val_if_fail (SWFDEC_IS_AS_CONTEXT (context), SWFDEC_AS_VALUE_UNDEFINED);
 
+  /* -0.0 compares equal to 0 but must keep its sign, so it stays boxed */
+  if (d >= G_MININT32 && d <= G_MAXINT32) {
+    int i = (int) d;
+    if (i == d && (i != 0 || !signbit (d)) && SWFDEC_AS_VALUE_INT_FITS (i))
+      return SWFDEC_AS_VALUE_FROM_INT (i);
+  }
+
   dval = swfdec_as_gcable_new (context, SwfdecAsDoubleValue);
   dval->number = d;
   SWFDEC_AS_GCABLE_SET_NEXT (dval, context->numbers);
@@ -310,7 +361,11 @@ swfdec_as_str_concat (SwfdecAsContext *cx, const char * s1, const char *s2)
 const char *
 swfdec_as_integer_to_string (SwfdecAsContext *context, int i)
 {
-  return swfdec_as_context_give_string (context, g_strdup_printf ("%d", i));
+  char s[16];
+  int len;
+
+  len = g_snprintf (s, sizeof (s), "%d", i);
+  return swfdec_as_context_get_string_len (context, s, len);
 }
 
 /**
@@ -426,9 +481,8 @@ swfdec_as_double_to_string (SwfdecAsContext *context, double d)
     while (*end != 0)
       *start++ = *end++;
   }
-  /* end string */
-  *start = 0;
-  return swfdec_as_context_get_string (context, s);
+  /* the string ends at start */
+  return swfdec_as_context_get_string_len (context, s, start - s);
 }
 
 /**
@@ -451,7 +505,7 @@ swfdec_as_value_to_string (SwfdecAsContext *context, SwfdecAsValue value)
 
   switch (SWFDEC_AS_VALUE_GET_TYPE (value)) {
     case SWFDEC_AS_TYPE_STRING:
-      return SWFDEC_AS_VALUE_GET_STRING (value);
+      return SWFDEC_AS_VALUE_GET_FLAT_STRING (value);
     case SWFDEC_AS_TYPE_UNDEFINED:
       if (context->version > 6)
 	return SWFDEC_AS_STR_undefined;
@@ -461,6 +515,8 @@ swfdec_as_value_to_string (SwfdecAsContext *context, SwfdecAsValue value)
       return SWFDEC_AS_VALUE_GET_BOOLEAN (value) ? SWFDEC_AS_STR_true : SWFDEC_AS_STR_false;
     case SWFDEC_AS_TYPE_NULL:
       return SWFDEC_AS_STR_null;
+    case SWFDEC_AS_TYPE_INT:
+      return swfdec_as_integer_to_string (context, SWFDEC_AS_VALUE_GET_INT (value));
     case SWFDEC_AS_TYPE_NUMBER:
       return swfdec_as_double_to_string (context, SWFDEC_AS_VALUE_GET_NUMBER (value));
     case SWFDEC_AS_TYPE_OBJECT:
@@ -472,7 +528,7 @@ swfdec_as_value_to_string (SwfdecAsContext *context, SwfdecAsValue value)
 	  SwfdecAsValue ret;
 	  swfdec_as_object_call (object, SWFDEC_AS_STR_toString, 0, NULL, &ret);
 	  if (SWFDEC_AS_VALUE_IS_STRING (ret))
-	    return SWFDEC_AS_VALUE_GET_STRING (ret);
+	    return SWFDEC_AS_VALUE_GET_FLAT_STRING (ret);
 	  else if (SWFDEC_IS_AS_SUPER (object->relay))
 	    return SWFDEC_AS_STR__type_Object_;
 	  else if (SWFDEC_IS_AS_FUNCTION (object->relay))
@@ -491,7 +547,6 @@ swfdec_as_value_to_string (SwfdecAsContext *context, SwfdecAsValue value)
 	str = swfdec_movie_get_path (movie, TRUE);
 	return swfdec_as_context_give_string (context, str);
       }
-    case SWFDEC_AS_TYPE_INT:
     default:
       g_assert_not_reached ();
       return SWFDEC_AS_STR_EMPTY;
@@ -523,6 +578,7 @@ swfdec_as_value_to_number (SwfdecAsContext *context, SwfdecAsValue value)
       return (context->version >= 7) ? NAN : 0.0;
     case SWFDEC_AS_TYPE_BOOLEAN:
       return SWFDEC_AS_VALUE_GET_BOOLEAN (value) ? 1 : 0;
+    case SWFDEC_AS_TYPE_INT:
     case SWFDEC_AS_TYPE_NUMBER:
       return SWFDEC_AS_VALUE_GET_NUMBER (value);
     case SWFDEC_AS_TYPE_STRING:
@@ -532,7 +588,7 @@ swfdec_as_value_to_number (SwfdecAsContext *context, SwfdecAsValue value)
 	double d;
 	
 	// FIXME: We should most likely copy Tamarin's code here (MathUtils.cpp)
-	s = SWFDEC_AS_VALUE_GET_STRING (value);
+	s = SWFDEC_AS_VALUE_GET_FLAT_STRING (value);
 	if (s == SWFDEC_AS_STR_EMPTY)
 	  return (context->version >= 5) ? NAN : 0.0;
 	if (context->version > 5 && s[0] == '0' &&
@@ -555,7 +611,6 @@ swfdec_as_value_to_number (SwfdecAsContext *context, SwfdecAsValue value)
     case SWFDEC_AS_TYPE_OBJECT:
     case SWFDEC_AS_TYPE_MOVIE:
       return (context->version >= 5) ? NAN : 0.0;
-    case SWFDEC_AS_TYPE_INT:
     default:
       g_assert_not_reached ();
       return NAN;
@@ -600,6 +655,9 @@ swfdec_as_value_to_integer (SwfdecAsContext *context, SwfdecAsValue value)
 {
   double d;
   
+  if (SWFDEC_AS_VALUE_IS_INT (value))
+    return SWFDEC_AS_VALUE_GET_INT (value);
+
   d = swfdec_as_value_to_number (context, value);
   return swfdec_as_double_to_integer (d);
 }
@@ -630,6 +688,7 @@ swfdec_as_value_to_object (SwfdecAsContext *context, SwfdecAsValue value)
     case SWFDEC_AS_TYPE_UNDEFINED:
     case SWFDEC_AS_TYPE_NULL:
       return NULL;
+    case SWFDEC_AS_TYPE_INT:
     case SWFDEC_AS_TYPE_NUMBER:
       s = SWFDEC_AS_STR_Number;
       break;
@@ -642,7 +701,6 @@ swfdec_as_value_to_object (SwfdecAsContext *context, SwfdecAsValue value)
     case SWFDEC_AS_TYPE_OBJECT:
     case SWFDEC_AS_TYPE_MOVIE:
       return SWFDEC_AS_VALUE_GET_COMPOSITE (value);
-    case SWFDEC_AS_TYPE_INT:
     default:
       g_assert_not_reached ();
       return NULL;
@@ -683,6 +741,8 @@ swfdec_as_value_to_boolean (SwfdecAsContext *context, SwfdecAsValue value)
       return FALSE;
     case SWFDEC_AS_TYPE_BOOLEAN:
       return SWFDEC_AS_VALUE_GET_BOOLEAN (value);
+    case SWFDEC_AS_TYPE_INT:
+      return SWFDEC_AS_VALUE_GET_INT (value) != 0;
     case SWFDEC_AS_TYPE_NUMBER:
       {
 	double d = SWFDEC_AS_VALUE_GET_NUMBER (value);
@@ -693,12 +753,11 @@ swfdec_as_value_to_boolean (SwfdecAsContext *context, SwfdecAsValue value)
 	double d = swfdec_as_value_to_number (context, value);
 	return d != 0.0 && !isnan (d);
       } else {
-	return SWFDEC_AS_VALUE_GET_STRING (value) != SWFDEC_AS_STR_EMPTY;
+	return SWFDEC_AS_VALUE_GET_FLAT_STRING (value) != SWFDEC_AS_STR_EMPTY;
       }
     case SWFDEC_AS_TYPE_OBJECT:
     case SWFDEC_AS_TYPE_MOVIE:
       return TRUE;
-    case SWFDEC_AS_TYPE_INT:
     default:
       g_assert_not_reached ();
       return FALSE;
@@ -37,6 +37,7 @@ typedef enum {
   SWFDEC_AS_TYPE_MOVIE = 7
 } SwfdecAsValueType;
 
+typedef struct _SwfdecAsCloner SwfdecAsCloner;
 typedef struct _SwfdecAsContext SwfdecAsContext;
 typedef struct _SwfdecAsDebugger SwfdecAsDebugger;
 typedef struct _SwfdecAsDoubleValue SwfdecAsDoubleValue;
@@ -85,8 +86,19 @@ struct _SwfdecAsDoubleValue {
   double		number;
 };
 
-#define SWFDEC_AS_VALUE_IS_NUMBER(val) (SWFDEC_AS_VALUE_GET_TYPE (val) == SWFDEC_AS_TYPE_NUMBER)
-#define SWFDEC_AS_VALUE_GET_NUMBER(val) (((SwfdecAsDoubleValue *) SWFDEC_AS_VALUE_GET_VALUE(val))->number)
+/* integers are stored immediately in the value bits, the full int32 range
+ * fits on 64bit, on 32bit only 29 bits are available */
+#define SWFDEC_AS_VALUE_IS_INT(val) (SWFDEC_AS_VALUE_GET_TYPE (val) == SWFDEC_AS_TYPE_INT)
+#define SWFDEC_AS_VALUE_GET_INT(val) ((int) (((gssize) (val)) >> SWFDEC_AS_VALUE_TYPE_BITS))
+#define SWFDEC_AS_VALUE_FROM_INT(i) ((((SwfdecAsValue) (gssize) (i)) << SWFDEC_AS_VALUE_TYPE_BITS) | SWFDEC_AS_TYPE_INT)
+#define SWFDEC_AS_VALUE_INT_FITS(i) (GLIB_SIZEOF_SIZE_T > 4 || \
+    ((i) >= -(1 << (31 - SWFDEC_AS_VALUE_TYPE_BITS)) && (i) < (1 << (31 - SWFDEC_AS_VALUE_TYPE_BITS))))
+
+/* NB: both immediate integers and boxed doubles are numbers */
+#define SWFDEC_AS_VALUE_IS_NUMBER(val) ((guint) SWFDEC_AS_VALUE_GET_TYPE (val) - SWFDEC_AS_TYPE_INT <= 1)
+#define SWFDEC_AS_VALUE_GET_NUMBER(val) (SWFDEC_AS_VALUE_IS_INT (val) ? \
+    (double) SWFDEC_AS_VALUE_GET_INT (val) : \
+    ((SwfdecAsDoubleValue *) SWFDEC_AS_VALUE_GET_VALUE(val))->number)
 
 #define SWFDEC_AS_VALUE_IS_STRING(val) (SWFDEC_AS_VALUE_GET_TYPE (val) == SWFDEC_AS_TYPE_STRING)
 #define SWFDEC_AS_VALUE_GET_STRING(val) (((SwfdecAsStringValue *) SWFDEC_AS_VALUE_GET_VALUE(val))->string)
@@ -28,6 +28,7 @@ extern const struct {
   guint x, y; 
   SwfdecAsNative func; 
   const char *name; 
+  gboolean fast;
 } native_funcs[];
 
 G_END_DECLS
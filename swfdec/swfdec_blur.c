@@ -0,0 +1,282 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec_blur.h"
+
+#include <math.h>
+#include <string.h>
+
+#include "swfdec_debug.h"
+
+/* The blur is a box blur that is applied quality times, just like the one in
+ * the Adobe Flash player. The box is separable, so it is done as a horizontal
+ * and a vertical pass, each of which keeps a running sum so the cost per 
+ * pixel doesn't depend on the size of the box. Boxes may have a fractional 
+ * size, the outermost pixels are weighted less in that case. All weights are 
+ * 16.16 fixed point numbers that sum up to at most 1.0. */
+
+/* The vertical pass works on whole rows at once, so the compiler can use 
+ * vector instructions for it. Let the dynamic linker pick the best ones the
+ * CPU supports if the toolchain can do that. */
+#ifdef HAVE_TARGET_CLONES
+#define SWFDEC_BLUR_KERNEL __attribute__ ((target_clones ("avx2", "sse4.1", "default")))
+#else
+#define SWFDEC_BLUR_KERNEL
+#endif
+
+struct _SwfdecBlur {
+  guint		quality;	/* number of passes */
+  guint		xradius;	/* pixels the box extends to the left and right */
+  guint32	xcenter;	/* weight of the pixels inside the box */
+  guint32	xedge;		/* weight of the leftmost and rightmost pixel */
+  guint		yradius;	/* pixels the box extends to the top and bottom */
+  guint32	ycenter;	/* weight of the pixels inside the box */
+  guint32	yedge;		/* weight of the topmost and bottommost pixel */
+};
+
+static void
+swfdec_blur_compute_weights (double size, guint *radius, guint32 *center,
+    guint32 *edge)
+{
+  size = MAX (size, 1);
+  *radius = ceil ((size - 1) / 2);
+  if (*radius == 0) {
+    *center = 65536;
+    *edge = 0;
+    return;
+  }
+  *center = 65536 / size;
+  *edge = *center * (1 - (2 * *radius + 1 - size) / 2);
+}
+
+/**
+ * swfdec_blur_new:
+ * @x: horizontal size of the box in pixels
+ * @y: vertical size of the box in pixels
+ * @quality: number of times the box is applied
+ *
+ * Creates a blur that can be applied to images using swfdec_blur_apply() or 
+ * swfdec_blur_apply_alpha().
+ *
+ * Returns: a new #SwfdecBlur, free it with swfdec_blur_free()
+ **/
+SwfdecBlur *
+swfdec_blur_new (double x, double y, guint quality)
+{
+  SwfdecBlur *blur;
+
+  g_return_val_if_fail (quality > 0, NULL);
+
+  blur = g_slice_new (SwfdecBlur);
+  blur->quality = quality;
+  swfdec_blur_compute_weights (x, &blur->xradius, &blur->xcenter, &blur->xedge);
+  swfdec_blur_compute_weights (y, &blur->yradius, &blur->ycenter, &blur->yedge);
+  return blur;
+}
+
+void
+swfdec_blur_free (SwfdecBlur *blur)
+{
+  g_return_if_fail (blur != NULL);
+
+  g_slice_free (SwfdecBlur, blur);
+}
+
+/**
+ * swfdec_blur_get_x_border:
+ * @blur: a #SwfdecBlur
+ *
+ * Queries how many pixels the blur spreads an image to the left and right.
+ * Images should have a transparent border of this size, as pixels outside 
+ * the image are treated as transparent.
+ *
+ * Returns: the number of pixels the blur adds to each side
+ **/
+guint
+swfdec_blur_get_x_border (SwfdecBlur *blur)
+{
+  g_return_val_if_fail (blur != NULL, 0);
+
+  return blur->xradius * blur->quality;
+}
+
+/**
+ * swfdec_blur_get_y_border:
+ * @blur: a #SwfdecBlur
+ *
+ * Queries how many pixels the blur spreads an image to the top and bottom.
+ * See swfdec_blur_get_x_border() for details.
+ *
+ * Returns: the number of pixels the blur adds to each side
+ **/
+guint
+swfdec_blur_get_y_border (SwfdecBlur *blur)
+{
+  g_return_val_if_fail (blur != NULL, 0);
+
+  return blur->yradius * blur->quality;
+}
+
+/* blurs one row of width pixels with bpp channels each. src must be padded 
+ * with radius transparent pixels on both sides */
+static void
+swfdec_blur_horizontal (guint8 *dest, const guint8 *src, guint width, guint bpp,
+    guint radius, guint32 center, guint32 edge)
+{
+  const guint8 *left, *right;
+  guint32 inner[4];
+  guint i, c;
+
+  left = src - radius * bpp;
+  right = src + radius * bpp;
+  for (c = 0; c < bpp; c++) {
+    inner[c] = 0;
+    for (i = 1; i < 2 * radius; i++)
+      inner[c] += left[i * bpp + c];
+  }
+  for (i = 0; i < width * bpp; i += bpp) {
+    for (c = 0; c < bpp; c++) {
+      dest[i + c] = (inner[c] * center + (left[i + c] + right[i + c]) * edge + 0x8000) >> 16;
+      inner[c] += right[i + c] - left[i + bpp + c];
+    }
+  }
+}
+
+/* computes one output row of the vertical pass from the rows at the edges of
+ * the box and moves the sum of the inner rows one row down */
+SWFDEC_BLUR_KERNEL static void
+swfdec_blur_vertical (guint8 *dest, guint32 *inner, const guint8 *top, 
+    const guint8 *bottom, const guint8 *next, guint n, guint32 center, 
+    guint32 edge)
+{
+  guint i;
+
+  for (i = 0; i < n; i++) {
+    dest[i] = (inner[i] * center + (top[i] + bottom[i]) * edge + 0x8000) >> 16;
+    inner[i] += bottom[i] - next[i];
+  }
+}
+
+SWFDEC_BLUR_KERNEL static void
+swfdec_blur_accumulate (guint32 *inner, const guint8 *row, guint n)
+{
+  guint i;
+
+  for (i = 0; i < n; i++)
+    inner[i] += row[i];
+}
+
+static void
+swfdec_blur_do_apply (SwfdecBlur *blur, guint width, guint height, 
+    guint8 *data, guint stride, guint bpp)
+{
+  guint8 *tmp, *src;
+  guint32 *inner;
+  guint pass, y, xr, yr, rowbytes;
+
+  xr = blur->xradius;
+  yr = blur->yradius;
+  rowbytes = width * bpp;
+  /* tmp is padded with transparent pixels, so the kernels don't need to 
+   * check bounds */
+  tmp = g_malloc (MAX ((width + 2 * xr) * bpp, rowbytes * (height + 2 * yr)));
+  inner = g_new (guint32, rowbytes);
+
+  for (pass = 0; pass < blur->quality; pass++) {
+    if (xr > 0) {
+      src = tmp + xr * bpp;
+      memset (tmp, 0, xr * bpp);
+      memset (src + rowbytes, 0, xr * bpp);
+      for (y = 0; y < height; y++) {
+	memcpy (src, data + y * stride, rowbytes);
+	swfdec_blur_horizontal (data + y * stride, src, width, bpp,
+	    xr, blur->xcenter, blur->xedge);
+      }
+    }
+    if (yr > 0) {
+      src = tmp + yr * rowbytes;
+      memset (tmp, 0, yr * rowbytes);
+      memset (src + height * rowbytes, 0, yr * rowbytes);
+      for (y = 0; y < height; y++)
+	memcpy (src + y * rowbytes, data + y * stride, rowbytes);
+      memset (inner, 0, rowbytes * sizeof (guint32));
+      for (y = 1; y < 2 * yr; y++)
+	swfdec_blur_accumulate (inner, tmp + y * rowbytes, rowbytes);
+      for (y = 0; y < height; y++) {
+	swfdec_blur_vertical (data + y * stride, inner, tmp + y * rowbytes,
+	    tmp + (y + 2 * yr) * rowbytes, tmp + (y + 1) * rowbytes, rowbytes,
+	    blur->ycenter, blur->yedge);
+      }
+    }
+  }
+
+  g_free (inner);
+  g_free (tmp);
+}
+
+/**
+ * swfdec_blur_apply:
+ * @blur: a #SwfdecBlur
+ * @width: width of the image
+ * @height: height of the image
+ * @data: image data in the format of a CAIRO_FORMAT_ARGB32 image
+ * @stride: rowstride of @data
+ *
+ * Blurs the given image in place.
+ **/
+void
+swfdec_blur_apply (SwfdecBlur *blur, guint width, guint height, 
+    guint8 *data, guint stride)
+{
+  g_return_if_fail (blur != NULL);
+  g_return_if_fail (data != NULL);
+  g_return_if_fail (stride >= width * 4);
+
+  if (width == 0 || height == 0)
+    return;
+  swfdec_blur_do_apply (blur, width, height, data, stride, 4);
+}
+
+/**
+ * swfdec_blur_apply_alpha:
+ * @blur: a #SwfdecBlur
+ * @width: width of the image
+ * @height: height of the image
+ * @data: image data in the format of a CAIRO_FORMAT_A8 image
+ * @stride: rowstride of @data
+ *
+ * Blurs the given alpha mask in place. This is what glow and drop shadow 
+ * effects need, and it is 4 times faster than blurring a color image.
+ **/
+void
+swfdec_blur_apply_alpha (SwfdecBlur *blur, guint width, guint height, 
+    guint8 *data, guint stride)
+{
+  g_return_if_fail (blur != NULL);
+  g_return_if_fail (data != NULL);
+  g_return_if_fail (stride >= width);
+
+  if (width == 0 || height == 0)
+    return;
+  swfdec_blur_do_apply (blur, width, height, data, stride, 1);
+}
@@ -0,0 +1,51 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_BLUR_H_
+#define _SWFDEC_BLUR_H_
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+
+typedef struct _SwfdecBlur SwfdecBlur;
+
+SwfdecBlur *	swfdec_blur_new			(double			x,
+						 double			y,
+						 guint			quality);
+void		swfdec_blur_free		(SwfdecBlur *		blur);
+
+guint		swfdec_blur_get_x_border	(SwfdecBlur *		blur);
+guint		swfdec_blur_get_y_border	(SwfdecBlur *		blur);
+
+void		swfdec_blur_apply		(SwfdecBlur *		blur,
+						 guint			width,
+						 guint			height,
+						 guint8 *		data,
+						 guint			stride);
+void		swfdec_blur_apply_alpha		(SwfdecBlur *		blur,
+						 guint			width,
+						 guint			height,
+						 guint8 *		data,
+						 guint			stride);
+
+
+G_END_DECLS
+#endif
@@ -41,41 +41,18 @@ swfdec_blur_filter_clone (SwfdecFilter *dfilter, SwfdecFilter *sfilter)
 }
 
 static void
-swfdec_blur_filter_create_convolution_matrix (SwfdecBlurFilter *blur,
+swfdec_blur_filter_create_blur (SwfdecBlurFilter *blur,
     double xscale, double yscale)
 {
-  guint x, y, w, h;
-  double div, blurx, blury;
-
-  if (blur->matrix && xscale == blur->xscale && yscale == blur->yscale)
+  if (blur->blur && xscale == blur->xscale && yscale == blur->yscale)
     return;
 
-  blurx = MAX (blur->x * xscale, 1);
-  blury = MAX (blur->y * yscale, 1);
-  w = ceil ((blurx - 1) / 2);
-  w = w * 2 + 1;
-  h = ceil ((blury - 1) / 2);
-  h = h * 2 + 1;
-
-  blur->matrix = swfdec_convolution_matrix_new (w, h);
+  if (blur->blur)
+    swfdec_blur_free (blur->blur);
+  blur->blur = swfdec_blur_new (blur->x * xscale, blur->y * yscale, 
+      blur->quality);
   blur->xscale = xscale;
   blur->yscale = yscale;
-
-  div = 1.0 / (blurx * blury);
-  for (y = 0; y < h; y++) {
-    double val = div;
-    if (y == 0 || y == w - 1) {
-      val *= (1 - (h - MAX (blury, 1)) / 2);
-    }
-    for (x = 0; x < w; x++) {
-      if (x == 0 || x == w - 1) {
-	swfdec_convolution_matrix_set (blur->matrix, x, y,
-	    val * (1 - (w - MAX (blurx, 1)) / 2));
-      } else {
-	swfdec_convolution_matrix_set (blur->matrix, x, y, val);
-      }
-    }
-  }
 }
 
 static void
@@ -104,65 +81,36 @@ swfdec_blur_filter_apply (SwfdecFilter *filter, cairo_pattern_t *pattern,
     double xscale, double yscale, const SwfdecRectangle *rect)
 {
   SwfdecBlurFilter *blur = SWFDEC_BLUR_FILTER (filter);
-  cairo_surface_t *a, *b;
-  guint i, j, x, y;
-  guint8 *adata, *bdata;
-  guint astride, bstride;
+  cairo_surface_t *surface;
+  guint x, y;
   cairo_t *cr;
 
-  if (blur->x <= 1.0 && blur->y <= 1.0)
+  if ((blur->x <= 1.0 && blur->y <= 1.0) || blur->quality == 0)
     return cairo_pattern_reference (pattern);
 
-  swfdec_blur_filter_create_convolution_matrix (blur, xscale, yscale);
-  x = swfdec_convolution_matrix_get_width (blur->matrix) / 2;
-  y = swfdec_convolution_matrix_get_height (blur->matrix) / 2;
-
-  /* FIXME: make this work in a single pass (requires smarter matrix construction) */
-  a = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
-      rect->width + 2 * x * blur->quality,
-      rect->height + 2 * y * blur->quality);
-  cairo_surface_set_device_offset (a, 
-      - (double) rect->x + x * blur->quality, - (double) rect->y + y * blur->quality);
-  b = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
-      rect->width + 2 * x * blur->quality,
-      rect->height + 2 * y * blur->quality);
-  cairo_surface_set_device_offset (b, 
-      - (double) rect->x + x * blur->quality, - (double) rect->y + y * blur->quality);
-
-  cr = cairo_create (b);
+  swfdec_blur_filter_create_blur (blur, xscale, yscale);
+  x = swfdec_blur_get_x_border (blur->blur);
+  y = swfdec_blur_get_y_border (blur->blur);
+
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
+      rect->width + 2 * x, rect->height + 2 * y);
+  cairo_surface_set_device_offset (surface, 
+      - (double) rect->x + x, - (double) rect->y + y);
+
+  cr = cairo_create (surface);
   cairo_set_source (cr, pattern);
   cairo_rectangle (cr, rect->x, rect->y, rect->width, rect->height);
   cairo_fill (cr);
   cairo_destroy (cr);
-  cairo_surface_flush (b);
-
-  adata = cairo_image_surface_get_data (a);
-  astride = cairo_image_surface_get_stride (a);
-  bdata = cairo_image_surface_get_data (b);
-  bstride = cairo_image_surface_get_stride (b);
-  for (i = 1, j = blur->quality - 1; i <= blur->quality; i++, j--) {
-    swfdec_convolution_matrix_apply (blur->matrix,
-	rect->width + 2 * x * i, rect->height + 2 * y * i,
-	adata + 4 * x * j + astride * y * j, astride,
-	bdata + 4 * x * j + bstride * y * j, bstride);
-    i++;
-    j--;
-    if (i > blur->quality) {
-      cairo_surface_destroy (b);
-      goto out;
-    }
-    swfdec_convolution_matrix_apply (blur->matrix,
-	rect->width + 2 * x * i, rect->height + 2 * y * i,
-	bdata + 4 * x * j + bstride * y * j, bstride,
-	adata + 4 * x * j + astride * y * j, astride);
-  }
+  cairo_surface_flush (surface);
+
+  swfdec_blur_apply (blur->blur, rect->width + 2 * x, rect->height + 2 * y,
+      cairo_image_surface_get_data (surface), 
+      cairo_image_surface_get_stride (surface));
 
-  cairo_surface_destroy (a);
-  a = b;
-out:
-  cairo_surface_mark_dirty (a);
-  pattern = cairo_pattern_create_for_surface (a);
-  cairo_surface_destroy (a);
+  cairo_surface_mark_dirty (surface);
+  pattern = cairo_pattern_create_for_surface (surface);
+  cairo_surface_destroy (surface);
 
   return pattern;
 }
@@ -172,9 +120,9 @@ swfdec_blur_filter_dispose (GObject *object)
 {
   SwfdecBlurFilter *blur = SWFDEC_BLUR_FILTER (object);
 
-  if (blur->matrix) {
-    swfdec_convolution_matrix_free (blur->matrix);
-    blur->matrix = NULL;
+  if (blur->blur) {
+    swfdec_blur_free (blur->blur);
+    blur->blur = NULL;
   }
 
   G_OBJECT_CLASS (swfdec_blur_filter_parent_class)->dispose (object);
@@ -206,9 +154,9 @@ swfdec_blur_filter_invalidate (SwfdecBlurFilter *blur)
 {
   g_return_if_fail (SWFDEC_IS_BLUR_FILTER (blur));
 
-  if (blur->matrix) {
-    swfdec_convolution_matrix_free (blur->matrix);
-    blur->matrix = NULL;
+  if (blur->blur) {
+    swfdec_blur_free (blur->blur);
+    blur->blur = NULL;
   }
 }
 
@@ -21,7 +21,7 @@
 #define _SWFDEC_BLUR_FILTER_H_
 
 #include <swfdec/swfdec_filter.h>
-#include <swfdec/swfdec_convolution_matrix.h>
+#include <swfdec/swfdec_blur.h>
 
 G_BEGIN_DECLS
 
@@ -43,9 +43,9 @@ struct _SwfdecBlurFilter {
   double		y;		/* blur in vertical direction */
   guint			quality;	/* number of passes */
 
-  SwfdecConvolutionMatrix *matrix;	/* matrix if computed or NULL */
-  double		xscale;		/* xscale matrix was computed for */
-  double		yscale;		/* yscale matrix was computed for */
+  SwfdecBlur *		blur;		/* blur if computed or NULL */
+  double		xscale;		/* xscale blur was computed for */
+  double		yscale;		/* yscale blur was computed for */
 };
 
 struct _SwfdecBlurFilterClass {
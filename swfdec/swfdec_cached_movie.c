@@ -0,0 +1,136 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec_cached_movie.h"
+#include "swfdec_debug.h"
+
+G_DEFINE_TYPE (SwfdecCachedMovie, swfdec_cached_movie, SWFDEC_TYPE_CACHED_IMAGE)
+
+static void
+swfdec_cached_movie_class_init (SwfdecCachedMovieClass * g_class)
+{
+}
+
+static void
+swfdec_cached_movie_init (SwfdecCachedMovie *cached)
+{
+  cairo_matrix_init_identity (&cached->matrix);
+}
+
+/**
+ * swfdec_cached_movie_new:
+ * @surface: the rendered contents of the movie
+ * @size: size of @surface in bytes
+ * @version: the cache version of the movie at the time it was rendered
+ * @matrix: the movie to stage matrix used for rendering. The translation must 
+ *          be pixel-aligned.
+ * @x: x coordinate of @surface's origin in stage coordinates
+ * @y: y coordinate of @surface's origin in stage coordinates
+ *
+ * Creates a new cache entry for a movie that was rendered into @surface.
+ *
+ * Returns: a new cache entry
+ **/
+SwfdecCachedMovie *
+swfdec_cached_movie_new (cairo_surface_t *surface, gsize size, guint version,
+    const cairo_matrix_t *matrix, int x, int y)
+{
+  SwfdecCachedMovie *cached;
+
+  g_return_val_if_fail (surface != NULL, NULL);
+  g_return_val_if_fail (size > 0, NULL);
+  g_return_val_if_fail (matrix != NULL, NULL);
+
+  size += sizeof (SwfdecCachedMovie);
+  cached = g_object_new (SWFDEC_TYPE_CACHED_MOVIE, "size", size, NULL);
+  SWFDEC_CACHED_IMAGE (cached)->surface = cairo_surface_reference (surface);
+  cached->version = version;
+  cached->matrix = *matrix;
+  cached->x = x;
+  cached->y = y;
+
+  return cached;
+}
+
+/**
+ * swfdec_cached_movie_matches:
+ * @cached: a cached movie
+ * @version: current cache version of the movie
+ * @trans: color transform the movie is going to be rendered with
+ * @matrix: movie to stage matrix the movie is going to be rendered with
+ *
+ * Checks if the contents of @cached can be used for rendering the movie. This
+ * is the case when neither the movie nor its children have changed and the 
+ * movie was only moved by full pixels.
+ *
+ * Returns: %TRUE if the cached surface can be used
+ **/
+gboolean
+swfdec_cached_movie_matches (SwfdecCachedMovie *cached, guint version,
+    const SwfdecColorTransform *trans, const cairo_matrix_t *matrix)
+{
+  SwfdecColorTransform ctrans;
+
+  g_return_val_if_fail (SWFDEC_IS_CACHED_MOVIE (cached), FALSE);
+  g_return_val_if_fail (trans != NULL, FALSE);
+  g_return_val_if_fail (matrix != NULL, FALSE);
+
+  if (cached->version != version)
+    return FALSE;
+  if (cached->matrix.xx != matrix->xx || cached->matrix.yx != matrix->yx ||
+      cached->matrix.xy != matrix->xy || cached->matrix.yy != matrix->yy)
+    return FALSE;
+  swfdec_cached_image_get_color_transform (SWFDEC_CACHED_IMAGE (cached), &ctrans);
+  return (trans->mask == ctrans.mask &&
+      trans->ra == ctrans.ra && 
+      trans->rb == ctrans.rb && 
+      trans->ga == ctrans.ga && 
+      trans->gb == ctrans.gb && 
+      trans->ba == ctrans.ba && 
+      trans->bb == ctrans.bb && 
+      trans->aa == ctrans.aa && 
+      trans->ab == ctrans.ab);
+}
+
+/**
+ * swfdec_cached_movie_get_position:
+ * @cached: a cached movie
+ * @matrix: the pixel-aligned movie to stage matrix the movie is rendered with
+ * @x: will be set to the x coordinate the surface should be painted at
+ * @y: will be set to the y coordinate the surface should be painted at
+ *
+ * Computes where the surface of @cached has to be painted to when the movie
+ * is rendered with @matrix. @matrix must match the @cached.
+ **/
+void
+swfdec_cached_movie_get_position (SwfdecCachedMovie *cached,
+    const cairo_matrix_t *matrix, int *x, int *y)
+{
+  g_return_if_fail (SWFDEC_IS_CACHED_MOVIE (cached));
+  g_return_if_fail (matrix != NULL);
+  g_return_if_fail (x != NULL);
+  g_return_if_fail (y != NULL);
+
+  *x = cached->x + (int) (matrix->x0 - cached->matrix.x0);
+  *y = cached->y + (int) (matrix->y0 - cached->matrix.y0);
+}
@@ -0,0 +1,71 @@
+/* Swfdec
+ * Copyright (c) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_CACHED_MOVIE_H_
+#define _SWFDEC_CACHED_MOVIE_H_
+
+#include <swfdec/swfdec_cached_image.h>
+
+G_BEGIN_DECLS
+
+typedef struct _SwfdecCachedMovie SwfdecCachedMovie;
+typedef struct _SwfdecCachedMovieClass SwfdecCachedMovieClass;
+
+#define SWFDEC_TYPE_CACHED_MOVIE                    (swfdec_cached_movie_get_type())
+#define SWFDEC_IS_CACHED_MOVIE(obj)                 (G_TYPE_CHECK_INSTANCE_TYPE ((obj), SWFDEC_TYPE_CACHED_MOVIE))
+#define SWFDEC_IS_CACHED_MOVIE_CLASS(klass)         (G_TYPE_CHECK_CLASS_TYPE ((klass), SWFDEC_TYPE_CACHED_MOVIE))
+#define SWFDEC_CACHED_MOVIE(obj)                    (G_TYPE_CHECK_INSTANCE_CAST ((obj), SWFDEC_TYPE_CACHED_MOVIE, SwfdecCachedMovie))
+#define SWFDEC_CACHED_MOVIE_CLASS(klass)            (G_TYPE_CHECK_CLASS_CAST ((klass), SWFDEC_TYPE_CACHED_MOVIE, SwfdecCachedMovieClass))
+#define SWFDEC_CACHED_MOVIE_GET_CLASS(obj)          (G_TYPE_INSTANCE_GET_CLASS ((obj), SWFDEC_TYPE_CACHED_MOVIE, SwfdecCachedMovieClass))
+
+
+struct _SwfdecCachedMovie {
+  SwfdecCachedImage	image;
+
+  guint			version;	/* cache version of the movie when it was rendered */
+  cairo_matrix_t	matrix;		/* movie => stage matrix used for rendering */
+  int			x;		/* stage position of the surface's top left corner */
+  int			y;
+};
+
+struct _SwfdecCachedMovieClass
+{
+  SwfdecCachedImageClass	image_class;
+};
+
+GType			swfdec_cached_movie_get_type	(void);
+
+SwfdecCachedMovie *	swfdec_cached_movie_new		(cairo_surface_t *	surface,
+							 gsize			size,
+							 guint			version,
+							 const cairo_matrix_t *	matrix,
+							 int			x,
+							 int			y);
+
+gboolean		swfdec_cached_movie_matches	(SwfdecCachedMovie *	cached,
+							 guint			version,
+							 const SwfdecColorTransform *trans,
+							 const cairo_matrix_t *	matrix);
+void			swfdec_cached_movie_get_position (SwfdecCachedMovie *	cached,
+							 const cairo_matrix_t *	matrix,
+							 int *			x,
+							 int *			y);
+
+G_END_DECLS
+#endif
@@ -143,68 +143,11 @@ ASSetPropFlags (NetStream.prototype, null, 3);
 
 /*** XMLNode ***/
 
-XMLNode = ASconstructor (253, 0);
-
-XMLNode.prototype.cloneNode = ASnative (253, 1);
-XMLNode.prototype.removeNode = ASnative (253, 2);
-XMLNode.prototype.insertBefore = ASnative (253, 3);
-XMLNode.prototype.appendChild = ASnative (253, 4);
-XMLNode.prototype.hasChildNodes = ASnative (253, 5);
-XMLNode.prototype.toString = ASnative (253, 6);
-XMLNode.prototype.getNamespaceForPrefix = ASnative (253, 7);
-XMLNode.prototype.getPrefixForNamespace = ASnative (253, 8);
+/* built on first use, see swfdec_initialize_xml_node.as */
 
 /*** XML ***/
 
-XML = ASconstructor (253, 9);
-
-XML.prototype = new XMLNode (1, "");
-delete XML.prototype.constructor;
-ASSetPropFlags (XML, "prototype", 3);
-
-XML.prototype.load = ASnative (301, 0);
-XML.prototype.send = ASnative (301, 1);
-XML.prototype.sendAndLoad = ASnative (301, 2);
-XML.prototype.createElement = ASnative (253, 10);
-XML.prototype.createTextNode = ASnative (253, 11);
-XML.prototype.parseXML = ASnative (253, 12);
-
-XML.prototype.onLoad = function () {
-};
-
-// Note: handling of loaded is different here than in LoadVars
-XML.prototype.onData = function (src) {
-  if (src != null) {
-    this.loaded = true;
-    this.parseXML (src);
-    this.onLoad (true);
-  } else {
-    this.loaded = false;
-    this.onLoad (false);
-  }
-};
-
-XML.prototype.getBytesLoaded = function () {
-  return this._bytesLoaded;
-};
-
-XML.prototype.getBytesTotal = function () {
-  return this._bytesTotal;
-};
-
-XML.prototype.addRequestHeader = function (key, value) {
-  if (typeof (this._customHeaders) == "undefined") {
-    this._customHeaders = new Array ();
-    ASSetPropFlags (this, "_customHeaders", 131);
-  }
-  if (typeof (key) == "string" && typeof (value) == "string") {
-    this._customHeaders.push (key, value);
-  } else if (key instanceof Array) {
-    for (var i = 0; i + 1 < key.length; i += 2) {
-      this.addRequestHeader (key[i], key[i + 1]);
-    }
-  }
-};
+/* built on first use, see swfdec_initialize_xml.as */
 
 /*** LOADVARS ***/
 
@@ -474,7 +417,7 @@ ASSetPropFlags (TextField, null, 131);
 
 /* TextFormat */
 
-TextFormat = ASconstructor (110, 0);
+/* built on first use, see swfdec_initialize_text_format.as */
 
 /* TextField.Stylesheet */
 
@@ -768,10 +711,7 @@ ASSetPropFlags (flash.net.FileReferenceList.prototype, null, 3);
 
 /* LocalConnection */
 
-LocalConnection = function () {};
-
-ASSetNative (LocalConnection.prototype, 2200, "6connect,6send,6close,6domain");
-ASSetPropFlags (LocalConnection.prototype, null, 3);
+/* built on first use, see swfdec_initialize_local_connection.as */
 
 /* Microphone */
 
@@ -1233,18 +1173,7 @@ ASSetNativeAccessor (flash.geom.Transform.prototype, 1106, "8matrix,8concatenate
 
 /* BitmapData */
 
-flash.display = {};
-flash.display.BitmapData = ASconstructor (1100, 0);
-
-flash.display.BitmapData.RED_CHANNEL = 1;
-flash.display.BitmapData.GREEN_CHANNEL = 2;
-flash.display.BitmapData.BLUE_CHANNEL = 4;
-flash.display.BitmapData.ALPHA_CHANNEL = 8;
-
-ASSetNative (flash.display.BitmapData, 1100, "8loadBitmap", 40);
-
-ASSetNative (flash.display.BitmapData.prototype, 1100, "8getPixel,8setPixel,8fillRect,8copyPixels,8applyFilter,8scroll,8threshold,8draw,8pixelDissolve,8getPixel32,8setPixel32,8floodFill,8getColorBoundsRect,8perlinNoise,8colorTransform,8hitTest,8paletteMap,8merge,8noise,8copyChannel,8clone,8dispose,8generateFilterRect,8compare", 1);
-ASSetNativeAccessor(flash.display.BitmapData.prototype, 1100, "8width,8height,8rectangle,8transparent", 100);
+/* flash.display is built on first use, see swfdec_initialize_bitmap_data.as */
 
 /* ExternalInterface */
 
@@ -1519,82 +1448,7 @@ ASSetNativeAccessor (Button.prototype, 900, "8tabIndex", 200);
 
 /* BitmapFilter */
 
-flash.filters = {};
-
-flash.filters.BitmapFilter = ASconstructor(1112, 0);
-
-ASSetNative(flash.filters.BitmapFilter.prototype, 1112, "8clone", 1);
-
-/* BevelFilter */
-
-flash.filters.BevelFilter = ASconstructor (1107, 0);
-flash.filters.BevelFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.BevelFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.BevelFilter.prototype, 1107, "8distance,8angle,8highlightColor,8highlightAlpha,8shadowColor,8shadowAlpha,8quality,8strength,8knockout,8blurX,8blurY,8type", 1);
-
-/* BlurFilter */
-
-flash.filters.BlurFilter = ASconstructor (1102, 0);
-flash.filters.BlurFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.BlurFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.BlurFilter.prototype, 1102, "8blurX,8blurY,8quality", 1);
-
-/* ColorMatrixFilter */
-
-flash.filters.ColorMatrixFilter = ASconstructor (1110, 0);
-flash.filters.ColorMatrixFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.ColorMatrixFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.ColorMatrixFilter.prototype, 1110, "8matrix", 1);
-
-/* ConvolutionFilter */
-
-flash.filters.ConvolutionFilter = ASconstructor (1109, 0);
-flash.filters.ConvolutionFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.ConvolutionFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.ConvolutionFilter.prototype, 1109, "8matrixX,8matrixY,8matrix,8divisor,8bias,8preserveAlpha,8clamp,8color,8alpha", 1);
-
-/* DisplacementMapFilter */
-
-flash.filters.DisplacementMapFilter = ASconstructor (1111, 0);
-flash.filters.DisplacementMapFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.DisplacementMapFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.DisplacementMapFilter.prototype, 1111, "8mapBitmap,8mapPoint,8componentX,8componentY,8scaleX,8scaleY,8mode,8color,8alpha", 1);
-
-/* DropShadowFilter */
-
-flash.filters.DropShadowFilter = ASconstructor (1101, 0);
-flash.filters.DropShadowFilter.prototype = new flash.filters.BitmapFilter();
-delete flash.filters.DropShadowFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.DropShadowFilter.prototype, 1101, "8distance,8angle,8color,8alpha,8quality,8inner,8knockout,8blurX,8blurY,8strength,8hideObject", 1);
-
-/* GlowFilter */
-
-flash.filters.GlowFilter = ASconstructor (1103, 0);
-flash.filters.GlowFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.GlowFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.GlowFilter.prototype, 1103, "8color,8alpha,8quality,8inner,8knockout,8blurX,8blurY,8strength", 1);
-
-/* GradientBevelFilter */
-
-flash.filters.GradientBevelFilter = ASconstructor (1108, 1000);
-flash.filters.GradientBevelFilter.prototype = new flash.filters.BitmapFilter ();
-delete flash.filters.GradientBevelFilter.prototype.constructor;
-
-ASSetNativeAccessor (flash.filters.GradientBevelFilter.prototype, 1108, "8distance,8angle,8colors,8alphas,8ratios,8blurX,8blurY,8quality,8strength,8knockout,8type", 1);
-
-/* GradientGlowFilter */
-
-flash.filters.GradientGlowFilter = ASconstructor (1108, 0);
-flash.filters.GradientGlowFilter.prototype = o = new flash.filters.BitmapFilter ();
-delete flash.filters.GradientGlowFilter.prototype.constructor;
-ASSetNativeAccessor (flash.filters.GradientGlowFilter.prototype, 1108, "8distance,8angle,8colors,8alphas,8ratios,8blurX,8blurY,8quality,8strength,8knockout,8type", 1);
+/* flash.filters is built on first use, see swfdec_initialize_filters.as */
 
 /* Global Functions */
 
@@ -2,7 +2,7 @@
 
 /* compiled from swfdec_initialize.as */
 static const unsigned char swfdec_initialize[] = {
-  0x88, 0x5E, 0x21, 0x24,  0x02, 0x41, 0x53, 0x53,  0x65, 0x74, 0x50, 0x72,  0x6F, 0x70, 0x46, 0x6C,
+  0x88, 0x40, 0x1C, 0xFC,  0x01, 0x41, 0x53, 0x53,  0x65, 0x74, 0x50, 0x72,  0x6F, 0x70, 0x46, 0x6C,
   0x61, 0x67, 0x73, 0x00,  0x41, 0x53, 0x6E, 0x61,  0x74, 0x69, 0x76, 0x65,  0x00, 0x41, 0x53, 0x53,
   0x65, 0x74, 0x4E, 0x61,  0x74, 0x69, 0x76, 0x65,  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x4E, 0x61,
   0x74, 0x69, 0x76, 0x65,  0x41, 0x63, 0x63, 0x65,  0x73, 0x73, 0x6F, 0x72,  0x00, 0x66, 0x6C, 0x61,
@@ -60,2291 +60,2345 @@ static const unsigned char swfdec_initialize[] = {
   0x74, 0x61, 0x63, 0x68,  0x56, 0x69, 0x64, 0x65,  0x6F, 0x2C, 0x36, 0x73,  0x65, 0x6E, 0x64, 0x2C,
   0x36, 0x73, 0x65, 0x74,  0x42, 0x75, 0x66, 0x66,  0x65, 0x72, 0x54, 0x69,  0x6D, 0x65, 0x00, 0x63,
   0x68, 0x65, 0x63, 0x6B,  0x50, 0x6F, 0x6C, 0x69,  0x63, 0x79, 0x46, 0x69,  0x6C, 0x65, 0x00, 0x58,
-  0x4D, 0x4C, 0x4E, 0x6F,  0x64, 0x65, 0x00, 0x63,  0x6C, 0x6F, 0x6E, 0x65,  0x4E, 0x6F, 0x64, 0x65,
-  0x00, 0x72, 0x65, 0x6D,  0x6F, 0x76, 0x65, 0x4E,  0x6F, 0x64, 0x65, 0x00,  0x69, 0x6E, 0x73, 0x65,
-  0x72, 0x74, 0x42, 0x65,  0x66, 0x6F, 0x72, 0x65,  0x00, 0x61, 0x70, 0x70,  0x65, 0x6E, 0x64, 0x43,
-  0x68, 0x69, 0x6C, 0x64,  0x00, 0x68, 0x61, 0x73,  0x43, 0x68, 0x69, 0x6C,  0x64, 0x4E, 0x6F, 0x64,
-  0x65, 0x73, 0x00, 0x67,  0x65, 0x74, 0x4E, 0x61,  0x6D, 0x65, 0x73, 0x70,  0x61, 0x63, 0x65, 0x46,
-  0x6F, 0x72, 0x50, 0x72,  0x65, 0x66, 0x69, 0x78,  0x00, 0x67, 0x65, 0x74,  0x50, 0x72, 0x65, 0x66,
-  0x69, 0x78, 0x46, 0x6F,  0x72, 0x4E, 0x61, 0x6D,  0x65, 0x73, 0x70, 0x61,  0x63, 0x65, 0x00, 0x58,
   0x4D, 0x4C, 0x00, 0x00,  0x63, 0x6F, 0x6E, 0x73,  0x74, 0x72, 0x75, 0x63,  0x74, 0x6F, 0x72, 0x00,
   0x6C, 0x6F, 0x61, 0x64,  0x00, 0x73, 0x65, 0x6E,  0x64, 0x00, 0x73, 0x65,  0x6E, 0x64, 0x41, 0x6E,
-  0x64, 0x4C, 0x6F, 0x61,  0x64, 0x00, 0x63, 0x72,  0x65, 0x61, 0x74, 0x65,  0x45, 0x6C, 0x65, 0x6D,
-  0x65, 0x6E, 0x74, 0x00,  0x63, 0x72, 0x65, 0x61,  0x74, 0x65, 0x54, 0x65,  0x78, 0x74, 0x4E, 0x6F,
-  0x64, 0x65, 0x00, 0x70,  0x61, 0x72, 0x73, 0x65,  0x58, 0x4D, 0x4C, 0x00,  0x6F, 0x6E, 0x4C, 0x6F,
-  0x61, 0x64, 0x00, 0x6F,  0x6E, 0x44, 0x61, 0x74,  0x61, 0x00, 0x73, 0x72,  0x63, 0x00, 0x6C, 0x6F,
-  0x61, 0x64, 0x65, 0x64,  0x00, 0x67, 0x65, 0x74,  0x42, 0x79, 0x74, 0x65,  0x73, 0x4C, 0x6F, 0x61,
-  0x64, 0x65, 0x64, 0x00,  0x5F, 0x62, 0x79, 0x74,  0x65, 0x73, 0x4C, 0x6F,  0x61, 0x64, 0x65, 0x64,
-  0x00, 0x67, 0x65, 0x74,  0x42, 0x79, 0x74, 0x65,  0x73, 0x54, 0x6F, 0x74,  0x61, 0x6C, 0x00, 0x5F,
-  0x62, 0x79, 0x74, 0x65,  0x73, 0x54, 0x6F, 0x74,  0x61, 0x6C, 0x00, 0x61,  0x64, 0x64, 0x52, 0x65,
-  0x71, 0x75, 0x65, 0x73,  0x74, 0x48, 0x65, 0x61,  0x64, 0x65, 0x72, 0x00,  0x5F, 0x63, 0x75, 0x73,
-  0x74, 0x6F, 0x6D, 0x48,  0x65, 0x61, 0x64, 0x65,  0x72, 0x73, 0x00, 0x41,  0x72, 0x72, 0x61, 0x79,
-  0x00, 0x6B, 0x65, 0x79,  0x00, 0x73, 0x74, 0x72,  0x69, 0x6E, 0x67, 0x00,  0x76, 0x61, 0x6C, 0x75,
-  0x65, 0x00, 0x4C, 0x6F,  0x61, 0x64, 0x56, 0x61,  0x72, 0x73, 0x00, 0x63,  0x6F, 0x6E, 0x74, 0x65,
-  0x6E, 0x74, 0x54, 0x79,  0x70, 0x65, 0x00, 0x61,  0x70, 0x70, 0x6C, 0x69,  0x63, 0x61, 0x74, 0x69,
-  0x6F, 0x6E, 0x2F, 0x78,  0x2D, 0x77, 0x77, 0x77,  0x2D, 0x66, 0x6F, 0x72,  0x6D, 0x2D, 0x75, 0x72,
-  0x6C, 0x65, 0x6E, 0x63,  0x6F, 0x64, 0x65, 0x64,  0x00, 0x64, 0x65, 0x63,  0x6F, 0x64, 0x65, 0x00,
-  0x61, 0x00, 0x65, 0x73,  0x63, 0x61, 0x70, 0x65,  0x00, 0x3D, 0x00, 0x26,  0x00, 0x6A, 0x6F, 0x69,
-  0x6E, 0x00, 0x53, 0x6F,  0x75, 0x6E, 0x64, 0x00,  0x67, 0x65, 0x74, 0x50,  0x61, 0x6E, 0x2C, 0x67,
-  0x65, 0x74, 0x54, 0x72,  0x61, 0x6E, 0x73, 0x66,  0x6F, 0x72, 0x6D, 0x2C,  0x67, 0x65, 0x74, 0x56,
-  0x6F, 0x6C, 0x75, 0x6D,  0x65, 0x2C, 0x73, 0x65,  0x74, 0x50, 0x61, 0x6E,  0x2C, 0x73, 0x65, 0x74,
-  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x2C, 0x73, 0x65,  0x74, 0x56, 0x6F, 0x6C,
-  0x75, 0x6D, 0x65, 0x2C,  0x73, 0x74, 0x6F, 0x70,  0x2C, 0x61, 0x74, 0x74,  0x61, 0x63, 0x68, 0x53,
-  0x6F, 0x75, 0x6E, 0x64,  0x2C, 0x73, 0x74, 0x61,  0x72, 0x74, 0x2C, 0x36,  0x67, 0x65, 0x74, 0x44,
-  0x75, 0x72, 0x61, 0x74,  0x69, 0x6F, 0x6E, 0x2C,  0x36, 0x73, 0x65, 0x74,  0x44, 0x75, 0x72, 0x61,
-  0x74, 0x69, 0x6F, 0x6E,  0x2C, 0x36, 0x67, 0x65,  0x74, 0x50, 0x6F, 0x73,  0x69, 0x74, 0x69, 0x6F,
-  0x6E, 0x2C, 0x36, 0x73,  0x65, 0x74, 0x50, 0x6F,  0x73, 0x69, 0x74, 0x69,  0x6F, 0x6E, 0x2C, 0x36,
-  0x6C, 0x6F, 0x61, 0x64,  0x53, 0x6F, 0x75, 0x6E,  0x64, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x42, 0x79,
-  0x74, 0x65, 0x73, 0x4C,  0x6F, 0x61, 0x64, 0x65,  0x64, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x42, 0x79,
-  0x74, 0x65, 0x73, 0x54,  0x6F, 0x74, 0x61, 0x6C,  0x2C, 0x39, 0x61, 0x72,  0x65, 0x53, 0x6F, 0x75,
-  0x6E, 0x64, 0x73, 0x49,  0x6E, 0x61, 0x63, 0x63,  0x65, 0x73, 0x73, 0x69,  0x62, 0x6C, 0x65, 0x00,
-  0x53, 0x79, 0x73, 0x74,  0x65, 0x6D, 0x00, 0x63,  0x61, 0x70, 0x61, 0x62,  0x69, 0x6C, 0x69, 0x74,
-  0x69, 0x65, 0x73, 0x00,  0x51, 0x75, 0x65, 0x72,  0x79, 0x00, 0x73, 0x65,  0x74, 0x43, 0x6C, 0x69,
-  0x70, 0x62, 0x6F, 0x61,  0x72, 0x64, 0x00, 0x73,  0x68, 0x6F, 0x77, 0x53,  0x65, 0x74, 0x74, 0x69,
-  0x6E, 0x67, 0x73, 0x00,  0x65, 0x78, 0x61, 0x63,  0x74, 0x53, 0x65, 0x74,  0x74, 0x69, 0x6E, 0x67,
-  0x73, 0x2C, 0x75, 0x73,  0x65, 0x43, 0x6F, 0x64,  0x65, 0x70, 0x61, 0x67,  0x65, 0x00, 0x65, 0x78,
-  0x61, 0x63, 0x74, 0x53,  0x65, 0x74, 0x74, 0x69,  0x6E, 0x67, 0x73, 0x2C,  0x75, 0x73, 0x65, 0x43,
-  0x6F, 0x64, 0x65, 0x50,  0x61, 0x67, 0x65, 0x00,  0x73, 0x65, 0x63, 0x75,  0x72, 0x69, 0x74, 0x79,
-  0x00, 0x61, 0x6C, 0x6C,  0x6F, 0x77, 0x44, 0x6F,  0x6D, 0x61, 0x69, 0x6E,  0x2C, 0x37, 0x61, 0x6C,
-  0x6C, 0x6F, 0x77, 0x49,  0x6E, 0x73, 0x65, 0x63,  0x75, 0x72, 0x65, 0x44,  0x6F, 0x6D, 0x61, 0x69,
-  0x6E, 0x2C, 0x6C, 0x6F,  0x61, 0x64, 0x50, 0x6F,  0x6C, 0x69, 0x63, 0x79,  0x46, 0x69, 0x6C, 0x65,
-  0x2C, 0x63, 0x68, 0x6F,  0x6F, 0x73, 0x65, 0x4C,  0x6F, 0x63, 0x61, 0x6C,  0x53, 0x77, 0x66, 0x50,
-  0x61, 0x74, 0x68, 0x2C,  0x65, 0x73, 0x63, 0x61,  0x70, 0x65, 0x44, 0x6F,  0x6D, 0x61, 0x69, 0x6E,
-  0x00, 0x73, 0x61, 0x6E,  0x64, 0x62, 0x6F, 0x78,  0x54, 0x79, 0x70, 0x65,  0x00, 0x50, 0x6F, 0x6C,
+  0x64, 0x4C, 0x6F, 0x61,  0x64, 0x00, 0x70, 0x61,  0x72, 0x73, 0x65, 0x58,  0x4D, 0x4C, 0x00, 0x6F,
+  0x6E, 0x4C, 0x6F, 0x61,  0x64, 0x00, 0x6F, 0x6E,  0x44, 0x61, 0x74, 0x61,  0x00, 0x73, 0x72, 0x63,
+  0x00, 0x6C, 0x6F, 0x61,  0x64, 0x65, 0x64, 0x00,  0x67, 0x65, 0x74, 0x42,  0x79, 0x74, 0x65, 0x73,
+  0x4C, 0x6F, 0x61, 0x64,  0x65, 0x64, 0x00, 0x5F,  0x62, 0x79, 0x74, 0x65,  0x73, 0x4C, 0x6F, 0x61,
+  0x64, 0x65, 0x64, 0x00,  0x67, 0x65, 0x74, 0x42,  0x79, 0x74, 0x65, 0x73,  0x54, 0x6F, 0x74, 0x61,
+  0x6C, 0x00, 0x5F, 0x62,  0x79, 0x74, 0x65, 0x73,  0x54, 0x6F, 0x74, 0x61,  0x6C, 0x00, 0x61, 0x64,
+  0x64, 0x52, 0x65, 0x71,  0x75, 0x65, 0x73, 0x74,  0x48, 0x65, 0x61, 0x64,  0x65, 0x72, 0x00, 0x5F,
+  0x63, 0x75, 0x73, 0x74,  0x6F, 0x6D, 0x48, 0x65,  0x61, 0x64, 0x65, 0x72,  0x73, 0x00, 0x41, 0x72,
+  0x72, 0x61, 0x79, 0x00,  0x6B, 0x65, 0x79, 0x00,  0x73, 0x74, 0x72, 0x69,  0x6E, 0x67, 0x00, 0x76,
+  0x61, 0x6C, 0x75, 0x65,  0x00, 0x4C, 0x6F, 0x61,  0x64, 0x56, 0x61, 0x72,  0x73, 0x00, 0x63, 0x6F,
+  0x6E, 0x74, 0x65, 0x6E,  0x74, 0x54, 0x79, 0x70,  0x65, 0x00, 0x61, 0x70,  0x70, 0x6C, 0x69, 0x63,
+  0x61, 0x74, 0x69, 0x6F,  0x6E, 0x2F, 0x78, 0x2D,  0x77, 0x77, 0x77, 0x2D,  0x66, 0x6F, 0x72, 0x6D,
+  0x2D, 0x75, 0x72, 0x6C,  0x65, 0x6E, 0x63, 0x6F,  0x64, 0x65, 0x64, 0x00,  0x64, 0x65, 0x63, 0x6F,
+  0x64, 0x65, 0x00, 0x61,  0x00, 0x65, 0x73, 0x63,  0x61, 0x70, 0x65, 0x00,  0x3D, 0x00, 0x26, 0x00,
+  0x6A, 0x6F, 0x69, 0x6E,  0x00, 0x53, 0x6F, 0x75,  0x6E, 0x64, 0x00, 0x67,  0x65, 0x74, 0x50, 0x61,
+  0x6E, 0x2C, 0x67, 0x65,  0x74, 0x54, 0x72, 0x61,  0x6E, 0x73, 0x66, 0x6F,  0x72, 0x6D, 0x2C, 0x67,
+  0x65, 0x74, 0x56, 0x6F,  0x6C, 0x75, 0x6D, 0x65,  0x2C, 0x73, 0x65, 0x74,  0x50, 0x61, 0x6E, 0x2C,
+  0x73, 0x65, 0x74, 0x54,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x2C, 0x73, 0x65, 0x74,
+  0x56, 0x6F, 0x6C, 0x75,  0x6D, 0x65, 0x2C, 0x73,  0x74, 0x6F, 0x70, 0x2C,  0x61, 0x74, 0x74, 0x61,
+  0x63, 0x68, 0x53, 0x6F,  0x75, 0x6E, 0x64, 0x2C,  0x73, 0x74, 0x61, 0x72,  0x74, 0x2C, 0x36, 0x67,
+  0x65, 0x74, 0x44, 0x75,  0x72, 0x61, 0x74, 0x69,  0x6F, 0x6E, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x44,
+  0x75, 0x72, 0x61, 0x74,  0x69, 0x6F, 0x6E, 0x2C,  0x36, 0x67, 0x65, 0x74,  0x50, 0x6F, 0x73, 0x69,
+  0x74, 0x69, 0x6F, 0x6E,  0x2C, 0x36, 0x73, 0x65,  0x74, 0x50, 0x6F, 0x73,  0x69, 0x74, 0x69, 0x6F,
+  0x6E, 0x2C, 0x36, 0x6C,  0x6F, 0x61, 0x64, 0x53,  0x6F, 0x75, 0x6E, 0x64,  0x2C, 0x36, 0x67, 0x65,
+  0x74, 0x42, 0x79, 0x74,  0x65, 0x73, 0x4C, 0x6F,  0x61, 0x64, 0x65, 0x64,  0x2C, 0x36, 0x67, 0x65,
+  0x74, 0x42, 0x79, 0x74,  0x65, 0x73, 0x54, 0x6F,  0x74, 0x61, 0x6C, 0x2C,  0x39, 0x61, 0x72, 0x65,
+  0x53, 0x6F, 0x75, 0x6E,  0x64, 0x73, 0x49, 0x6E,  0x61, 0x63, 0x63, 0x65,  0x73, 0x73, 0x69, 0x62,
+  0x6C, 0x65, 0x00, 0x53,  0x79, 0x73, 0x74, 0x65,  0x6D, 0x00, 0x63, 0x61,  0x70, 0x61, 0x62, 0x69,
+  0x6C, 0x69, 0x74, 0x69,  0x65, 0x73, 0x00, 0x51,  0x75, 0x65, 0x72, 0x79,  0x00, 0x73, 0x65, 0x74,
+  0x43, 0x6C, 0x69, 0x70,  0x62, 0x6F, 0x61, 0x72,  0x64, 0x00, 0x73, 0x68,  0x6F, 0x77, 0x53, 0x65,
+  0x74, 0x74, 0x69, 0x6E,  0x67, 0x73, 0x00, 0x65,  0x78, 0x61, 0x63, 0x74,  0x53, 0x65, 0x74, 0x74,
+  0x69, 0x6E, 0x67, 0x73,  0x2C, 0x75, 0x73, 0x65,  0x43, 0x6F, 0x64, 0x65,  0x70, 0x61, 0x67, 0x65,
+  0x00, 0x65, 0x78, 0x61,  0x63, 0x74, 0x53, 0x65,  0x74, 0x74, 0x69, 0x6E,  0x67, 0x73, 0x2C, 0x75,
+  0x73, 0x65, 0x43, 0x6F,  0x64, 0x65, 0x50, 0x61,  0x67, 0x65, 0x00, 0x73,  0x65, 0x63, 0x75, 0x72,
+  0x69, 0x74, 0x79, 0x00,  0x61, 0x6C, 0x6C, 0x6F,  0x77, 0x44, 0x6F, 0x6D,  0x61, 0x69, 0x6E, 0x2C,
+  0x37, 0x61, 0x6C, 0x6C,  0x6F, 0x77, 0x49, 0x6E,  0x73, 0x65, 0x63, 0x75,  0x72, 0x65, 0x44, 0x6F,
+  0x6D, 0x61, 0x69, 0x6E,  0x2C, 0x6C, 0x6F, 0x61,  0x64, 0x50, 0x6F, 0x6C,  0x69, 0x63, 0x79, 0x46,
+  0x69, 0x6C, 0x65, 0x2C,  0x63, 0x68, 0x6F, 0x6F,  0x73, 0x65, 0x4C, 0x6F,  0x63, 0x61, 0x6C, 0x53,
+  0x77, 0x66, 0x50, 0x61,  0x74, 0x68, 0x2C, 0x65,  0x73, 0x63, 0x61, 0x70,  0x65, 0x44, 0x6F, 0x6D,
+  0x61, 0x69, 0x6E, 0x00,  0x73, 0x61, 0x6E, 0x64,  0x62, 0x6F, 0x78, 0x54,  0x79, 0x70, 0x65, 0x00,
+  0x50, 0x6F, 0x6C, 0x69,  0x63, 0x79, 0x46, 0x69,  0x6C, 0x65, 0x52, 0x65,  0x73, 0x6F, 0x6C, 0x76,
+  0x65, 0x72, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x79, 0x73,
+  0x74, 0x65, 0x6D, 0x2E,  0x73, 0x65, 0x63, 0x75,  0x72, 0x69, 0x74, 0x79,  0x2E, 0x50, 0x6F, 0x6C,
   0x69, 0x63, 0x79, 0x46,  0x69, 0x6C, 0x65, 0x52,  0x65, 0x73, 0x6F, 0x6C,  0x76, 0x65, 0x72, 0x00,
+  0x72, 0x65, 0x73, 0x6F,  0x6C, 0x76, 0x65, 0x00,  0x50, 0x72, 0x6F, 0x64,  0x75, 0x63, 0x74, 0x00,
   0x49, 0x6D, 0x70, 0x6C,  0x65, 0x6D, 0x65, 0x6E,  0x74, 0x20, 0x53, 0x79,  0x73, 0x74, 0x65, 0x6D,
-  0x2E, 0x73, 0x65, 0x63,  0x75, 0x72, 0x69, 0x74,  0x79, 0x2E, 0x50, 0x6F,  0x6C, 0x69, 0x63, 0x79,
-  0x46, 0x69, 0x6C, 0x65,  0x52, 0x65, 0x73, 0x6F,  0x6C, 0x76, 0x65, 0x72,  0x00, 0x72, 0x65, 0x73,
-  0x6F, 0x6C, 0x76, 0x65,  0x00, 0x50, 0x72, 0x6F,  0x64, 0x75, 0x63, 0x74,  0x00, 0x49, 0x6D, 0x70,
-  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x20, 0x53,  0x79, 0x73, 0x74, 0x65,  0x6D, 0x2E, 0x50, 0x72,
-  0x6F, 0x64, 0x75, 0x63,  0x74, 0x00, 0x69, 0x73,  0x52, 0x75, 0x6E, 0x6E,  0x69, 0x6E, 0x67, 0x00,
-  0x49, 0x6D, 0x70, 0x6C,  0x65, 0x6D, 0x65, 0x6E,  0x74, 0x20, 0x53, 0x79,  0x73, 0x74, 0x65, 0x6D,
-  0x2E, 0x50, 0x72, 0x6F,  0x64, 0x75, 0x63, 0x74,  0x2E, 0x69, 0x73, 0x52,  0x75, 0x6E, 0x6E, 0x69,
-  0x6E, 0x67, 0x00, 0x69,  0x73, 0x49, 0x6E, 0x73,  0x74, 0x61, 0x6C, 0x6C,  0x65, 0x64, 0x00, 0x49,
-  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x79, 0x73,  0x74, 0x65, 0x6D, 0x2E,
-  0x50, 0x72, 0x6F, 0x64,  0x75, 0x63, 0x74, 0x2E,  0x69, 0x73, 0x49, 0x6E,  0x73, 0x74, 0x61, 0x6C,
-  0x6C, 0x65, 0x64, 0x00,  0x6C, 0x61, 0x75, 0x6E,  0x63, 0x68, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,
-  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x79, 0x73,  0x74, 0x65, 0x6D, 0x2E,  0x50, 0x72, 0x6F, 0x64,
-  0x75, 0x63, 0x74, 0x2E,  0x6C, 0x61, 0x75, 0x6E,  0x63, 0x68, 0x00, 0x64,  0x6F, 0x77, 0x6E, 0x6C,
-  0x6F, 0x61, 0x64, 0x00,  0x49, 0x6D, 0x70, 0x6C,  0x65, 0x6D, 0x65, 0x6E,  0x74, 0x20, 0x53, 0x79,
-  0x73, 0x74, 0x65, 0x6D,  0x2E, 0x50, 0x72, 0x6F,  0x64, 0x75, 0x63, 0x74,  0x2E, 0x64, 0x6F, 0x77,
-  0x6E, 0x6C, 0x6F, 0x61,  0x64, 0x00, 0x69, 0x6E,  0x73, 0x74, 0x61, 0x6C,  0x6C, 0x65, 0x64, 0x56,
-  0x65, 0x72, 0x73, 0x69,  0x6F, 0x6E, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,
+  0x2E, 0x50, 0x72, 0x6F,  0x64, 0x75, 0x63, 0x74,  0x00, 0x69, 0x73, 0x52,  0x75, 0x6E, 0x6E, 0x69,
+  0x6E, 0x67, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x79, 0x73,
+  0x74, 0x65, 0x6D, 0x2E,  0x50, 0x72, 0x6F, 0x64,  0x75, 0x63, 0x74, 0x2E,  0x69, 0x73, 0x52, 0x75,
+  0x6E, 0x6E, 0x69, 0x6E,  0x67, 0x00, 0x69, 0x73,  0x49, 0x6E, 0x73, 0x74,  0x61, 0x6C, 0x6C, 0x65,
+  0x64, 0x00, 0x49, 0x6D,  0x70, 0x6C, 0x65, 0x6D,  0x65, 0x6E, 0x74, 0x20,  0x53, 0x79, 0x73, 0x74,
+  0x65, 0x6D, 0x2E, 0x50,  0x72, 0x6F, 0x64, 0x75,  0x63, 0x74, 0x2E, 0x69,  0x73, 0x49, 0x6E, 0x73,
+  0x74, 0x61, 0x6C, 0x6C,  0x65, 0x64, 0x00, 0x6C,  0x61, 0x75, 0x6E, 0x63,  0x68, 0x00, 0x49, 0x6D,
+  0x70, 0x6C, 0x65, 0x6D,  0x65, 0x6E, 0x74, 0x20,  0x53, 0x79, 0x73, 0x74,  0x65, 0x6D, 0x2E, 0x50,
+  0x72, 0x6F, 0x64, 0x75,  0x63, 0x74, 0x2E, 0x6C,  0x61, 0x75, 0x6E, 0x63,  0x68, 0x00, 0x64, 0x6F,
+  0x77, 0x6E, 0x6C, 0x6F,  0x61, 0x64, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,
   0x20, 0x53, 0x79, 0x73,  0x74, 0x65, 0x6D, 0x2E,  0x50, 0x72, 0x6F, 0x64,  0x75, 0x63, 0x74, 0x2E,
-  0x69, 0x6E, 0x73, 0x74,  0x61, 0x6C, 0x6C, 0x65,  0x64, 0x56, 0x65, 0x72,  0x73, 0x69, 0x6F, 0x6E,
-  0x00, 0x76, 0x61, 0x6C,  0x69, 0x64, 0x61, 0x74,  0x65, 0x00, 0x49, 0x6D,  0x70, 0x6C, 0x65, 0x6D,
+  0x64, 0x6F, 0x77, 0x6E,  0x6C, 0x6F, 0x61, 0x64,  0x00, 0x69, 0x6E, 0x73,  0x74, 0x61, 0x6C, 0x6C,
+  0x65, 0x64, 0x56, 0x65,  0x72, 0x73, 0x69, 0x6F,  0x6E, 0x00, 0x49, 0x6D,  0x70, 0x6C, 0x65, 0x6D,
   0x65, 0x6E, 0x74, 0x20,  0x53, 0x79, 0x73, 0x74,  0x65, 0x6D, 0x2E, 0x50,  0x72, 0x6F, 0x64, 0x75,
-  0x63, 0x74, 0x2E, 0x76,  0x61, 0x6C, 0x69, 0x64,  0x61, 0x74, 0x65, 0x00,  0x49, 0x4D, 0x45, 0x00,
-  0x41, 0x4C, 0x50, 0x48,  0x41, 0x4E, 0x55, 0x4D,  0x45, 0x52, 0x49, 0x43,  0x5F, 0x46, 0x55, 0x4C,
-  0x4C, 0x00, 0x41, 0x4C,  0x50, 0x48, 0x41, 0x4E,  0x55, 0x4D, 0x45, 0x52,  0x49, 0x43, 0x5F, 0x48,
-  0x41, 0x4C, 0x46, 0x00,  0x43, 0x48, 0x49, 0x4E,  0x45, 0x53, 0x45, 0x00,  0x4A, 0x41, 0x50, 0x41,
-  0x4E, 0x45, 0x53, 0x45,  0x5F, 0x48, 0x49, 0x52,  0x41, 0x47, 0x41, 0x4E,  0x41, 0x00, 0x4A, 0x41,
-  0x50, 0x41, 0x4E, 0x45,  0x53, 0x45, 0x5F, 0x4B,  0x41, 0x54, 0x41, 0x4B,  0x41, 0x4E, 0x41, 0x5F,
-  0x46, 0x55, 0x4C, 0x4C,  0x00, 0x4A, 0x41, 0x50,  0x41, 0x4E, 0x45, 0x53,  0x45, 0x5F, 0x4B, 0x41,
-  0x54, 0x41, 0x4B, 0x41,  0x4E, 0x41, 0x5F, 0x48,  0x41, 0x4C, 0x46, 0x00,  0x4B, 0x4F, 0x52, 0x45,
-  0x41, 0x4E, 0x00, 0x55,  0x4E, 0x4B, 0x4E, 0x4F,  0x57, 0x4E, 0x00, 0x38,  0x67, 0x65, 0x74, 0x45,
-  0x6E, 0x61, 0x62, 0x6C,  0x65, 0x64, 0x2C, 0x38,  0x73, 0x65, 0x74, 0x45,  0x6E, 0x61, 0x62, 0x6C,
-  0x65, 0x64, 0x2C, 0x38,  0x67, 0x65, 0x74, 0x43,  0x6F, 0x6E, 0x76, 0x65,  0x72, 0x73, 0x69, 0x6F,
-  0x6E, 0x4D, 0x6F, 0x64,  0x65, 0x2C, 0x38, 0x73,  0x65, 0x74, 0x43, 0x6F,  0x6E, 0x76, 0x65, 0x72,
-  0x73, 0x69, 0x6F, 0x6E,  0x4D, 0x6F, 0x64, 0x65,  0x2C, 0x38, 0x73, 0x65,  0x74, 0x43, 0x6F, 0x6D,
-  0x70, 0x6F, 0x73, 0x69,  0x74, 0x69, 0x6F, 0x6E,  0x53, 0x74, 0x72, 0x69,  0x6E, 0x67, 0x2C, 0x38,
-  0x64, 0x6F, 0x43, 0x6F,  0x6E, 0x76, 0x65, 0x72,  0x73, 0x69, 0x6F, 0x6E,  0x00, 0x43, 0x6F, 0x6C,
-  0x6F, 0x72, 0x00, 0x74,  0x61, 0x72, 0x67, 0x65,  0x74, 0x00, 0x73, 0x65,  0x74, 0x52, 0x47, 0x42,
-  0x2C, 0x73, 0x65, 0x74,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x2C, 0x67, 0x65,
-  0x74, 0x52, 0x47, 0x42,  0x2C, 0x67, 0x65, 0x74,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,
-  0x6D, 0x00, 0x54, 0x65,  0x78, 0x74, 0x53, 0x6E,  0x61, 0x70, 0x73, 0x68,  0x6F, 0x74, 0x00, 0x36,
-  0x67, 0x65, 0x74, 0x43,  0x6F, 0x75, 0x6E, 0x74,  0x2C, 0x36, 0x73, 0x65,  0x74, 0x53, 0x65, 0x6C,
-  0x65, 0x63, 0x74, 0x65,  0x64, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x53, 0x65,  0x6C, 0x65, 0x63, 0x74,
-  0x65, 0x64, 0x2C, 0x36,  0x67, 0x65, 0x74, 0x54,  0x65, 0x78, 0x74, 0x2C,  0x36, 0x67, 0x65, 0x74,
-  0x53, 0x65, 0x6C, 0x65,  0x63, 0x74, 0x65, 0x64,  0x54, 0x65, 0x78, 0x74,  0x2C, 0x36, 0x68, 0x69,
-  0x74, 0x54, 0x65, 0x73,  0x74, 0x54, 0x65, 0x78,  0x74, 0x4E, 0x65, 0x61,  0x72, 0x50, 0x6F, 0x73,
-  0x2C, 0x36, 0x66, 0x69,  0x6E, 0x64, 0x54, 0x65,  0x78, 0x74, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x53,
-  0x65, 0x6C, 0x65, 0x63,  0x74, 0x43, 0x6F, 0x6C,  0x6F, 0x72, 0x2C, 0x36,  0x67, 0x65, 0x74, 0x54,
-  0x65, 0x78, 0x74, 0x52,  0x75, 0x6E, 0x49, 0x6E,  0x66, 0x6F, 0x00, 0x4D,  0x6F, 0x76, 0x69, 0x65,
-  0x43, 0x6C, 0x69, 0x70,  0x00, 0x75, 0x73, 0x65,  0x48, 0x61, 0x6E, 0x64,  0x43, 0x75, 0x72, 0x73,
-  0x6F, 0x72, 0x00, 0x65,  0x6E, 0x61, 0x62, 0x6C,  0x65, 0x64, 0x00, 0x6D,  0x65, 0x74, 0x68, 0x00,
-  0x6D, 0x65, 0x74, 0x68,  0x6F, 0x64, 0x00, 0x74,  0x6F, 0x4C, 0x6F, 0x77,  0x65, 0x72, 0x43, 0x61,
-  0x73, 0x65, 0x00, 0x6C,  0x6F, 0x77, 0x65, 0x72,  0x00, 0x70, 0x6F, 0x73,  0x74, 0x00, 0x67, 0x65,
-  0x74, 0x00, 0x67, 0x65,  0x74, 0x55, 0x52, 0x4C,  0x00, 0x74, 0x79, 0x70,  0x65, 0x00, 0x75, 0x72,
-  0x6C, 0x00, 0x6C, 0x6F,  0x61, 0x64, 0x56, 0x61,  0x72, 0x69, 0x61, 0x62,  0x6C, 0x65, 0x73, 0x00,
-  0x5F, 0x74, 0x61, 0x72,  0x67, 0x65, 0x74, 0x00,  0x6C, 0x6F, 0x61, 0x64,  0x4D, 0x6F, 0x76, 0x69,
-  0x65, 0x00, 0x75, 0x6E,  0x6C, 0x6F, 0x61, 0x64,  0x4D, 0x6F, 0x76, 0x69,  0x65, 0x00, 0x67, 0x65,
-  0x74, 0x54, 0x65, 0x78,  0x74, 0x53, 0x6E, 0x61,  0x70, 0x73, 0x68, 0x6F,  0x74, 0x00, 0x61, 0x74,
-  0x74, 0x61, 0x63, 0x68,  0x4D, 0x6F, 0x76, 0x69,  0x65, 0x2C, 0x73, 0x77,  0x61, 0x70, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x73,  0x2C, 0x6C, 0x6F, 0x63,  0x61, 0x6C, 0x54, 0x6F,  0x47, 0x6C, 0x6F, 0x62,
-  0x61, 0x6C, 0x2C, 0x67,  0x6C, 0x6F, 0x62, 0x61,  0x6C, 0x54, 0x6F, 0x4C,  0x6F, 0x63, 0x61, 0x6C,
-  0x2C, 0x68, 0x69, 0x74,  0x54, 0x65, 0x73, 0x74,  0x2C, 0x67, 0x65, 0x74,  0x42, 0x6F, 0x75, 0x6E,
-  0x64, 0x73, 0x2C, 0x67,  0x65, 0x74, 0x42, 0x79,  0x74, 0x65, 0x73, 0x54,  0x6F, 0x74, 0x61, 0x6C,
-  0x2C, 0x67, 0x65, 0x74,  0x42, 0x79, 0x74, 0x65,  0x73, 0x4C, 0x6F, 0x61,  0x64, 0x65, 0x64, 0x2C,
-  0x36, 0x61, 0x74, 0x74,  0x61, 0x63, 0x68, 0x41,  0x75, 0x64, 0x69, 0x6F,  0x2C, 0x36, 0x61, 0x74,
-  0x74, 0x61, 0x63, 0x68,  0x56, 0x69, 0x64, 0x65,  0x6F, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x2C,  0x36, 0x73, 0x65, 0x74,  0x4D, 0x61, 0x73, 0x6B,  0x2C, 0x70, 0x6C, 0x61,
-  0x79, 0x2C, 0x73, 0x74,  0x6F, 0x70, 0x2C, 0x6E,  0x65, 0x78, 0x74, 0x46,  0x72, 0x61, 0x6D, 0x65,
-  0x2C, 0x70, 0x72, 0x65,  0x76, 0x46, 0x72, 0x61,  0x6D, 0x65, 0x2C, 0x67,  0x6F, 0x74, 0x6F, 0x41,
-  0x6E, 0x64, 0x50, 0x6C,  0x61, 0x79, 0x2C, 0x67,  0x6F, 0x74, 0x6F, 0x41,  0x6E, 0x64, 0x53, 0x74,
-  0x6F, 0x70, 0x2C, 0x64,  0x75, 0x70, 0x6C, 0x69,  0x63, 0x61, 0x74, 0x65,  0x4D, 0x6F, 0x76, 0x69,
-  0x65, 0x43, 0x6C, 0x69,  0x70, 0x2C, 0x72, 0x65,  0x6D, 0x6F, 0x76, 0x65,  0x4D, 0x6F, 0x76, 0x69,
-  0x65, 0x43, 0x6C, 0x69,  0x70, 0x2C, 0x73, 0x74,  0x61, 0x72, 0x74, 0x44,  0x72, 0x61, 0x67, 0x2C,
-  0x73, 0x74, 0x6F, 0x70,  0x44, 0x72, 0x61, 0x67,  0x2C, 0x37, 0x67, 0x65,  0x74, 0x4E, 0x65, 0x78,
-  0x74, 0x48, 0x69, 0x67,  0x68, 0x65, 0x73, 0x74,  0x44, 0x65, 0x70, 0x74,  0x68, 0x2C, 0x37, 0x67,
-  0x65, 0x74, 0x49, 0x6E,  0x73, 0x74, 0x61, 0x6E,  0x63, 0x65, 0x41, 0x74,  0x44, 0x65, 0x70, 0x74,
-  0x68, 0x2C, 0x67, 0x65,  0x74, 0x53, 0x57, 0x46,  0x56, 0x65, 0x72, 0x73,  0x69, 0x6F, 0x6E, 0x2C,
-  0x38, 0x61, 0x74, 0x74,  0x61, 0x63, 0x68, 0x42,  0x69, 0x74, 0x6D, 0x61,  0x70, 0x2C, 0x38, 0x67,
-  0x65, 0x74, 0x52, 0x65,  0x63, 0x74, 0x00, 0x74,  0x61, 0x62, 0x49, 0x6E,  0x64, 0x65, 0x78, 0x00,
-  0x5F, 0x6C, 0x6F, 0x63,  0x6B, 0x72, 0x6F, 0x6F,  0x74, 0x00, 0x38, 0x63,  0x61, 0x63, 0x68, 0x65,
-  0x41, 0x73, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,  0x2C, 0x38, 0x6F, 0x70,  0x61, 0x71, 0x75, 0x65,
-  0x42, 0x61, 0x63, 0x6B,  0x67, 0x72, 0x6F, 0x75,  0x6E, 0x64, 0x2C, 0x38,  0x73, 0x63, 0x72, 0x6F,
-  0x6C, 0x6C, 0x52, 0x65,  0x63, 0x74, 0x00, 0x38,  0x66, 0x69, 0x6C, 0x74,  0x65, 0x72, 0x73, 0x2C,
-  0x38, 0x74, 0x72, 0x61,  0x6E, 0x73, 0x66, 0x6F,  0x72, 0x6D, 0x00, 0x38,  0x62, 0x6C, 0x65, 0x6E,
-  0x64, 0x4D, 0x6F, 0x64,  0x65, 0x00, 0x36, 0x63,  0x72, 0x65, 0x61, 0x74,  0x65, 0x45, 0x6D, 0x70,
-  0x74, 0x79, 0x4D, 0x6F,  0x76, 0x69, 0x65, 0x43,  0x6C, 0x69, 0x70, 0x2C,  0x36, 0x62, 0x65, 0x67,
-  0x69, 0x6E, 0x46, 0x69,  0x6C, 0x6C, 0x2C, 0x36,  0x62, 0x65, 0x67, 0x69,  0x6E, 0x47, 0x72, 0x61,
-  0x64, 0x69, 0x65, 0x6E,  0x74, 0x46, 0x69, 0x6C,  0x6C, 0x2C, 0x36, 0x6D,  0x6F, 0x76, 0x65, 0x54,
-  0x6F, 0x2C, 0x36, 0x6C,  0x69, 0x6E, 0x65, 0x54,  0x6F, 0x2C, 0x36, 0x63,  0x75, 0x72, 0x76, 0x65,
-  0x54, 0x6F, 0x2C, 0x36,  0x6C, 0x69, 0x6E, 0x65,  0x53, 0x74, 0x79, 0x6C,  0x65, 0x2C, 0x36, 0x65,
-  0x6E, 0x64, 0x46, 0x69,  0x6C, 0x6C, 0x2C, 0x36,  0x63, 0x6C, 0x65, 0x61,  0x72, 0x2C, 0x38, 0x6C,
-  0x69, 0x6E, 0x65, 0x47,  0x72, 0x61, 0x64, 0x69,  0x65, 0x6E, 0x74, 0x53,  0x74, 0x79, 0x6C, 0x65,
-  0x2C, 0x38, 0x62, 0x65,  0x67, 0x69, 0x6E, 0x4D,  0x65, 0x73, 0x68, 0x46,  0x69, 0x6C, 0x6C, 0x2C,
-  0x38, 0x62, 0x65, 0x67,  0x69, 0x6E, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,  0x46, 0x69, 0x6C, 0x6C,
-  0x00, 0x38, 0x73, 0x63,  0x61, 0x6C, 0x65, 0x39,  0x47, 0x72, 0x69, 0x64,  0x00, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x65, 0x54,  0x65, 0x78, 0x74, 0x46,  0x69, 0x65, 0x6C, 0x64,  0x00, 0x4D, 0x6F, 0x76,
-  0x69, 0x65, 0x43, 0x6C,  0x69, 0x70, 0x4C, 0x6F,  0x61, 0x64, 0x65, 0x72,  0x00, 0x37, 0x6C, 0x6F,
-  0x61, 0x64, 0x43, 0x6C,  0x69, 0x70, 0x2C, 0x37,  0x67, 0x65, 0x74, 0x50,  0x72, 0x6F, 0x67, 0x72,
-  0x65, 0x73, 0x73, 0x2C,  0x37, 0x75, 0x6E, 0x6C,  0x6F, 0x61, 0x64, 0x43,  0x6C, 0x69, 0x70, 0x00,
-  0x54, 0x65, 0x78, 0x74,  0x46, 0x69, 0x65, 0x6C,  0x64, 0x00, 0x67, 0x65,  0x74, 0x46, 0x6F, 0x6E,
-  0x74, 0x4C, 0x69, 0x73,  0x74, 0x00, 0x36, 0x72,  0x65, 0x70, 0x6C, 0x61,  0x63, 0x65, 0x53, 0x65,
-  0x6C, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x54, 0x65,  0x78, 0x74, 0x46, 0x6F,  0x72, 0x6D, 0x61, 0x74,
-  0x2C, 0x36, 0x73, 0x65,  0x74, 0x54, 0x65, 0x78,  0x74, 0x46, 0x6F, 0x72,  0x6D, 0x61, 0x74, 0x2C,
-  0x36, 0x72, 0x65, 0x6D,  0x6F, 0x76, 0x65, 0x54,  0x65, 0x78, 0x74, 0x46,  0x69, 0x65, 0x6C, 0x64,
-  0x2C, 0x36, 0x67, 0x65,  0x74, 0x4E, 0x65, 0x77,  0x54, 0x65, 0x78, 0x74,  0x46, 0x6F, 0x72, 0x6D,
-  0x61, 0x74, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x4E,  0x65, 0x77, 0x54, 0x65,  0x78, 0x74, 0x46, 0x6F,
-  0x72, 0x6D, 0x61, 0x74,  0x2C, 0x36, 0x67, 0x65,  0x74, 0x44, 0x65, 0x70,  0x74, 0x68, 0x2C, 0x37,
-  0x72, 0x65, 0x70, 0x6C,  0x61, 0x63, 0x65, 0x54,  0x65, 0x78, 0x74, 0x00,  0x38, 0x67, 0x72, 0x69,
-  0x64, 0x46, 0x69, 0x74,  0x54, 0x79, 0x70, 0x65,  0x2C, 0x38, 0x61, 0x6E,  0x74, 0x69, 0x41, 0x6C,
-  0x69, 0x61, 0x73, 0x54,  0x79, 0x70, 0x65, 0x2C,  0x38, 0x74, 0x68, 0x69,  0x63, 0x6B, 0x6E, 0x65,
-  0x73, 0x73, 0x2C, 0x38,  0x73, 0x68, 0x61, 0x72,  0x70, 0x6E, 0x65, 0x73,  0x73, 0x2C, 0x38, 0x66,
-  0x69, 0x6C, 0x74, 0x65,  0x72, 0x73, 0x00, 0x38,  0x74, 0x61, 0x62, 0x49,  0x6E, 0x64, 0x65, 0x78,
-  0x00, 0x54, 0x65, 0x78,  0x74, 0x46, 0x6F, 0x72,  0x6D, 0x61, 0x74, 0x00,  0x53, 0x74, 0x79, 0x6C,
-  0x65, 0x53, 0x68, 0x65,  0x65, 0x74, 0x00, 0x5F,  0x63, 0x6F, 0x70, 0x79,  0x00, 0x6F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x00,  0x6F, 0x5F, 0x6E, 0x65,  0x77, 0x00, 0x70, 0x72,  0x6F, 0x70, 0x00, 0x63,
-  0x6C, 0x65, 0x61, 0x72,  0x00, 0x5F, 0x63, 0x73,  0x73, 0x00, 0x5F, 0x73,  0x74, 0x79, 0x6C, 0x65,
-  0x73, 0x00, 0x75, 0x70,  0x64, 0x61, 0x74, 0x65,  0x00, 0x67, 0x65, 0x74,  0x53, 0x74, 0x79, 0x6C,
-  0x65, 0x00, 0x73, 0x65,  0x74, 0x53, 0x74, 0x79,  0x6C, 0x65, 0x00, 0x73,  0x74, 0x79, 0x6C, 0x65,
-  0x00, 0x64, 0x6F, 0x54,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x00, 0x67, 0x65, 0x74,
-  0x53, 0x74, 0x79, 0x6C,  0x65, 0x4E, 0x61, 0x6D,  0x65, 0x73, 0x00, 0x74,  0x6D, 0x70, 0x00, 0x6E,
-  0x61, 0x6D, 0x65, 0x73,  0x00, 0x74, 0x72, 0x61,  0x6E, 0x73, 0x66, 0x6F,  0x72, 0x6D, 0x00, 0x66,
-  0x6F, 0x72, 0x6D, 0x61,  0x74, 0x00, 0x74, 0x65,  0x78, 0x74, 0x41, 0x6C,  0x69, 0x67, 0x6E, 0x00,
-  0x61, 0x6C, 0x69, 0x67,  0x6E, 0x00, 0x66, 0x6F,  0x6E, 0x74, 0x57, 0x65,  0x69, 0x67, 0x68, 0x74,
-  0x00, 0x62, 0x6F, 0x6C,  0x64, 0x00, 0x6E, 0x6F,  0x72, 0x6D, 0x61, 0x6C,  0x00, 0x63, 0x6F, 0x6C,
-  0x6F, 0x72, 0x00, 0x70,  0x61, 0x72, 0x73, 0x65,  0x43, 0x6F, 0x6C, 0x6F,  0x72, 0x00, 0x64, 0x69,
-  0x73, 0x70, 0x6C, 0x61,  0x79, 0x00, 0x66, 0x6F,  0x6E, 0x74, 0x46, 0x61,  0x6D, 0x69, 0x6C, 0x79,
-  0x00, 0x66, 0x6F, 0x6E,  0x74, 0x00, 0x70, 0x61,  0x72, 0x73, 0x65, 0x43,  0x53, 0x53, 0x46, 0x6F,
-  0x6E, 0x74, 0x46, 0x61,  0x6D, 0x69, 0x6C, 0x79,  0x00, 0x74, 0x65, 0x78,  0x74, 0x49, 0x6E, 0x64,
-  0x65, 0x6E, 0x74, 0x00,  0x69, 0x6E, 0x64, 0x65,  0x6E, 0x74, 0x00, 0x70,  0x61, 0x72, 0x73, 0x65,
-  0x49, 0x6E, 0x74, 0x00,  0x66, 0x6F, 0x6E, 0x74,  0x53, 0x74, 0x79, 0x6C,  0x65, 0x00, 0x69, 0x74,
-  0x61, 0x6C, 0x69, 0x63,  0x00, 0x6B, 0x65, 0x72,  0x6E, 0x69, 0x6E, 0x67,  0x00, 0x74, 0x72, 0x75,
-  0x65, 0x00, 0x66, 0x61,  0x6C, 0x73, 0x65, 0x00,  0x6C, 0x65, 0x61, 0x64,  0x69, 0x6E, 0x67, 0x00,
-  0x6D, 0x61, 0x72, 0x67,  0x69, 0x6E, 0x4C, 0x65,  0x66, 0x74, 0x00, 0x6C,  0x65, 0x66, 0x74, 0x4D,
-  0x61, 0x72, 0x67, 0x69,  0x6E, 0x00, 0x6C, 0x65,  0x74, 0x74, 0x65, 0x72,  0x53, 0x70, 0x61, 0x63,
-  0x69, 0x6E, 0x67, 0x00,  0x6D, 0x61, 0x72, 0x67,  0x69, 0x6E, 0x52, 0x69,  0x67, 0x68, 0x74, 0x00,
-  0x72, 0x69, 0x67, 0x68,  0x74, 0x4D, 0x61, 0x72,  0x67, 0x69, 0x6E, 0x00,  0x66, 0x6F, 0x6E, 0x74,
-  0x53, 0x69, 0x7A, 0x65,  0x00, 0x73, 0x69, 0x7A,  0x65, 0x00, 0x74, 0x65,  0x78, 0x74, 0x44, 0x65,
-  0x63, 0x6F, 0x72, 0x61,  0x74, 0x69, 0x6F, 0x6E,  0x00, 0x75, 0x6E, 0x64,  0x65, 0x72, 0x6C, 0x69,
-  0x6E, 0x65, 0x00, 0x70,  0x61, 0x72, 0x73, 0x65,  0x43, 0x53, 0x53, 0x00,  0x63, 0x73, 0x73, 0x00,
-  0x70, 0x61, 0x72, 0x73,  0x65, 0x43, 0x53, 0x53,  0x49, 0x6E, 0x74, 0x65,  0x72, 0x6E, 0x61, 0x6C,
-  0x00, 0x72, 0x65, 0x73,  0x75, 0x6C, 0x74, 0x00,  0x6E, 0x75, 0x6C, 0x6C,  0x00, 0x70, 0x61, 0x72,
-  0x73, 0x65, 0x00, 0x37,  0x75, 0x70, 0x64, 0x61,  0x74, 0x65, 0x2C, 0x37,  0x70, 0x61, 0x72, 0x73,
-  0x65, 0x43, 0x53, 0x53,  0x49, 0x6E, 0x74, 0x65,  0x72, 0x6E, 0x61, 0x6C,  0x2C, 0x37, 0x70, 0x61,
-  0x72, 0x73, 0x65, 0x43,  0x53, 0x53, 0x46, 0x6F,  0x6E, 0x74, 0x46, 0x61,  0x6D, 0x69, 0x6C, 0x79,
-  0x2C, 0x37, 0x70, 0x61,  0x72, 0x73, 0x65, 0x43,  0x6F, 0x6C, 0x6F, 0x72,  0x00, 0x56, 0x69, 0x64,
-  0x65, 0x6F, 0x00, 0x36,  0x61, 0x74, 0x74, 0x61,  0x63, 0x68, 0x56, 0x69,  0x64, 0x65, 0x6F, 0x2C,
-  0x36, 0x63, 0x6C, 0x65,  0x61, 0x72, 0x00, 0x41,  0x63, 0x63, 0x65, 0x73,  0x73, 0x69, 0x62, 0x69,
-  0x6C, 0x69, 0x74, 0x79,  0x00, 0x36, 0x69, 0x73,  0x41, 0x63, 0x74, 0x69,  0x76, 0x65, 0x2C, 0x36,
-  0x73, 0x65, 0x6E, 0x64,  0x45, 0x76, 0x65, 0x6E,  0x74, 0x2C, 0x36, 0x75,  0x70, 0x64, 0x61, 0x74,
-  0x65, 0x50, 0x72, 0x6F,  0x70, 0x65, 0x72, 0x74,  0x69, 0x65, 0x73, 0x00,  0x43, 0x61, 0x6D, 0x65,
-  0x72, 0x61, 0x00, 0x67,  0x65, 0x74, 0x5F, 0x66,  0x75, 0x6E, 0x63, 0x00,  0x69, 0x6E, 0x64, 0x65,
-  0x78, 0x00, 0x36, 0x73,  0x65, 0x74, 0x4D, 0x6F,  0x64, 0x65, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x51,
-  0x75, 0x61, 0x6C, 0x69,  0x74, 0x79, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x4B,  0x65, 0x79, 0x46, 0x72,
-  0x61, 0x6D, 0x65, 0x49,  0x6E, 0x74, 0x65, 0x72,  0x76, 0x61, 0x6C, 0x2C,  0x36, 0x73, 0x65, 0x74,
-  0x4D, 0x6F, 0x74, 0x69,  0x6F, 0x6E, 0x4C, 0x65,  0x76, 0x65, 0x6C, 0x2C,  0x36, 0x73, 0x65, 0x74,
-  0x4C, 0x6F, 0x6F, 0x70,  0x62, 0x61, 0x63, 0x6B,  0x2C, 0x36, 0x73, 0x65,  0x74, 0x43, 0x75, 0x72,
-  0x73, 0x6F, 0x72, 0x00,  0x43, 0x6F, 0x6E, 0x74,  0x65, 0x78, 0x74, 0x4D,  0x65, 0x6E, 0x75, 0x00,
-  0x6F, 0x6E, 0x53, 0x65,  0x6C, 0x65, 0x63, 0x74,  0x00, 0x63, 0x61, 0x6C,  0x6C, 0x62, 0x61, 0x63,
-  0x6B, 0x00, 0x63, 0x75,  0x73, 0x74, 0x6F, 0x6D,  0x49, 0x74, 0x65, 0x6D,  0x73, 0x00, 0x62, 0x75,
-  0x69, 0x6C, 0x74, 0x49,  0x6E, 0x49, 0x74, 0x65,  0x6D, 0x73, 0x00, 0x66,  0x6F, 0x72, 0x77, 0x61,
-  0x72, 0x64, 0x5F, 0x62,  0x61, 0x63, 0x6B, 0x00,  0x6C, 0x6F, 0x6F, 0x70,  0x00, 0x70, 0x6C, 0x61,
-  0x79, 0x00, 0x70, 0x72,  0x69, 0x6E, 0x74, 0x00,  0x71, 0x75, 0x61, 0x6C,  0x69, 0x74, 0x79, 0x00,
-  0x72, 0x65, 0x77, 0x69,  0x6E, 0x64, 0x00, 0x73,  0x61, 0x76, 0x65, 0x00,  0x7A, 0x6F, 0x6F, 0x6D,
-  0x00, 0x63, 0x6F, 0x70,  0x79, 0x00, 0x68, 0x69,  0x64, 0x65, 0x42, 0x75,  0x69, 0x6C, 0x74, 0x49,
-  0x6E, 0x49, 0x74, 0x65,  0x6D, 0x73, 0x00, 0x43,  0x6F, 0x6E, 0x74, 0x65,  0x78, 0x74, 0x4D, 0x65,
-  0x6E, 0x75, 0x49, 0x74,  0x65, 0x6D, 0x00, 0x63,  0x61, 0x70, 0x74, 0x69,  0x6F, 0x6E, 0x00, 0x73,
-  0x65, 0x70, 0x61, 0x72,  0x61, 0x74, 0x6F, 0x72,  0x42, 0x65, 0x66, 0x6F,  0x72, 0x65, 0x00, 0x76,
-  0x69, 0x73, 0x69, 0x62,  0x6C, 0x65, 0x00, 0x6E,  0x65, 0x74, 0x00, 0x46,  0x69, 0x6C, 0x65, 0x52,
-  0x65, 0x66, 0x65, 0x72,  0x65, 0x6E, 0x63, 0x65,  0x00, 0x63, 0x00, 0x38,  0x62, 0x72, 0x6F, 0x77,
-  0x73, 0x65, 0x2C, 0x38,  0x75, 0x70, 0x6C, 0x6F,  0x61, 0x64, 0x2C, 0x38,  0x64, 0x6F, 0x77, 0x6E,
-  0x6C, 0x6F, 0x61, 0x64,  0x2C, 0x38, 0x63, 0x61,  0x6E, 0x63, 0x65, 0x6C,  0x00, 0x46, 0x69, 0x6C,
-  0x65, 0x52, 0x65, 0x66,  0x65, 0x72, 0x65, 0x6E,  0x63, 0x65, 0x4C, 0x69,  0x73, 0x74, 0x00, 0x66,
-  0x69, 0x6C, 0x65, 0x4C,  0x69, 0x73, 0x74, 0x00,  0x38, 0x62, 0x72, 0x6F,  0x77, 0x73, 0x65, 0x00,
-  0x4C, 0x6F, 0x63, 0x61,  0x6C, 0x43, 0x6F, 0x6E,  0x6E, 0x65, 0x63, 0x74,  0x69, 0x6F, 0x6E, 0x00,
-  0x36, 0x63, 0x6F, 0x6E,  0x6E, 0x65, 0x63, 0x74,  0x2C, 0x36, 0x73, 0x65,  0x6E, 0x64, 0x2C, 0x36,
-  0x63, 0x6C, 0x6F, 0x73,  0x65, 0x2C, 0x36, 0x64,  0x6F, 0x6D, 0x61, 0x69,  0x6E, 0x00, 0x4D, 0x69,
-  0x63, 0x72, 0x6F, 0x70,  0x68, 0x6F, 0x6E, 0x65,  0x00, 0x36, 0x73, 0x65,  0x74, 0x53, 0x69, 0x6C,
-  0x65, 0x6E, 0x63, 0x65,  0x4C, 0x65, 0x76, 0x65,  0x6C, 0x2C, 0x36, 0x73,  0x65, 0x74, 0x52, 0x61,
-  0x74, 0x65, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x47,  0x61, 0x69, 0x6E, 0x2C,  0x36, 0x73, 0x65, 0x74,
-  0x55, 0x73, 0x65, 0x45,  0x63, 0x68, 0x6F, 0x53,  0x75, 0x70, 0x70, 0x72,  0x65, 0x73, 0x73, 0x69,
-  0x6F, 0x6E, 0x00, 0x50,  0x72, 0x69, 0x6E, 0x74,  0x4A, 0x6F, 0x62, 0x00,  0x37, 0x73, 0x74, 0x61,
-  0x72, 0x74, 0x2C, 0x37,  0x61, 0x64, 0x64, 0x50,  0x61, 0x67, 0x65, 0x2C,  0x37, 0x73, 0x65, 0x6E,
-  0x64, 0x00, 0x53, 0x65,  0x6C, 0x65, 0x63, 0x74,  0x69, 0x6F, 0x6E, 0x00,  0x67, 0x65, 0x74, 0x42,
-  0x65, 0x67, 0x69, 0x6E,  0x49, 0x6E, 0x64, 0x65,  0x78, 0x2C, 0x67, 0x65,  0x74, 0x45, 0x6E, 0x64,
-  0x49, 0x6E, 0x64, 0x65,  0x78, 0x2C, 0x67, 0x65,  0x74, 0x43, 0x61, 0x72,  0x65, 0x74, 0x49, 0x6E,
-  0x64, 0x65, 0x78, 0x2C,  0x67, 0x65, 0x74, 0x46,  0x6F, 0x63, 0x75, 0x73,  0x2C, 0x73, 0x65, 0x74,
-  0x46, 0x6F, 0x63, 0x75,  0x73, 0x2C, 0x73, 0x65,  0x74, 0x53, 0x65, 0x6C,  0x65, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x00, 0x74,  0x65, 0x78, 0x74, 0x00,  0x54, 0x65, 0x78, 0x74,  0x52, 0x65, 0x6E, 0x64,
-  0x65, 0x72, 0x65, 0x72,  0x00, 0x38, 0x73, 0x65,  0x74, 0x41, 0x64, 0x76,  0x61, 0x6E, 0x63, 0x65,
-  0x64, 0x41, 0x6E, 0x74,  0x69, 0x61, 0x6C, 0x69,  0x61, 0x73, 0x69, 0x6E,  0x67, 0x54, 0x61, 0x62,
-  0x6C, 0x65, 0x00, 0x38,  0x6D, 0x61, 0x78, 0x4C,  0x65, 0x76, 0x65, 0x6C,  0x00, 0x38, 0x64, 0x69,
-  0x73, 0x70, 0x6C, 0x61,  0x79, 0x4D, 0x6F, 0x64,  0x65, 0x00, 0x74, 0x65,  0x78, 0x74, 0x52, 0x65,
-  0x6E, 0x64, 0x65, 0x72,  0x65, 0x72, 0x00, 0x58,  0x4D, 0x4C, 0x53, 0x6F,  0x63, 0x6B, 0x65, 0x74,
-  0x00, 0x6F, 0x6E, 0x58,  0x4D, 0x4C, 0x00, 0x63,  0x6F, 0x6E, 0x6E, 0x65,  0x63, 0x74, 0x2C, 0x73,
-  0x65, 0x6E, 0x64, 0x2C,  0x63, 0x6C, 0x6F, 0x73,  0x65, 0x00, 0x67, 0x65,  0x6F, 0x6D, 0x00, 0x50,
-  0x6F, 0x69, 0x6E, 0x74,  0x00, 0x61, 0x72, 0x67,  0x75, 0x6D, 0x65, 0x6E,  0x74, 0x73, 0x00, 0x79,
-  0x00, 0x64, 0x69, 0x73,  0x74, 0x61, 0x6E, 0x63,  0x65, 0x00, 0x62, 0x00,  0x73, 0x75, 0x62, 0x74,
-  0x72, 0x61, 0x63, 0x74,  0x00, 0x69, 0x6E, 0x74,  0x65, 0x72, 0x70, 0x6F,  0x6C, 0x61, 0x74, 0x65,
-  0x00, 0x70, 0x6F, 0x6C,  0x61, 0x72, 0x00, 0x4D,  0x61, 0x74, 0x68, 0x00,  0x61, 0x6E, 0x67, 0x6C,
-  0x65, 0x00, 0x63, 0x6F,  0x73, 0x00, 0x73, 0x69,  0x6E, 0x00, 0x73, 0x71,  0x72, 0x74, 0x00, 0x61,
-  0x64, 0x64, 0x00, 0x6F,  0x74, 0x68, 0x65, 0x72,  0x00, 0x63, 0x6C, 0x6F,  0x6E, 0x65, 0x00, 0x65,
-  0x71, 0x75, 0x61, 0x6C,  0x73, 0x00, 0x6E, 0x6F,  0x72, 0x6D, 0x61, 0x6C,  0x69, 0x7A, 0x65, 0x00,
-  0x66, 0x61, 0x63, 0x74,  0x6F, 0x72, 0x00, 0x6F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x00, 0x28, 0x78,
-  0x3D, 0x00, 0x2C, 0x20,  0x79, 0x3D, 0x00, 0x29,  0x00, 0x52, 0x65, 0x63,  0x74, 0x61, 0x6E, 0x67,
-  0x6C, 0x65, 0x00, 0x73,  0x65, 0x74, 0x45, 0x6D,  0x70, 0x74, 0x79, 0x00,  0x77, 0x69, 0x64, 0x74,
-  0x68, 0x00, 0x68, 0x65,  0x69, 0x67, 0x68, 0x74,  0x00, 0x2C, 0x20, 0x77,  0x3D, 0x00, 0x2C, 0x20,
-  0x68, 0x3D, 0x00, 0x72,  0x65, 0x63, 0x74, 0x00,  0x63, 0x6F, 0x6E, 0x74,  0x61, 0x69, 0x6E, 0x73,
-  0x00, 0x63, 0x6F, 0x6E,  0x74, 0x61, 0x69, 0x6E,  0x73, 0x50, 0x6F, 0x69,  0x6E, 0x74, 0x00, 0x70,
-  0x6F, 0x69, 0x6E, 0x74,  0x00, 0x63, 0x6F, 0x6E,  0x74, 0x61, 0x69, 0x6E,  0x73, 0x52, 0x65, 0x63,
-  0x74, 0x61, 0x6E, 0x67,  0x6C, 0x65, 0x00, 0x74,  0x72, 0x00, 0x74, 0x62,  0x00, 0x72, 0x72, 0x00,
-  0x72, 0x62, 0x00, 0x69,  0x73, 0x45, 0x6D, 0x70,  0x74, 0x79, 0x00, 0x69,  0x6E, 0x74, 0x65, 0x72,
-  0x73, 0x65, 0x63, 0x74,  0x69, 0x6F, 0x6E, 0x00,  0x69, 0x6E, 0x74, 0x73,  0x00, 0x6D, 0x61, 0x78,
-  0x00, 0x6D, 0x69, 0x6E,  0x00, 0x69, 0x6E, 0x74,  0x65, 0x72, 0x73, 0x65,  0x63, 0x74, 0x73, 0x00,
-  0x75, 0x6E, 0x69, 0x6F,  0x6E, 0x00, 0x64, 0x78,  0x00, 0x64, 0x79, 0x00,  0x6F, 0x66, 0x66, 0x73,
-  0x65, 0x74, 0x50, 0x6F,  0x69, 0x6E, 0x74, 0x00,  0x64, 0x00, 0x69, 0x6E,  0x66, 0x6C, 0x61, 0x74,
-  0x65, 0x00, 0x69, 0x6E,  0x66, 0x6C, 0x61, 0x74,  0x65, 0x50, 0x6F, 0x69,  0x6E, 0x74, 0x00, 0x6C,
-  0x65, 0x66, 0x74, 0x00,  0x72, 0x69, 0x67, 0x68,  0x74, 0x00, 0x74, 0x6F,  0x70, 0x00, 0x62, 0x6F,
-  0x74, 0x74, 0x6F, 0x6D,  0x00, 0x74, 0x6F, 0x70,  0x4C, 0x65, 0x66, 0x74,  0x00, 0x62, 0x6F, 0x74,
-  0x74, 0x6F, 0x6D, 0x52,  0x69, 0x67, 0x68, 0x74,  0x00, 0x4D, 0x61, 0x74,  0x72, 0x69, 0x78, 0x00,
-  0x69, 0x64, 0x65, 0x6E,  0x74, 0x69, 0x74, 0x79,  0x00, 0x70, 0x61, 0x00,  0x70, 0x62, 0x00, 0x70,
-  0x63, 0x00, 0x70, 0x64,  0x00, 0x74, 0x78, 0x00,  0x70, 0x74, 0x78, 0x00,  0x74, 0x79, 0x00, 0x70,
-  0x74, 0x79, 0x00, 0x63,  0x6F, 0x6E, 0x63, 0x61,  0x74, 0x00, 0x63, 0x72,  0x65, 0x61, 0x74, 0x65,
-  0x42, 0x6F, 0x78, 0x00,  0x72, 0x6F, 0x74, 0x61,  0x74, 0x69, 0x6F, 0x6E,  0x00, 0x72, 0x6F, 0x74,
-  0x61, 0x74, 0x65, 0x00,  0x73, 0x63, 0x61, 0x6C,  0x65, 0x58, 0x00, 0x73,  0x63, 0x61, 0x6C, 0x65,
-  0x59, 0x00, 0x73, 0x63,  0x61, 0x6C, 0x65, 0x00,  0x63, 0x72, 0x65, 0x61,  0x74, 0x65, 0x47, 0x72,
-  0x61, 0x64, 0x69, 0x65,  0x6E, 0x74, 0x42, 0x6F,  0x78, 0x00, 0x64, 0x65,  0x6C, 0x74, 0x61, 0x54,
-  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x50, 0x6F, 0x69, 0x6E,  0x74, 0x00, 0x70, 0x00,
-  0x69, 0x6E, 0x76, 0x65,  0x72, 0x74, 0x00, 0x64,  0x65, 0x74, 0x00, 0x61,  0x6D, 0x6F, 0x75, 0x6E,
-  0x74, 0x00, 0x74, 0x72,  0x61, 0x6E, 0x73, 0x66,  0x6F, 0x72, 0x6D, 0x50,  0x6F, 0x69, 0x6E, 0x74,
-  0x00, 0x74, 0x72, 0x61,  0x6E, 0x73, 0x6C, 0x61,  0x74, 0x65, 0x00, 0x28,  0x61, 0x3D, 0x00, 0x2C,
-  0x20, 0x62, 0x3D, 0x00,  0x2C, 0x20, 0x63, 0x3D,  0x00, 0x2C, 0x20, 0x64,  0x3D, 0x00, 0x2C, 0x20,
-  0x74, 0x78, 0x3D, 0x00,  0x2C, 0x20, 0x74, 0x79,  0x3D, 0x00, 0x43, 0x6F,  0x6C, 0x6F, 0x72, 0x54,
-  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x00, 0x28, 0x72, 0x65,  0x64, 0x4D, 0x75, 0x6C,
-  0x74, 0x69, 0x70, 0x6C,  0x69, 0x65, 0x72, 0x3D,  0x00, 0x72, 0x65, 0x64,  0x4D, 0x75, 0x6C, 0x74,
-  0x69, 0x70, 0x6C, 0x69,  0x65, 0x72, 0x00, 0x2C,  0x20, 0x67, 0x72, 0x65,  0x65, 0x6E, 0x4D, 0x75,
-  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x3D, 0x00, 0x67, 0x72,  0x65, 0x65, 0x6E, 0x4D,
-  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,  0x72, 0x00, 0x2C, 0x20,  0x62, 0x6C, 0x75, 0x65,
-  0x4D, 0x75, 0x6C, 0x74,  0x69, 0x70, 0x6C, 0x69,  0x65, 0x72, 0x3D, 0x00,  0x62, 0x6C, 0x75, 0x65,
-  0x4D, 0x75, 0x6C, 0x74,  0x69, 0x70, 0x6C, 0x69,  0x65, 0x72, 0x00, 0x2C,  0x20, 0x61, 0x6C, 0x70,
-  0x68, 0x61, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x3D, 0x00, 0x61, 0x6C,
-  0x70, 0x68, 0x61, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,  0x72, 0x00, 0x2C, 0x20,
-  0x72, 0x65, 0x64, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x3D, 0x00, 0x72,  0x65, 0x64, 0x4F, 0x66,
-  0x66, 0x73, 0x65, 0x74,  0x00, 0x2C, 0x20, 0x67,  0x72, 0x65, 0x65, 0x6E,  0x4F, 0x66, 0x66, 0x73,
-  0x65, 0x74, 0x3D, 0x00,  0x67, 0x72, 0x65, 0x65,  0x6E, 0x4F, 0x66, 0x66,  0x73, 0x65, 0x74, 0x00,
-  0x2C, 0x20, 0x62, 0x6C,  0x75, 0x65, 0x4F, 0x66,  0x66, 0x73, 0x65, 0x74,  0x3D, 0x00, 0x62, 0x6C,
-  0x75, 0x65, 0x4F, 0x66,  0x66, 0x73, 0x65, 0x74,  0x00, 0x2C, 0x20, 0x61,  0x6C, 0x70, 0x68, 0x61,
-  0x4F, 0x66, 0x66, 0x73,  0x65, 0x74, 0x3D, 0x00,  0x61, 0x6C, 0x70, 0x68,  0x61, 0x4F, 0x66, 0x66,
-  0x73, 0x65, 0x74, 0x00,  0x38, 0x63, 0x6F, 0x6E,  0x63, 0x61, 0x74, 0x00,  0x38, 0x61, 0x6C, 0x70,
-  0x68, 0x61, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x2C, 0x38, 0x72, 0x65,
-  0x64, 0x4D, 0x75, 0x6C,  0x74, 0x69, 0x70, 0x6C,  0x69, 0x65, 0x72, 0x2C,  0x38, 0x67, 0x72, 0x65,
-  0x65, 0x6E, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x2C, 0x38, 0x62, 0x6C,
-  0x75, 0x65, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x2C, 0x38, 0x61, 0x6C,
-  0x70, 0x68, 0x61, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x2C, 0x38, 0x72,  0x65, 0x64, 0x4F, 0x66,
-  0x66, 0x73, 0x65, 0x74,  0x2C, 0x38, 0x67, 0x72,  0x65, 0x65, 0x6E, 0x4F,  0x66, 0x66, 0x73, 0x65,
-  0x74, 0x2C, 0x38, 0x62,  0x6C, 0x75, 0x65, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x2C, 0x38, 0x72,
-  0x67, 0x62, 0x00, 0x54,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x00, 0x38, 0x6D, 0x61,
-  0x74, 0x72, 0x69, 0x78,  0x2C, 0x38, 0x63, 0x6F,  0x6E, 0x63, 0x61, 0x74,  0x65, 0x6E, 0x61, 0x74,
-  0x65, 0x64, 0x4D, 0x61,  0x74, 0x72, 0x69, 0x78,  0x2C, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x54,
-  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,  0x2C, 0x38, 0x63, 0x6F,  0x6E, 0x63, 0x61, 0x74,
-  0x65, 0x6E, 0x61, 0x74,  0x65, 0x64, 0x43, 0x6F,  0x6C, 0x6F, 0x72, 0x54,  0x72, 0x61, 0x6E, 0x73,
-  0x66, 0x6F, 0x72, 0x6D,  0x2C, 0x38, 0x70, 0x69,  0x78, 0x65, 0x6C, 0x42,  0x6F, 0x75, 0x6E, 0x64,
-  0x73, 0x00, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,  0x44, 0x61, 0x74, 0x61,  0x00, 0x52, 0x45, 0x44,
-  0x5F, 0x43, 0x48, 0x41,  0x4E, 0x4E, 0x45, 0x4C,  0x00, 0x47, 0x52, 0x45,  0x45, 0x4E, 0x5F, 0x43,
-  0x48, 0x41, 0x4E, 0x4E,  0x45, 0x4C, 0x00, 0x42,  0x4C, 0x55, 0x45, 0x5F,  0x43, 0x48, 0x41, 0x4E,
-  0x4E, 0x45, 0x4C, 0x00,  0x41, 0x4C, 0x50, 0x48,  0x41, 0x5F, 0x43, 0x48,  0x41, 0x4E, 0x4E, 0x45,
-  0x4C, 0x00, 0x38, 0x6C,  0x6F, 0x61, 0x64, 0x42,  0x69, 0x74, 0x6D, 0x61,  0x70, 0x00, 0x38, 0x67,
-  0x65, 0x74, 0x50, 0x69,  0x78, 0x65, 0x6C, 0x2C,  0x38, 0x73, 0x65, 0x74,  0x50, 0x69, 0x78, 0x65,
-  0x6C, 0x2C, 0x38, 0x66,  0x69, 0x6C, 0x6C, 0x52,  0x65, 0x63, 0x74, 0x2C,  0x38, 0x63, 0x6F, 0x70,
-  0x79, 0x50, 0x69, 0x78,  0x65, 0x6C, 0x73, 0x2C,  0x38, 0x61, 0x70, 0x70,  0x6C, 0x79, 0x46, 0x69,
-  0x6C, 0x74, 0x65, 0x72,  0x2C, 0x38, 0x73, 0x63,  0x72, 0x6F, 0x6C, 0x6C,  0x2C, 0x38, 0x74, 0x68,
-  0x72, 0x65, 0x73, 0x68,  0x6F, 0x6C, 0x64, 0x2C,  0x38, 0x64, 0x72, 0x61,  0x77, 0x2C, 0x38, 0x70,
-  0x69, 0x78, 0x65, 0x6C,  0x44, 0x69, 0x73, 0x73,  0x6F, 0x6C, 0x76, 0x65,  0x2C, 0x38, 0x67, 0x65,
-  0x74, 0x50, 0x69, 0x78,  0x65, 0x6C, 0x33, 0x32,  0x2C, 0x38, 0x73, 0x65,  0x74, 0x50, 0x69, 0x78,
-  0x65, 0x6C, 0x33, 0x32,  0x2C, 0x38, 0x66, 0x6C,  0x6F, 0x6F, 0x64, 0x46,  0x69, 0x6C, 0x6C, 0x2C,
-  0x38, 0x67, 0x65, 0x74,  0x43, 0x6F, 0x6C, 0x6F,  0x72, 0x42, 0x6F, 0x75,  0x6E, 0x64, 0x73, 0x52,
-  0x65, 0x63, 0x74, 0x2C,  0x38, 0x70, 0x65, 0x72,  0x6C, 0x69, 0x6E, 0x4E,  0x6F, 0x69, 0x73, 0x65,
-  0x2C, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x54,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,
-  0x2C, 0x38, 0x68, 0x69,  0x74, 0x54, 0x65, 0x73,  0x74, 0x2C, 0x38, 0x70,  0x61, 0x6C, 0x65, 0x74,
-  0x74, 0x65, 0x4D, 0x61,  0x70, 0x2C, 0x38, 0x6D,  0x65, 0x72, 0x67, 0x65,  0x2C, 0x38, 0x6E, 0x6F,
-  0x69, 0x73, 0x65, 0x2C,  0x38, 0x63, 0x6F, 0x70,  0x79, 0x43, 0x68, 0x61,  0x6E, 0x6E, 0x65, 0x6C,
-  0x2C, 0x38, 0x63, 0x6C,  0x6F, 0x6E, 0x65, 0x2C,  0x38, 0x64, 0x69, 0x73,  0x70, 0x6F, 0x73, 0x65,
-  0x2C, 0x38, 0x67, 0x65,  0x6E, 0x65, 0x72, 0x61,  0x74, 0x65, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,
-  0x52, 0x65, 0x63, 0x74,  0x2C, 0x38, 0x63, 0x6F,  0x6D, 0x70, 0x61, 0x72,  0x65, 0x00, 0x38, 0x77,
-  0x69, 0x64, 0x74, 0x68,  0x2C, 0x38, 0x68, 0x65,  0x69, 0x67, 0x68, 0x74,  0x2C, 0x38, 0x72, 0x65,
-  0x63, 0x74, 0x61, 0x6E,  0x67, 0x6C, 0x65, 0x2C,  0x38, 0x74, 0x72, 0x61,  0x6E, 0x73, 0x70, 0x61,
-  0x72, 0x65, 0x6E, 0x74,  0x00, 0x65, 0x78, 0x74,  0x65, 0x72, 0x6E, 0x61,  0x6C, 0x00, 0x45, 0x78,
-  0x74, 0x65, 0x72, 0x6E,  0x61, 0x6C, 0x49, 0x6E,  0x74, 0x65, 0x72, 0x66,  0x61, 0x63, 0x65, 0x00,
-  0x61, 0x64, 0x64, 0x43,  0x61, 0x6C, 0x6C, 0x62,  0x61, 0x63, 0x6B, 0x00,  0x61, 0x76, 0x61, 0x69,
-  0x6C, 0x61, 0x62, 0x6C,  0x65, 0x00, 0x5F, 0x69,  0x6E, 0x69, 0x74, 0x4A,  0x53, 0x00, 0x69, 0x6E,
-  0x73, 0x74, 0x61, 0x6E,  0x63, 0x65, 0x00, 0x72,  0x65, 0x71, 0x75, 0x65,  0x73, 0x74, 0x00, 0x5F,
-  0x63, 0x61, 0x6C, 0x6C,  0x49, 0x6E, 0x00, 0x5F,  0x61, 0x64, 0x64, 0x43,  0x61, 0x6C, 0x6C, 0x62,
-  0x61, 0x63, 0x6B, 0x00,  0x63, 0x61, 0x6C, 0x6C,  0x00, 0x74, 0x72, 0x79,  0x20, 0x7B, 0x20, 0x00,
-  0x5F, 0x6F, 0x62, 0x6A,  0x65, 0x63, 0x74, 0x49,  0x44, 0x00, 0x69, 0x64,  0x00, 0x2E, 0x53, 0x65,
-  0x74, 0x52, 0x65, 0x74,  0x75, 0x72, 0x6E, 0x56,  0x61, 0x6C, 0x75, 0x65,  0x28, 0x00, 0x5F, 0x5F,
-  0x66, 0x6C, 0x61, 0x73,  0x68, 0x5F, 0x5F, 0x74,  0x6F, 0x58, 0x4D, 0x4C,  0x20, 0x28, 0x00, 0x28,
-  0x00, 0x2C, 0x00, 0x5F,  0x74, 0x6F, 0x4A, 0x53,  0x00, 0x29, 0x29, 0x20,  0x00, 0x3B, 0x20, 0x7D,
-  0x20, 0x63, 0x61, 0x74,  0x63, 0x68, 0x20, 0x28,  0x65, 0x29, 0x20, 0x7B,  0x20, 0x00, 0x2E, 0x53,
-  0x65, 0x74, 0x52, 0x65,  0x74, 0x75, 0x72, 0x6E,  0x56, 0x61, 0x6C, 0x75,  0x65, 0x28, 0x22, 0x3C,
-  0x75, 0x6E, 0x64, 0x65,  0x66, 0x69, 0x6E, 0x65,  0x64, 0x2F, 0x3E, 0x22,  0x29, 0x3B, 0x20, 0x7D,
-  0x00, 0x22, 0x3C, 0x75,  0x6E, 0x64, 0x65, 0x66,  0x69, 0x6E, 0x65, 0x64,  0x2F, 0x3E, 0x22, 0x3B,
-  0x20, 0x7D, 0x00, 0x5F,  0x65, 0x76, 0x61, 0x6C,  0x4A, 0x53, 0x00, 0x3C,  0x69, 0x6E, 0x76, 0x6F,
-  0x6B, 0x65, 0x20, 0x6E,  0x61, 0x6D, 0x65, 0x3D,  0x22, 0x00, 0x22, 0x20,  0x72, 0x65, 0x74, 0x75,
-  0x72, 0x6E, 0x74, 0x79,  0x70, 0x65, 0x3D, 0x22,  0x78, 0x6D, 0x6C, 0x22,  0x3E, 0x00, 0x5F, 0x61,
-  0x72, 0x67, 0x75, 0x6D,  0x65, 0x6E, 0x74, 0x73,  0x54, 0x6F, 0x58, 0x4D,  0x4C, 0x00, 0x3C, 0x2F,
-  0x69, 0x6E, 0x76, 0x6F,  0x6B, 0x65, 0x3E, 0x00,  0x5F, 0x63, 0x61, 0x6C,  0x6C, 0x4F, 0x75, 0x74,
-  0x00, 0x78, 0x6D, 0x6C,  0x00, 0x69, 0x67, 0x6E,  0x6F, 0x72, 0x65, 0x57,  0x68, 0x69, 0x74, 0x65,
-  0x00, 0x66, 0x69, 0x72,  0x73, 0x74, 0x43, 0x68,  0x69, 0x6C, 0x64, 0x00,  0x5F, 0x74, 0x6F, 0x41,
-  0x53, 0x00, 0x61, 0x72,  0x67, 0x73, 0x00, 0x63,  0x68, 0x69, 0x6C, 0x64,  0x4E, 0x6F, 0x64, 0x65,
-  0x73, 0x00, 0x6E, 0x6F,  0x64, 0x65, 0x4E, 0x61,  0x6D, 0x65, 0x00, 0x5F,  0x61, 0x72, 0x67, 0x75,
-  0x6D, 0x65, 0x6E, 0x74,  0x73, 0x54, 0x6F, 0x41,  0x53, 0x00, 0x61, 0x70,  0x70, 0x6C, 0x79, 0x00,
-  0x61, 0x74, 0x74, 0x72,  0x69, 0x62, 0x75, 0x74,  0x65, 0x73, 0x00, 0x72,  0x65, 0x74, 0x75, 0x72,
-  0x6E, 0x74, 0x79, 0x70,  0x65, 0x00, 0x6A, 0x61,  0x76, 0x61, 0x73, 0x63,  0x72, 0x69, 0x70, 0x74,
-  0x00, 0x5F, 0x74, 0x6F,  0x58, 0x4D, 0x4C, 0x00,  0x5F, 0x61, 0x72, 0x72,  0x61, 0x79, 0x54, 0x6F,
-  0x58, 0x4D, 0x4C, 0x00,  0x3C, 0x61, 0x72, 0x72,  0x61, 0x79, 0x3E, 0x00,  0x73, 0x00, 0x61, 0x72,
-  0x72, 0x61, 0x79, 0x00,  0x3C, 0x70, 0x72, 0x6F,  0x70, 0x65, 0x72, 0x74,  0x79, 0x20, 0x69, 0x64,
-  0x3D, 0x22, 0x00, 0x22,  0x3E, 0x00, 0x3C, 0x2F,  0x70, 0x72, 0x6F, 0x70,  0x65, 0x72, 0x74, 0x79,
-  0x3E, 0x00, 0x3C, 0x2F,  0x61, 0x72, 0x72, 0x61,  0x79, 0x3E, 0x00, 0x3C,  0x61, 0x72, 0x67, 0x75,
-  0x6D, 0x65, 0x6E, 0x74,  0x73, 0x3E, 0x00, 0x3C,  0x2F, 0x61, 0x72, 0x67,  0x75, 0x6D, 0x65, 0x6E,
-  0x74, 0x73, 0x3E, 0x00,  0x5F, 0x6F, 0x62, 0x6A,  0x65, 0x63, 0x74, 0x54,  0x6F, 0x58, 0x4D, 0x4C,
-  0x00, 0x3C, 0x6F, 0x62,  0x6A, 0x65, 0x63, 0x74,  0x3E, 0x00, 0x6F, 0x62,  0x6A, 0x00, 0x3C, 0x2F,
-  0x6F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x3E, 0x00,  0x3C, 0x73, 0x74, 0x72,  0x69, 0x6E, 0x67, 0x3E,
-  0x00, 0x5F, 0x65, 0x73,  0x63, 0x61, 0x70, 0x65,  0x58, 0x4D, 0x4C, 0x00,  0x3C, 0x2F, 0x73, 0x74,
-  0x72, 0x69, 0x6E, 0x67,  0x3E, 0x00, 0x3C, 0x75,  0x6E, 0x64, 0x65, 0x66,  0x69, 0x6E, 0x65, 0x64,
-  0x2F, 0x3E, 0x00, 0x6E,  0x75, 0x6D, 0x62, 0x65,  0x72, 0x00, 0x3C, 0x6E,  0x75, 0x6D, 0x62, 0x65,
-  0x72, 0x3E, 0x00, 0x3C,  0x2F, 0x6E, 0x75, 0x6D,  0x62, 0x65, 0x72, 0x3E,  0x00, 0x3C, 0x6E, 0x75,
-  0x6C, 0x6C, 0x2F, 0x3E,  0x00, 0x62, 0x6F, 0x6F,  0x6C, 0x65, 0x61, 0x6E,  0x00, 0x3C, 0x74, 0x72,
-  0x75, 0x65, 0x2F, 0x3E,  0x00, 0x3C, 0x66, 0x61,  0x6C, 0x73, 0x65, 0x2F,  0x3E, 0x00, 0x68, 0x61,
-  0x73, 0x4F, 0x77, 0x6E,  0x50, 0x72, 0x6F, 0x70,  0x65, 0x72, 0x74, 0x79,  0x00, 0x5F, 0x6F, 0x62,
-  0x6A, 0x65, 0x63, 0x74,  0x54, 0x6F, 0x41, 0x53,  0x00, 0x70, 0x72, 0x6F,  0x70, 0x65, 0x72, 0x74,
-  0x79, 0x00, 0x5F, 0x61,  0x72, 0x72, 0x61, 0x79,  0x54, 0x6F, 0x41, 0x53,  0x00, 0x4E, 0x75, 0x6D,
-  0x62, 0x65, 0x72, 0x00,  0x53, 0x74, 0x72, 0x69,  0x6E, 0x67, 0x00, 0x5F,  0x75, 0x6E, 0x65, 0x73,
-  0x63, 0x61, 0x70, 0x65,  0x58, 0x4D, 0x4C, 0x00,  0x63, 0x6C, 0x61, 0x73,  0x73, 0x00, 0x5F, 0x61,
-  0x72, 0x72, 0x61, 0x79,  0x54, 0x6F, 0x4A, 0x53,  0x00, 0x5B, 0x00, 0x5F,  0x6C, 0x31, 0x00, 0x5D,
-  0x00, 0x5F, 0x6F, 0x62,  0x6A, 0x65, 0x63, 0x74,  0x54, 0x6F, 0x4A, 0x53,  0x00, 0x28, 0x7B, 0x00,
-  0x6E, 0x65, 0x65, 0x64,  0x73, 0x5F, 0x63, 0x6F,  0x6D, 0x6D, 0x61, 0x00,  0x3A, 0x00, 0x7D, 0x29,
-  0x00, 0x22, 0x00, 0x5F,  0x6A, 0x73, 0x51, 0x75,  0x6F, 0x74, 0x65, 0x53,  0x74, 0x72, 0x69, 0x6E,
-  0x67, 0x00, 0x38, 0x5F,  0x69, 0x6E, 0x69, 0x74,  0x4A, 0x53, 0x2C, 0x38,  0x5F, 0x6F, 0x62, 0x6A,
-  0x65, 0x63, 0x74, 0x49,  0x44, 0x2C, 0x38, 0x5F,  0x61, 0x64, 0x64, 0x43,  0x61, 0x6C, 0x6C, 0x62,
-  0x61, 0x63, 0x6B, 0x2C,  0x38, 0x5F, 0x65, 0x76,  0x61, 0x6C, 0x4A, 0x53,  0x2C, 0x38, 0x5F, 0x63,
-  0x61, 0x6C, 0x6C, 0x4F,  0x75, 0x74, 0x2C, 0x38,  0x5F, 0x65, 0x73, 0x63,  0x61, 0x70, 0x65, 0x58,
-  0x4D, 0x4C, 0x2C, 0x38,  0x5F, 0x75, 0x6E, 0x65,  0x73, 0x63, 0x61, 0x70,  0x65, 0x58, 0x4D, 0x4C,
-  0x2C, 0x38, 0x5F, 0x6A,  0x73, 0x51, 0x75, 0x6F,  0x74, 0x65, 0x53, 0x74,  0x72, 0x69, 0x6E, 0x67,
-  0x00, 0x38, 0x61, 0x76,  0x61, 0x69, 0x6C, 0x61,  0x62, 0x6C, 0x65, 0x00,  0x53, 0x68, 0x61, 0x72,
-  0x65, 0x64, 0x4F, 0x62,  0x6A, 0x65, 0x63, 0x74,  0x00, 0x64, 0x65, 0x6C,  0x65, 0x74, 0x65, 0x41,
-  0x6C, 0x6C, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x68, 0x61,
-  0x72, 0x65, 0x64, 0x4F,  0x62, 0x6A, 0x65, 0x63,  0x74, 0x2E, 0x64, 0x65,  0x6C, 0x65, 0x74, 0x65,
-  0x41, 0x6C, 0x6C, 0x20,  0x28, 0x73, 0x74, 0x61,  0x74, 0x69, 0x63, 0x29,  0x00, 0x67, 0x65, 0x74,
-  0x44, 0x69, 0x73, 0x6B,  0x55, 0x73, 0x61, 0x67,  0x65, 0x00, 0x49, 0x6D,  0x70, 0x6C, 0x65, 0x6D,
-  0x65, 0x6E, 0x74, 0x20,  0x53, 0x68, 0x61, 0x72,  0x65, 0x64, 0x4F, 0x62,  0x6A, 0x65, 0x63, 0x74,
-  0x2E, 0x67, 0x65, 0x74,  0x44, 0x69, 0x73, 0x6B,  0x55, 0x73, 0x61, 0x67,  0x65, 0x20, 0x28, 0x73,
-  0x74, 0x61, 0x74, 0x69,  0x63, 0x29, 0x00, 0x67,  0x65, 0x74, 0x4C, 0x6F,  0x63, 0x61, 0x6C, 0x00,
-  0x49, 0x6D, 0x70, 0x6C,  0x65, 0x6D, 0x65, 0x6E,  0x74, 0x20, 0x53, 0x68,  0x61, 0x72, 0x65, 0x64,
-  0x4F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x2E, 0x67,  0x65, 0x74, 0x4C, 0x6F,  0x63, 0x61, 0x6C, 0x20,
-  0x28, 0x73, 0x74, 0x61,  0x74, 0x69, 0x63, 0x29,  0x00, 0x67, 0x65, 0x74,  0x52, 0x65, 0x6D, 0x6F,
-  0x74, 0x65, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x53, 0x68, 0x61,
-  0x72, 0x65, 0x64, 0x4F,  0x62, 0x6A, 0x65, 0x63,  0x74, 0x2E, 0x67, 0x65,  0x74, 0x52, 0x65, 0x6D,
-  0x6F, 0x74, 0x65, 0x20,  0x28, 0x73, 0x74, 0x61,  0x74, 0x69, 0x63, 0x29,  0x00, 0x64, 0x65, 0x6C,
-  0x65, 0x74, 0x65, 0x41,  0x6C, 0x6C, 0x2C, 0x67,  0x65, 0x74, 0x44, 0x69,  0x73, 0x6B, 0x55, 0x73,
-  0x61, 0x67, 0x65, 0x00,  0x36, 0x63, 0x6F, 0x6E,  0x6E, 0x65, 0x63, 0x74,  0x2C, 0x36, 0x73, 0x65,
-  0x6E, 0x64, 0x2C, 0x36,  0x66, 0x6C, 0x75, 0x73,  0x68, 0x2C, 0x36, 0x63,  0x6C, 0x6F, 0x73, 0x65,
-  0x2C, 0x36, 0x67, 0x65,  0x74, 0x53, 0x69, 0x7A,  0x65, 0x2C, 0x36, 0x73,  0x65, 0x74, 0x46, 0x70,
-  0x73, 0x2C, 0x36, 0x63,  0x6C, 0x65, 0x61, 0x72,  0x00, 0x41, 0x73, 0x53,  0x65, 0x74, 0x75, 0x70,
-  0x45, 0x72, 0x72, 0x6F,  0x72, 0x00, 0x73, 0x70,  0x6C, 0x69, 0x74, 0x00,  0x63, 0x6F, 0x75, 0x6E,
-  0x74, 0x00, 0x52, 0x65,  0x6D, 0x6F, 0x74, 0x65,  0x4C, 0x53, 0x4F, 0x55,  0x73, 0x61, 0x67, 0x65,
-  0x00, 0x67, 0x65, 0x74,  0x55, 0x52, 0x4C, 0x50,  0x61, 0x67, 0x65, 0x53,  0x75, 0x70, 0x70, 0x6F,
-  0x72, 0x74, 0x00, 0x49,  0x6D, 0x70, 0x6C, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x20, 0x52, 0x65, 0x6D,
-  0x6F, 0x74, 0x65, 0x4C,  0x53, 0x4F, 0x55, 0x73,  0x61, 0x67, 0x65, 0x2E,  0x67, 0x65, 0x74, 0x55,
-  0x52, 0x4C, 0x50, 0x61,  0x67, 0x65, 0x53, 0x75,  0x70, 0x70, 0x6F, 0x72,  0x74, 0x20, 0x28, 0x73,
-  0x74, 0x61, 0x74, 0x69,  0x63, 0x29, 0x00, 0x42,  0x75, 0x74, 0x74, 0x6F,  0x6E, 0x00, 0x67, 0x65,
-  0x74, 0x44, 0x65, 0x70,  0x74, 0x68, 0x00, 0x38,  0x73, 0x63, 0x61, 0x6C,  0x65, 0x39, 0x47, 0x72,
-  0x69, 0x64, 0x2C, 0x38,  0x66, 0x69, 0x6C, 0x74,  0x65, 0x72, 0x73, 0x2C,  0x38, 0x63, 0x61, 0x63,
-  0x68, 0x65, 0x41, 0x73,  0x42, 0x69, 0x74, 0x6D,  0x61, 0x70, 0x2C, 0x38,  0x62, 0x6C, 0x65, 0x6E,
-  0x64, 0x4D, 0x6F, 0x64,  0x65, 0x00, 0x66, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x73, 0x00, 0x42, 0x69,
-  0x74, 0x6D, 0x61, 0x70,  0x46, 0x69, 0x6C, 0x74,  0x65, 0x72, 0x00, 0x38,  0x63, 0x6C, 0x6F, 0x6E,
-  0x65, 0x00, 0x42, 0x65,  0x76, 0x65, 0x6C, 0x46,  0x69, 0x6C, 0x74, 0x65,  0x72, 0x00, 0x38, 0x64,
-  0x69, 0x73, 0x74, 0x61,  0x6E, 0x63, 0x65, 0x2C,  0x38, 0x61, 0x6E, 0x67,  0x6C, 0x65, 0x2C, 0x38,
-  0x68, 0x69, 0x67, 0x68,  0x6C, 0x69, 0x67, 0x68,  0x74, 0x43, 0x6F, 0x6C,  0x6F, 0x72, 0x2C, 0x38,
-  0x68, 0x69, 0x67, 0x68,  0x6C, 0x69, 0x67, 0x68,  0x74, 0x41, 0x6C, 0x70,  0x68, 0x61, 0x2C, 0x38,
-  0x73, 0x68, 0x61, 0x64,  0x6F, 0x77, 0x43, 0x6F,  0x6C, 0x6F, 0x72, 0x2C,  0x38, 0x73, 0x68, 0x61,
-  0x64, 0x6F, 0x77, 0x41,  0x6C, 0x70, 0x68, 0x61,  0x2C, 0x38, 0x71, 0x75,  0x61, 0x6C, 0x69, 0x74,
-  0x79, 0x2C, 0x38, 0x73,  0x74, 0x72, 0x65, 0x6E,  0x67, 0x74, 0x68, 0x2C,  0x38, 0x6B, 0x6E, 0x6F,
-  0x63, 0x6B, 0x6F, 0x75,  0x74, 0x2C, 0x38, 0x62,  0x6C, 0x75, 0x72, 0x58,  0x2C, 0x38, 0x62, 0x6C,
-  0x75, 0x72, 0x59, 0x2C,  0x38, 0x74, 0x79, 0x70,  0x65, 0x00, 0x42, 0x6C,  0x75, 0x72, 0x46, 0x69,
-  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x62, 0x6C,  0x75, 0x72, 0x58, 0x2C,  0x38, 0x62, 0x6C, 0x75,
-  0x72, 0x59, 0x2C, 0x38,  0x71, 0x75, 0x61, 0x6C,  0x69, 0x74, 0x79, 0x00,  0x43, 0x6F, 0x6C, 0x6F,
-  0x72, 0x4D, 0x61, 0x74,  0x72, 0x69, 0x78, 0x46,  0x69, 0x6C, 0x74, 0x65,  0x72, 0x00, 0x38, 0x6D,
-  0x61, 0x74, 0x72, 0x69,  0x78, 0x00, 0x43, 0x6F,  0x6E, 0x76, 0x6F, 0x6C,  0x75, 0x74, 0x69, 0x6F,
-  0x6E, 0x46, 0x69, 0x6C,  0x74, 0x65, 0x72, 0x00,  0x38, 0x6D, 0x61, 0x74,  0x72, 0x69, 0x78, 0x58,
-  0x2C, 0x38, 0x6D, 0x61,  0x74, 0x72, 0x69, 0x78,  0x59, 0x2C, 0x38, 0x6D,  0x61, 0x74, 0x72, 0x69,
-  0x78, 0x2C, 0x38, 0x64,  0x69, 0x76, 0x69, 0x73,  0x6F, 0x72, 0x2C, 0x38,  0x62, 0x69, 0x61, 0x73,
-  0x2C, 0x38, 0x70, 0x72,  0x65, 0x73, 0x65, 0x72,  0x76, 0x65, 0x41, 0x6C,  0x70, 0x68, 0x61, 0x2C,
-  0x38, 0x63, 0x6C, 0x61,  0x6D, 0x70, 0x2C, 0x38,  0x63, 0x6F, 0x6C, 0x6F,  0x72, 0x2C, 0x38, 0x61,
-  0x6C, 0x70, 0x68, 0x61,  0x00, 0x44, 0x69, 0x73,  0x70, 0x6C, 0x61, 0x63,  0x65, 0x6D, 0x65, 0x6E,
-  0x74, 0x4D, 0x61, 0x70,  0x46, 0x69, 0x6C, 0x74,  0x65, 0x72, 0x00, 0x38,  0x6D, 0x61, 0x70, 0x42,
-  0x69, 0x74, 0x6D, 0x61,  0x70, 0x2C, 0x38, 0x6D,  0x61, 0x70, 0x50, 0x6F,  0x69, 0x6E, 0x74, 0x2C,
-  0x38, 0x63, 0x6F, 0x6D,  0x70, 0x6F, 0x6E, 0x65,  0x6E, 0x74, 0x58, 0x2C,  0x38, 0x63, 0x6F, 0x6D,
-  0x70, 0x6F, 0x6E, 0x65,  0x6E, 0x74, 0x59, 0x2C,  0x38, 0x73, 0x63, 0x61,  0x6C, 0x65, 0x58, 0x2C,
-  0x38, 0x73, 0x63, 0x61,  0x6C, 0x65, 0x59, 0x2C,  0x38, 0x6D, 0x6F, 0x64,  0x65, 0x2C, 0x38, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72,  0x2C, 0x38, 0x61, 0x6C,  0x70, 0x68, 0x61, 0x00,  0x44, 0x72, 0x6F, 0x70,
-  0x53, 0x68, 0x61, 0x64,  0x6F, 0x77, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x64, 0x69,
-  0x73, 0x74, 0x61, 0x6E,  0x63, 0x65, 0x2C, 0x38,  0x61, 0x6E, 0x67, 0x6C,  0x65, 0x2C, 0x38, 0x63,
-  0x6F, 0x6C, 0x6F, 0x72,  0x2C, 0x38, 0x61, 0x6C,  0x70, 0x68, 0x61, 0x2C,  0x38, 0x71, 0x75, 0x61,
-  0x6C, 0x69, 0x74, 0x79,  0x2C, 0x38, 0x69, 0x6E,  0x6E, 0x65, 0x72, 0x2C,  0x38, 0x6B, 0x6E, 0x6F,
-  0x63, 0x6B, 0x6F, 0x75,  0x74, 0x2C, 0x38, 0x62,  0x6C, 0x75, 0x72, 0x58,  0x2C, 0x38, 0x62, 0x6C,
-  0x75, 0x72, 0x59, 0x2C,  0x38, 0x73, 0x74, 0x72,  0x65, 0x6E, 0x67, 0x74,  0x68, 0x2C, 0x38, 0x68,
-  0x69, 0x64, 0x65, 0x4F,  0x62, 0x6A, 0x65, 0x63,  0x74, 0x00, 0x47, 0x6C,  0x6F, 0x77, 0x46, 0x69,
-  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x2C,  0x38, 0x61, 0x6C, 0x70,
-  0x68, 0x61, 0x2C, 0x38,  0x71, 0x75, 0x61, 0x6C,  0x69, 0x74, 0x79, 0x2C,  0x38, 0x69, 0x6E, 0x6E,
-  0x65, 0x72, 0x2C, 0x38,  0x6B, 0x6E, 0x6F, 0x63,  0x6B, 0x6F, 0x75, 0x74,  0x2C, 0x38, 0x62, 0x6C,
-  0x75, 0x72, 0x58, 0x2C,  0x38, 0x62, 0x6C, 0x75,  0x72, 0x59, 0x2C, 0x38,  0x73, 0x74, 0x72, 0x65,
-  0x6E, 0x67, 0x74, 0x68,  0x00, 0x47, 0x72, 0x61,  0x64, 0x69, 0x65, 0x6E,  0x74, 0x42, 0x65, 0x76,
-  0x65, 0x6C, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x64, 0x69,  0x73, 0x74, 0x61, 0x6E,
-  0x63, 0x65, 0x2C, 0x38,  0x61, 0x6E, 0x67, 0x6C,  0x65, 0x2C, 0x38, 0x63,  0x6F, 0x6C, 0x6F, 0x72,
-  0x73, 0x2C, 0x38, 0x61,  0x6C, 0x70, 0x68, 0x61,  0x73, 0x2C, 0x38, 0x72,  0x61, 0x74, 0x69, 0x6F,
-  0x73, 0x2C, 0x38, 0x62,  0x6C, 0x75, 0x72, 0x58,  0x2C, 0x38, 0x62, 0x6C,  0x75, 0x72, 0x59, 0x2C,
-  0x38, 0x71, 0x75, 0x61,  0x6C, 0x69, 0x74, 0x79,  0x2C, 0x38, 0x73, 0x74,  0x72, 0x65, 0x6E, 0x67,
-  0x74, 0x68, 0x2C, 0x38,  0x6B, 0x6E, 0x6F, 0x63,  0x6B, 0x6F, 0x75, 0x74,  0x2C, 0x38, 0x74, 0x79,
-  0x70, 0x65, 0x00, 0x47,  0x72, 0x61, 0x64, 0x69,  0x65, 0x6E, 0x74, 0x47,  0x6C, 0x6F, 0x77, 0x46,
-  0x69, 0x6C, 0x74, 0x65,  0x72, 0x00, 0x73, 0x65,  0x74, 0x49, 0x6E, 0x74,  0x65, 0x72, 0x76, 0x61,
-  0x6C, 0x00, 0x63, 0x6C,  0x65, 0x61, 0x72, 0x49,  0x6E, 0x74, 0x65, 0x72,  0x76, 0x61, 0x6C, 0x00,
-  0x73, 0x65, 0x74, 0x54,  0x69, 0x6D, 0x65, 0x6F,  0x75, 0x74, 0x00, 0x63,  0x6C, 0x65, 0x61, 0x72,
-  0x54, 0x69, 0x6D, 0x65,  0x6F, 0x75, 0x74, 0x00,  0x73, 0x68, 0x6F, 0x77,  0x52, 0x65, 0x64, 0x72,
-  0x61, 0x77, 0x52, 0x65,  0x67, 0x69, 0x6F, 0x6E,  0x73, 0x00, 0x74, 0x72,  0x61, 0x63, 0x65, 0x00,
-  0x75, 0x70, 0x64, 0x61,  0x74, 0x65, 0x41, 0x66,  0x74, 0x65, 0x72, 0x45,  0x76, 0x65, 0x6E, 0x74,
-  0x00, 0x96, 0x13, 0x00,  0x08, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x1D, 0x96, 0x13, 0x00,  0x08, 0x02, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,
-  0x1D, 0x96, 0x13, 0x00,  0x08, 0x03, 0x07, 0x01,  0x00, 0x00, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x1D, 0x96, 0x07, 0x00,  0x08, 0x04, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x1D, 0x96, 0x02, 0x00,  0x08, 0x05, 0x1C, 0x96,  0x13, 0x00, 0x08, 0x06,
-  0x07, 0x08, 0x00, 0x00,  0x00, 0x07, 0x65, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
-  0x01, 0x3D, 0x4F, 0x96,  0x08, 0x00, 0x07, 0x07,  0x00, 0x00, 0x00, 0x02,  0x08, 0x05, 0x1C, 0x96,
-  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0x80,
-  0x00, 0x00, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x07, 0x08, 0x05,  0x1C, 0x96, 0x07, 0x00,
-  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x08, 0x9B, 0x09,
-  0x00, 0x00, 0x01, 0x00,  0x6D, 0x73, 0x67, 0x00,  0x23, 0x00, 0x96, 0x02,  0x00, 0x08, 0x09, 0x1C,
-  0x44, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x49, 0x12,  0x12, 0x9D, 0x02, 0x00,  0x0F, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,  0x0C, 0x08, 0x09, 0x1C,  0x4F, 0x1D, 0x96, 0x02,
-  0x00, 0x08, 0x08, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0x0E, 0x08,
-  0x08, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x04, 0x00, 0x08,  0x0C, 0x08, 0x08, 0x87,
-  0x01, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x04,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x08, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0F, 0x9B,  0x05, 0x00, 0x00, 0x00,
-  0x00, 0x0D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0C, 0x4E, 0x3E,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x10, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x1D, 0x96,
-  0x02, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x13, 0x00,  0x08, 0x11, 0x07, 0x0C,  0x00, 0x00, 0x00, 0x07,
-  0x65, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x12,  0x9B, 0x07, 0x00, 0x00,  0x01, 0x00, 0x78, 0x00,
-  0x3C, 0x00, 0x96, 0x02,  0x00, 0x08, 0x13, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x14,  0x52, 0x17, 0x96, 0x02,  0x00, 0x08, 0x13, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x15,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x16, 0x52, 0x17,  0x96, 0x02, 0x00, 0x05,  0x01, 0x3E, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x14, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,
-  0x78, 0x00, 0x8A, 0x00,  0x96, 0x04, 0x00, 0x08,  0x17, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x15, 0x4E, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x41, 0x96, 0x07, 0x00,  0x08, 0x18, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x17, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x4B,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x17, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x13, 0x1C,
-  0x49, 0x12, 0x9D, 0x02,  0x00, 0x23, 0x00, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x18, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x17,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x1A, 0x52, 0x17,  0x96, 0x02, 0x00, 0x05,  0x01, 0x3E, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,
-  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x9C, 0xFF,  0x96, 0x02, 0x00, 0x05,  0x00, 0x3E, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1B, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,
-  0x6F, 0x00, 0x73, 0x00,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x13,  0x00, 0x08, 0x11, 0x07,
-  0x0C, 0x00, 0x00, 0x00,  0x07, 0x65, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x04, 0x00, 0x08,  0x12, 0x08, 0x10, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x12, 0x4E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x04, 0x00,
-  0x08, 0x14, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x14, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x1C, 0x1C, 0x96, 0x07,  0x00, 0x08, 0x15, 0x07,  0x00, 0x00, 0x00, 0x00,  0x42, 0x4F, 0x96, 0x09,
-  0x00, 0x07, 0x83, 0x00,  0x00, 0x00, 0x08, 0x1D,  0x08, 0x1C, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,
-  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x4F,  0x96, 0x8C, 0x00, 0x08,  0x1E, 0x08, 0x1F, 0x07,
-  0x12, 0x00, 0x00, 0x00,  0x08, 0x20, 0x07, 0x08,  0x00, 0x00, 0x00, 0x08,  0x21, 0x07, 0x14, 0x00,
-  0x00, 0x00, 0x08, 0x22,  0x07, 0x11, 0x00, 0x00,  0x00, 0x08, 0x23, 0x07,  0x2E, 0x00, 0x00, 0x00,
-  0x08, 0x24, 0x07, 0x28,  0x00, 0x00, 0x00, 0x08,  0x25, 0x07, 0x23, 0x00,  0x00, 0x00, 0x08, 0x26,
-  0x07, 0x0D, 0x00, 0x00,  0x00, 0x08, 0x27, 0x07,  0x1B, 0x00, 0x00, 0x00,  0x08, 0x28, 0x07, 0x24,
-  0x00, 0x00, 0x00, 0x08,  0x29, 0x07, 0x2D, 0x00,  0x00, 0x00, 0x08, 0x2A,  0x07, 0x25, 0x00, 0x00,
-  0x00, 0x08, 0x2B, 0x07,  0x22, 0x00, 0x00, 0x00,  0x08, 0x2C, 0x07, 0x21,  0x00, 0x00, 0x00, 0x08,
-  0x2D, 0x07, 0x27, 0x00,  0x00, 0x00, 0x08, 0x2E,  0x07, 0x10, 0x00, 0x00,  0x00, 0x08, 0x2F, 0x07,
-  0x20, 0x00, 0x00, 0x00,  0x08, 0x30, 0x07, 0x09,  0x00, 0x00, 0x00, 0x08,  0x31, 0x07, 0x26, 0x00,
-  0x00, 0x00, 0x07, 0x13,  0x00, 0x00, 0x00, 0x43,  0x1D, 0x96, 0x09, 0x00,  0x08, 0x32, 0x07, 0x20,
-  0x03, 0x00, 0x00, 0x08,  0x1E, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,
-  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x1E, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,  0x52, 0x17, 0x96, 0x08,  0x00, 0x07, 0x07, 0x00,
-  0x00, 0x00, 0x02, 0x08,  0x1E, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x07,  0x00, 0x08, 0x33, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x1D, 0x96, 0x02,
-  0x00, 0x08, 0x33, 0x1C,  0x96, 0x13, 0x00, 0x08,  0x34, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x05,
+  0x63, 0x74, 0x2E, 0x69,  0x6E, 0x73, 0x74, 0x61,  0x6C, 0x6C, 0x65, 0x64,  0x56, 0x65, 0x72, 0x73,
+  0x69, 0x6F, 0x6E, 0x00,  0x76, 0x61, 0x6C, 0x69,  0x64, 0x61, 0x74, 0x65,  0x00, 0x49, 0x6D, 0x70,
+  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x20, 0x53,  0x79, 0x73, 0x74, 0x65,  0x6D, 0x2E, 0x50, 0x72,
+  0x6F, 0x64, 0x75, 0x63,  0x74, 0x2E, 0x76, 0x61,  0x6C, 0x69, 0x64, 0x61,  0x74, 0x65, 0x00, 0x49,
+  0x4D, 0x45, 0x00, 0x41,  0x4C, 0x50, 0x48, 0x41,  0x4E, 0x55, 0x4D, 0x45,  0x52, 0x49, 0x43, 0x5F,
+  0x46, 0x55, 0x4C, 0x4C,  0x00, 0x41, 0x4C, 0x50,  0x48, 0x41, 0x4E, 0x55,  0x4D, 0x45, 0x52, 0x49,
+  0x43, 0x5F, 0x48, 0x41,  0x4C, 0x46, 0x00, 0x43,  0x48, 0x49, 0x4E, 0x45,  0x53, 0x45, 0x00, 0x4A,
+  0x41, 0x50, 0x41, 0x4E,  0x45, 0x53, 0x45, 0x5F,  0x48, 0x49, 0x52, 0x41,  0x47, 0x41, 0x4E, 0x41,
+  0x00, 0x4A, 0x41, 0x50,  0x41, 0x4E, 0x45, 0x53,  0x45, 0x5F, 0x4B, 0x41,  0x54, 0x41, 0x4B, 0x41,
+  0x4E, 0x41, 0x5F, 0x46,  0x55, 0x4C, 0x4C, 0x00,  0x4A, 0x41, 0x50, 0x41,  0x4E, 0x45, 0x53, 0x45,
+  0x5F, 0x4B, 0x41, 0x54,  0x41, 0x4B, 0x41, 0x4E,  0x41, 0x5F, 0x48, 0x41,  0x4C, 0x46, 0x00, 0x4B,
+  0x4F, 0x52, 0x45, 0x41,  0x4E, 0x00, 0x55, 0x4E,  0x4B, 0x4E, 0x4F, 0x57,  0x4E, 0x00, 0x38, 0x67,
+  0x65, 0x74, 0x45, 0x6E,  0x61, 0x62, 0x6C, 0x65,  0x64, 0x2C, 0x38, 0x73,  0x65, 0x74, 0x45, 0x6E,
+  0x61, 0x62, 0x6C, 0x65,  0x64, 0x2C, 0x38, 0x67,  0x65, 0x74, 0x43, 0x6F,  0x6E, 0x76, 0x65, 0x72,
+  0x73, 0x69, 0x6F, 0x6E,  0x4D, 0x6F, 0x64, 0x65,  0x2C, 0x38, 0x73, 0x65,  0x74, 0x43, 0x6F, 0x6E,
+  0x76, 0x65, 0x72, 0x73,  0x69, 0x6F, 0x6E, 0x4D,  0x6F, 0x64, 0x65, 0x2C,  0x38, 0x73, 0x65, 0x74,
+  0x43, 0x6F, 0x6D, 0x70,  0x6F, 0x73, 0x69, 0x74,  0x69, 0x6F, 0x6E, 0x53,  0x74, 0x72, 0x69, 0x6E,
+  0x67, 0x2C, 0x38, 0x64,  0x6F, 0x43, 0x6F, 0x6E,  0x76, 0x65, 0x72, 0x73,  0x69, 0x6F, 0x6E, 0x00,
+  0x43, 0x6F, 0x6C, 0x6F,  0x72, 0x00, 0x74, 0x61,  0x72, 0x67, 0x65, 0x74,  0x00, 0x73, 0x65, 0x74,
+  0x52, 0x47, 0x42, 0x2C,  0x73, 0x65, 0x74, 0x54,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,
+  0x2C, 0x67, 0x65, 0x74,  0x52, 0x47, 0x42, 0x2C,  0x67, 0x65, 0x74, 0x54,  0x72, 0x61, 0x6E, 0x73,
+  0x66, 0x6F, 0x72, 0x6D,  0x00, 0x54, 0x65, 0x78,  0x74, 0x53, 0x6E, 0x61,  0x70, 0x73, 0x68, 0x6F,
+  0x74, 0x00, 0x36, 0x67,  0x65, 0x74, 0x43, 0x6F,  0x75, 0x6E, 0x74, 0x2C,  0x36, 0x73, 0x65, 0x74,
+  0x53, 0x65, 0x6C, 0x65,  0x63, 0x74, 0x65, 0x64,  0x2C, 0x36, 0x67, 0x65,  0x74, 0x53, 0x65, 0x6C,
+  0x65, 0x63, 0x74, 0x65,  0x64, 0x2C, 0x36, 0x67,  0x65, 0x74, 0x54, 0x65,  0x78, 0x74, 0x2C, 0x36,
+  0x67, 0x65, 0x74, 0x53,  0x65, 0x6C, 0x65, 0x63,  0x74, 0x65, 0x64, 0x54,  0x65, 0x78, 0x74, 0x2C,
+  0x36, 0x68, 0x69, 0x74,  0x54, 0x65, 0x73, 0x74,  0x54, 0x65, 0x78, 0x74,  0x4E, 0x65, 0x61, 0x72,
+  0x50, 0x6F, 0x73, 0x2C,  0x36, 0x66, 0x69, 0x6E,  0x64, 0x54, 0x65, 0x78,  0x74, 0x2C, 0x36, 0x73,
+  0x65, 0x74, 0x53, 0x65,  0x6C, 0x65, 0x63, 0x74,  0x43, 0x6F, 0x6C, 0x6F,  0x72, 0x2C, 0x36, 0x67,
+  0x65, 0x74, 0x54, 0x65,  0x78, 0x74, 0x52, 0x75,  0x6E, 0x49, 0x6E, 0x66,  0x6F, 0x00, 0x4D, 0x6F,
+  0x76, 0x69, 0x65, 0x43,  0x6C, 0x69, 0x70, 0x00,  0x75, 0x73, 0x65, 0x48,  0x61, 0x6E, 0x64, 0x43,
+  0x75, 0x72, 0x73, 0x6F,  0x72, 0x00, 0x65, 0x6E,  0x61, 0x62, 0x6C, 0x65,  0x64, 0x00, 0x6D, 0x65,
+  0x74, 0x68, 0x00, 0x6D,  0x65, 0x74, 0x68, 0x6F,  0x64, 0x00, 0x74, 0x6F,  0x4C, 0x6F, 0x77, 0x65,
+  0x72, 0x43, 0x61, 0x73,  0x65, 0x00, 0x6C, 0x6F,  0x77, 0x65, 0x72, 0x00,  0x70, 0x6F, 0x73, 0x74,
+  0x00, 0x67, 0x65, 0x74,  0x00, 0x67, 0x65, 0x74,  0x55, 0x52, 0x4C, 0x00,  0x74, 0x79, 0x70, 0x65,
+  0x00, 0x75, 0x72, 0x6C,  0x00, 0x6C, 0x6F, 0x61,  0x64, 0x56, 0x61, 0x72,  0x69, 0x61, 0x62, 0x6C,
+  0x65, 0x73, 0x00, 0x5F,  0x74, 0x61, 0x72, 0x67,  0x65, 0x74, 0x00, 0x6C,  0x6F, 0x61, 0x64, 0x4D,
+  0x6F, 0x76, 0x69, 0x65,  0x00, 0x75, 0x6E, 0x6C,  0x6F, 0x61, 0x64, 0x4D,  0x6F, 0x76, 0x69, 0x65,
+  0x00, 0x67, 0x65, 0x74,  0x54, 0x65, 0x78, 0x74,  0x53, 0x6E, 0x61, 0x70,  0x73, 0x68, 0x6F, 0x74,
+  0x00, 0x61, 0x74, 0x74,  0x61, 0x63, 0x68, 0x4D,  0x6F, 0x76, 0x69, 0x65,  0x2C, 0x73, 0x77, 0x61,
+  0x70, 0x44, 0x65, 0x70,  0x74, 0x68, 0x73, 0x2C,  0x6C, 0x6F, 0x63, 0x61,  0x6C, 0x54, 0x6F, 0x47,
+  0x6C, 0x6F, 0x62, 0x61,  0x6C, 0x2C, 0x67, 0x6C,  0x6F, 0x62, 0x61, 0x6C,  0x54, 0x6F, 0x4C, 0x6F,
+  0x63, 0x61, 0x6C, 0x2C,  0x68, 0x69, 0x74, 0x54,  0x65, 0x73, 0x74, 0x2C,  0x67, 0x65, 0x74, 0x42,
+  0x6F, 0x75, 0x6E, 0x64,  0x73, 0x2C, 0x67, 0x65,  0x74, 0x42, 0x79, 0x74,  0x65, 0x73, 0x54, 0x6F,
+  0x74, 0x61, 0x6C, 0x2C,  0x67, 0x65, 0x74, 0x42,  0x79, 0x74, 0x65, 0x73,  0x4C, 0x6F, 0x61, 0x64,
+  0x65, 0x64, 0x2C, 0x36,  0x61, 0x74, 0x74, 0x61,  0x63, 0x68, 0x41, 0x75,  0x64, 0x69, 0x6F, 0x2C,
+  0x36, 0x61, 0x74, 0x74,  0x61, 0x63, 0x68, 0x56,  0x69, 0x64, 0x65, 0x6F,  0x2C, 0x36, 0x67, 0x65,
+  0x74, 0x44, 0x65, 0x70,  0x74, 0x68, 0x2C, 0x36,  0x73, 0x65, 0x74, 0x4D,  0x61, 0x73, 0x6B, 0x2C,
+  0x70, 0x6C, 0x61, 0x79,  0x2C, 0x73, 0x74, 0x6F,  0x70, 0x2C, 0x6E, 0x65,  0x78, 0x74, 0x46, 0x72,
+  0x61, 0x6D, 0x65, 0x2C,  0x70, 0x72, 0x65, 0x76,  0x46, 0x72, 0x61, 0x6D,  0x65, 0x2C, 0x67, 0x6F,
+  0x74, 0x6F, 0x41, 0x6E,  0x64, 0x50, 0x6C, 0x61,  0x79, 0x2C, 0x67, 0x6F,  0x74, 0x6F, 0x41, 0x6E,
+  0x64, 0x53, 0x74, 0x6F,  0x70, 0x2C, 0x64, 0x75,  0x70, 0x6C, 0x69, 0x63,  0x61, 0x74, 0x65, 0x4D,
+  0x6F, 0x76, 0x69, 0x65,  0x43, 0x6C, 0x69, 0x70,  0x2C, 0x72, 0x65, 0x6D,  0x6F, 0x76, 0x65, 0x4D,
+  0x6F, 0x76, 0x69, 0x65,  0x43, 0x6C, 0x69, 0x70,  0x2C, 0x73, 0x74, 0x61,  0x72, 0x74, 0x44, 0x72,
+  0x61, 0x67, 0x2C, 0x73,  0x74, 0x6F, 0x70, 0x44,  0x72, 0x61, 0x67, 0x2C,  0x37, 0x67, 0x65, 0x74,
+  0x4E, 0x65, 0x78, 0x74,  0x48, 0x69, 0x67, 0x68,  0x65, 0x73, 0x74, 0x44,  0x65, 0x70, 0x74, 0x68,
+  0x2C, 0x37, 0x67, 0x65,  0x74, 0x49, 0x6E, 0x73,  0x74, 0x61, 0x6E, 0x63,  0x65, 0x41, 0x74, 0x44,
+  0x65, 0x70, 0x74, 0x68,  0x2C, 0x67, 0x65, 0x74,  0x53, 0x57, 0x46, 0x56,  0x65, 0x72, 0x73, 0x69,
+  0x6F, 0x6E, 0x2C, 0x38,  0x61, 0x74, 0x74, 0x61,  0x63, 0x68, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,
+  0x2C, 0x38, 0x67, 0x65,  0x74, 0x52, 0x65, 0x63,  0x74, 0x00, 0x74, 0x61,  0x62, 0x49, 0x6E, 0x64,
+  0x65, 0x78, 0x00, 0x5F,  0x6C, 0x6F, 0x63, 0x6B,  0x72, 0x6F, 0x6F, 0x74,  0x00, 0x38, 0x63, 0x61,
+  0x63, 0x68, 0x65, 0x41,  0x73, 0x42, 0x69, 0x74,  0x6D, 0x61, 0x70, 0x2C,  0x38, 0x6F, 0x70, 0x61,
+  0x71, 0x75, 0x65, 0x42,  0x61, 0x63, 0x6B, 0x67,  0x72, 0x6F, 0x75, 0x6E,  0x64, 0x2C, 0x38, 0x73,
+  0x63, 0x72, 0x6F, 0x6C,  0x6C, 0x52, 0x65, 0x63,  0x74, 0x00, 0x38, 0x66,  0x69, 0x6C, 0x74, 0x65,
+  0x72, 0x73, 0x2C, 0x38,  0x74, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x00, 0x38, 0x62,
+  0x6C, 0x65, 0x6E, 0x64,  0x4D, 0x6F, 0x64, 0x65,  0x00, 0x36, 0x63, 0x72,  0x65, 0x61, 0x74, 0x65,
+  0x45, 0x6D, 0x70, 0x74,  0x79, 0x4D, 0x6F, 0x76,  0x69, 0x65, 0x43, 0x6C,  0x69, 0x70, 0x2C, 0x36,
+  0x62, 0x65, 0x67, 0x69,  0x6E, 0x46, 0x69, 0x6C,  0x6C, 0x2C, 0x36, 0x62,  0x65, 0x67, 0x69, 0x6E,
+  0x47, 0x72, 0x61, 0x64,  0x69, 0x65, 0x6E, 0x74,  0x46, 0x69, 0x6C, 0x6C,  0x2C, 0x36, 0x6D, 0x6F,
+  0x76, 0x65, 0x54, 0x6F,  0x2C, 0x36, 0x6C, 0x69,  0x6E, 0x65, 0x54, 0x6F,  0x2C, 0x36, 0x63, 0x75,
+  0x72, 0x76, 0x65, 0x54,  0x6F, 0x2C, 0x36, 0x6C,  0x69, 0x6E, 0x65, 0x53,  0x74, 0x79, 0x6C, 0x65,
+  0x2C, 0x36, 0x65, 0x6E,  0x64, 0x46, 0x69, 0x6C,  0x6C, 0x2C, 0x36, 0x63,  0x6C, 0x65, 0x61, 0x72,
+  0x2C, 0x38, 0x6C, 0x69,  0x6E, 0x65, 0x47, 0x72,  0x61, 0x64, 0x69, 0x65,  0x6E, 0x74, 0x53, 0x74,
+  0x79, 0x6C, 0x65, 0x2C,  0x38, 0x62, 0x65, 0x67,  0x69, 0x6E, 0x4D, 0x65,  0x73, 0x68, 0x46, 0x69,
+  0x6C, 0x6C, 0x2C, 0x38,  0x62, 0x65, 0x67, 0x69,  0x6E, 0x42, 0x69, 0x74,  0x6D, 0x61, 0x70, 0x46,
+  0x69, 0x6C, 0x6C, 0x00,  0x38, 0x73, 0x63, 0x61,  0x6C, 0x65, 0x39, 0x47,  0x72, 0x69, 0x64, 0x00,
+  0x63, 0x72, 0x65, 0x61,  0x74, 0x65, 0x54, 0x65,  0x78, 0x74, 0x46, 0x69,  0x65, 0x6C, 0x64, 0x00,
+  0x4D, 0x6F, 0x76, 0x69,  0x65, 0x43, 0x6C, 0x69,  0x70, 0x4C, 0x6F, 0x61,  0x64, 0x65, 0x72, 0x00,
+  0x37, 0x6C, 0x6F, 0x61,  0x64, 0x43, 0x6C, 0x69,  0x70, 0x2C, 0x37, 0x67,  0x65, 0x74, 0x50, 0x72,
+  0x6F, 0x67, 0x72, 0x65,  0x73, 0x73, 0x2C, 0x37,  0x75, 0x6E, 0x6C, 0x6F,  0x61, 0x64, 0x43, 0x6C,
+  0x69, 0x70, 0x00, 0x54,  0x65, 0x78, 0x74, 0x46,  0x69, 0x65, 0x6C, 0x64,  0x00, 0x67, 0x65, 0x74,
+  0x46, 0x6F, 0x6E, 0x74,  0x4C, 0x69, 0x73, 0x74,  0x00, 0x36, 0x72, 0x65,  0x70, 0x6C, 0x61, 0x63,
+  0x65, 0x53, 0x65, 0x6C,  0x2C, 0x36, 0x67, 0x65,  0x74, 0x54, 0x65, 0x78,  0x74, 0x46, 0x6F, 0x72,
+  0x6D, 0x61, 0x74, 0x2C,  0x36, 0x73, 0x65, 0x74,  0x54, 0x65, 0x78, 0x74,  0x46, 0x6F, 0x72, 0x6D,
+  0x61, 0x74, 0x2C, 0x36,  0x72, 0x65, 0x6D, 0x6F,  0x76, 0x65, 0x54, 0x65,  0x78, 0x74, 0x46, 0x69,
+  0x65, 0x6C, 0x64, 0x2C,  0x36, 0x67, 0x65, 0x74,  0x4E, 0x65, 0x77, 0x54,  0x65, 0x78, 0x74, 0x46,
+  0x6F, 0x72, 0x6D, 0x61,  0x74, 0x2C, 0x36, 0x73,  0x65, 0x74, 0x4E, 0x65,  0x77, 0x54, 0x65, 0x78,
+  0x74, 0x46, 0x6F, 0x72,  0x6D, 0x61, 0x74, 0x2C,  0x36, 0x67, 0x65, 0x74,  0x44, 0x65, 0x70, 0x74,
+  0x68, 0x2C, 0x37, 0x72,  0x65, 0x70, 0x6C, 0x61,  0x63, 0x65, 0x54, 0x65,  0x78, 0x74, 0x00, 0x38,
+  0x67, 0x72, 0x69, 0x64,  0x46, 0x69, 0x74, 0x54,  0x79, 0x70, 0x65, 0x2C,  0x38, 0x61, 0x6E, 0x74,
+  0x69, 0x41, 0x6C, 0x69,  0x61, 0x73, 0x54, 0x79,  0x70, 0x65, 0x2C, 0x38,  0x74, 0x68, 0x69, 0x63,
+  0x6B, 0x6E, 0x65, 0x73,  0x73, 0x2C, 0x38, 0x73,  0x68, 0x61, 0x72, 0x70,  0x6E, 0x65, 0x73, 0x73,
+  0x2C, 0x38, 0x66, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x73, 0x00, 0x38, 0x74,  0x61, 0x62, 0x49, 0x6E,
+  0x64, 0x65, 0x78, 0x00,  0x54, 0x65, 0x78, 0x74,  0x46, 0x6F, 0x72, 0x6D,  0x61, 0x74, 0x00, 0x53,
+  0x74, 0x79, 0x6C, 0x65,  0x53, 0x68, 0x65, 0x65,  0x74, 0x00, 0x5F, 0x63,  0x6F, 0x70, 0x79, 0x00,
+  0x6F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x00, 0x6F,  0x5F, 0x6E, 0x65, 0x77,  0x00, 0x70, 0x72, 0x6F,
+  0x70, 0x00, 0x63, 0x6C,  0x65, 0x61, 0x72, 0x00,  0x5F, 0x63, 0x73, 0x73,  0x00, 0x5F, 0x73, 0x74,
+  0x79, 0x6C, 0x65, 0x73,  0x00, 0x75, 0x70, 0x64,  0x61, 0x74, 0x65, 0x00,  0x67, 0x65, 0x74, 0x53,
+  0x74, 0x79, 0x6C, 0x65,  0x00, 0x73, 0x65, 0x74,  0x53, 0x74, 0x79, 0x6C,  0x65, 0x00, 0x73, 0x74,
+  0x79, 0x6C, 0x65, 0x00,  0x64, 0x6F, 0x54, 0x72,  0x61, 0x6E, 0x73, 0x66,  0x6F, 0x72, 0x6D, 0x00,
+  0x67, 0x65, 0x74, 0x53,  0x74, 0x79, 0x6C, 0x65,  0x4E, 0x61, 0x6D, 0x65,  0x73, 0x00, 0x74, 0x6D,
+  0x70, 0x00, 0x6E, 0x61,  0x6D, 0x65, 0x73, 0x00,  0x74, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,
+  0x6D, 0x00, 0x66, 0x6F,  0x72, 0x6D, 0x61, 0x74,  0x00, 0x74, 0x65, 0x78,  0x74, 0x41, 0x6C, 0x69,
+  0x67, 0x6E, 0x00, 0x61,  0x6C, 0x69, 0x67, 0x6E,  0x00, 0x66, 0x6F, 0x6E,  0x74, 0x57, 0x65, 0x69,
+  0x67, 0x68, 0x74, 0x00,  0x62, 0x6F, 0x6C, 0x64,  0x00, 0x6E, 0x6F, 0x72,  0x6D, 0x61, 0x6C, 0x00,
+  0x63, 0x6F, 0x6C, 0x6F,  0x72, 0x00, 0x70, 0x61,  0x72, 0x73, 0x65, 0x43,  0x6F, 0x6C, 0x6F, 0x72,
+  0x00, 0x64, 0x69, 0x73,  0x70, 0x6C, 0x61, 0x79,  0x00, 0x66, 0x6F, 0x6E,  0x74, 0x46, 0x61, 0x6D,
+  0x69, 0x6C, 0x79, 0x00,  0x66, 0x6F, 0x6E, 0x74,  0x00, 0x70, 0x61, 0x72,  0x73, 0x65, 0x43, 0x53,
+  0x53, 0x46, 0x6F, 0x6E,  0x74, 0x46, 0x61, 0x6D,  0x69, 0x6C, 0x79, 0x00,  0x74, 0x65, 0x78, 0x74,
+  0x49, 0x6E, 0x64, 0x65,  0x6E, 0x74, 0x00, 0x69,  0x6E, 0x64, 0x65, 0x6E,  0x74, 0x00, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x49,  0x6E, 0x74, 0x00, 0x66,  0x6F, 0x6E, 0x74, 0x53,  0x74, 0x79, 0x6C, 0x65,
+  0x00, 0x69, 0x74, 0x61,  0x6C, 0x69, 0x63, 0x00,  0x6B, 0x65, 0x72, 0x6E,  0x69, 0x6E, 0x67, 0x00,
+  0x74, 0x72, 0x75, 0x65,  0x00, 0x66, 0x61, 0x6C,  0x73, 0x65, 0x00, 0x6C,  0x65, 0x61, 0x64, 0x69,
+  0x6E, 0x67, 0x00, 0x6D,  0x61, 0x72, 0x67, 0x69,  0x6E, 0x4C, 0x65, 0x66,  0x74, 0x00, 0x6C, 0x65,
+  0x66, 0x74, 0x4D, 0x61,  0x72, 0x67, 0x69, 0x6E,  0x00, 0x6C, 0x65, 0x74,  0x74, 0x65, 0x72, 0x53,
+  0x70, 0x61, 0x63, 0x69,  0x6E, 0x67, 0x00, 0x6D,  0x61, 0x72, 0x67, 0x69,  0x6E, 0x52, 0x69, 0x67,
+  0x68, 0x74, 0x00, 0x72,  0x69, 0x67, 0x68, 0x74,  0x4D, 0x61, 0x72, 0x67,  0x69, 0x6E, 0x00, 0x66,
+  0x6F, 0x6E, 0x74, 0x53,  0x69, 0x7A, 0x65, 0x00,  0x73, 0x69, 0x7A, 0x65,  0x00, 0x74, 0x65, 0x78,
+  0x74, 0x44, 0x65, 0x63,  0x6F, 0x72, 0x61, 0x74,  0x69, 0x6F, 0x6E, 0x00,  0x75, 0x6E, 0x64, 0x65,
+  0x72, 0x6C, 0x69, 0x6E,  0x65, 0x00, 0x70, 0x61,  0x72, 0x73, 0x65, 0x43,  0x53, 0x53, 0x00, 0x63,
+  0x73, 0x73, 0x00, 0x70,  0x61, 0x72, 0x73, 0x65,  0x43, 0x53, 0x53, 0x49,  0x6E, 0x74, 0x65, 0x72,
+  0x6E, 0x61, 0x6C, 0x00,  0x72, 0x65, 0x73, 0x75,  0x6C, 0x74, 0x00, 0x6E,  0x75, 0x6C, 0x6C, 0x00,
+  0x70, 0x61, 0x72, 0x73,  0x65, 0x00, 0x37, 0x75,  0x70, 0x64, 0x61, 0x74,  0x65, 0x2C, 0x37, 0x70,
+  0x61, 0x72, 0x73, 0x65,  0x43, 0x53, 0x53, 0x49,  0x6E, 0x74, 0x65, 0x72,  0x6E, 0x61, 0x6C, 0x2C,
+  0x37, 0x70, 0x61, 0x72,  0x73, 0x65, 0x43, 0x53,  0x53, 0x46, 0x6F, 0x6E,  0x74, 0x46, 0x61, 0x6D,
+  0x69, 0x6C, 0x79, 0x2C,  0x37, 0x70, 0x61, 0x72,  0x73, 0x65, 0x43, 0x6F,  0x6C, 0x6F, 0x72, 0x00,
+  0x56, 0x69, 0x64, 0x65,  0x6F, 0x00, 0x36, 0x61,  0x74, 0x74, 0x61, 0x63,  0x68, 0x56, 0x69, 0x64,
+  0x65, 0x6F, 0x2C, 0x36,  0x63, 0x6C, 0x65, 0x61,  0x72, 0x00, 0x41, 0x63,  0x63, 0x65, 0x73, 0x73,
+  0x69, 0x62, 0x69, 0x6C,  0x69, 0x74, 0x79, 0x00,  0x36, 0x69, 0x73, 0x41,  0x63, 0x74, 0x69, 0x76,
+  0x65, 0x2C, 0x36, 0x73,  0x65, 0x6E, 0x64, 0x45,  0x76, 0x65, 0x6E, 0x74,  0x2C, 0x36, 0x75, 0x70,
+  0x64, 0x61, 0x74, 0x65,  0x50, 0x72, 0x6F, 0x70,  0x65, 0x72, 0x74, 0x69,  0x65, 0x73, 0x00, 0x43,
+  0x61, 0x6D, 0x65, 0x72,  0x61, 0x00, 0x67, 0x65,  0x74, 0x5F, 0x66, 0x75,  0x6E, 0x63, 0x00, 0x69,
+  0x6E, 0x64, 0x65, 0x78,  0x00, 0x36, 0x73, 0x65,  0x74, 0x4D, 0x6F, 0x64,  0x65, 0x2C, 0x36, 0x73,
+  0x65, 0x74, 0x51, 0x75,  0x61, 0x6C, 0x69, 0x74,  0x79, 0x2C, 0x36, 0x73,  0x65, 0x74, 0x4B, 0x65,
+  0x79, 0x46, 0x72, 0x61,  0x6D, 0x65, 0x49, 0x6E,  0x74, 0x65, 0x72, 0x76,  0x61, 0x6C, 0x2C, 0x36,
+  0x73, 0x65, 0x74, 0x4D,  0x6F, 0x74, 0x69, 0x6F,  0x6E, 0x4C, 0x65, 0x76,  0x65, 0x6C, 0x2C, 0x36,
+  0x73, 0x65, 0x74, 0x4C,  0x6F, 0x6F, 0x70, 0x62,  0x61, 0x63, 0x6B, 0x2C,  0x36, 0x73, 0x65, 0x74,
+  0x43, 0x75, 0x72, 0x73,  0x6F, 0x72, 0x00, 0x43,  0x6F, 0x6E, 0x74, 0x65,  0x78, 0x74, 0x4D, 0x65,
+  0x6E, 0x75, 0x00, 0x6F,  0x6E, 0x53, 0x65, 0x6C,  0x65, 0x63, 0x74, 0x00,  0x63, 0x61, 0x6C, 0x6C,
+  0x62, 0x61, 0x63, 0x6B,  0x00, 0x63, 0x75, 0x73,  0x74, 0x6F, 0x6D, 0x49,  0x74, 0x65, 0x6D, 0x73,
+  0x00, 0x62, 0x75, 0x69,  0x6C, 0x74, 0x49, 0x6E,  0x49, 0x74, 0x65, 0x6D,  0x73, 0x00, 0x66, 0x6F,
+  0x72, 0x77, 0x61, 0x72,  0x64, 0x5F, 0x62, 0x61,  0x63, 0x6B, 0x00, 0x6C,  0x6F, 0x6F, 0x70, 0x00,
+  0x70, 0x6C, 0x61, 0x79,  0x00, 0x70, 0x72, 0x69,  0x6E, 0x74, 0x00, 0x71,  0x75, 0x61, 0x6C, 0x69,
+  0x74, 0x79, 0x00, 0x72,  0x65, 0x77, 0x69, 0x6E,  0x64, 0x00, 0x73, 0x61,  0x76, 0x65, 0x00, 0x7A,
+  0x6F, 0x6F, 0x6D, 0x00,  0x63, 0x6F, 0x70, 0x79,  0x00, 0x68, 0x69, 0x64,  0x65, 0x42, 0x75, 0x69,
+  0x6C, 0x74, 0x49, 0x6E,  0x49, 0x74, 0x65, 0x6D,  0x73, 0x00, 0x43, 0x6F,  0x6E, 0x74, 0x65, 0x78,
+  0x74, 0x4D, 0x65, 0x6E,  0x75, 0x49, 0x74, 0x65,  0x6D, 0x00, 0x63, 0x61,  0x70, 0x74, 0x69, 0x6F,
+  0x6E, 0x00, 0x73, 0x65,  0x70, 0x61, 0x72, 0x61,  0x74, 0x6F, 0x72, 0x42,  0x65, 0x66, 0x6F, 0x72,
+  0x65, 0x00, 0x76, 0x69,  0x73, 0x69, 0x62, 0x6C,  0x65, 0x00, 0x6E, 0x65,  0x74, 0x00, 0x46, 0x69,
+  0x6C, 0x65, 0x52, 0x65,  0x66, 0x65, 0x72, 0x65,  0x6E, 0x63, 0x65, 0x00,  0x63, 0x00, 0x38, 0x62,
+  0x72, 0x6F, 0x77, 0x73,  0x65, 0x2C, 0x38, 0x75,  0x70, 0x6C, 0x6F, 0x61,  0x64, 0x2C, 0x38, 0x64,
+  0x6F, 0x77, 0x6E, 0x6C,  0x6F, 0x61, 0x64, 0x2C,  0x38, 0x63, 0x61, 0x6E,  0x63, 0x65, 0x6C, 0x00,
+  0x46, 0x69, 0x6C, 0x65,  0x52, 0x65, 0x66, 0x65,  0x72, 0x65, 0x6E, 0x63,  0x65, 0x4C, 0x69, 0x73,
+  0x74, 0x00, 0x66, 0x69,  0x6C, 0x65, 0x4C, 0x69,  0x73, 0x74, 0x00, 0x38,  0x62, 0x72, 0x6F, 0x77,
+  0x73, 0x65, 0x00, 0x4D,  0x69, 0x63, 0x72, 0x6F,  0x70, 0x68, 0x6F, 0x6E,  0x65, 0x00, 0x36, 0x73,
+  0x65, 0x74, 0x53, 0x69,  0x6C, 0x65, 0x6E, 0x63,  0x65, 0x4C, 0x65, 0x76,  0x65, 0x6C, 0x2C, 0x36,
+  0x73, 0x65, 0x74, 0x52,  0x61, 0x74, 0x65, 0x2C,  0x36, 0x73, 0x65, 0x74,  0x47, 0x61, 0x69, 0x6E,
+  0x2C, 0x36, 0x73, 0x65,  0x74, 0x55, 0x73, 0x65,  0x45, 0x63, 0x68, 0x6F,  0x53, 0x75, 0x70, 0x70,
+  0x72, 0x65, 0x73, 0x73,  0x69, 0x6F, 0x6E, 0x00,  0x50, 0x72, 0x69, 0x6E,  0x74, 0x4A, 0x6F, 0x62,
+  0x00, 0x37, 0x73, 0x74,  0x61, 0x72, 0x74, 0x2C,  0x37, 0x61, 0x64, 0x64,  0x50, 0x61, 0x67, 0x65,
+  0x2C, 0x37, 0x73, 0x65,  0x6E, 0x64, 0x00, 0x53,  0x65, 0x6C, 0x65, 0x63,  0x74, 0x69, 0x6F, 0x6E,
+  0x00, 0x67, 0x65, 0x74,  0x42, 0x65, 0x67, 0x69,  0x6E, 0x49, 0x6E, 0x64,  0x65, 0x78, 0x2C, 0x67,
+  0x65, 0x74, 0x45, 0x6E,  0x64, 0x49, 0x6E, 0x64,  0x65, 0x78, 0x2C, 0x67,  0x65, 0x74, 0x43, 0x61,
+  0x72, 0x65, 0x74, 0x49,  0x6E, 0x64, 0x65, 0x78,  0x2C, 0x67, 0x65, 0x74,  0x46, 0x6F, 0x63, 0x75,
+  0x73, 0x2C, 0x73, 0x65,  0x74, 0x46, 0x6F, 0x63,  0x75, 0x73, 0x2C, 0x73,  0x65, 0x74, 0x53, 0x65,
+  0x6C, 0x65, 0x63, 0x74,  0x69, 0x6F, 0x6E, 0x00,  0x74, 0x65, 0x78, 0x74,  0x00, 0x54, 0x65, 0x78,
+  0x74, 0x52, 0x65, 0x6E,  0x64, 0x65, 0x72, 0x65,  0x72, 0x00, 0x38, 0x73,  0x65, 0x74, 0x41, 0x64,
+  0x76, 0x61, 0x6E, 0x63,  0x65, 0x64, 0x41, 0x6E,  0x74, 0x69, 0x61, 0x6C,  0x69, 0x61, 0x73, 0x69,
+  0x6E, 0x67, 0x54, 0x61,  0x62, 0x6C, 0x65, 0x00,  0x38, 0x6D, 0x61, 0x78,  0x4C, 0x65, 0x76, 0x65,
+  0x6C, 0x00, 0x38, 0x64,  0x69, 0x73, 0x70, 0x6C,  0x61, 0x79, 0x4D, 0x6F,  0x64, 0x65, 0x00, 0x74,
+  0x65, 0x78, 0x74, 0x52,  0x65, 0x6E, 0x64, 0x65,  0x72, 0x65, 0x72, 0x00,  0x58, 0x4D, 0x4C, 0x53,
+  0x6F, 0x63, 0x6B, 0x65,  0x74, 0x00, 0x6F, 0x6E,  0x58, 0x4D, 0x4C, 0x00,  0x63, 0x6F, 0x6E, 0x6E,
+  0x65, 0x63, 0x74, 0x2C,  0x73, 0x65, 0x6E, 0x64,  0x2C, 0x63, 0x6C, 0x6F,  0x73, 0x65, 0x00, 0x67,
+  0x65, 0x6F, 0x6D, 0x00,  0x50, 0x6F, 0x69, 0x6E,  0x74, 0x00, 0x61, 0x72,  0x67, 0x75, 0x6D, 0x65,
+  0x6E, 0x74, 0x73, 0x00,  0x79, 0x00, 0x64, 0x69,  0x73, 0x74, 0x61, 0x6E,  0x63, 0x65, 0x00, 0x62,
+  0x00, 0x73, 0x75, 0x62,  0x74, 0x72, 0x61, 0x63,  0x74, 0x00, 0x69, 0x6E,  0x74, 0x65, 0x72, 0x70,
+  0x6F, 0x6C, 0x61, 0x74,  0x65, 0x00, 0x70, 0x6F,  0x6C, 0x61, 0x72, 0x00,  0x4D, 0x61, 0x74, 0x68,
+  0x00, 0x61, 0x6E, 0x67,  0x6C, 0x65, 0x00, 0x63,  0x6F, 0x73, 0x00, 0x73,  0x69, 0x6E, 0x00, 0x73,
+  0x71, 0x72, 0x74, 0x00,  0x61, 0x64, 0x64, 0x00,  0x6F, 0x74, 0x68, 0x65,  0x72, 0x00, 0x63, 0x6C,
+  0x6F, 0x6E, 0x65, 0x00,  0x65, 0x71, 0x75, 0x61,  0x6C, 0x73, 0x00, 0x6E,  0x6F, 0x72, 0x6D, 0x61,
+  0x6C, 0x69, 0x7A, 0x65,  0x00, 0x66, 0x61, 0x63,  0x74, 0x6F, 0x72, 0x00,  0x6F, 0x66, 0x66, 0x73,
+  0x65, 0x74, 0x00, 0x28,  0x78, 0x3D, 0x00, 0x2C,  0x20, 0x79, 0x3D, 0x00,  0x29, 0x00, 0x52, 0x65,
+  0x63, 0x74, 0x61, 0x6E,  0x67, 0x6C, 0x65, 0x00,  0x73, 0x65, 0x74, 0x45,  0x6D, 0x70, 0x74, 0x79,
+  0x00, 0x77, 0x69, 0x64,  0x74, 0x68, 0x00, 0x68,  0x65, 0x69, 0x67, 0x68,  0x74, 0x00, 0x2C, 0x20,
+  0x77, 0x3D, 0x00, 0x2C,  0x20, 0x68, 0x3D, 0x00,  0x72, 0x65, 0x63, 0x74,  0x00, 0x63, 0x6F, 0x6E,
+  0x74, 0x61, 0x69, 0x6E,  0x73, 0x00, 0x63, 0x6F,  0x6E, 0x74, 0x61, 0x69,  0x6E, 0x73, 0x50, 0x6F,
+  0x69, 0x6E, 0x74, 0x00,  0x70, 0x6F, 0x69, 0x6E,  0x74, 0x00, 0x63, 0x6F,  0x6E, 0x74, 0x61, 0x69,
+  0x6E, 0x73, 0x52, 0x65,  0x63, 0x74, 0x61, 0x6E,  0x67, 0x6C, 0x65, 0x00,  0x74, 0x72, 0x00, 0x74,
+  0x62, 0x00, 0x72, 0x72,  0x00, 0x72, 0x62, 0x00,  0x69, 0x73, 0x45, 0x6D,  0x70, 0x74, 0x79, 0x00,
+  0x69, 0x6E, 0x74, 0x65,  0x72, 0x73, 0x65, 0x63,  0x74, 0x69, 0x6F, 0x6E,  0x00, 0x69, 0x6E, 0x74,
+  0x73, 0x00, 0x6D, 0x61,  0x78, 0x00, 0x6D, 0x69,  0x6E, 0x00, 0x69, 0x6E,  0x74, 0x65, 0x72, 0x73,
+  0x65, 0x63, 0x74, 0x73,  0x00, 0x75, 0x6E, 0x69,  0x6F, 0x6E, 0x00, 0x64,  0x78, 0x00, 0x64, 0x79,
+  0x00, 0x6F, 0x66, 0x66,  0x73, 0x65, 0x74, 0x50,  0x6F, 0x69, 0x6E, 0x74,  0x00, 0x64, 0x00, 0x69,
+  0x6E, 0x66, 0x6C, 0x61,  0x74, 0x65, 0x00, 0x69,  0x6E, 0x66, 0x6C, 0x61,  0x74, 0x65, 0x50, 0x6F,
+  0x69, 0x6E, 0x74, 0x00,  0x6C, 0x65, 0x66, 0x74,  0x00, 0x72, 0x69, 0x67,  0x68, 0x74, 0x00, 0x74,
+  0x6F, 0x70, 0x00, 0x62,  0x6F, 0x74, 0x74, 0x6F,  0x6D, 0x00, 0x74, 0x6F,  0x70, 0x4C, 0x65, 0x66,
+  0x74, 0x00, 0x62, 0x6F,  0x74, 0x74, 0x6F, 0x6D,  0x52, 0x69, 0x67, 0x68,  0x74, 0x00, 0x4D, 0x61,
+  0x74, 0x72, 0x69, 0x78,  0x00, 0x69, 0x64, 0x65,  0x6E, 0x74, 0x69, 0x74,  0x79, 0x00, 0x70, 0x61,
+  0x00, 0x70, 0x62, 0x00,  0x70, 0x63, 0x00, 0x70,  0x64, 0x00, 0x74, 0x78,  0x00, 0x70, 0x74, 0x78,
+  0x00, 0x74, 0x79, 0x00,  0x70, 0x74, 0x79, 0x00,  0x63, 0x6F, 0x6E, 0x63,  0x61, 0x74, 0x00, 0x63,
+  0x72, 0x65, 0x61, 0x74,  0x65, 0x42, 0x6F, 0x78,  0x00, 0x72, 0x6F, 0x74,  0x61, 0x74, 0x69, 0x6F,
+  0x6E, 0x00, 0x72, 0x6F,  0x74, 0x61, 0x74, 0x65,  0x00, 0x73, 0x63, 0x61,  0x6C, 0x65, 0x58, 0x00,
+  0x73, 0x63, 0x61, 0x6C,  0x65, 0x59, 0x00, 0x73,  0x63, 0x61, 0x6C, 0x65,  0x00, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x47,  0x72, 0x61, 0x64, 0x69,  0x65, 0x6E, 0x74, 0x42,  0x6F, 0x78, 0x00, 0x64,
+  0x65, 0x6C, 0x74, 0x61,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x50, 0x6F, 0x69,
+  0x6E, 0x74, 0x00, 0x70,  0x00, 0x69, 0x6E, 0x76,  0x65, 0x72, 0x74, 0x00,  0x64, 0x65, 0x74, 0x00,
+  0x61, 0x6D, 0x6F, 0x75,  0x6E, 0x74, 0x00, 0x74,  0x72, 0x61, 0x6E, 0x73,  0x66, 0x6F, 0x72, 0x6D,
+  0x50, 0x6F, 0x69, 0x6E,  0x74, 0x00, 0x74, 0x72,  0x61, 0x6E, 0x73, 0x6C,  0x61, 0x74, 0x65, 0x00,
+  0x28, 0x61, 0x3D, 0x00,  0x2C, 0x20, 0x62, 0x3D,  0x00, 0x2C, 0x20, 0x63,  0x3D, 0x00, 0x2C, 0x20,
+  0x64, 0x3D, 0x00, 0x2C,  0x20, 0x74, 0x78, 0x3D,  0x00, 0x2C, 0x20, 0x74,  0x79, 0x3D, 0x00, 0x43,
+  0x6F, 0x6C, 0x6F, 0x72,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x00, 0x28, 0x72,
+  0x65, 0x64, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,  0x3D, 0x00, 0x72, 0x65,
+  0x64, 0x4D, 0x75, 0x6C,  0x74, 0x69, 0x70, 0x6C,  0x69, 0x65, 0x72, 0x00,  0x2C, 0x20, 0x67, 0x72,
+  0x65, 0x65, 0x6E, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,  0x72, 0x3D, 0x00, 0x67,
+  0x72, 0x65, 0x65, 0x6E,  0x4D, 0x75, 0x6C, 0x74,  0x69, 0x70, 0x6C, 0x69,  0x65, 0x72, 0x00, 0x2C,
+  0x20, 0x62, 0x6C, 0x75,  0x65, 0x4D, 0x75, 0x6C,  0x74, 0x69, 0x70, 0x6C,  0x69, 0x65, 0x72, 0x3D,
+  0x00, 0x62, 0x6C, 0x75,  0x65, 0x4D, 0x75, 0x6C,  0x74, 0x69, 0x70, 0x6C,  0x69, 0x65, 0x72, 0x00,
+  0x2C, 0x20, 0x61, 0x6C,  0x70, 0x68, 0x61, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,
+  0x72, 0x3D, 0x00, 0x61,  0x6C, 0x70, 0x68, 0x61,  0x4D, 0x75, 0x6C, 0x74,  0x69, 0x70, 0x6C, 0x69,
+  0x65, 0x72, 0x00, 0x2C,  0x20, 0x72, 0x65, 0x64,  0x4F, 0x66, 0x66, 0x73,  0x65, 0x74, 0x3D, 0x00,
+  0x72, 0x65, 0x64, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x00, 0x2C, 0x20,  0x67, 0x72, 0x65, 0x65,
+  0x6E, 0x4F, 0x66, 0x66,  0x73, 0x65, 0x74, 0x3D,  0x00, 0x67, 0x72, 0x65,  0x65, 0x6E, 0x4F, 0x66,
+  0x66, 0x73, 0x65, 0x74,  0x00, 0x2C, 0x20, 0x62,  0x6C, 0x75, 0x65, 0x4F,  0x66, 0x66, 0x73, 0x65,
+  0x74, 0x3D, 0x00, 0x62,  0x6C, 0x75, 0x65, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x00, 0x2C, 0x20,
+  0x61, 0x6C, 0x70, 0x68,  0x61, 0x4F, 0x66, 0x66,  0x73, 0x65, 0x74, 0x3D,  0x00, 0x61, 0x6C, 0x70,
+  0x68, 0x61, 0x4F, 0x66,  0x66, 0x73, 0x65, 0x74,  0x00, 0x38, 0x63, 0x6F,  0x6E, 0x63, 0x61, 0x74,
+  0x00, 0x38, 0x61, 0x6C,  0x70, 0x68, 0x61, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,
+  0x72, 0x2C, 0x38, 0x72,  0x65, 0x64, 0x4D, 0x75,  0x6C, 0x74, 0x69, 0x70,  0x6C, 0x69, 0x65, 0x72,
+  0x2C, 0x38, 0x67, 0x72,  0x65, 0x65, 0x6E, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,
+  0x72, 0x2C, 0x38, 0x62,  0x6C, 0x75, 0x65, 0x4D,  0x75, 0x6C, 0x74, 0x69,  0x70, 0x6C, 0x69, 0x65,
+  0x72, 0x2C, 0x38, 0x61,  0x6C, 0x70, 0x68, 0x61,  0x4F, 0x66, 0x66, 0x73,  0x65, 0x74, 0x2C, 0x38,
+  0x72, 0x65, 0x64, 0x4F,  0x66, 0x66, 0x73, 0x65,  0x74, 0x2C, 0x38, 0x67,  0x72, 0x65, 0x65, 0x6E,
+  0x4F, 0x66, 0x66, 0x73,  0x65, 0x74, 0x2C, 0x38,  0x62, 0x6C, 0x75, 0x65,  0x4F, 0x66, 0x66, 0x73,
+  0x65, 0x74, 0x2C, 0x38,  0x72, 0x67, 0x62, 0x00,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,
+  0x6D, 0x00, 0x38, 0x6D,  0x61, 0x74, 0x72, 0x69,  0x78, 0x2C, 0x38, 0x63,  0x6F, 0x6E, 0x63, 0x61,
+  0x74, 0x65, 0x6E, 0x61,  0x74, 0x65, 0x64, 0x4D,  0x61, 0x74, 0x72, 0x69,  0x78, 0x2C, 0x38, 0x63,
+  0x6F, 0x6C, 0x6F, 0x72,  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x2C, 0x38, 0x63,
+  0x6F, 0x6E, 0x63, 0x61,  0x74, 0x65, 0x6E, 0x61,  0x74, 0x65, 0x64, 0x43,  0x6F, 0x6C, 0x6F, 0x72,
+  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x2C, 0x38, 0x70,  0x69, 0x78, 0x65, 0x6C,
+  0x42, 0x6F, 0x75, 0x6E,  0x64, 0x73, 0x00, 0x65,  0x78, 0x74, 0x65, 0x72,  0x6E, 0x61, 0x6C, 0x00,
+  0x45, 0x78, 0x74, 0x65,  0x72, 0x6E, 0x61, 0x6C,  0x49, 0x6E, 0x74, 0x65,  0x72, 0x66, 0x61, 0x63,
+  0x65, 0x00, 0x61, 0x64,  0x64, 0x43, 0x61, 0x6C,  0x6C, 0x62, 0x61, 0x63,  0x6B, 0x00, 0x61, 0x76,
+  0x61, 0x69, 0x6C, 0x61,  0x62, 0x6C, 0x65, 0x00,  0x5F, 0x69, 0x6E, 0x69,  0x74, 0x4A, 0x53, 0x00,
+  0x69, 0x6E, 0x73, 0x74,  0x61, 0x6E, 0x63, 0x65,  0x00, 0x72, 0x65, 0x71,  0x75, 0x65, 0x73, 0x74,
+  0x00, 0x5F, 0x63, 0x61,  0x6C, 0x6C, 0x49, 0x6E,  0x00, 0x5F, 0x61, 0x64,  0x64, 0x43, 0x61, 0x6C,
+  0x6C, 0x62, 0x61, 0x63,  0x6B, 0x00, 0x63, 0x61,  0x6C, 0x6C, 0x00, 0x74,  0x72, 0x79, 0x20, 0x7B,
+  0x20, 0x00, 0x5F, 0x6F,  0x62, 0x6A, 0x65, 0x63,  0x74, 0x49, 0x44, 0x00,  0x69, 0x64, 0x00, 0x2E,
+  0x53, 0x65, 0x74, 0x52,  0x65, 0x74, 0x75, 0x72,  0x6E, 0x56, 0x61, 0x6C,  0x75, 0x65, 0x28, 0x00,
+  0x5F, 0x5F, 0x66, 0x6C,  0x61, 0x73, 0x68, 0x5F,  0x5F, 0x74, 0x6F, 0x58,  0x4D, 0x4C, 0x20, 0x28,
+  0x00, 0x28, 0x00, 0x2C,  0x00, 0x5F, 0x74, 0x6F,  0x4A, 0x53, 0x00, 0x29,  0x29, 0x20, 0x00, 0x3B,
+  0x20, 0x7D, 0x20, 0x63,  0x61, 0x74, 0x63, 0x68,  0x20, 0x28, 0x65, 0x29,  0x20, 0x7B, 0x20, 0x00,
+  0x2E, 0x53, 0x65, 0x74,  0x52, 0x65, 0x74, 0x75,  0x72, 0x6E, 0x56, 0x61,  0x6C, 0x75, 0x65, 0x28,
+  0x22, 0x3C, 0x75, 0x6E,  0x64, 0x65, 0x66, 0x69,  0x6E, 0x65, 0x64, 0x2F,  0x3E, 0x22, 0x29, 0x3B,
+  0x20, 0x7D, 0x00, 0x22,  0x3C, 0x75, 0x6E, 0x64,  0x65, 0x66, 0x69, 0x6E,  0x65, 0x64, 0x2F, 0x3E,
+  0x22, 0x3B, 0x20, 0x7D,  0x00, 0x5F, 0x65, 0x76,  0x61, 0x6C, 0x4A, 0x53,  0x00, 0x3C, 0x69, 0x6E,
+  0x76, 0x6F, 0x6B, 0x65,  0x20, 0x6E, 0x61, 0x6D,  0x65, 0x3D, 0x22, 0x00,  0x22, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6E,  0x74, 0x79, 0x70, 0x65,  0x3D, 0x22, 0x78, 0x6D,  0x6C, 0x22, 0x3E, 0x00,
+  0x5F, 0x61, 0x72, 0x67,  0x75, 0x6D, 0x65, 0x6E,  0x74, 0x73, 0x54, 0x6F,  0x58, 0x4D, 0x4C, 0x00,
+  0x3C, 0x2F, 0x69, 0x6E,  0x76, 0x6F, 0x6B, 0x65,  0x3E, 0x00, 0x5F, 0x63,  0x61, 0x6C, 0x6C, 0x4F,
+  0x75, 0x74, 0x00, 0x78,  0x6D, 0x6C, 0x00, 0x69,  0x67, 0x6E, 0x6F, 0x72,  0x65, 0x57, 0x68, 0x69,
+  0x74, 0x65, 0x00, 0x66,  0x69, 0x72, 0x73, 0x74,  0x43, 0x68, 0x69, 0x6C,  0x64, 0x00, 0x5F, 0x74,
+  0x6F, 0x41, 0x53, 0x00,  0x61, 0x72, 0x67, 0x73,  0x00, 0x63, 0x68, 0x69,  0x6C, 0x64, 0x4E, 0x6F,
+  0x64, 0x65, 0x73, 0x00,  0x6E, 0x6F, 0x64, 0x65,  0x4E, 0x61, 0x6D, 0x65,  0x00, 0x5F, 0x61, 0x72,
+  0x67, 0x75, 0x6D, 0x65,  0x6E, 0x74, 0x73, 0x54,  0x6F, 0x41, 0x53, 0x00,  0x61, 0x70, 0x70, 0x6C,
+  0x79, 0x00, 0x61, 0x74,  0x74, 0x72, 0x69, 0x62,  0x75, 0x74, 0x65, 0x73,  0x00, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6E, 0x74,  0x79, 0x70, 0x65, 0x00,  0x6A, 0x61, 0x76, 0x61,  0x73, 0x63, 0x72, 0x69,
+  0x70, 0x74, 0x00, 0x5F,  0x74, 0x6F, 0x58, 0x4D,  0x4C, 0x00, 0x5F, 0x61,  0x72, 0x72, 0x61, 0x79,
+  0x54, 0x6F, 0x58, 0x4D,  0x4C, 0x00, 0x3C, 0x61,  0x72, 0x72, 0x61, 0x79,  0x3E, 0x00, 0x73, 0x00,
+  0x61, 0x72, 0x72, 0x61,  0x79, 0x00, 0x3C, 0x70,  0x72, 0x6F, 0x70, 0x65,  0x72, 0x74, 0x79, 0x20,
+  0x69, 0x64, 0x3D, 0x22,  0x00, 0x22, 0x3E, 0x00,  0x3C, 0x2F, 0x70, 0x72,  0x6F, 0x70, 0x65, 0x72,
+  0x74, 0x79, 0x3E, 0x00,  0x3C, 0x2F, 0x61, 0x72,  0x72, 0x61, 0x79, 0x3E,  0x00, 0x3C, 0x61, 0x72,
+  0x67, 0x75, 0x6D, 0x65,  0x6E, 0x74, 0x73, 0x3E,  0x00, 0x3C, 0x2F, 0x61,  0x72, 0x67, 0x75, 0x6D,
+  0x65, 0x6E, 0x74, 0x73,  0x3E, 0x00, 0x5F, 0x6F,  0x62, 0x6A, 0x65, 0x63,  0x74, 0x54, 0x6F, 0x58,
+  0x4D, 0x4C, 0x00, 0x3C,  0x6F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x3E, 0x00,  0x6F, 0x62, 0x6A, 0x00,
+  0x3C, 0x2F, 0x6F, 0x62,  0x6A, 0x65, 0x63, 0x74,  0x3E, 0x00, 0x3C, 0x73,  0x74, 0x72, 0x69, 0x6E,
+  0x67, 0x3E, 0x00, 0x5F,  0x65, 0x73, 0x63, 0x61,  0x70, 0x65, 0x58, 0x4D,  0x4C, 0x00, 0x3C, 0x2F,
+  0x73, 0x74, 0x72, 0x69,  0x6E, 0x67, 0x3E, 0x00,  0x3C, 0x75, 0x6E, 0x64,  0x65, 0x66, 0x69, 0x6E,
+  0x65, 0x64, 0x2F, 0x3E,  0x00, 0x6E, 0x75, 0x6D,  0x62, 0x65, 0x72, 0x00,  0x3C, 0x6E, 0x75, 0x6D,
+  0x62, 0x65, 0x72, 0x3E,  0x00, 0x3C, 0x2F, 0x6E,  0x75, 0x6D, 0x62, 0x65,  0x72, 0x3E, 0x00, 0x3C,
+  0x6E, 0x75, 0x6C, 0x6C,  0x2F, 0x3E, 0x00, 0x62,  0x6F, 0x6F, 0x6C, 0x65,  0x61, 0x6E, 0x00, 0x3C,
+  0x74, 0x72, 0x75, 0x65,  0x2F, 0x3E, 0x00, 0x3C,  0x66, 0x61, 0x6C, 0x73,  0x65, 0x2F, 0x3E, 0x00,
+  0x68, 0x61, 0x73, 0x4F,  0x77, 0x6E, 0x50, 0x72,  0x6F, 0x70, 0x65, 0x72,  0x74, 0x79, 0x00, 0x5F,
+  0x6F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x54, 0x6F,  0x41, 0x53, 0x00, 0x70,  0x72, 0x6F, 0x70, 0x65,
+  0x72, 0x74, 0x79, 0x00,  0x5F, 0x61, 0x72, 0x72,  0x61, 0x79, 0x54, 0x6F,  0x41, 0x53, 0x00, 0x4E,
+  0x75, 0x6D, 0x62, 0x65,  0x72, 0x00, 0x53, 0x74,  0x72, 0x69, 0x6E, 0x67,  0x00, 0x5F, 0x75, 0x6E,
+  0x65, 0x73, 0x63, 0x61,  0x70, 0x65, 0x58, 0x4D,  0x4C, 0x00, 0x63, 0x6C,  0x61, 0x73, 0x73, 0x00,
+  0x5F, 0x61, 0x72, 0x72,  0x61, 0x79, 0x54, 0x6F,  0x4A, 0x53, 0x00, 0x5B,  0x00, 0x5F, 0x6C, 0x31,
+  0x00, 0x5D, 0x00, 0x5F,  0x6F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x54, 0x6F,  0x4A, 0x53, 0x00, 0x28,
+  0x7B, 0x00, 0x6E, 0x65,  0x65, 0x64, 0x73, 0x5F,  0x63, 0x6F, 0x6D, 0x6D,  0x61, 0x00, 0x3A, 0x00,
+  0x7D, 0x29, 0x00, 0x22,  0x00, 0x5F, 0x6A, 0x73,  0x51, 0x75, 0x6F, 0x74,  0x65, 0x53, 0x74, 0x72,
+  0x69, 0x6E, 0x67, 0x00,  0x38, 0x5F, 0x69, 0x6E,  0x69, 0x74, 0x4A, 0x53,  0x2C, 0x38, 0x5F, 0x6F,
+  0x62, 0x6A, 0x65, 0x63,  0x74, 0x49, 0x44, 0x2C,  0x38, 0x5F, 0x61, 0x64,  0x64, 0x43, 0x61, 0x6C,
+  0x6C, 0x62, 0x61, 0x63,  0x6B, 0x2C, 0x38, 0x5F,  0x65, 0x76, 0x61, 0x6C,  0x4A, 0x53, 0x2C, 0x38,
+  0x5F, 0x63, 0x61, 0x6C,  0x6C, 0x4F, 0x75, 0x74,  0x2C, 0x38, 0x5F, 0x65,  0x73, 0x63, 0x61, 0x70,
+  0x65, 0x58, 0x4D, 0x4C,  0x2C, 0x38, 0x5F, 0x75,  0x6E, 0x65, 0x73, 0x63,  0x61, 0x70, 0x65, 0x58,
+  0x4D, 0x4C, 0x2C, 0x38,  0x5F, 0x6A, 0x73, 0x51,  0x75, 0x6F, 0x74, 0x65,  0x53, 0x74, 0x72, 0x69,
+  0x6E, 0x67, 0x00, 0x38,  0x61, 0x76, 0x61, 0x69,  0x6C, 0x61, 0x62, 0x6C,  0x65, 0x00, 0x53, 0x68,
+  0x61, 0x72, 0x65, 0x64,  0x4F, 0x62, 0x6A, 0x65,  0x63, 0x74, 0x00, 0x64,  0x65, 0x6C, 0x65, 0x74,
+  0x65, 0x41, 0x6C, 0x6C,  0x00, 0x49, 0x6D, 0x70,  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x20, 0x53,
+  0x68, 0x61, 0x72, 0x65,  0x64, 0x4F, 0x62, 0x6A,  0x65, 0x63, 0x74, 0x2E,  0x64, 0x65, 0x6C, 0x65,
+  0x74, 0x65, 0x41, 0x6C,  0x6C, 0x20, 0x28, 0x73,  0x74, 0x61, 0x74, 0x69,  0x63, 0x29, 0x00, 0x67,
+  0x65, 0x74, 0x44, 0x69,  0x73, 0x6B, 0x55, 0x73,  0x61, 0x67, 0x65, 0x00,  0x49, 0x6D, 0x70, 0x6C,
+  0x65, 0x6D, 0x65, 0x6E,  0x74, 0x20, 0x53, 0x68,  0x61, 0x72, 0x65, 0x64,  0x4F, 0x62, 0x6A, 0x65,
+  0x63, 0x74, 0x2E, 0x67,  0x65, 0x74, 0x44, 0x69,  0x73, 0x6B, 0x55, 0x73,  0x61, 0x67, 0x65, 0x20,
+  0x28, 0x73, 0x74, 0x61,  0x74, 0x69, 0x63, 0x29,  0x00, 0x67, 0x65, 0x74,  0x4C, 0x6F, 0x63, 0x61,
+  0x6C, 0x00, 0x49, 0x6D,  0x70, 0x6C, 0x65, 0x6D,  0x65, 0x6E, 0x74, 0x20,  0x53, 0x68, 0x61, 0x72,
+  0x65, 0x64, 0x4F, 0x62,  0x6A, 0x65, 0x63, 0x74,  0x2E, 0x67, 0x65, 0x74,  0x4C, 0x6F, 0x63, 0x61,
+  0x6C, 0x20, 0x28, 0x73,  0x74, 0x61, 0x74, 0x69,  0x63, 0x29, 0x00, 0x67,  0x65, 0x74, 0x52, 0x65,
+  0x6D, 0x6F, 0x74, 0x65,  0x00, 0x49, 0x6D, 0x70,  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x20, 0x53,
+  0x68, 0x61, 0x72, 0x65,  0x64, 0x4F, 0x62, 0x6A,  0x65, 0x63, 0x74, 0x2E,  0x67, 0x65, 0x74, 0x52,
+  0x65, 0x6D, 0x6F, 0x74,  0x65, 0x20, 0x28, 0x73,  0x74, 0x61, 0x74, 0x69,  0x63, 0x29, 0x00, 0x64,
+  0x65, 0x6C, 0x65, 0x74,  0x65, 0x41, 0x6C, 0x6C,  0x2C, 0x67, 0x65, 0x74,  0x44, 0x69, 0x73, 0x6B,
+  0x55, 0x73, 0x61, 0x67,  0x65, 0x00, 0x36, 0x63,  0x6F, 0x6E, 0x6E, 0x65,  0x63, 0x74, 0x2C, 0x36,
+  0x73, 0x65, 0x6E, 0x64,  0x2C, 0x36, 0x66, 0x6C,  0x75, 0x73, 0x68, 0x2C,  0x36, 0x63, 0x6C, 0x6F,
+  0x73, 0x65, 0x2C, 0x36,  0x67, 0x65, 0x74, 0x53,  0x69, 0x7A, 0x65, 0x2C,  0x36, 0x73, 0x65, 0x74,
+  0x46, 0x70, 0x73, 0x2C,  0x36, 0x63, 0x6C, 0x65,  0x61, 0x72, 0x00, 0x41,  0x73, 0x53, 0x65, 0x74,
+  0x75, 0x70, 0x45, 0x72,  0x72, 0x6F, 0x72, 0x00,  0x73, 0x70, 0x6C, 0x69,  0x74, 0x00, 0x63, 0x6F,
+  0x75, 0x6E, 0x74, 0x00,  0x52, 0x65, 0x6D, 0x6F,  0x74, 0x65, 0x4C, 0x53,  0x4F, 0x55, 0x73, 0x61,
+  0x67, 0x65, 0x00, 0x67,  0x65, 0x74, 0x55, 0x52,  0x4C, 0x50, 0x61, 0x67,  0x65, 0x53, 0x75, 0x70,
+  0x70, 0x6F, 0x72, 0x74,  0x00, 0x49, 0x6D, 0x70,  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x20, 0x52,
+  0x65, 0x6D, 0x6F, 0x74,  0x65, 0x4C, 0x53, 0x4F,  0x55, 0x73, 0x61, 0x67,  0x65, 0x2E, 0x67, 0x65,
+  0x74, 0x55, 0x52, 0x4C,  0x50, 0x61, 0x67, 0x65,  0x53, 0x75, 0x70, 0x70,  0x6F, 0x72, 0x74, 0x20,
+  0x28, 0x73, 0x74, 0x61,  0x74, 0x69, 0x63, 0x29,  0x00, 0x42, 0x75, 0x74,  0x74, 0x6F, 0x6E, 0x00,
+  0x67, 0x65, 0x74, 0x44,  0x65, 0x70, 0x74, 0x68,  0x00, 0x38, 0x73, 0x63,  0x61, 0x6C, 0x65, 0x39,
+  0x47, 0x72, 0x69, 0x64,  0x2C, 0x38, 0x66, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x73, 0x2C, 0x38, 0x63,
+  0x61, 0x63, 0x68, 0x65,  0x41, 0x73, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,  0x2C, 0x38, 0x62, 0x6C,
+  0x65, 0x6E, 0x64, 0x4D,  0x6F, 0x64, 0x65, 0x00,  0x73, 0x65, 0x74, 0x49,  0x6E, 0x74, 0x65, 0x72,
+  0x76, 0x61, 0x6C, 0x00,  0x63, 0x6C, 0x65, 0x61,  0x72, 0x49, 0x6E, 0x74,  0x65, 0x72, 0x76, 0x61,
+  0x6C, 0x00, 0x73, 0x65,  0x74, 0x54, 0x69, 0x6D,  0x65, 0x6F, 0x75, 0x74,  0x00, 0x63, 0x6C, 0x65,
+  0x61, 0x72, 0x54, 0x69,  0x6D, 0x65, 0x6F, 0x75,  0x74, 0x00, 0x73, 0x68,  0x6F, 0x77, 0x52, 0x65,
+  0x64, 0x72, 0x61, 0x77,  0x52, 0x65, 0x67, 0x69,  0x6F, 0x6E, 0x73, 0x00,  0x74, 0x72, 0x61, 0x63,
+  0x65, 0x00, 0x75, 0x70,  0x64, 0x61, 0x74, 0x65,  0x41, 0x66, 0x74, 0x65,  0x72, 0x45, 0x76, 0x65,
+  0x6E, 0x74, 0x00, 0x96,  0x13, 0x00, 0x08, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x1D, 0x96,  0x13, 0x00, 0x08, 0x02,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
+  0x01, 0x3D, 0x1D, 0x96,  0x13, 0x00, 0x08, 0x03,  0x07, 0x01, 0x00, 0x00,  0x00, 0x07, 0x04, 0x00,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x1D, 0x96,  0x07, 0x00, 0x08, 0x04,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x1D, 0x96,  0x02, 0x00, 0x08, 0x05,  0x1C, 0x96, 0x13, 0x00,
+  0x08, 0x06, 0x07, 0x08,  0x00, 0x00, 0x00, 0x07,  0x65, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x08, 0x00,  0x07, 0x07, 0x00, 0x00,  0x00, 0x02, 0x08, 0x05,
+  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x0E, 0x00,
+  0x07, 0x80, 0x00, 0x00,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x07,  0x08, 0x05, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x08,
+  0x9B, 0x09, 0x00, 0x00,  0x01, 0x00, 0x6D, 0x73,  0x67, 0x00, 0x23, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x09, 0x1C, 0x44, 0x96,  0x02, 0x00, 0x08, 0x0A,  0x49, 0x12, 0x12, 0x9D,  0x02, 0x00, 0x0F, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x0C, 0x08,  0x09, 0x1C, 0x4F, 0x1D,
+  0x96, 0x02, 0x00, 0x08,  0x08, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x04, 0x00, 0x08,
+  0x0E, 0x08, 0x08, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0x0C, 0x08,
+  0x08, 0x87, 0x01, 0x00,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x04, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x08, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0F, 0x9B, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x0D,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0C,
+  0x4E, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x10,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+  0x1D, 0x96, 0x02, 0x00,  0x08, 0x10, 0x1C, 0x96,  0x13, 0x00, 0x08, 0x11,  0x07, 0x0C, 0x00, 0x00,
+  0x00, 0x07, 0x65, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x12, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,
+  0x78, 0x00, 0x3C, 0x00,  0x96, 0x02, 0x00, 0x08,  0x13, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x14, 0x52, 0x17,  0x96, 0x02, 0x00, 0x08,
+  0x13, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x15, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x16,  0x52, 0x17, 0x96, 0x02,  0x00, 0x05, 0x01, 0x3E,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x14,  0x9B, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x78, 0x00,  0x8A, 0x00, 0x96, 0x04,  0x00, 0x08, 0x17, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x15, 0x4E,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x41, 0x96,  0x07, 0x00, 0x08, 0x18,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x17, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,  0x00, 0x4B, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x17,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x13, 0x1C, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x23,  0x00, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0x18, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x17, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x1A,  0x52, 0x17, 0x96, 0x02,  0x00, 0x05, 0x01, 0x3E,  0x96, 0x02, 0x00, 0x08,
+  0x18, 0x4C, 0x1C, 0x50,  0x1D, 0x99, 0x02, 0x00,  0x9C, 0xFF, 0x96, 0x02,  0x00, 0x05, 0x00, 0x3E,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,  0x9B, 0x07, 0x00, 0x00,
+  0x01, 0x00, 0x6F, 0x00,  0x73, 0x00, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x13, 0x00, 0x08,
+  0x11, 0x07, 0x0C, 0x00,  0x00, 0x00, 0x07, 0x65,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x12, 0x08,
+  0x10, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x12, 0x4E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,
+  0x04, 0x00, 0x08, 0x14,  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x14,  0x4E, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x07, 0x00, 0x08,  0x15, 0x07, 0x00, 0x00,  0x00, 0x00, 0x42, 0x4F,
+  0x96, 0x09, 0x00, 0x07,  0x83, 0x00, 0x00, 0x00,  0x08, 0x1D, 0x08, 0x1C,  0x1C, 0x96, 0x07, 0x00,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x4F, 0x96, 0x8C,  0x00, 0x08, 0x1E, 0x08,
+  0x1F, 0x07, 0x12, 0x00,  0x00, 0x00, 0x08, 0x20,  0x07, 0x08, 0x00, 0x00,  0x00, 0x08, 0x21, 0x07,
+  0x14, 0x00, 0x00, 0x00,  0x08, 0x22, 0x07, 0x11,  0x00, 0x00, 0x00, 0x08,  0x23, 0x07, 0x2E, 0x00,
+  0x00, 0x00, 0x08, 0x24,  0x07, 0x28, 0x00, 0x00,  0x00, 0x08, 0x25, 0x07,  0x23, 0x00, 0x00, 0x00,
+  0x08, 0x26, 0x07, 0x0D,  0x00, 0x00, 0x00, 0x08,  0x27, 0x07, 0x1B, 0x00,  0x00, 0x00, 0x08, 0x28,
+  0x07, 0x24, 0x00, 0x00,  0x00, 0x08, 0x29, 0x07,  0x2D, 0x00, 0x00, 0x00,  0x08, 0x2A, 0x07, 0x25,
+  0x00, 0x00, 0x00, 0x08,  0x2B, 0x07, 0x22, 0x00,  0x00, 0x00, 0x08, 0x2C,  0x07, 0x21, 0x00, 0x00,
+  0x00, 0x08, 0x2D, 0x07,  0x27, 0x00, 0x00, 0x00,  0x08, 0x2E, 0x07, 0x10,  0x00, 0x00, 0x00, 0x08,
+  0x2F, 0x07, 0x20, 0x00,  0x00, 0x00, 0x08, 0x30,  0x07, 0x09, 0x00, 0x00,  0x00, 0x08, 0x31, 0x07,
+  0x26, 0x00, 0x00, 0x00,  0x07, 0x13, 0x00, 0x00,  0x00, 0x43, 0x1D, 0x96,  0x09, 0x00, 0x08, 0x32,
+  0x07, 0x20, 0x03, 0x00,  0x00, 0x08, 0x1E, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x02, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x1E, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1B, 0x52, 0x17,  0x96, 0x08, 0x00, 0x07,
+  0x07, 0x00, 0x00, 0x00,  0x02, 0x08, 0x1E, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x3D, 0x17,  0x96, 0x07, 0x00, 0x08,  0x33, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x1D,
+  0x96, 0x02, 0x00, 0x08,  0x33, 0x1C, 0x96, 0x13,  0x00, 0x08, 0x34, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x07, 0x05, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x33, 0x1C,  0x96, 0x13, 0x00, 0x08,  0x35, 0x07, 0x01, 0x00,  0x00, 0x00, 0x07, 0x05,
   0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x33, 0x1C, 0x96, 0x13,  0x00, 0x08, 0x35, 0x07,  0x01, 0x00, 0x00, 0x00,  0x07, 0x05, 0x00, 0x00,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x33, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,
-  0x52, 0x17, 0x96, 0x08,  0x00, 0x07, 0x07, 0x00,  0x00, 0x00, 0x02, 0x08,  0x33, 0x1C, 0x96, 0x07,
-  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x07,  0x00, 0x08, 0x36, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x43, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x36, 0x1C,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,  0x52, 0x17, 0x96, 0x0E,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x37,  0x07, 0x9A, 0x02, 0x00,  0x00, 0x08, 0x36, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x0E, 0x00, 0x07,
-  0x64, 0x00, 0x00, 0x00,  0x08, 0x38, 0x07, 0x9A,  0x02, 0x00, 0x00, 0x08,  0x36, 0x1C, 0x96, 0x07,
-  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x13,  0x00, 0x08, 0x39, 0x07,
-  0xC8, 0x00, 0x00, 0x00,  0x07, 0x34, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
-  0x3D, 0x1D, 0x96, 0x09,  0x00, 0x08, 0x3B, 0x07,  0x34, 0x08, 0x00, 0x00,  0x08, 0x39, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,
-  0x17, 0x96, 0x12, 0x00,  0x02, 0x07, 0x04, 0x00,  0x00, 0x00, 0x07, 0x34,  0x08, 0x00, 0x00, 0x07,
-  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x96,  0x09, 0x00, 0x08, 0x3C,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x39, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x07, 0x52,
-  0x17, 0x96, 0x02, 0x00,  0x08, 0x39, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x04, 0x00,
-  0x08, 0x3D, 0x08, 0x3E,  0x4F, 0x96, 0x12, 0x00,  0x02, 0x07, 0x05, 0x00,  0x00, 0x00, 0x07, 0x34,
-  0x08, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x96,  0x09, 0x00, 0x08, 0x3F,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x39, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x07, 0x52,  0x17, 0x96, 0x08, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x08, 0x39,
+  0x33, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x1B, 0x52, 0x17,  0x96, 0x08, 0x00, 0x07,  0x07, 0x00, 0x00, 0x00,  0x02, 0x08, 0x33, 0x1C,
+  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x07, 0x00, 0x08,
+  0x36, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x1D,  0x96, 0x02, 0x00, 0x08,  0x36, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1B, 0x52, 0x17,
+  0x96, 0x0E, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x37, 0x07, 0x9A,  0x02, 0x00, 0x00, 0x08,
+  0x36, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x0E,
+  0x00, 0x07, 0x64, 0x00,  0x00, 0x00, 0x08, 0x38,  0x07, 0x9A, 0x02, 0x00,  0x00, 0x08, 0x36, 0x1C,
+  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x13, 0x00, 0x08,
+  0x39, 0x07, 0xC8, 0x00,  0x00, 0x00, 0x07, 0x34,  0x08, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x3A, 0x3D, 0x1D,  0x96, 0x09, 0x00, 0x08,  0x3B, 0x07, 0x34, 0x08,  0x00, 0x00, 0x08, 0x39,
   0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
-  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x40,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x41,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,
-  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x42,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x40,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x43,  0x9B, 0x0A, 0x00, 0x00,
-  0x01, 0x00, 0x66, 0x6C,  0x61, 0x67, 0x00, 0x1E,  0x00, 0x96, 0x07, 0x00,  0x08, 0x1C, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x3C, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x1C, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x44, 0x52, 0x17, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x40, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x45, 0x9B, 0x0A, 0x00,  0x00, 0x01, 0x00, 0x66,
-  0x6C, 0x61, 0x67, 0x00,  0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x46, 0x52, 0x17,  0x4F, 0x96, 0x09, 0x00,  0x08, 0x47, 0x07, 0x35,  0x08, 0x00, 0x00, 0x08,
-  0x40, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x3D, 0x17,  0x96, 0x0E, 0x00, 0x07,  0x05, 0x00, 0x00, 0x00,  0x08, 0x48, 0x07, 0x35,
-  0x08, 0x00, 0x00, 0x08,  0x40, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
-  0x02, 0x08, 0x40, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
-  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x13,  0x00, 0x08, 0x49, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x1D, 0x96, 0x02,
-  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4A, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,
-  0x00, 0x08, 0x4B, 0x07,  0x02, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4C, 0x07,  0x03, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4D, 0x07,  0x04, 0x00, 0x00, 0x00,
-  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4E, 0x07,
-  0x05, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,
-  0x00, 0x08, 0x0F, 0x07,  0x06, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4F, 0x07,  0x07, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x49, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x50, 0x07,  0x08, 0x00, 0x00, 0x00,
-  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x13,
-  0x00, 0x08, 0x51, 0x07,  0x09, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x51, 0x1C,  0x96, 0x10, 0x00, 0x08,
-  0x0D, 0x08, 0x52, 0x07,  0x01, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x49, 0x40,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x53, 0x3A, 0x17,  0x96, 0x09, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x0D, 0x08, 0x51,
+  0x02, 0x3D, 0x17, 0x96,  0x12, 0x00, 0x02, 0x07,  0x04, 0x00, 0x00, 0x00,  0x07, 0x34, 0x08, 0x00,
+  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x96, 0x09, 0x00,  0x08, 0x3C, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x08,  0x39, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x52, 0x17, 0x96,  0x02, 0x00, 0x08, 0x39,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x04, 0x00, 0x08, 0x3D,  0x08, 0x3E, 0x4F, 0x96,  0x12, 0x00, 0x02, 0x07,  0x05, 0x00, 0x00, 0x00,
+  0x07, 0x34, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x96, 0x09, 0x00,
+  0x08, 0x3F, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x39, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x07, 0x52, 0x17, 0x96,  0x08, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,
+  0x08, 0x39, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x40, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x41, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,
+  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x42, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x40, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x43, 0x9B, 0x0A,
+  0x00, 0x00, 0x01, 0x00,  0x66, 0x6C, 0x61, 0x67,  0x00, 0x1E, 0x00, 0x96,  0x07, 0x00, 0x08, 0x1C,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x3C, 0x96,  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,
+  0x1C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x44, 0x52,  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x40, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x45, 0x9B,  0x0A, 0x00, 0x00, 0x01,
+  0x00, 0x66, 0x6C, 0x61,  0x67, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x46,  0x52, 0x17, 0x4F, 0x96,  0x09, 0x00, 0x08, 0x47,  0x07, 0x35, 0x08, 0x00,
+  0x00, 0x08, 0x40, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
+  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x05, 0x00,  0x00, 0x00, 0x08, 0x48,
+  0x07, 0x35, 0x08, 0x00,  0x00, 0x08, 0x40, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x03, 0x00,
+  0x00, 0x00, 0x02, 0x08,  0x40, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
+  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x5E, 0x9B, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00,  0x00, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0x5F, 0x08,  0x60, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4C, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x07, 0x2D, 0x01, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x5E, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x4D, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x07, 0x2D, 0x01, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,
+  0x00, 0x08, 0x4E, 0x07,  0x02, 0x00, 0x00, 0x00,  0x07, 0x2D, 0x01, 0x00,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x61, 0x07,  0x03, 0x00, 0x00, 0x00,  0x07, 0x2D, 0x01, 0x00,
+  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x50, 0x9B,  0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x5E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x51, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x73,  0x72, 0x63, 0x00, 0x64,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0x53,  0x05, 0x01, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x52,  0x1C, 0x96, 0x01, 0x00,  0x02, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x19, 0x00,
+  0x96, 0x09, 0x00, 0x05,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x50, 0x52, 0x17,  0x99, 0x02, 0x00, 0x2C,  0x00, 0x96, 0x02, 0x00,  0x08, 0x52, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x61, 0x52,
+  0x17, 0x96, 0x09, 0x00,  0x05, 0x01, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x50, 0x52,  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0F, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x83, 0x00, 0x96,
+  0x07, 0x00, 0x08, 0x62,  0x07, 0x00, 0x00, 0x00,  0x00, 0x42, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x46, 0x87, 0x01, 0x00,  0x00, 0x96, 0x01, 0x00,  0x02, 0x49, 0x9D, 0x02,  0x00, 0x4F, 0x00, 0x96,
+  0x04, 0x00, 0x08, 0x13,  0x04, 0x00, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x1C, 0x96, 0x07, 0x00,
+  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x63, 0x3D,  0x96, 0x02, 0x00, 0x08,  0x64, 0x47, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x1C, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0x63, 0x3D, 0x47, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x62, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x16, 0x52,  0x17, 0x99, 0x02, 0x00,  0xA3, 0xFF, 0x96, 0x09,
+  0x00, 0x08, 0x65, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x62, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x66,
+  0x52, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x5E,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x54,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x0D, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x55, 0x4E,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5E, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x56, 0x9B,  0x05, 0x00, 0x00, 0x00,
+  0x00, 0x0D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x57, 0x4E, 0x3E,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x5E, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x58, 0x9B, 0x0F,  0x00, 0x00, 0x02, 0x00,  0x6B, 0x65, 0x79, 0x00,  0x76, 0x61, 0x6C, 0x75,
+  0x65, 0x00, 0x21, 0x01,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x59, 0x4E,
+  0x44, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x2D,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x09, 0x00, 0x08, 0x59,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x5A, 0x40,
+  0x4F, 0x96, 0x09, 0x00,  0x07, 0x83, 0x00, 0x00,  0x00, 0x08, 0x59, 0x08,  0x0B, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x5B, 0x1C,
+  0x44, 0x96, 0x02, 0x00,  0x08, 0x5C, 0x49, 0x4C,  0x12, 0x9D, 0x02, 0x00,  0x0E, 0x00, 0x17, 0x96,
+  0x02, 0x00, 0x08, 0x5D,  0x1C, 0x44, 0x96, 0x02,  0x00, 0x08, 0x5C, 0x49,  0x9D, 0x02, 0x00, 0x90,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x5B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x5A,  0x1C, 0x54, 0x12, 0x9D,
+  0x02, 0x00, 0x78, 0x00,  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0x18,  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x47, 0x96, 0x02,
+  0x00, 0x08, 0x5B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x4B,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x5B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x96, 0x05, 0x00,
+  0x07, 0x01, 0x00, 0x00,  0x00, 0x47, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x5B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x58,  0x52, 0x17, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x96, 0x05, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x47, 0x1D, 0x99,  0x02, 0x00, 0x93, 0xFF,  0x99, 0x02, 0x00, 0x24,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x5D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x5B,  0x1C, 0x96, 0x07, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x59, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x16, 0x52,  0x17, 0x4F, 0x96, 0x08,  0x00, 0x07, 0x83, 0x00,  0x00, 0x00, 0x02, 0x08,
+  0x5E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x3D, 0x17,  0x96, 0x13, 0x00, 0x08,  0x67, 0x07, 0x11, 0x00,  0x00, 0x00, 0x07, 0xF4,
+  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x1D,  0x96, 0x09, 0x00, 0x08,
+  0x68, 0x07, 0xF4, 0x01,  0x00, 0x00, 0x08, 0x67,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0x12,
+  0x00, 0x00, 0x00, 0x08,  0x48, 0x07, 0xF4, 0x01,  0x00, 0x00, 0x08, 0x67,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,
+  0x08, 0x00, 0x07, 0x07,  0x00, 0x00, 0x00, 0x02,  0x08, 0x67, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x07, 0x00,
+  0x08, 0x69, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,  0x1D, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,
+  0x07, 0x00, 0x08, 0x6A,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x69,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x6A, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x6B,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x0B, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x4F, 0x96,
+  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x69, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x6A, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x6B, 0x52, 0x17, 0x96,  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x6A, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x6B,  0x3A, 0x17, 0x96, 0x02,  0x00, 0x08, 0x69, 0x1C,
+  0x96, 0x13, 0x00, 0x08,  0x6C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x2A,  0x04, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x69, 0x1C, 0x96, 0x13,
+  0x00, 0x08, 0x6D, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x3B, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x0E,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x6E,
+  0x07, 0x3B, 0x08, 0x00,  0x00, 0x08, 0x69, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x3D, 0x17,  0x96, 0x09, 0x00, 0x07,  0x80, 0x00, 0x00, 0x00,  0x08, 0x6F, 0x08, 0x69,
   0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,
-  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,  0x08, 0x54, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x07,  0x2D, 0x01, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,
-  0x08, 0x55, 0x07, 0x01,  0x00, 0x00, 0x00, 0x07,  0x2D, 0x01, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x13, 0x00,  0x08, 0x56, 0x07, 0x02,  0x00, 0x00, 0x00, 0x07,  0x2D, 0x01, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,  0x08, 0x57, 0x07, 0x0A,  0x00, 0x00, 0x00, 0x07,
-  0xFD, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,  0x08, 0x58, 0x07, 0x0B,
-  0x00, 0x00, 0x00, 0x07,  0xFD, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,
-  0x08, 0x59, 0x07, 0x0C,  0x00, 0x00, 0x00, 0x07,  0xFD, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x5A, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x51,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x5B,
-  0x9B, 0x09, 0x00, 0x00,  0x01, 0x00, 0x73, 0x72,  0x63, 0x00, 0x72, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x5C, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x27,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0x5D,  0x05, 0x00, 0x4F, 0x96,  0x09, 0x00, 0x05, 0x00,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x5A, 0x52, 0x17, 0x99,
-  0x02, 0x00, 0x3A, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x5D, 0x05,
-  0x01, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x5C, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x59,  0x52, 0x17, 0x96, 0x09,  0x00, 0x05, 0x01, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x5A,  0x52, 0x17, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x51,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x5E,
-  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x0D, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x5F, 0x4E,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x51, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x60, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x0D, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x61, 0x4E, 0x3E,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x51, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x62, 0x9B, 0x0F,
-  0x00, 0x00, 0x02, 0x00,  0x6B, 0x65, 0x79, 0x00,  0x76, 0x61, 0x6C, 0x75,  0x65, 0x00, 0x21, 0x01,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x63, 0x4E,  0x44, 0x96, 0x02, 0x00,
-  0x08, 0x0A, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x2D,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x09, 0x00, 0x08, 0x63,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x64, 0x40,  0x4F, 0x96, 0x09, 0x00,
-  0x07, 0x83, 0x00, 0x00,  0x00, 0x08, 0x63, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
-  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x65, 0x1C,  0x44, 0x96, 0x02, 0x00,
-  0x08, 0x66, 0x49, 0x4C,  0x12, 0x9D, 0x02, 0x00,  0x0E, 0x00, 0x17, 0x96,  0x02, 0x00, 0x08, 0x67,
-  0x1C, 0x44, 0x96, 0x02,  0x00, 0x08, 0x66, 0x49,  0x9D, 0x02, 0x00, 0x90,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x65, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x64,  0x1C, 0x54, 0x12, 0x9D,  0x02, 0x00, 0x78, 0x00,
-  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x18,
-  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x47, 0x96, 0x02,  0x00, 0x08, 0x65, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x4B,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x65, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x47, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x65,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x62,
-  0x52, 0x17, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x96, 0x05, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x47, 0x1D, 0x99,  0x02, 0x00, 0x93, 0xFF,  0x99, 0x02, 0x00, 0x24,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x67, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x65,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x63, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x16, 0x52,
-  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x68, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x1D,
-  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x04, 0x00, 0x08,
-  0x69, 0x08, 0x6A, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x13, 0x00, 0x08,  0x54, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,
-  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x13, 0x00, 0x08,  0x55, 0x07, 0x01, 0x00,  0x00, 0x00, 0x07, 0x2D,
-  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x13, 0x00, 0x08,  0x56, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x13, 0x00, 0x08,
-  0x6B, 0x07, 0x03, 0x00,  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
-  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x5A, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x00,  0x00, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x68, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x5B, 0x9B,
-  0x09, 0x00, 0x00, 0x01,  0x00, 0x73, 0x72, 0x63,  0x00, 0x64, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x04, 0x00,  0x08, 0x5D, 0x05, 0x01,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x5C, 0x1C, 0x96,
-  0x01, 0x00, 0x02, 0x49,  0x12, 0x9D, 0x02, 0x00,  0x19, 0x00, 0x96, 0x09,  0x00, 0x05, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x5A,  0x52, 0x17, 0x99, 0x02,
-  0x00, 0x2C, 0x00, 0x96,  0x02, 0x00, 0x08, 0x5C,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x6B, 0x52, 0x17, 0x96,  0x09, 0x00, 0x05, 0x01,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x5A, 0x52, 0x17, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x83,  0x00, 0x96, 0x07, 0x00,  0x08, 0x6C, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x42,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x46, 0x87,  0x01, 0x00, 0x00, 0x96,
-  0x01, 0x00, 0x02, 0x49,  0x9D, 0x02, 0x00, 0x4F,  0x00, 0x96, 0x04, 0x00,  0x08, 0x13, 0x04, 0x00,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x6D, 0x3D, 0x96, 0x02,  0x00, 0x08, 0x6E, 0x47,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x1C,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x6D, 0x3D,
-  0x47, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x6C, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x16, 0x52, 0x17, 0x99,  0x02, 0x00, 0xA3, 0xFF,  0x96, 0x09, 0x00, 0x08,  0x6F, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x08, 0x6C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x70, 0x52, 0x3E,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x68, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x5E, 0x9B, 0x05,
-  0x00, 0x00, 0x00, 0x00,  0x0D, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x5F, 0x4E, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x68, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x60, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x0D,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x61,  0x4E, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x68,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x62,  0x9B, 0x0F, 0x00, 0x00,
-  0x02, 0x00, 0x6B, 0x65,  0x79, 0x00, 0x76, 0x61,  0x6C, 0x75, 0x65, 0x00,  0x21, 0x01, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x63, 0x4E, 0x44, 0x96,  0x02, 0x00, 0x08, 0x0A,
-  0x49, 0x12, 0x9D, 0x02,  0x00, 0x2D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x09, 0x00,
-  0x08, 0x63, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x64, 0x40, 0x4F, 0x96,  0x09, 0x00, 0x07, 0x83,
-  0x00, 0x00, 0x00, 0x08,  0x63, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x65, 0x1C, 0x44, 0x96,  0x02, 0x00, 0x08, 0x66,
-  0x49, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x0E, 0x00,  0x17, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x44,
-  0x96, 0x02, 0x00, 0x08,  0x66, 0x49, 0x9D, 0x02,  0x00, 0x90, 0x00, 0x96,  0x02, 0x00, 0x08, 0x65,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x64, 0x1C, 0x54,  0x12, 0x9D, 0x02, 0x00,  0x78, 0x00, 0x96, 0x07,
-  0x00, 0x08, 0x18, 0x07,  0x00, 0x00, 0x00, 0x00,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,
-  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x47,  0x96, 0x02, 0x00, 0x08,  0x65, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,  0x00, 0x4B, 0x00, 0x96,  0x02, 0x00, 0x08, 0x65,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x47,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x65, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x07,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x62, 0x52, 0x17,
-  0x96, 0x02, 0x00, 0x08,  0x18, 0x4C, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x47,
-  0x1D, 0x99, 0x02, 0x00,  0x93, 0xFF, 0x99, 0x02,  0x00, 0x24, 0x00, 0x96,  0x02, 0x00, 0x08, 0x67,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x65, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x63, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x16, 0x52, 0x17, 0x4F,
-  0x96, 0x08, 0x00, 0x07,  0x83, 0x00, 0x00, 0x00,  0x02, 0x08, 0x68, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x13,
-  0x00, 0x08, 0x71, 0x07,  0x11, 0x00, 0x00, 0x00,  0x07, 0xF4, 0x01, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x1D, 0x96, 0x09,  0x00, 0x08, 0x72, 0x07,  0xF4, 0x01, 0x00, 0x00,
-  0x08, 0x71, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x0E, 0x00,  0x07, 0x12, 0x00, 0x00,  0x00, 0x08, 0x48, 0x07,
-  0xF4, 0x01, 0x00, 0x00,  0x08, 0x71, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
-  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x08, 0x00,  0x07, 0x07, 0x00, 0x00,
-  0x00, 0x02, 0x08, 0x71,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,
-  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x07, 0x00, 0x08, 0x73,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x43, 0x1D, 0x96,  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x07, 0x00,  0x08, 0x74, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x74,
-  0x4E, 0x96, 0x13, 0x00,  0x08, 0x75, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x0B, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x73, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x74, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x75, 0x52,
-  0x17, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x74,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x75, 0x3A, 0x17,  0x96, 0x02, 0x00, 0x08,  0x73, 0x1C, 0x96, 0x13,  0x00, 0x08, 0x76, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x07, 0x2A, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x73, 0x1C,  0x96, 0x13, 0x00, 0x08,  0x77, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x3B,  0x08, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,
-  0x96, 0x0E, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x78, 0x07, 0x3B,  0x08, 0x00, 0x00, 0x08,
-  0x73, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x09,
-  0x00, 0x07, 0x80, 0x00,  0x00, 0x00, 0x08, 0x79,  0x08, 0x73, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,
-  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x09, 0x00,
-  0x08, 0x7A, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x05, 0x40, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x73,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x7A, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x53,  0x3A, 0x17, 0x96, 0x09,
-  0x00, 0x08, 0x7B, 0x07,  0x0C, 0x00, 0x00, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x7A,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x0E, 0x00,
-  0x07, 0x05, 0x00, 0x00,  0x00, 0x08, 0x7C, 0x07,  0x0C, 0x00, 0x00, 0x00,  0x08, 0x73, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x7A,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,
-  0x17, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x7A,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x7D, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,
+  0x08, 0x69, 0x1C, 0x96,  0x09, 0x00, 0x08, 0x70,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x05, 0x40,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x70,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x4B, 0x3A, 0x17,  0x96, 0x09, 0x00, 0x08,  0x71, 0x07, 0x0C, 0x00,  0x00, 0x00, 0x08, 0x69,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x70, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x02, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0x05,  0x00, 0x00, 0x00, 0x08,  0x72, 0x07, 0x0C, 0x00,
+  0x00, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x70, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,
+  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x70, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x73,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,
+  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x74,  0x52, 0x17, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x70, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x73,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x75,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x0F, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x70, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x73,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x10, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1B, 0x52,  0x17, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x76,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,
+  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x77,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x69,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x76, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x78, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,
   0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x7E, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x7A,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x7D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x13, 0x00,  0x08, 0x7F, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x0F, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x7A,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x7D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x10, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x1B, 0x52, 0x17, 0x96,  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x80, 0x9B, 0x05,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x79, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x76,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x7A,
+  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x7B,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x76, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x7C, 0x9B, 0x05,
   0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,
   0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x81, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x80,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x82,  0x9B, 0x05, 0x00, 0x00,
+  0x08, 0x7D, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x76,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x7E,  0x9B, 0x05, 0x00, 0x00,
   0x00, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,
-  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x83,
-  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x80, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x84, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
+  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x7F,
+  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x76, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x80, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
   0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,
-  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x85, 0x52, 0x17,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x80,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x86,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,
+  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x81, 0x52, 0x17,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x76,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x82,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,
   0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x87,  0x52, 0x17, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x80, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x88, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,
-  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x89, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x73, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x80,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x8A,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1E, 0x00,  0x96, 0x07, 0x00, 0x08,
-  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x8B,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x73,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x80, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x8C, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1E, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x8D, 0x52, 0x17,  0x4F, 0x96, 0x08, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x02, 0x08, 0x73,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x80, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,
-  0x08, 0x73, 0x1C, 0x96,  0x27, 0x00, 0x08, 0x8E,  0x08, 0x8F, 0x08, 0x8F,  0x08, 0x90, 0x08, 0x90,
-  0x08, 0x91, 0x08, 0x91,  0x08, 0x92, 0x08, 0x92,  0x08, 0x93, 0x08, 0x93,  0x08, 0x94, 0x08, 0x94,
-  0x08, 0x95, 0x08, 0x95,  0x08, 0x96, 0x08, 0x96,  0x07, 0x08, 0x00, 0x00,  0x00, 0x43, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x73,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x8E, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x10, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1B, 0x52,  0x17, 0x96, 0x09, 0x00,
-  0x08, 0x97, 0x07, 0x0D,  0x00, 0x00, 0x00, 0x08,  0x73, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x8E, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x07,
-  0x07, 0x00, 0x00, 0x00,  0x02, 0x08, 0x73, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x8E, 0x4E, 0x96, 0x07,
-  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x98, 0x9B,
-  0x0C, 0x00, 0x00, 0x01,  0x00, 0x74, 0x61, 0x72,  0x67, 0x65, 0x74, 0x00,  0x27, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,  0x99, 0x08, 0x99, 0x1C,  0x4F, 0x96, 0x08, 0x00,
-  0x07, 0x07, 0x00, 0x00,  0x00, 0x02, 0x08, 0x0B,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x3D,  0x17, 0x1D, 0x96, 0x09,  0x00, 0x08, 0x9A, 0x07,  0xBC, 0x02, 0x00, 0x00,
-  0x08, 0x98, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x08, 0x00,  0x07, 0x07, 0x00, 0x00,  0x00, 0x02, 0x08, 0x98,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
-  0x00, 0x3D, 0x17, 0x96,  0x13, 0x00, 0x08, 0x9B,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x2B, 0x04,
-  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x3A, 0x3D, 0x1D, 0x96,  0x0E, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x9C, 0x07, 0x2B, 0x04,  0x00, 0x00, 0x08, 0x9B,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,
-  0x02, 0x00, 0x08, 0x9D,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,  0x1D, 0x96, 0x02, 0x00,
-  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x04, 0x00,  0x08, 0x9E, 0x05, 0x01,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x04, 0x00,
-  0x08, 0x9F, 0x05, 0x01,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0xA0, 0x9B, 0x0C,  0x00, 0x00, 0x01, 0x00,  0x6D, 0x65, 0x74, 0x68,
-  0x6F, 0x64, 0x00, 0x5B,  0x00, 0x96, 0x09, 0x00,  0x08, 0xA3, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,
-  0xA1, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xA2, 0x52,  0x3C, 0x96, 0x02, 0x00,  0x08, 0xA3, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xA4,  0x49, 0x9D, 0x02, 0x00,  0x2D, 0x00, 0x96, 0x02,  0x00, 0x08, 0xA3, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xA5, 0x49, 0x9D, 0x02,  0x00, 0x0E, 0x00, 0x96,  0x05, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x3E,  0x99, 0x02, 0x00, 0x09,  0x00, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x3E, 0x99, 0x02,  0x00, 0x09, 0x00, 0x96,  0x05, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x3E,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0xA6, 0x9B, 0x17,  0x00, 0x00, 0x03, 0x00,  0x75, 0x72, 0x6C, 0x00,  0x74, 0x61, 0x72, 0x67,
-  0x65, 0x74, 0x00, 0x6D,  0x65, 0x74, 0x68, 0x6F,  0x64, 0x00, 0x97, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x99, 0x1C, 0x44, 0x96,  0x02, 0x00, 0x08, 0x0A,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x08, 0x00, 0x96,
-  0x04, 0x00, 0x08, 0x99,  0x08, 0x52, 0x1D, 0x96,  0x04, 0x00, 0x08, 0xA7,  0x08, 0xA1, 0x1C, 0x96,
-  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xA0, 0x52,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,
-  0x9D, 0x02, 0x00, 0x3E,  0x00, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x15,  0x00, 0x96, 0x02, 0x00,  0x08, 0xA8, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x99,  0x1C, 0x9A, 0x01, 0x00,  0x02, 0x99, 0x02, 0x00,  0x10, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0xA8, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x99, 0x1C, 0x9A, 0x01,  0x00, 0x01, 0x99, 0x02,
-  0x00, 0x10, 0x00, 0x96,  0x02, 0x00, 0x08, 0xA8,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x99, 0x1C, 0x9A,
-  0x01, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0xA9, 0x9B, 0x10, 0x00,  0x00, 0x02, 0x00, 0x75,  0x72, 0x6C, 0x00, 0x6D,
-  0x65, 0x74, 0x68, 0x6F,  0x64, 0x00, 0x99, 0x00,  0x96, 0x04, 0x00, 0x08,  0xA7, 0x08, 0xA1, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xA0,
-  0x52, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x20, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,
-  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x4A,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0xA7, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x1B,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0xA8, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xAA, 0x4E, 0x9A,  0x01, 0x00, 0xC2, 0x99,  0x02, 0x00, 0x16, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0xA8, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xAA, 0x4E, 0x9A, 0x01,
-  0x00, 0xC1, 0x99, 0x02,  0x00, 0x16, 0x00, 0x96,  0x02, 0x00, 0x08, 0xA8,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xAA,  0x4E, 0x9A, 0x01, 0x00,  0xC0, 0x8B, 0x01, 0x00,
-  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x9D, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0xAB, 0x9B,  0x10, 0x00, 0x00, 0x02,  0x00, 0x75, 0x72, 0x6C,  0x00, 0x6D, 0x65, 0x74,
-  0x68, 0x6F, 0x64, 0x00,  0x99, 0x00, 0x96, 0x04,  0x00, 0x08, 0xA7, 0x08,  0xA1, 0x1C, 0x96, 0x07,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xA0, 0x52, 0x3C,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x20, 0x96,  0x02, 0x00, 0x08, 0xA7,  0x1C, 0x96, 0x05, 0x00,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,  0x00, 0x4A, 0x00, 0x96,  0x02, 0x00, 0x08, 0xA7,
-  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,  0x00, 0x1B, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0xA8,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xAA,
-  0x4E, 0x9A, 0x01, 0x00,  0x42, 0x99, 0x02, 0x00,  0x16, 0x00, 0x96, 0x02,  0x00, 0x08, 0xA8, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xAA, 0x4E,  0x9A, 0x01, 0x00, 0x41,
-  0x99, 0x02, 0x00, 0x16,  0x00, 0x96, 0x02, 0x00,  0x08, 0xA8, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xAA, 0x4E, 0x9A,  0x01, 0x00, 0x40, 0x8B,  0x01, 0x00, 0x00, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0xAC, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1D,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x20,
-  0x96, 0x04, 0x00, 0x08,  0x52, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xAA, 0x4E, 0x9A, 0x01,
-  0x00, 0x40, 0x8B, 0x01,  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xAD,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x12, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x9B,
-  0x40, 0x3E, 0x4F, 0x96,  0x09, 0x00, 0x07, 0x80,  0x00, 0x00, 0x00, 0x08,  0xAD, 0x08, 0x9D, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x09,  0x00, 0x08, 0xAE, 0x07,  0x84, 0x03, 0x00, 0x00,  0x08, 0x9D, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,
-  0x17, 0x96, 0x0E, 0x00,  0x07, 0xC8, 0x00, 0x00,  0x00, 0x08, 0xAF, 0x07,  0x84, 0x03, 0x00, 0x00,
-  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
-  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x0E, 0x00,  0x07, 0x2C, 0x01, 0x00,  0x00, 0x08, 0xB0, 0x07,
-  0x84, 0x03, 0x00, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
-  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x0E, 0x00,  0x07, 0x91, 0x01, 0x00,
-  0x00, 0x08, 0xB1, 0x07,  0x84, 0x03, 0x00, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x0E, 0x00,
-  0x07, 0xA1, 0x01, 0x00,  0x00, 0x08, 0xB2, 0x07,  0x84, 0x03, 0x00, 0x00,  0x08, 0x9D, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,
-  0x17, 0x96, 0x0E, 0x00,  0x07, 0xF4, 0x01, 0x00,  0x00, 0x08, 0xB3, 0x07,  0x84, 0x03, 0x00, 0x00,
-  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
-  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x09, 0x00,  0x08, 0xB4, 0x07, 0x85,  0x03, 0x00, 0x00, 0x08,
-  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
-  0x08, 0x02, 0x3D, 0x17,  0x96, 0x0E, 0x00, 0x07,  0x0C, 0x00, 0x00, 0x00,  0x08, 0xB5, 0x07, 0x85,
-  0x03, 0x00, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x13, 0x00, 0x08,  0xB6, 0x07, 0xC8, 0x00,  0x00, 0x00, 0x07, 0x68,
-  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x08, 0x00, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x02, 0x08, 0x9D, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
-  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x13,  0x00, 0x08, 0xB7, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x07, 0x70, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
-  0x3D, 0x1D, 0x96, 0x0E,  0x00, 0x07, 0x64, 0x00,  0x00, 0x00, 0x08, 0xB8,  0x07, 0x70, 0x00, 0x00,
-  0x00, 0x08, 0xB7, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
-  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0xB7, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x1B, 0x52, 0x17,  0x96, 0x08, 0x00, 0x07,  0x03, 0x04, 0x00, 0x00,  0x02, 0x08, 0xB7, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x13,  0x00, 0x08, 0xB9, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x68, 0x00, 0x00,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x1D, 0x96, 0x02,  0x00, 0x08, 0xB9, 0x1C,
-  0x96, 0x13, 0x00, 0x08,  0xBA, 0x07, 0xC9, 0x00,  0x00, 0x00, 0x07, 0x68,  0x00, 0x00, 0x00, 0x07,
-  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x0E, 0x00, 0x07,  0x64, 0x00, 0x00, 0x00,
-  0x08, 0xBB, 0x07, 0x68,  0x00, 0x00, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x83,  0x52, 0x17, 0x4F, 0x96,
+  0x08, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,  0x08, 0x69, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x76,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x69,  0x1C, 0x96, 0x27, 0x00,  0x08, 0x84, 0x08, 0x85,
+  0x08, 0x85, 0x08, 0x86,  0x08, 0x86, 0x08, 0x87,  0x08, 0x87, 0x08, 0x88,  0x08, 0x88, 0x08, 0x89,
+  0x08, 0x89, 0x08, 0x8A,  0x08, 0x8A, 0x08, 0x8B,  0x08, 0x8B, 0x08, 0x8C,  0x08, 0x8C, 0x07, 0x08,
+  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x69, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x84,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x10, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x1B, 0x52, 0x17, 0x96,  0x09, 0x00, 0x08, 0x8D,  0x07, 0x0D, 0x00, 0x00,  0x00, 0x08, 0x69, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x84, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,
+  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x07, 0x00,  0x00, 0x00, 0x02, 0x08,  0x69, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x84, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
+  0x96, 0x02, 0x00, 0x08,  0x8E, 0x9B, 0x0C, 0x00,  0x00, 0x01, 0x00, 0x74,  0x61, 0x72, 0x67, 0x65,
+  0x74, 0x00, 0x27, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x8F, 0x08,
+  0x8F, 0x1C, 0x4F, 0x96,  0x08, 0x00, 0x07, 0x07,  0x00, 0x00, 0x00, 0x02,  0x08, 0x0B, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x1D,  0x96, 0x09, 0x00, 0x08,
+  0x90, 0x07, 0xBC, 0x02,  0x00, 0x00, 0x08, 0x8E,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x08, 0x00, 0x07, 0x07,
+  0x00, 0x00, 0x00, 0x02,  0x08, 0x8E, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x13, 0x00,  0x08, 0x91, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07,  0x2B, 0x04, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x3A, 0x3D,
+  0x1D, 0x96, 0x0E, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x92, 0x07,  0x2B, 0x04, 0x00, 0x00,
+  0x08, 0x91, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x93, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1D, 0x96,  0x02, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x04, 0x00, 0x08, 0x94,  0x05, 0x01, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x04, 0x00, 0x08, 0x95,  0x05, 0x01, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x93,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x96,  0x9B, 0x0C, 0x00, 0x00,
+  0x01, 0x00, 0x6D, 0x65,  0x74, 0x68, 0x6F, 0x64,  0x00, 0x5B, 0x00, 0x96,  0x09, 0x00, 0x08, 0x99,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x97, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x98, 0x52, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0x99,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x9A, 0x49, 0x9D,  0x02, 0x00, 0x2D, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0x99, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x9B, 0x49,  0x9D, 0x02, 0x00, 0x0E,
+  0x00, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x3E, 0x99, 0x02,  0x00, 0x09, 0x00, 0x96,
+  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x3E,  0x99, 0x02, 0x00, 0x09,  0x00, 0x96, 0x05, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x9C,  0x9B, 0x17, 0x00, 0x00,  0x03, 0x00, 0x75, 0x72,
+  0x6C, 0x00, 0x74, 0x61,  0x72, 0x67, 0x65, 0x74,  0x00, 0x6D, 0x65, 0x74,  0x68, 0x6F, 0x64, 0x00,
+  0x97, 0x00, 0x96, 0x02,  0x00, 0x08, 0x8F, 0x1C,  0x44, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x49, 0x12,
+  0x9D, 0x02, 0x00, 0x08,  0x00, 0x96, 0x04, 0x00,  0x08, 0x8F, 0x08, 0x4A,  0x1D, 0x96, 0x04, 0x00,
+  0x08, 0x9D, 0x08, 0x97,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x96, 0x52, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,  0x00, 0x3E, 0x00, 0x96,  0x02, 0x00, 0x08, 0x9D,
+  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,  0x00, 0x15, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x9E,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x8F, 0x1C, 0x9A,  0x01, 0x00, 0x02, 0x99,
+  0x02, 0x00, 0x10, 0x00,  0x96, 0x02, 0x00, 0x08,  0x9E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x8F, 0x1C,
+  0x9A, 0x01, 0x00, 0x01,  0x99, 0x02, 0x00, 0x10,  0x00, 0x96, 0x02, 0x00,  0x08, 0x9E, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x8F,  0x1C, 0x9A, 0x01, 0x00,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x93, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x9F, 0x9B,  0x10, 0x00, 0x00, 0x02,
+  0x00, 0x75, 0x72, 0x6C,  0x00, 0x6D, 0x65, 0x74,  0x68, 0x6F, 0x64, 0x00,  0x99, 0x00, 0x96, 0x04,
+  0x00, 0x08, 0x9D, 0x08,  0x97, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x96, 0x52, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x20, 0x96,
+  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,
+  0x00, 0x4A, 0x00, 0x96,  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x49, 0x9D, 0x02,  0x00, 0x1B, 0x00, 0x96,  0x02, 0x00, 0x08, 0x9E,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xA0,  0x4E, 0x9A, 0x01, 0x00,  0xC2, 0x99, 0x02, 0x00,
+  0x16, 0x00, 0x96, 0x02,  0x00, 0x08, 0x9E, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xA0, 0x4E,  0x9A, 0x01, 0x00, 0xC1,  0x99, 0x02, 0x00, 0x16,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x9E, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xA0, 0x4E, 0x9A,
+  0x01, 0x00, 0xC0, 0x8B,  0x01, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x93, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0xA1, 0x9B, 0x10, 0x00,  0x00, 0x02, 0x00, 0x75,
+  0x72, 0x6C, 0x00, 0x6D,  0x65, 0x74, 0x68, 0x6F,  0x64, 0x00, 0x99, 0x00,  0x96, 0x04, 0x00, 0x08,
+  0x9D, 0x08, 0x97, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x96,  0x52, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x20, 0x96, 0x02, 0x00,
+  0x08, 0x9D, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x4A,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x49,
+  0x9D, 0x02, 0x00, 0x1B,  0x00, 0x96, 0x02, 0x00,  0x08, 0x9E, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xA0, 0x4E, 0x9A,  0x01, 0x00, 0x42, 0x99,  0x02, 0x00, 0x16, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0x9E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0xA0, 0x4E, 0x9A, 0x01,  0x00, 0x41, 0x99, 0x02,  0x00, 0x16, 0x00, 0x96,  0x02, 0x00, 0x08, 0x9E,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xA0,  0x4E, 0x9A, 0x01, 0x00,
+  0x40, 0x8B, 0x01, 0x00,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x93, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xA2, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x1D, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x20, 0x96, 0x04,  0x00, 0x08, 0x4A, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xA0, 0x4E,  0x9A, 0x01, 0x00, 0x40,  0x8B, 0x01, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x93, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xA3, 0x9B, 0x05,
+  0x00, 0x00, 0x00, 0x00,  0x12, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x08, 0x91, 0x40, 0x3E,  0x4F, 0x96, 0x09, 0x00,  0x07, 0x80, 0x00, 0x00,
+  0x00, 0x08, 0xA3, 0x08,  0x93, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
+  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x09, 0x00, 0x08,  0xA4, 0x07, 0x84, 0x03,
+  0x00, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0xC8,  0x00, 0x00, 0x00, 0x08,
+  0xA5, 0x07, 0x84, 0x03,  0x00, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0x2C,
+  0x01, 0x00, 0x00, 0x08,  0xA6, 0x07, 0x84, 0x03,  0x00, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,
+  0x0E, 0x00, 0x07, 0x91,  0x01, 0x00, 0x00, 0x08,  0xA7, 0x07, 0x84, 0x03,  0x00, 0x00, 0x08, 0x93,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,
+  0x03, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0xA1,  0x01, 0x00, 0x00, 0x08,  0xA8, 0x07, 0x84, 0x03,
+  0x00, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,
+  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x0E, 0x00, 0x07, 0xF4,  0x01, 0x00, 0x00, 0x08,
+  0xA9, 0x07, 0x84, 0x03,  0x00, 0x00, 0x08, 0x93,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x09, 0x00, 0x08, 0xAA,
+  0x07, 0x85, 0x03, 0x00,  0x00, 0x08, 0x93, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x0C, 0x00,
+  0x00, 0x00, 0x08, 0xAB,  0x07, 0x85, 0x03, 0x00,  0x00, 0x08, 0x93, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x02,
+  0x00, 0x08, 0x93, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x13,  0x00, 0x08, 0xAC, 0x07,
+  0xC8, 0x00, 0x00, 0x00,  0x07, 0x68, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x4F, 0x96, 0x08,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x02, 0x08,  0x93, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
+  0x96, 0x13, 0x00, 0x08,  0xAD, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x70,  0x00, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x1D,  0x96, 0x0E, 0x00, 0x07,  0x64, 0x00, 0x00, 0x00,
+  0x08, 0xAE, 0x07, 0x70,  0x00, 0x00, 0x00, 0x08,  0xAD, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
   0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,
-  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,  0x52, 0x17, 0x96, 0x08,  0x00, 0x07, 0x83, 0x00,
-  0x00, 0x00, 0x02, 0x08,  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x0E, 0x00, 0x07,  0x2C, 0x01, 0x00, 0x00,
-  0x08, 0xBC, 0x07, 0x68,  0x00, 0x00, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x0E, 0x00, 0x07,
-  0xC8, 0x00, 0x00, 0x00,  0x08, 0xBD, 0x07, 0x84,  0x03, 0x00, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,
-  0x96, 0x08, 0x00, 0x07,  0x83, 0x00, 0x00, 0x00,  0x02, 0x08, 0xB9, 0x1C,  0x96, 0x07, 0x00, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x13, 0x00, 0x08,  0xBE, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x6E,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x1D,
-  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x13,  0x00, 0x08, 0xBF, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x07, 0x71, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0xB9, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xBF, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0xC0, 0x9B, 0x07, 0x00,  0x00, 0x01, 0x00, 0x6F,  0x00, 0x67, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x44, 0x96, 0x02,  0x00, 0x08, 0xC1, 0x49,  0x12, 0x12, 0x9D, 0x02,
-  0x00, 0x05, 0x00, 0x96,  0x01, 0x00, 0x02, 0x3E,  0x96, 0x07, 0x00, 0x08,  0xC2, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x43, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x46, 0x87, 0x01,  0x00, 0x00, 0x96, 0x01,
-  0x00, 0x02, 0x49, 0x9D,  0x02, 0x00, 0x27, 0x00,  0x96, 0x04, 0x00, 0x08,  0xC3, 0x04, 0x00, 0x3C,
-  0x96, 0x02, 0x00, 0x08,  0xC2, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC3, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x1C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC3, 0x1C,  0x4E, 0x4F, 0x99, 0x02,  0x00, 0xCB, 0xFF, 0x96,
-  0x02, 0x00, 0x08, 0xC2,  0x1C, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xC4, 0x9B, 0x05,
-  0x00, 0x00, 0x00, 0x00,  0x36, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x08,
-  0xC5, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,
-  0x00, 0x08, 0xC6, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x4F, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC7, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0xB9, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xBF,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0xC8,  0x9B, 0x0A, 0x00, 0x00,  0x01, 0x00, 0x6E, 0x61,  0x6D, 0x65, 0x00, 0x25,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC5,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0E, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xC0,  0x52, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xC9, 0x9B, 0x10,
-  0x00, 0x00, 0x02, 0x00,  0x6E, 0x61, 0x6D, 0x65,  0x00, 0x73, 0x74, 0x79,  0x6C, 0x65, 0x00, 0x79,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC5,  0x4E, 0x12, 0x12, 0x9D,
-  0x02, 0x00, 0x12, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x08, 0xC5, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x43, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0xC5, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0E, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xCA, 0x1C, 0x96, 0x07,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC0, 0x52, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x0E, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xCB, 0x52, 0x17,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC7,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xB9,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0xCC, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x5B, 0x00, 0x96, 0x04,  0x00, 0x08, 0xCD, 0x08,
-  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC5, 0x4E,  0x3C, 0x96, 0x07, 0x00,  0x08, 0xCE, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x42,  0x3C, 0x96, 0x02, 0x00,  0x08, 0xCD, 0x46, 0x87,  0x01, 0x00, 0x00, 0x96,
-  0x01, 0x00, 0x02, 0x49,  0x9D, 0x02, 0x00, 0x25,  0x00, 0x96, 0x04, 0x00,  0x08, 0xC3, 0x04, 0x00,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0xC3, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0xCE, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x16, 0x52,  0x17, 0x99, 0x02, 0x00,  0xCD, 0xFF, 0x96, 0x02,
-  0x00, 0x08, 0xCE, 0x1C,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xB9, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0xBF, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0xCB, 0x9B, 0x0A, 0x00,
-  0x00, 0x01, 0x00, 0x6E,  0x61, 0x6D, 0x65, 0x00,  0x5C, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xC6, 0x4E, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x12,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x07, 0x00, 0x08, 0xC6,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0E,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC5,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0E, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xCF,  0x52, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xCF, 0x9B, 0x0B,
-  0x00, 0x00, 0x01, 0x00,  0x73, 0x74, 0x79, 0x6C,  0x65, 0x00, 0x9D, 0x03,  0x96, 0x02, 0x00, 0x08,
-  0xCA, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x05,  0x00, 0x96, 0x01, 0x00,
-  0x02, 0x3E, 0x96, 0x09,  0x00, 0x08, 0xD0, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0xBE, 0x40, 0x3C,
-  0x96, 0x02, 0x00, 0x08,  0xCA, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xD1, 0x4E,  0x12, 0x9D, 0x02, 0x00,
-  0x15, 0x00, 0x96, 0x02,  0x00, 0x08, 0xD0, 0x1C,  0x96, 0x04, 0x00, 0x08,  0xD2, 0x08, 0xCA, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xD1, 0x4E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xD3, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xD4,  0x49, 0x9D, 0x02, 0x00,  0x2B, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0xCA, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xD3, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xD5, 0x49,
-  0x12, 0x9D, 0x02, 0x00,  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0xD0, 0x1C,  0x96, 0x04, 0x00, 0x08,
-  0xD4, 0x05, 0x00, 0x4F,  0x99, 0x02, 0x00, 0x0E,  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,
-  0x04, 0x00, 0x08, 0xD4,  0x05, 0x01, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xD6, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x41,  0x00, 0x96, 0x04, 0x00,  0x08, 0xCD, 0x08, 0xCA,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD6, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xD7, 0x52,  0x3C, 0x96, 0x02, 0x00,  0x08, 0xCD, 0x1C, 0x96,
-  0x01, 0x00, 0x02, 0x49,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x0F, 0x00, 0x96,  0x02, 0x00, 0x08, 0xD0,
-  0x1C, 0x96, 0x04, 0x00,  0x08, 0xD6, 0x08, 0xCD,  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xD0, 0x1C,
-  0x96, 0x04, 0x00, 0x08,  0xD8, 0x08, 0xCA, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xD8, 0x4E, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD9, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x26,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xDA,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xD9,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xDB, 0x52, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xDC, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x20,  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,
-  0x04, 0x00, 0x08, 0xDD,  0x08, 0xCA, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xDC,  0x4E, 0x96, 0x07, 0x00,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xDE, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xDF,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xE0, 0x49, 0x9D,  0x02, 0x00, 0x2B, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0xCA, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xDF, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0xD5, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,  0xD0, 0x1C, 0x96, 0x04,
-  0x00, 0x08, 0xE0, 0x05,  0x00, 0x4F, 0x99, 0x02,  0x00, 0x0E, 0x00, 0x96,  0x02, 0x00, 0x08, 0xD0,
-  0x1C, 0x96, 0x04, 0x00,  0x08, 0xE0, 0x05, 0x01,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xE1,  0x4E, 0x96, 0x02, 0x00,  0x08, 0xE2, 0x49, 0x9D,  0x02, 0x00, 0x4F, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0xCA, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xE1, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0xE3, 0x49, 0x9D, 0x02,  0x00, 0x25, 0x00, 0x96,  0x02, 0x00, 0x08, 0xD0,  0x1C, 0x96, 0x04, 0x00,
-  0x08, 0xE1, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE1, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0xDE, 0x3D, 0x4F, 0x99,  0x02, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0xD0, 0x1C, 0x96, 0x04,  0x00, 0x08, 0xE1, 0x05,  0x00, 0x4F, 0x99, 0x02,  0x00, 0x0E, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0xD0,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xE1, 0x05, 0x01,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0xCA, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xE4,  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x20, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0xD0,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xE4, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xE4, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0xDE, 0x3D, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE5, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x20,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xE6,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xE5,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xDE, 0x3D,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xE7,  0x4E, 0x12, 0x9D, 0x02,
-  0x00, 0x20, 0x00, 0x96,  0x02, 0x00, 0x08, 0xD0,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xE7, 0x08, 0xCA,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE7, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0xDE, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xCA,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE8, 0x4E, 0x12,
-  0x9D, 0x02, 0x00, 0x20,  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xE9,
-  0x08, 0xCA, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xE8,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x08, 0xDE, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xEA,
-  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x3B, 0x00, 0x96,  0x04, 0x00, 0x08, 0xCD,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xEA,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xDE, 0x3D,
-  0x3C, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0xCD, 0x1C,  0x48, 0x12, 0x9D, 0x02,
-  0x00, 0x0F, 0x00, 0x96,  0x02, 0x00, 0x08, 0xD0,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xEB, 0x08, 0xCD,
-  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xCA, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xEC, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0xED, 0x49,  0x9D, 0x02, 0x00, 0x2B,  0x00, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xEC,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x3E, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x0E,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0xD0, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xED,  0x05, 0x00, 0x4F, 0x99,
-  0x02, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,  0xD0, 0x1C, 0x96, 0x04,  0x00, 0x08, 0xED, 0x05,
-  0x01, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xD0, 0x1C,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xB9, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xBF, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0xEE, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x63,  0x73, 0x73, 0x00, 0xDA,  0x00, 0x96, 0x04, 0x00,
-  0x08, 0xF1, 0x08, 0xEF,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xF0, 0x52, 0x3C, 0x96,  0x02, 0x00, 0x08, 0xF1,  0x1C, 0x44, 0x96, 0x02,
-  0x00, 0x08, 0xF2, 0x49,  0x12, 0x9D, 0x02, 0x00,  0x06, 0x00, 0x96, 0x02,  0x00, 0x05, 0x00, 0x3E,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC5, 0x4E,  0x12, 0x12, 0x9D, 0x02,
-  0x00, 0x12, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x07, 0x00,  0x08, 0xC5, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xF1, 0x46, 0x87,  0x01, 0x00, 0x00, 0x96,
-  0x01, 0x00, 0x02, 0x49,  0x9D, 0x02, 0x00, 0x56,  0x00, 0x96, 0x04, 0x00,  0x08, 0xC3, 0x04, 0x00,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC5,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0xC3, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xF1,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC3, 0x1C, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC0,
-  0x52, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xC3, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xCB,  0x52, 0x17, 0x99, 0x02,  0x00, 0x9C, 0xFF, 0x96,
-  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC7, 0x52,
-  0x17, 0x96, 0x02, 0x00,  0x05, 0x01, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0xBF, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0xF3, 0x08,
-  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xBF, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0xEE, 0x4E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xB9, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xBF,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x54,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x2D, 0x01,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x5A, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBF, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x5B, 0x9B, 0x09,  0x00, 0x00, 0x01, 0x00,  0x73, 0x72, 0x63, 0x00,
-  0x6B, 0x00, 0x96, 0x02,  0x00, 0x08, 0x5C, 0x1C,  0x96, 0x01, 0x00, 0x02,  0x49, 0x12, 0x9D, 0x02,
-  0x00, 0x19, 0x00, 0x96,  0x09, 0x00, 0x05, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x5A, 0x52, 0x17, 0x99,  0x02, 0x00, 0x41, 0x00,  0x96, 0x04, 0x00, 0x08,
-  0xF1, 0x08, 0x5C, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xF3,  0x52, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,
-  0x5D, 0x08, 0xF1, 0x1C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xF1, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x5A, 0x52,  0x17, 0x4F, 0x96, 0x0E,
-  0x00, 0x07, 0x64, 0x00,  0x00, 0x00, 0x08, 0xF4,  0x07, 0x71, 0x00, 0x00,  0x00, 0x08, 0xB9, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0xBF, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x04, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x07,  0x03, 0x04, 0x00, 0x00,
-  0x02, 0x08, 0xB9, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xBF, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x09, 0x00, 0x07,
-  0x03, 0x04, 0x00, 0x00,  0x08, 0xBF, 0x08, 0xB9,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0xF5, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1D, 0x96,  0x0E, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0xF6, 0x07, 0x9B, 0x02,
-  0x00, 0x00, 0x08, 0xF5,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,
-  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x08, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,
-  0x08, 0xF5, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x07, 0x00,  0x08, 0xF7, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,
-  0x1D, 0x96, 0x09, 0x00,  0x08, 0xF8, 0x07, 0xCF,  0x07, 0x00, 0x00, 0x08,  0xF7, 0x1C, 0x96, 0x07,
-  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x06, 0x00,
-  0x00, 0x00, 0x02, 0x08,  0xF7, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0xF9, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x1D,
-  0x96, 0x02, 0x00, 0x08,  0xF9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xA5, 0x9B,  0x0B, 0x00, 0x00, 0x01,
-  0x00, 0x69, 0x6E, 0x64,  0x65, 0x78, 0x00, 0x2A,  0x00, 0x96, 0x13, 0x00,  0x08, 0xFA, 0x07, 0xC8,
-  0x00, 0x00, 0x00, 0x07,  0x36, 0x08, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0xFB, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0xFA, 0x3D, 0x3E, 0x4F,  0x96, 0x12, 0x00, 0x02,  0x07, 0xC9, 0x00, 0x00,  0x00, 0x07, 0x36, 0x08,
-  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x96, 0x09,  0x00, 0x08, 0xCE, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x08, 0xF9, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x52, 0x17, 0x96, 0x09,
-  0x00, 0x08, 0xFC, 0x07,  0x36, 0x08, 0x00, 0x00,  0x08, 0xF9, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x08, 0x00,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x08, 0xF9,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
-  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0xFD,
-  0x9B, 0x0E, 0x00, 0x00,  0x01, 0x00, 0x63, 0x61,  0x6C, 0x6C, 0x62, 0x61,  0x63, 0x6B, 0x00, 0x5F,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xFE,  0x08, 0xFF, 0x1C, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x0A,  0x00, 0x09, 0x00, 0x01,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x64, 0x40,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x30, 0x00, 0x09, 0x01,
-  0x01, 0x09, 0x02, 0x01,  0x05, 0x01, 0x09, 0x03,  0x01, 0x05, 0x01, 0x09,  0x04, 0x01, 0x05, 0x01,
-  0x09, 0x05, 0x01, 0x05,  0x01, 0x09, 0x06, 0x01,  0x05, 0x01, 0x09, 0x07,  0x01, 0x05, 0x01, 0x09,
-  0x08, 0x01, 0x05, 0x01,  0x09, 0x09, 0x01, 0x05,  0x01, 0x07, 0x08, 0x00,  0x00, 0x00, 0x43, 0x4F,
-  0x1D, 0x96, 0x02, 0x00,  0x08, 0xFD, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x0A, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0xC8, 0x00, 0x96,  0x09, 0x00, 0x08, 0x1C,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0xFD, 0x40,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,
-  0x04, 0x00, 0x08, 0xFE,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xFE,  0x4E, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x0A, 0x00, 0x09,  0x00, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,
-  0x64, 0x40, 0x4F, 0x96,  0x07, 0x00, 0x08, 0x18,  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,
-  0x00, 0x08, 0x18, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x00, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,  0x12, 0x9D, 0x02, 0x00,  0x47, 0x00, 0x96, 0x07,
-  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x00, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x0A,  0x01, 0x52, 0x96, 0x07,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x00, 0x01, 0x4E,
+  0xAD, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x08, 0x10, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1B,  0x52, 0x17, 0x96, 0x08,  0x00, 0x07, 0x03, 0x04,
+  0x00, 0x00, 0x02, 0x08,  0xAD, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
+  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x13, 0x00, 0x08,  0xAF, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x68,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x1D,
+  0x96, 0x02, 0x00, 0x08,  0xAF, 0x1C, 0x96, 0x13,  0x00, 0x08, 0xB0, 0x07,  0xC9, 0x00, 0x00, 0x00,
+  0x07, 0x68, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x4F, 0x96, 0x0E,
+  0x00, 0x07, 0x64, 0x00,  0x00, 0x00, 0x08, 0xB1,  0x07, 0x68, 0x00, 0x00,  0x00, 0x08, 0xAF, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x02,
+  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0xAF, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1B, 0x52, 0x17,
+  0x96, 0x08, 0x00, 0x07,  0x83, 0x00, 0x00, 0x00,  0x02, 0x08, 0xAF, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x0E,
+  0x00, 0x07, 0x2C, 0x01,  0x00, 0x00, 0x08, 0xB2,  0x07, 0x68, 0x00, 0x00,  0x00, 0x08, 0xAF, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,
+  0x3D, 0x17, 0x96, 0x0E,  0x00, 0x07, 0xC8, 0x00,  0x00, 0x00, 0x08, 0xB3,  0x07, 0x84, 0x03, 0x00,
+  0x00, 0x08, 0xAF, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
+  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x83, 0x00,  0x00, 0x00, 0x02, 0x08,
+  0xAF, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,
+  0x00, 0x08, 0xAF, 0x1C,  0x96, 0x13, 0x00, 0x08,  0xB5, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x71,
+  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0xAF, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xB5, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0xB6, 0x9B,  0x07, 0x00, 0x00, 0x01,  0x00, 0x6F, 0x00, 0x67,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x1C, 0x1C, 0x44,  0x96, 0x02, 0x00, 0x08,  0xB7, 0x49, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x05,
+  0x00, 0x96, 0x01, 0x00,  0x02, 0x3E, 0x96, 0x07,  0x00, 0x08, 0xB8, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x43, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x46,  0x87, 0x01, 0x00, 0x00,  0x96, 0x01, 0x00, 0x02,
+  0x49, 0x9D, 0x02, 0x00,  0x27, 0x00, 0x96, 0x04,  0x00, 0x08, 0xB9, 0x04,  0x00, 0x3C, 0x96, 0x02,
+  0x00, 0x08, 0xB8, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x4E, 0x4F,  0x99, 0x02, 0x00, 0xCB,  0xFF, 0x96, 0x02, 0x00,
+  0x08, 0xB8, 0x1C, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xAF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB5,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xBA,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x36, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x08, 0xBB, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x43, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x08,
+  0xBC, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x4F,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xBD,  0x52, 0x17, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xAF,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xB5, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0xBE, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x6E, 0x61, 0x6D, 0x65,  0x00, 0x25, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBB, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0E,
+  0x1C, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xB6, 0x52, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xAF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB5,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xBF,  0x9B, 0x10, 0x00, 0x00,
+  0x02, 0x00, 0x6E, 0x61,  0x6D, 0x65, 0x00, 0x73,  0x74, 0x79, 0x6C, 0x65,  0x00, 0x79, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBB, 0x4E, 0x12,  0x12, 0x9D, 0x02, 0x00,
+  0x12, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x08,  0xBB, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xBB, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC0, 0x1C,  0x96, 0x07, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB6,  0x52, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0E, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0xC1,  0x52, 0x17, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBD, 0x52, 0x17,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xAF, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0xB5,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xC2,
+  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x5B, 0x00,  0x96, 0x04, 0x00, 0x08,  0xC3, 0x08, 0x0B, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xBB, 0x4E, 0x3C, 0x96,  0x07, 0x00, 0x08, 0xC4,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0x3C, 0x96,  0x02, 0x00, 0x08, 0xC3,  0x46, 0x87, 0x01, 0x00,  0x00, 0x96, 0x01, 0x00,
+  0x02, 0x49, 0x9D, 0x02,  0x00, 0x25, 0x00, 0x96,  0x04, 0x00, 0x08, 0xB9,  0x04, 0x00, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xC4, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x16, 0x52, 0x17, 0x99,  0x02, 0x00, 0xCD, 0xFF,  0x96, 0x02, 0x00, 0x08,
+  0xC4, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0xAF, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xB5, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xC1, 0x9B,  0x0A, 0x00, 0x00, 0x01,
+  0x00, 0x6E, 0x61, 0x6D,  0x65, 0x00, 0x5C, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xBC, 0x4E,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x12, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x07, 0x00,  0x08, 0xBC, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xBC,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0E, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBB, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0E,
+  0x1C, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xC5, 0x52, 0x4F,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xAF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB5,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xC5,  0x9B, 0x0B, 0x00, 0x00,
+  0x01, 0x00, 0x73, 0x74,  0x79, 0x6C, 0x65, 0x00,  0x9D, 0x03, 0x96, 0x02,  0x00, 0x08, 0xC0, 0x1C,
+  0x96, 0x01, 0x00, 0x02,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x05, 0x00, 0x96,  0x01, 0x00, 0x02, 0x3E,
+  0x96, 0x09, 0x00, 0x08,  0xC6, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0xB4,  0x40, 0x3C, 0x96, 0x02,
+  0x00, 0x08, 0xC0, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xC7, 0x4E, 0x12, 0x9D,  0x02, 0x00, 0x15, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0xC6, 0x1C, 0x96, 0x04,  0x00, 0x08, 0xC8, 0x08,  0xC0, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xC7, 0x4E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xC9,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0xCA, 0x49, 0x9D,  0x02, 0x00, 0x2B, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0xC0, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC9, 0x4E,  0x96, 0x02, 0x00, 0x08,  0xCB, 0x49, 0x12, 0x9D,
+  0x02, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,  0xC6, 0x1C, 0x96, 0x04,  0x00, 0x08, 0xCA, 0x05,
+  0x00, 0x4F, 0x99, 0x02,  0x00, 0x0E, 0x00, 0x96,  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,
+  0x08, 0xCA, 0x05, 0x01,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xCC,
+  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x41, 0x00, 0x96,  0x04, 0x00, 0x08, 0xC3,  0x08, 0xC0, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0xCC,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xCD, 0x52, 0x3C, 0x96,  0x02, 0x00, 0x08, 0xC3,  0x1C, 0x96, 0x01, 0x00,
+  0x02, 0x49, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x0F,  0x00, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x1C, 0x96,
+  0x04, 0x00, 0x08, 0xCC,  0x08, 0xC3, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0xC6, 0x1C, 0x96, 0x04,
+  0x00, 0x08, 0xCE, 0x08,  0xC0, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xCE, 0x4E,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xCF,  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x26, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xD0, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xCF, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xD1, 0x52,  0x4F, 0x96, 0x02, 0x00,  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xD2,
+  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x20, 0x00, 0x96,  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,
+  0x08, 0xD3, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD2, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0xD4, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xD5, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xD6,  0x49, 0x9D, 0x02, 0x00,  0x2B, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0xC0, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xD5, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xCB, 0x49,
+  0x12, 0x9D, 0x02, 0x00,  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0xC6, 0x1C,  0x96, 0x04, 0x00, 0x08,
+  0xD6, 0x05, 0x00, 0x4F,  0x99, 0x02, 0x00, 0x0E,  0x00, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x1C, 0x96,
+  0x04, 0x00, 0x08, 0xD6,  0x05, 0x01, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xD7, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xD8,  0x49, 0x9D, 0x02, 0x00,  0x4F, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0xC0, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xD7, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xD9, 0x49,
+  0x9D, 0x02, 0x00, 0x25,  0x00, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xD7,
+  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xD7,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0xD4, 0x3D,  0x4F, 0x99, 0x02, 0x00,  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0xC6, 0x1C,
+  0x96, 0x04, 0x00, 0x08,  0xD7, 0x05, 0x00, 0x4F,  0x99, 0x02, 0x00, 0x0E,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0xC6, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xD7,  0x05, 0x01, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xC0,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xDA, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x20,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0xC6, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xDA,  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xDA,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xD4, 0x3D,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xDB,  0x4E, 0x12, 0x9D, 0x02,  0x00, 0x20, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xDC, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xDB, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0xD4, 0x3D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xDD, 0x4E, 0x12,  0x9D, 0x02, 0x00, 0x20,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xDD,  0x08, 0xC0, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0xDD,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xD4, 0x3D,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0xC0, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xDE,  0x4E, 0x12, 0x9D, 0x02,
+  0x00, 0x20, 0x00, 0x96,  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xDF, 0x08, 0xC0,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xDE, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0xD4, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE0, 0x4E, 0x12,
+  0x9D, 0x02, 0x00, 0x3B,  0x00, 0x96, 0x04, 0x00,  0x08, 0xC3, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xE0, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0xD4, 0x3D, 0x3C, 0x96,
+  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0xC3, 0x1C, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x0F,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0xC6, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xE1,  0x08, 0xC3, 0x1C, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0xC0, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xE2, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0xE3, 0x49, 0x9D, 0x02,  0x00, 0x2B, 0x00, 0x96,  0x02, 0x00, 0x08, 0xC0,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xE2, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x3E,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x0E, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0xC6,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xE3, 0x05, 0x00,  0x4F, 0x99, 0x02, 0x00,
+  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0xC6, 0x1C,  0x96, 0x04, 0x00, 0x08,  0xE3, 0x05, 0x01, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0xC6, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0xAF, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xB5, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0xE4, 0x9B,
+  0x09, 0x00, 0x00, 0x01,  0x00, 0x63, 0x73, 0x73,  0x00, 0xDA, 0x00, 0x96,  0x04, 0x00, 0x08, 0xE7,
+  0x08, 0xE5, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xE6, 0x52,  0x3C, 0x96, 0x02, 0x00,  0x08, 0xE7, 0x1C, 0x44,  0x96, 0x02, 0x00, 0x08,
+  0xE8, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x06, 0x00,  0x96, 0x02, 0x00, 0x05,  0x00, 0x3E, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xBB, 0x4E, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x12,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x07, 0x00, 0x08, 0xBB,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xE7,  0x46, 0x87, 0x01, 0x00,  0x00, 0x96, 0x01, 0x00,
+  0x02, 0x49, 0x9D, 0x02,  0x00, 0x56, 0x00, 0x96,  0x04, 0x00, 0x08, 0xB9,  0x04, 0x00, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xBB, 0x4E, 0x96,  0x02, 0x00, 0x08, 0xB9,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xE7, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB9,  0x1C, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xB6, 0x52, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC1, 0x52, 0x17,  0x99, 0x02, 0x00, 0x9C,  0xFF, 0x96, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xBD, 0x52, 0x17, 0x96,
+  0x02, 0x00, 0x05, 0x01,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xAF, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0xB5, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x04, 0x00, 0x08,  0xE9, 0x08, 0xAF, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xB5, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0xE4, 0x4E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xAF,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xB5, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x13, 0x00,  0x08, 0x4C, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,
+  0x2D, 0x01, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0xAF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB5,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x50,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0xAF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xB5,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x51,  0x9B, 0x09, 0x00, 0x00,  0x01, 0x00, 0x73, 0x72,  0x63, 0x00, 0x6B, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0x52, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x19,
+  0x00, 0x96, 0x09, 0x00,  0x05, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x50, 0x52,  0x17, 0x99, 0x02, 0x00,  0x41, 0x00, 0x96, 0x04,  0x00, 0x08, 0xE7, 0x08,
+  0x52, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xE9, 0x52, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x53, 0x08,
+  0xE7, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0xE7,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x50, 0x52, 0x17, 0x4F,  0x96, 0x0E, 0x00, 0x07,
+  0x64, 0x00, 0x00, 0x00,  0x08, 0xEA, 0x07, 0x71,  0x00, 0x00, 0x00, 0x08,  0xAF, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xB5, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
+  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x03, 0x04,  0x00, 0x00, 0x02, 0x08,
+  0xAF, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xB5, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x09,  0x00, 0x07, 0x03, 0x04,
+  0x00, 0x00, 0x08, 0xB5,  0x08, 0xAF, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0xEB,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
+  0x1D, 0x96, 0x0E, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xEC, 0x07,  0x9B, 0x02, 0x00, 0x00,
+  0x08, 0xEB, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x08, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x08, 0xEB,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x17, 0x96,  0x07, 0x00, 0x08, 0xED,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x1D, 0x96,
+  0x09, 0x00, 0x08, 0xEE,  0x07, 0xCF, 0x07, 0x00,  0x00, 0x08, 0xED, 0x1C,  0x96, 0x07, 0x00, 0x07,
+  0x03, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x07,  0x06, 0x00, 0x00, 0x00,
+  0x02, 0x08, 0xED, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
+  0x96, 0x02, 0x00, 0x08,  0xEF, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x00,  0x00, 0x1D, 0x96, 0x02,
+  0x00, 0x08, 0xEF, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x9B, 0x9B, 0x0B, 0x00,  0x00, 0x01, 0x00, 0x69,
+  0x6E, 0x64, 0x65, 0x78,  0x00, 0x2A, 0x00, 0x96,  0x13, 0x00, 0x08, 0xF0,  0x07, 0xC8, 0x00, 0x00,
+  0x00, 0x07, 0x36, 0x08,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0xF1,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0xF0, 0x3D,
+  0x3E, 0x4F, 0x96, 0x12,  0x00, 0x02, 0x07, 0xC9,  0x00, 0x00, 0x00, 0x07,  0x36, 0x08, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x96, 0x09, 0x00, 0x08,  0xC4, 0x07, 0x03, 0x00,
+  0x00, 0x00, 0x08, 0xEF,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x52, 0x17,  0x96, 0x09, 0x00, 0x08,
+  0xF2, 0x07, 0x36, 0x08,  0x00, 0x00, 0x08, 0xEF,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x08, 0x00, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x02,  0x08, 0xEF, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0xF3, 0x9B, 0x0E,
+  0x00, 0x00, 0x01, 0x00,  0x63, 0x61, 0x6C, 0x6C,  0x62, 0x61, 0x63, 0x6B,  0x00, 0x55, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x04, 0x00,  0x08, 0xF4, 0x08, 0xF5,  0x1C, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x09, 0x00, 0x08,  0xF6, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x5A,
+  0x40, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x27, 0x00, 0x08,  0xF7, 0x08, 0xF8, 0x05,
+  0x01, 0x08, 0xF9, 0x05,  0x01, 0x08, 0xFA, 0x05,  0x01, 0x08, 0xFB, 0x05,  0x01, 0x08, 0xFC, 0x05,
+  0x01, 0x08, 0xFD, 0x05,  0x01, 0x08, 0xFE, 0x05,  0x01, 0x08, 0xFF, 0x05,  0x01, 0x07, 0x08, 0x00,
+  0x00, 0x00, 0x43, 0x4F,  0x1D, 0x96, 0x02, 0x00,  0x08, 0xF3, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x00, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0xC2, 0x00, 0x96,
+  0x09, 0x00, 0x08, 0x1C,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0xF3, 0x40,  0x3C, 0x96, 0x02, 0x00,
+  0x08, 0x1C, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xF4,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xF4,
+  0x4E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x09, 0x00, 0x08,  0xF6, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x5A,  0x40, 0x4F, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0xF6, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x19,  0x4E, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x45, 0x00,
+  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xF6,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x00, 0x01, 0x52, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xF6, 0x4E,
   0x96, 0x02, 0x00, 0x08,  0x16, 0x52, 0x17, 0x96,  0x02, 0x00, 0x08, 0x18,  0x4C, 0x1C, 0x50, 0x1D,
-  0x99, 0x02, 0x00, 0x99,  0xFF, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x01,
-  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x01, 0x01, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x1C, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0xFD, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x0B, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x3B, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x30, 0x00, 0x09,  0x01, 0x01, 0x09, 0x02,  0x01, 0x05, 0x00, 0x09,
-  0x03, 0x01, 0x05, 0x00,  0x09, 0x04, 0x01, 0x05,  0x00, 0x09, 0x05, 0x01,  0x05, 0x00, 0x09, 0x06,
-  0x01, 0x05, 0x00, 0x09,  0x07, 0x01, 0x05, 0x00,  0x09, 0x08, 0x01, 0x05,  0x00, 0x09, 0x09, 0x01,
-  0x05, 0x00, 0x07, 0x08,  0x00, 0x00, 0x00, 0x43,  0x4F, 0x4F, 0x96, 0x08,  0x00, 0x07, 0x03, 0x04,
-  0x00, 0x00, 0x02, 0x08,  0xFD, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x03, 0x00, 0x09,  0x0C, 0x01, 0x9B, 0x36,
-  0x00, 0x00, 0x05, 0x00,  0x63, 0x61, 0x70, 0x74,  0x69, 0x6F, 0x6E, 0x00,  0x63, 0x61, 0x6C, 0x6C,
-  0x62, 0x61, 0x63, 0x6B,  0x00, 0x73, 0x65, 0x70,  0x61, 0x72, 0x61, 0x74,  0x6F, 0x72, 0x42, 0x65,
-  0x66, 0x6F, 0x72, 0x65,  0x00, 0x65, 0x6E, 0x61,  0x62, 0x6C, 0x65, 0x64,  0x00, 0x76, 0x69, 0x73,
-  0x69, 0x62, 0x6C, 0x65,  0x00, 0xBE, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,
-  0x09, 0x0D, 0x01, 0x09,  0x0D, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,
-  0x00, 0x08, 0xFE, 0x08,  0xFF, 0x1C, 0x4F, 0x96,  0x03, 0x00, 0x09, 0x0E,  0x01, 0x1C, 0x96, 0x01,
-  0x00, 0x03, 0x49, 0x9D,  0x02, 0x00, 0x16, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,
-  0x00, 0x09, 0x0E, 0x01,  0x09, 0x0E, 0x01, 0x1C,  0x4F, 0x99, 0x02, 0x00,  0x0F, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,  0x0E, 0x01, 0x05, 0x00,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x9F, 0x1C, 0x96,  0x01, 0x00, 0x03, 0x49,  0x9D, 0x02, 0x00, 0x14,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0x9F,  0x08, 0x9F, 0x1C, 0x4F,  0x99, 0x02, 0x00, 0x0E,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0x9F,  0x05, 0x01, 0x4F, 0x96,
-  0x03, 0x00, 0x09, 0x0F,  0x01, 0x1C, 0x96, 0x01,  0x00, 0x03, 0x49, 0x9D,  0x02, 0x00, 0x16, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x0F, 0x01,  0x09, 0x0F, 0x01, 0x1C,
-  0x4F, 0x99, 0x02, 0x00,  0x0F, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,
-  0x0F, 0x01, 0x05, 0x01,  0x4F, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x0C, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x0A,  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x85,
-  0x00, 0x96, 0x0A, 0x00,  0x08, 0x1C, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,  0x0C, 0x01, 0x40, 0x3C,
-  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x0D, 0x01,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x0D,  0x01, 0x4E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x04, 0x00,
-  0x08, 0xFE, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xFE, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x1C, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x0E, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x0E,
-  0x01, 0x4E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x04, 0x00,  0x08, 0x9F, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x9F, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x05,
-  0x00, 0x09, 0x0F, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x0F,  0x01, 0x4E, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x3E, 0x4F, 0x96,  0x09, 0x00, 0x07, 0x03,  0x04, 0x00, 0x00, 0x02,
-  0x09, 0x0C, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
-  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x08, 0x00, 0x09,
-  0x10, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x10,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x11, 0x01,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x3E, 0x00,  0x96, 0x14, 0x00, 0x09,  0x12, 0x01, 0x07, 0xC8,  0x00, 0x00, 0x00, 0x07,
-  0x9C, 0x08, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x3C, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x08, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0x12, 0x01, 0x3D, 0x17,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x08, 0x15, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x42, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x10, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x11, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x10, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x1B, 0x52, 0x17, 0x96,
-  0x0A, 0x00, 0x09, 0x13,  0x01, 0x07, 0x9C, 0x08,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x10, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x11, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x08, 0x00,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x10, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x11, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x10,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x14, 0x01,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x27, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x0A,  0x00, 0x09, 0x15, 0x01,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x64, 0x40,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x07, 0x00, 0x08, 0x15,  0x07, 0x00, 0x00, 0x00,  0x00, 0x42, 0x4F, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x10, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x14, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1B, 0x52, 0x17,  0x96, 0x0A, 0x00, 0x09,  0x16, 0x01, 0x07, 0x9D,
-  0x08, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x10, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x14, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
-  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x02, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x10, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x14, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x03,  0x00, 0x09, 0x17, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
-  0x1D, 0x96, 0x0B, 0x00,  0x09, 0x18, 0x01, 0x07,  0x98, 0x08, 0x00, 0x00,  0x09, 0x17, 0x01, 0x1C,
+  0x99, 0x02, 0x00, 0x9C,  0xFF, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xF7,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xF7,  0x4E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x1C,
+  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0xF3, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x01, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x32, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x27,  0x00, 0x08, 0xF7, 0x08,  0xF8, 0x05, 0x00, 0x08,  0xF9, 0x05, 0x00, 0x08,
+  0xFA, 0x05, 0x00, 0x08,  0xFB, 0x05, 0x00, 0x08,  0xFC, 0x05, 0x00, 0x08,  0xFD, 0x05, 0x00, 0x08,
+  0xFE, 0x05, 0x00, 0x08,  0xFF, 0x05, 0x00, 0x07,  0x08, 0x00, 0x00, 0x00,  0x43, 0x4F, 0x4F, 0x96,
+  0x08, 0x00, 0x07, 0x03,  0x04, 0x00, 0x00, 0x02,  0x08, 0xF3, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x03, 0x00,
+  0x09, 0x02, 0x01, 0x9B,  0x36, 0x00, 0x00, 0x05,  0x00, 0x63, 0x61, 0x70,  0x74, 0x69, 0x6F, 0x6E,
+  0x00, 0x63, 0x61, 0x6C,  0x6C, 0x62, 0x61, 0x63,  0x6B, 0x00, 0x73, 0x65,  0x70, 0x61, 0x72, 0x61,
+  0x74, 0x6F, 0x72, 0x42,  0x65, 0x66, 0x6F, 0x72,  0x65, 0x00, 0x65, 0x6E,  0x61, 0x62, 0x6C, 0x65,
+  0x64, 0x00, 0x76, 0x69,  0x73, 0x69, 0x62, 0x6C,  0x65, 0x00, 0xBE, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x03, 0x01,  0x09, 0x03, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0xF4,  0x08, 0xF5, 0x1C, 0x4F,  0x96, 0x03, 0x00, 0x09,
+  0x04, 0x01, 0x1C, 0x96,  0x01, 0x00, 0x03, 0x49,  0x9D, 0x02, 0x00, 0x16,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x04,  0x01, 0x09, 0x04, 0x01,  0x1C, 0x4F, 0x99, 0x02,
+  0x00, 0x0F, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x09, 0x04, 0x01, 0x05,
+  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x95, 0x1C,  0x96, 0x01, 0x00, 0x03,  0x49, 0x9D, 0x02, 0x00,
+  0x14, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,  0x95, 0x08, 0x95, 0x1C,
+  0x4F, 0x99, 0x02, 0x00,  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,
+  0x95, 0x05, 0x01, 0x4F,  0x96, 0x03, 0x00, 0x09,  0x05, 0x01, 0x1C, 0x96,  0x01, 0x00, 0x03, 0x49,
+  0x9D, 0x02, 0x00, 0x16,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x05,
+  0x01, 0x09, 0x05, 0x01,  0x1C, 0x4F, 0x99, 0x02,  0x00, 0x0F, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x05, 0x00,  0x09, 0x05, 0x01, 0x05,  0x01, 0x4F, 0x1D, 0x96,  0x03, 0x00, 0x09, 0x02,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x00, 0x01, 0x9B, 0x05,
+  0x00, 0x00, 0x00, 0x00,  0x85, 0x00, 0x96, 0x0A,  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x09, 0x02, 0x01, 0x40,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x03,
+  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x03, 0x01, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x1C, 0x1C, 0x96, 0x04,  0x00, 0x08, 0xF4, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xF4, 0x4E,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x04,  0x01, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x04, 0x01, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x04,
+  0x00, 0x08, 0x95, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x95, 0x4E,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x1C, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x05,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x05, 0x01, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x3E, 0x4F,  0x96, 0x09, 0x00, 0x07,
+  0x03, 0x04, 0x00, 0x00,  0x02, 0x09, 0x02, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x08, 0x00,  0x09, 0x06, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x06, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x07,
+  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x3E,  0x00, 0x96, 0x14, 0x00,  0x09, 0x08, 0x01, 0x07,
+  0xC8, 0x00, 0x00, 0x00,  0x07, 0x9C, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x09, 0x08, 0x01, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x07, 0x00, 0x08, 0x15,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x42, 0x4F, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x06, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x07, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x10,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x1B, 0x52, 0x17,  0x96, 0x0A, 0x00, 0x09,  0x09, 0x01, 0x07, 0x9C,  0x08, 0x00, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x06, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x07, 0x01, 0x4E,
   0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,
-  0x3D, 0x17, 0x96, 0x09,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x02, 0x09,  0x17, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,
-  0x17, 0x96, 0x03, 0x00,  0x09, 0x19, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x1D,
-  0x96, 0x03, 0x00, 0x09,  0x19, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xA5,  0x9B, 0x0B, 0x00, 0x00,
-  0x01, 0x00, 0x69, 0x6E,  0x64, 0x65, 0x78, 0x00,  0x2A, 0x00, 0x96, 0x13,  0x00, 0x08, 0xFA, 0x07,
-  0xC8, 0x00, 0x00, 0x00,  0x07, 0x38, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
-  0x3D, 0x3C, 0x96, 0x02,  0x00, 0x08, 0xFB, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0xFA, 0x3D, 0x3E,  0x4F, 0x96, 0x12, 0x00,  0x02, 0x07, 0xC9, 0x00,  0x00, 0x00, 0x07, 0x38,
-  0x08, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x96,  0x0A, 0x00, 0x08, 0xCE,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x09, 0x19, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x52, 0x17,
-  0x96, 0x0B, 0x00, 0x09,  0x1A, 0x01, 0x07, 0x38,  0x08, 0x00, 0x00, 0x09,  0x19, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,
-  0x17, 0x96, 0x09, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x09, 0x19,  0x01, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
-  0x96, 0x14, 0x00, 0x09,  0x1B, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x6F, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x3A, 0x3D,  0x1D, 0x96, 0x10, 0x00,  0x07, 0x64, 0x00, 0x00,
-  0x00, 0x09, 0x1C, 0x01,  0x07, 0x6F, 0x00, 0x00,  0x00, 0x09, 0x1B, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,
-  0x09, 0x00, 0x07, 0x03,  0x04, 0x00, 0x00, 0x02,  0x09, 0x1B, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x08,
-  0x00, 0x09, 0x1D, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x1D, 0x96,  0x0B, 0x00, 0x09, 0x1E,
-  0x01, 0x07, 0x58, 0x02,  0x00, 0x00, 0x09, 0x1D,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
-  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x03,  0x00, 0x09, 0x1D, 0x01,  0x1C, 0x96, 0x07, 0x00,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x10, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x1B, 0x52, 0x17, 0x96,
-  0x09, 0x00, 0x07, 0x07,  0x00, 0x00, 0x00, 0x02,  0x09, 0x1D, 0x01, 0x1C,  0x96, 0x07, 0x00, 0x07,
+  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x02, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x06, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x07, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x06, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x0A,
+  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x27,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x0A, 0x00, 0x09, 0x0B,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x5A,  0x40, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x08,  0x15, 0x07, 0x00, 0x00,  0x00, 0x00, 0x42, 0x4F,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x06,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x0A, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0x10, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1B, 0x52,  0x17, 0x96, 0x0A, 0x00,
+  0x09, 0x0C, 0x01, 0x07,  0x9D, 0x08, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x06,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x0A, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x08, 0x00, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x02,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x06,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x0A, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x03, 0x00, 0x09, 0x0D,  0x01, 0x9B, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00,  0x00, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x0D, 0x01,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x9B, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,  0x69, 0x6E, 0x64, 0x65,  0x78, 0x00, 0x2A, 0x00,
+  0x96, 0x13, 0x00, 0x08,  0xF0, 0x07, 0xC8, 0x00,  0x00, 0x00, 0x07, 0x38,  0x08, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x3C,  0x96, 0x02, 0x00, 0x08,  0xF1, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0xF0,  0x3D, 0x3E, 0x4F, 0x96,  0x12, 0x00, 0x02, 0x07,
+  0xC9, 0x00, 0x00, 0x00,  0x07, 0x38, 0x08, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x96, 0x0A, 0x00,  0x08, 0xC4, 0x07, 0x03,  0x00, 0x00, 0x00, 0x09,  0x0D, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x07,  0x52, 0x17, 0x96, 0x0B,  0x00, 0x09, 0x0E, 0x01,  0x07, 0x38, 0x08, 0x00,
+  0x00, 0x09, 0x0D, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,  0x09, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,
+  0x09, 0x0D, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,
+  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x14,  0x00, 0x09, 0x0F, 0x01,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x6F, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x3A, 0x3D, 0x1D, 0x96,
+  0x10, 0x00, 0x07, 0x64,  0x00, 0x00, 0x00, 0x09,  0x10, 0x01, 0x07, 0x6F,  0x00, 0x00, 0x00, 0x09,
+  0x0F, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x09, 0x00,  0x07, 0x03, 0x04, 0x00,  0x00, 0x02, 0x09, 0x0F,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x09,  0x11, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,
+  0x1D, 0x96, 0x0B, 0x00,  0x09, 0x12, 0x01, 0x07,  0x58, 0x02, 0x00, 0x00,  0x09, 0x11, 0x01, 0x1C,
+  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x03, 0x00, 0x09,
+  0x11, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x10, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x1B, 0x52,  0x17, 0x96, 0x09, 0x00,  0x07, 0x07, 0x00, 0x00,  0x00, 0x02, 0x09, 0x11,
+  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x08, 0x00, 0x09,  0x13, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x13,  0x01, 0x4E, 0x96, 0x14,
+  0x00, 0x09, 0x14, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x66, 0x08,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x3A, 0x3D, 0x4F, 0x96,  0x0F, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,
+  0x15, 0x01, 0x07, 0x66,  0x08, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x13, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x14, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
+  0x08, 0x02, 0x3D, 0x17,  0x96, 0x0F, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x09, 0x16, 0x01, 0x07,
+  0x66, 0x08, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x13,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x14, 0x01,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,
+  0x17, 0x96, 0x0F, 0x00,  0x07, 0x0A, 0x00, 0x00,  0x00, 0x09, 0x17, 0x01,  0x07, 0x66, 0x08, 0x00,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x13, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x14,
+  0x01, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x05,
+  0x00, 0x09, 0x18, 0x01,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x13,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x14, 0x01,  0x4E, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x19, 0x01,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,  0x1D, 0x96, 0x03, 0x00,  0x09, 0x19, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x51, 0x9B,  0x09, 0x00, 0x00, 0x01,  0x00, 0x73, 0x72, 0x63,
+  0x00, 0x24, 0x00, 0x96,  0x02, 0x00, 0x08, 0x52,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0x49, 0x40,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1A,  0x01, 0x52, 0x17, 0x4F,  0x96, 0x0B, 0x00, 0x09,  0x1B, 0x01, 0x07, 0x90,
+  0x01, 0x00, 0x00, 0x09,  0x19, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x09, 0x00,  0x07, 0x03, 0x00, 0x00,
+  0x00, 0x02, 0x09, 0x19,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
   0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x08,
-  0x00, 0x09, 0x1F, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x14, 0x00, 0x09,  0x20, 0x01, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x07,  0x66, 0x08, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x3A, 0x3D,
-  0x4F, 0x96, 0x0F, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0x21, 0x01,  0x07, 0x66, 0x08, 0x00,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x20,
-  0x01, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x0F,
-  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x09, 0x22,  0x01, 0x07, 0x66, 0x08,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x20, 0x01, 0x4E, 0x96,
-  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x0A,
-  0x00, 0x00, 0x00, 0x09,  0x23, 0x01, 0x07, 0x66,  0x08, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x20, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x05, 0x00, 0x09,  0x24, 0x01, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x20, 0x01, 0x4E, 0x1D,
-  0x96, 0x03, 0x00, 0x09,  0x25, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x1D, 0x96,
-  0x03, 0x00, 0x09, 0x25,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x5B, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x73,  0x72, 0x63, 0x00, 0x24,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x5C, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x51, 0x40, 0x96, 0x07,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x26, 0x01, 0x52,
-  0x17, 0x4F, 0x96, 0x0B,  0x00, 0x09, 0x27, 0x01,  0x07, 0x90, 0x01, 0x00,  0x00, 0x09, 0x25, 0x01,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
-  0x02, 0x3D, 0x17, 0x96,  0x09, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,  0x09, 0x25, 0x01, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,
-  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x08, 0x00, 0x09,  0x28, 0x01, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x29, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x76, 0x00,
-  0x96, 0x03, 0x00, 0x09,  0x2A, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,  0x4E, 0x96, 0x05, 0x00,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,  0x00, 0x38, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x05, 0x00,  0x08, 0x13, 0x09, 0x2A,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x2B, 0x01,
-  0x09, 0x2A, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x4E, 0x4F, 0x99, 0x02,
-  0x00, 0x23, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x07, 0x00,  0x08, 0x13, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x08,  0x00, 0x09, 0x2B, 0x01,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x29, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2C,
-  0x01, 0x9B, 0x09, 0x00,  0x00, 0x02, 0x00, 0x61,  0x00, 0x62, 0x00, 0x20,  0x00, 0x96, 0x03, 0x00,
-  0x09, 0x2D, 0x01, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x6C, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x2E,  0x01, 0x52, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x3E, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x2F, 0x01,  0x9B, 0x0F, 0x00, 0x00,  0x03, 0x00, 0x61, 0x00,
-  0x62, 0x00, 0x76, 0x61,  0x6C, 0x75, 0x65, 0x00,  0x7B, 0x00, 0x96, 0x03,  0x00, 0x09, 0x2D, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x67, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x6C, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2D,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x0B, 0x0C, 0x47,  0x96, 0x03, 0x00, 0x09,
-  0x2D, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x6C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2D,
-  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x0B, 0x0C, 0x47, 0x96,  0x07, 0x00, 0x07, 0x02,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x29, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x30, 0x01,
-  0x9B, 0x12, 0x00, 0x00,  0x02, 0x00, 0x6C, 0x65,  0x6E, 0x67, 0x74, 0x68,  0x00, 0x61, 0x6E, 0x67,
-  0x6C, 0x65, 0x00, 0x5C,  0x00, 0x96, 0x02, 0x00,  0x08, 0x19, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x32,
-  0x01, 0x1C, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0x31,  0x01, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x34, 0x01,  0x52, 0x0C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x32, 0x01, 0x1C, 0x96,  0x08, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0x31, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x33,  0x01, 0x52, 0x0C, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x53,
-  0x3E, 0x4F, 0x96, 0x01,  0x00, 0x02, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x49, 0x00, 0x96, 0x02,
+  0x00, 0x09, 0x1C, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x1D, 0x01, 0x9B, 0x05,
+  0x00, 0x00, 0x00, 0x00,  0x76, 0x00, 0x96, 0x03,  0x00, 0x09, 0x1E, 0x01,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x19, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x38,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x05, 0x00, 0x08, 0x13,  0x09, 0x1E, 0x01, 0x1C,
+  0x96, 0x05, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x4E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x06, 0x00, 0x09,  0x1F, 0x01, 0x09, 0x1E,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x4E, 0x4F,  0x99, 0x02, 0x00, 0x23,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x07, 0x00, 0x08, 0x13,  0x07, 0x00, 0x00, 0x00,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x08, 0x00, 0x09,  0x1F, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x4F,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x1D, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x20, 0x01, 0x9B,  0x09, 0x00, 0x00, 0x02,  0x00, 0x61, 0x00, 0x62,
+  0x00, 0x20, 0x00, 0x96,  0x03, 0x00, 0x09, 0x21,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x62,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x22, 0x01, 0x52,  0x96, 0x02, 0x00, 0x08,
+  0x19, 0x4E, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x23, 0x01, 0x9B, 0x0F,
+  0x00, 0x00, 0x03, 0x00,  0x61, 0x00, 0x62, 0x00,  0x76, 0x61, 0x6C, 0x75,  0x65, 0x00, 0x7B, 0x00,
+  0x96, 0x03, 0x00, 0x09,  0x21, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x5D, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x62, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x21, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x0B,
+  0x0C, 0x47, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x5D,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x62, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x21, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0B, 0x0C,
+  0x47, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1D,  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x24, 0x01, 0x9B, 0x12,  0x00, 0x00, 0x02, 0x00,  0x6C, 0x65, 0x6E, 0x67,
+  0x74, 0x68, 0x00, 0x61,  0x6E, 0x67, 0x6C, 0x65,  0x00, 0x5C, 0x00, 0x96,  0x02, 0x00, 0x08, 0x19,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x26, 0x01, 0x1C,  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x09, 0x25, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x52, 0x0C,  0x96, 0x02, 0x00, 0x08,
+  0x19, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x26, 0x01,  0x1C, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0x25, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x27, 0x01, 0x52,  0x0C, 0x96, 0x07, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x1D,  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x01, 0x00, 0x02,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x0C, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x0C,  0x47, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0x25, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x52,  0x3E, 0x96, 0x09, 0x00,
+  0x08, 0x19, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x07, 0x52,  0x17, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x1D, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x2A,  0x01, 0x9B, 0x0B, 0x00,  0x00, 0x01, 0x00, 0x6F,  0x74, 0x68, 0x65, 0x72,
+  0x00, 0x50, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x47, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x47, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1D,
+  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x2C, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x33, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1D,  0x01, 0x53, 0x3E, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x1D, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x2D, 0x01,
+  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x6F, 0x74,  0x68, 0x65, 0x72, 0x00,  0x68, 0x00, 0x96, 0x03,
+  0x00, 0x09, 0x2B, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x1D, 0x01,  0x4E, 0x54, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x06,
+  0x00, 0x96, 0x02, 0x00,  0x05, 0x00, 0x3E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x13, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x49, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x1D, 0x00,  0x17, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1F, 0x01, 0x4E,  0x49, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x1D, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x2E, 0x01, 0x9B,  0x0C, 0x00, 0x00, 0x01,  0x00, 0x6C, 0x65, 0x6E,
+  0x67, 0x74, 0x68, 0x00,  0x71, 0x00, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x05, 0x00, 0x96,
+  0x01, 0x00, 0x03, 0x3E,  0x96, 0x05, 0x00, 0x09,  0x2F, 0x01, 0x08, 0x19,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,  0x4E, 0x0D, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x04, 0x00,  0x08, 0x13, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x2F,  0x01, 0x1C, 0x0C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x05,
+  0x00, 0x09, 0x1F, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x2F, 0x01,  0x1C, 0x0C, 0x4F, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x22, 0x01,  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x6F, 0x74,
+  0x68, 0x65, 0x72, 0x00,  0x50, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4E, 0x0B, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x2B, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x0B,  0x96, 0x07, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x1D, 0x01,  0x53, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x1D, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x30, 0x01, 0x9B,  0x09, 0x00, 0x00, 0x02,  0x00, 0x78, 0x00, 0x79,
+  0x00, 0x39, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x13, 0x1C, 0x47, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4D, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x1C, 0x47,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4D, 0x4F,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x1D, 0x01,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0F,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x2D, 0x00,  0x96, 0x05, 0x00, 0x09,  0x31, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x13, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x32, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x33, 0x01, 0x47,
+  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x9B, 0x16, 0x00,  0x00, 0x04, 0x00, 0x78,  0x00, 0x79, 0x00, 0x77,
+  0x69, 0x64, 0x74, 0x68,  0x00, 0x68, 0x65, 0x69,  0x67, 0x68, 0x74, 0x00,  0x75, 0x00, 0x96, 0x03,
+  0x00, 0x09, 0x1E, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x49,  0x9D, 0x02, 0x00, 0x47,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x04, 0x00, 0x08, 0x13,  0x08, 0x13, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,
+  0x00, 0x09, 0x1F, 0x01,  0x09, 0x1F, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x06, 0x00, 0x09, 0x36,  0x01, 0x09, 0x36, 0x01,  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x06, 0x00, 0x09,  0x37, 0x01, 0x09, 0x37,  0x01, 0x1C, 0x4F, 0x99,  0x02, 0x00, 0x13, 0x00,
+  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x35,
+  0x01, 0x52, 0x17, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x34, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x2C, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x4D, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x36,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x34, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x57,
+  0x00, 0x96, 0x05, 0x00,  0x09, 0x31, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x47, 0x96, 0x03, 0x00,  0x09, 0x32, 0x01, 0x47,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x38, 0x01,  0x47, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x36,  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x39,
+  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4E, 0x47,
+  0x96, 0x03, 0x00, 0x09,  0x33, 0x01, 0x47, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2D,  0x01, 0x9B, 0x0A, 0x00,  0x00, 0x01, 0x00, 0x72,
+  0x65, 0x63, 0x74, 0x00,  0xAB, 0x00, 0x96, 0x03,  0x00, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,
+  0x4E, 0x54, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x1B,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x13, 0x4E, 0x49,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x1D, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x3A, 0x01, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x49,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x1D, 0x00, 0x17,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x36, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x36, 0x01, 0x4E, 0x49,  0x4C, 0x12, 0x9D, 0x02,
+  0x00, 0x1D, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4E, 0x49,
+  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x3B, 0x01, 0x9B, 0x09,  0x00, 0x00, 0x02, 0x00,  0x78, 0x00, 0x79, 0x00,  0x87, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0x13, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x48, 0x12, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x17,  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x48, 0x12,
+  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x22, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,  0x13, 0x1C, 0x96, 0x02,
   0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x0C, 0x47, 0x96,  0x08, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0x31, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x35,  0x01, 0x52, 0x3E, 0x96,  0x09, 0x00, 0x08, 0x19,  0x07, 0x03, 0x00, 0x00,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x07, 0x52, 0x17, 0x96,
-  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x29, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x9B,
-  0x0B, 0x00, 0x00, 0x01,  0x00, 0x6F, 0x74, 0x68,  0x65, 0x72, 0x00, 0x50,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x13, 0x4E, 0x47, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x38, 0x01, 0x9B, 0x05,
-  0x00, 0x00, 0x00, 0x00,  0x33, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x2B, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
-  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,  0x01, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x39, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,
-  0x6F, 0x74, 0x68, 0x65,  0x72, 0x00, 0x68, 0x00,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x29, 0x01, 0x4E, 0x54,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x06, 0x00, 0x96,  0x02, 0x00, 0x05, 0x00,
-  0x3E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x49, 0x4C,  0x12, 0x9D, 0x02, 0x00,
-  0x1D, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x37,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x49, 0x3E,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x29, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x3A,
-  0x01, 0x9B, 0x0C, 0x00,  0x00, 0x01, 0x00, 0x6C,  0x65, 0x6E, 0x67, 0x74,  0x68, 0x00, 0x71, 0x00,
-  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,
-  0x4E, 0x48, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x05,  0x00, 0x96, 0x01, 0x00,  0x03, 0x3E, 0x96, 0x05,
-  0x00, 0x09, 0x3B, 0x01,  0x08, 0x19, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x19, 0x4E, 0x0D,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x04, 0x00, 0x08, 0x13,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x3B, 0x01, 0x1C,
-  0x0C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,  0x2B, 0x01, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x3B, 0x01, 0x1C, 0x0C,
-  0x4F, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x29,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x2E, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,  0x6F, 0x74, 0x68, 0x65,  0x72, 0x00, 0x50, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x0B,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x13,  0x4E, 0x0B, 0x96, 0x07,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x29, 0x01, 0x53, 0x3E,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x29, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x3C,
-  0x01, 0x9B, 0x09, 0x00,  0x00, 0x02, 0x00, 0x78,  0x00, 0x79, 0x00, 0x39,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x13, 0x1C,
-  0x47, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,
-  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x1C, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x2B, 0x01,  0x4D, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x29, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0F, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x2D, 0x00, 0x96, 0x05,
-  0x00, 0x09, 0x3D, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x3E, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,
-  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x3F,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x9B,
-  0x16, 0x00, 0x00, 0x04,  0x00, 0x78, 0x00, 0x79,  0x00, 0x77, 0x69, 0x64,  0x74, 0x68, 0x00, 0x68,
-  0x65, 0x69, 0x67, 0x68,  0x74, 0x00, 0x75, 0x00,  0x96, 0x03, 0x00, 0x09,  0x2A, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x19,  0x4E, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x9D, 0x02,
-  0x00, 0x47, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x04, 0x00,  0x08, 0x13, 0x08, 0x13,
-  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x2B, 0x01, 0x09, 0x2B,
-  0x01, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x42, 0x01, 0x09,
-  0x42, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x43, 0x01,
-  0x09, 0x43, 0x01, 0x1C,  0x4F, 0x99, 0x02, 0x00,  0x13, 0x00, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x41, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x40,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x38, 0x01, 0x9B, 0x05,
-  0x00, 0x00, 0x00, 0x00,  0x4D, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x43, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x40,
-  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0F, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x57, 0x00, 0x96,  0x05, 0x00, 0x09, 0x3D,
-  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x3E,
-  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x47,
-  0x96, 0x03, 0x00, 0x09,  0x44, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x42, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x45, 0x01, 0x47,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x3F, 0x01,
-  0x47, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x39, 0x01, 0x9B,  0x0A, 0x00, 0x00, 0x01,  0x00, 0x72, 0x65, 0x63,  0x74, 0x00, 0xAB, 0x00,
-  0x96, 0x03, 0x00, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x54,  0x4C, 0x12, 0x9D, 0x02,
-  0x00, 0x1B, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x49, 0x4C, 0x12,
-  0x9D, 0x02, 0x00, 0x1D,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x2B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x46,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x49, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x1D,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x42, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x46,  0x01, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x42, 0x01,  0x4E, 0x49, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x1D,  0x00, 0x17, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x46,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x49, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x47, 0x01,  0x9B, 0x09, 0x00, 0x00,
-  0x02, 0x00, 0x78, 0x00,  0x79, 0x00, 0x87, 0x00,  0x96, 0x02, 0x00, 0x08,  0x13, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x48, 0x12,  0x4C, 0x12, 0x9D, 0x02,
-  0x00, 0x17, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x48, 0x12, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x22,
-  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x13, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x42, 0x01,
-  0x4E, 0x47, 0x48, 0x4C,  0x12, 0x9D, 0x02, 0x00,  0x24, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x2B,
-  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x4E,  0x47, 0x48, 0x3E, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x40, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x48, 0x01,
-  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x70, 0x6F,  0x69, 0x6E, 0x74, 0x00,  0xA3, 0x00, 0x96, 0x03,
-  0x00, 0x09, 0x49, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x48,  0x12, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x1E, 0x00,
-  0x17, 0x96, 0x03, 0x00,  0x09, 0x49, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x48, 0x12, 0x4C, 0x12,
-  0x9D, 0x02, 0x00, 0x29,  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x49, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x13, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4E,  0x47, 0x48, 0x4C, 0x12,
-  0x9D, 0x02, 0x00, 0x2B,  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x49, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x4E, 0x47, 0x48,
-  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x40,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x4A, 0x01, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x72, 0x65, 0x63, 0x74,  0x00, 0x63, 0x01, 0x96,
-  0x05, 0x00, 0x09, 0x4B,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x42, 0x01, 0x4E, 0x47,  0x3C, 0x96, 0x05, 0x00,
-  0x09, 0x4C, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x4E, 0x47, 0x3C,  0x96, 0x06, 0x00, 0x09,
-  0x4D, 0x01, 0x09, 0x46,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x46, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x42,  0x01, 0x4E, 0x47, 0x3C,  0x96, 0x06, 0x00, 0x09,
-  0x4E, 0x01, 0x09, 0x46,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x47,  0x3C, 0x96, 0x03, 0x00,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x48, 0x12,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x16, 0x00, 0x17,
-  0x96, 0x03, 0x00, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x4B, 0x01, 0x1C,  0x48, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x1E, 0x00,  0x17, 0x96, 0x03, 0x00,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x48, 0x12, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x17,
-  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x46, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x4C, 0x01, 0x1C, 0x48,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x15, 0x00, 0x17,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x4D, 0x01, 0x1C, 0x48,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x11, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,
-  0x4B, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x4D,  0x01, 0x1C, 0x48, 0x12,  0x4C, 0x12, 0x9D, 0x02,
-  0x00, 0x16, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x4E, 0x01, 0x1C,  0x48, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x11, 0x00,
-  0x17, 0x96, 0x03, 0x00,  0x09, 0x4C, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4E, 0x01, 0x1C, 0x48,
-  0x12, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x4F, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x30, 0x00, 0x96,  0x07, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x42, 0x01,  0x4E, 0x48, 0x12, 0x4C,
-  0x9D, 0x02, 0x00, 0x15,  0x00, 0x17, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x4E,  0x48, 0x12, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x41, 0x01,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x47, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x08, 0x13, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x08, 0x00, 0x09, 0x2B,
-  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x08, 0x00,
-  0x09, 0x42, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x08, 0x00, 0x09, 0x43,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x50, 0x01,  0x9B, 0x0A, 0x00, 0x00,
-  0x01, 0x00, 0x72, 0x65,  0x63, 0x74, 0x00, 0xF4,  0x01, 0x96, 0x0A, 0x00,  0x09, 0x51, 0x01, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x40, 0x01,  0x53, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x4F, 0x01, 0x52,  0x4C, 0x9D, 0x02, 0x00,  0x14, 0x00, 0x17, 0x96,
-  0x08, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x4F,
-  0x01, 0x52, 0x12, 0x9D,  0x02, 0x00, 0x1C, 0x00,  0x96, 0x08, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x09, 0x51, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x41, 0x01, 0x52, 0x17,  0x96, 0x03, 0x00, 0x09,
-  0x51, 0x01, 0x1C, 0x3E,  0x96, 0x03, 0x00, 0x09,  0x51, 0x01, 0x1C, 0x96,  0x05, 0x00, 0x08, 0x13,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x08,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x09, 0x31,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x52, 0x01,  0x52, 0x4F, 0x96, 0x03,  0x00, 0x09, 0x51, 0x01,
-  0x1C, 0x96, 0x06, 0x00,  0x09, 0x2B, 0x01, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,
-  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,  0x31, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x52,
-  0x01, 0x52, 0x4F, 0x96,  0x03, 0x00, 0x09, 0x51,  0x01, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x42, 0x01,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x46, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4E,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x42,
-  0x01, 0x4E, 0x47, 0x96,  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,  0x31, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x53,  0x01, 0x52, 0x96, 0x03,  0x00, 0x09, 0x51, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x13, 0x4E, 0x0B,  0x4F, 0x96, 0x03, 0x00,  0x09, 0x51, 0x01, 0x1C,  0x96, 0x06, 0x00, 0x09,
-  0x43, 0x01, 0x09, 0x46,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x47,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x43,  0x01, 0x4E, 0x47, 0x96,  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,
-  0x31, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x53,  0x01, 0x52, 0x96, 0x03,  0x00, 0x09, 0x51, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x0B, 0x4F, 0x96, 0x08,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x51,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x42, 0x01,  0x4E, 0x48, 0x12, 0x4C,
-  0x9D, 0x02, 0x00, 0x16,  0x00, 0x17, 0x96, 0x08,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x09, 0x51,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x48, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x14,
-  0x00, 0x96, 0x08, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x09, 0x51, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x41, 0x01, 0x52,  0x17, 0x96, 0x03, 0x00,  0x09, 0x51, 0x01, 0x1C,  0x3E, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x40,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x54, 0x01, 0x9B, 0x0A,
-  0x00, 0x00, 0x01, 0x00,  0x72, 0x65, 0x63, 0x74,  0x00, 0x27, 0x00, 0x96,  0x08, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x50, 0x01,  0x52, 0x96, 0x03, 0x00,  0x09, 0x4F, 0x01, 0x52,
-  0x12, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x55, 0x01, 0x9B,  0x0A, 0x00, 0x00, 0x01,  0x00, 0x72, 0x65, 0x63,  0x74, 0x00, 0xB3, 0x01,
-  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x4F,
-  0x01, 0x52, 0x12, 0x9D,  0x02, 0x00, 0x14, 0x00,  0x96, 0x08, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x38, 0x01, 0x52, 0x3E,  0x96, 0x08, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4F, 0x01, 0x52, 0x12,
-  0x9D, 0x02, 0x00, 0x13,  0x00, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x38, 0x01, 0x52, 0x3E,  0x96, 0x0A, 0x00, 0x09,  0x55, 0x01, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x40, 0x01, 0x53,  0x3C, 0x96, 0x03, 0x00,  0x09, 0x55, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x08,
-  0x13, 0x09, 0x46, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,
-  0x31, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x53,  0x01, 0x52, 0x4F, 0x96,  0x03, 0x00, 0x09, 0x55,
-  0x01, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x2B, 0x01,  0x09, 0x46, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x2B, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,
-  0x96, 0x08, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x09, 0x31, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x53, 0x01, 0x52, 0x4F,  0x96, 0x03, 0x00, 0x09,  0x55, 0x01, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x42,
-  0x01, 0x09, 0x46, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x46,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x42, 0x01,  0x4E, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x42, 0x01, 0x4E, 0x47,  0x96, 0x08, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x09, 0x31, 0x01, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x52, 0x01, 0x52, 0x96,  0x03, 0x00, 0x09, 0x55,  0x01, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x0B, 0x4F, 0x96, 0x03,  0x00, 0x09, 0x55, 0x01,  0x1C, 0x96, 0x06, 0x00,
-  0x09, 0x43, 0x01, 0x09,  0x46, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x46, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x4E,  0x47, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x47,  0x96, 0x08, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
-  0x09, 0x31, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x52, 0x01, 0x52, 0x96,  0x03, 0x00, 0x09, 0x55,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x0B, 0x4F, 0x96,  0x03, 0x00, 0x09, 0x55,
-  0x01, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x3C, 0x01,  0x9B, 0x0B, 0x00, 0x00,  0x02, 0x00, 0x64, 0x78,  0x00, 0x64, 0x79, 0x00,
-  0x3A, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x56,  0x01, 0x1C, 0x47, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4D, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x57, 0x01, 0x1C, 0x47,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4D, 0x4F,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x40, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x58,  0x01, 0x9B, 0x07, 0x00,
-  0x00, 0x01, 0x00, 0x64,  0x00, 0x47, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x59, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
-  0x4E, 0x47, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,
-  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x59,  0x01, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4D, 0x4F, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x40, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x5A, 0x01, 0x9B,
-  0x0B, 0x00, 0x00, 0x02,  0x00, 0x64, 0x78, 0x00,  0x64, 0x79, 0x00, 0x82,  0x00, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x56, 0x01,
-  0x1C, 0x0B, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,
-  0x96, 0x03, 0x00, 0x09,  0x42, 0x01, 0x4E, 0x96,  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,
-  0x56, 0x01, 0x1C, 0x0C,  0x47, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4D,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x57,
-  0x01, 0x1C, 0x0B, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x96, 0x08, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x09, 0x57, 0x01,  0x1C, 0x0C, 0x47, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x4D, 0x4F, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x40, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x5B, 0x01,
-  0x9B, 0x07, 0x00, 0x00,  0x01, 0x00, 0x64, 0x00,  0x9C, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x4C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x59,  0x01, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x0B, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x42,  0x01, 0x4E, 0x96, 0x08,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x09, 0x59,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x0C, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x42, 0x01,  0x4D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,
-  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x59, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,
-  0x01, 0x4E, 0x0B, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x96, 0x08, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x09, 0x59, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x0C, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x43, 0x01,  0x4D, 0x4F, 0x4F, 0x9B,  0x0A, 0x00, 0x00, 0x01,  0x00, 0x6C, 0x65, 0x66,
-  0x74, 0x00, 0x3B, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x42,
-  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x5C, 0x01,  0x1C, 0x0B, 0x47, 0x96,  0x03, 0x00, 0x09, 0x42,  0x01, 0x4D, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x08, 0x13, 0x09, 0x5C,  0x01, 0x1C, 0x4F, 0x9B,
-  0x05, 0x00, 0x00, 0x00,  0x00, 0x0D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x13, 0x4E, 0x3E,  0x96, 0x0A, 0x00, 0x09,  0x5C, 0x01, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x07, 0x52,  0x17, 0x9B, 0x0B, 0x00,
-  0x00, 0x01, 0x00, 0x72,  0x69, 0x67, 0x68, 0x74,  0x00, 0x1E, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x06, 0x00,  0x09, 0x42, 0x01, 0x09,  0x5D, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x0B,  0x4F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1B,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x42,  0x01, 0x4E, 0x47, 0x3E,  0x96, 0x0A, 0x00, 0x09,
-  0x5D, 0x01, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x07, 0x52,  0x17, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x74,  0x6F, 0x70, 0x00, 0x3D,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x5E, 0x01, 0x1C, 0x0B,  0x47, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x4D,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x2B,  0x01, 0x09, 0x5E, 0x01,  0x1C, 0x4F, 0x9B, 0x05,
-  0x00, 0x00, 0x00, 0x00,  0x0E, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x2B, 0x01, 0x4E, 0x3E,  0x96, 0x0A, 0x00, 0x09,  0x5E, 0x01, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x40, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x07, 0x52,  0x17, 0x9B, 0x0C, 0x00,
-  0x00, 0x01, 0x00, 0x62,  0x6F, 0x74, 0x74, 0x6F,  0x6D, 0x00, 0x1F, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x43, 0x01,  0x09, 0x5F, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x0B, 0x4F, 0x9B,  0x05, 0x00, 0x00, 0x00,
-  0x00, 0x1C, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x43, 0x01,  0x4E, 0x47, 0x3E, 0x96,
-  0x0A, 0x00, 0x09, 0x5F,  0x01, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x07, 0x52, 0x17,  0x9B, 0x0D, 0x00, 0x00,  0x01, 0x00, 0x74, 0x6F,
-  0x70, 0x4C, 0x65, 0x66,  0x74, 0x00, 0x92, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,
-  0x03, 0x00, 0x09, 0x42,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x60, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x0B,
-  0x47, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,
-  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x2B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x60, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,
-  0x01, 0x4E, 0x0B, 0x47,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x08, 0x13, 0x09,  0x60, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
-  0x4E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x2B, 0x01, 0x09, 0x60,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x4F, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x02,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x29, 0x01, 0x53,  0x3E, 0x96, 0x0A, 0x00,  0x09, 0x60, 0x01, 0x07,  0x03, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x40, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x07,  0x52, 0x17, 0x9B, 0x11,
-  0x00, 0x00, 0x01, 0x00,  0x62, 0x6F, 0x74, 0x74,  0x6F, 0x6D, 0x52, 0x69,  0x67, 0x68, 0x74, 0x00,
-  0x4A, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x42, 0x01, 0x09, 0x61,
-  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x0B, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,
-  0x43, 0x01, 0x09, 0x61,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x0B, 0x4F,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x4F, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x4E, 0x47, 0x96,
+  0x96, 0x03, 0x00, 0x09,  0x36, 0x01, 0x4E, 0x47,  0x48, 0x4C, 0x12, 0x9D,  0x02, 0x00, 0x24, 0x00,
+  0x17, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x37,
+  0x01, 0x4E, 0x47, 0x48,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x3C, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,  0x70, 0x6F, 0x69, 0x6E,
+  0x74, 0x00, 0xA3, 0x00,  0x96, 0x03, 0x00, 0x09,  0x3D, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x48, 0x12, 0x4C,
+  0x12, 0x9D, 0x02, 0x00,  0x1E, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x3D,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,
+  0x01, 0x4E, 0x48, 0x12,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x29, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,
+  0x3D, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x36,
+  0x01, 0x4E, 0x47, 0x48,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x2B, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,
+  0x3D, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x37, 0x01, 0x4E,  0x47, 0x48, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x34, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x3E, 0x01,  0x9B, 0x0A, 0x00, 0x00,  0x01, 0x00, 0x72, 0x65,
+  0x63, 0x74, 0x00, 0x63,  0x01, 0x96, 0x05, 0x00,  0x09, 0x3F, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x13, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x36, 0x01,
+  0x4E, 0x47, 0x3C, 0x96,  0x05, 0x00, 0x09, 0x40,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x4E,
+  0x47, 0x3C, 0x96, 0x06,  0x00, 0x09, 0x41, 0x01,  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,
+  0x47, 0x3C, 0x96, 0x06,  0x00, 0x09, 0x42, 0x01,  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
+  0x4E, 0x47, 0x3C, 0x96,  0x03, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x48, 0x12, 0x4C, 0x12,
+  0x9D, 0x02, 0x00, 0x16,  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x13, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x3F,  0x01, 0x1C, 0x48, 0x4C,  0x12, 0x9D, 0x02, 0x00,
+  0x1E, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x48, 0x12,
+  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x17, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,  0x3A, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x40, 0x01,  0x1C, 0x48, 0x4C, 0x12,
+  0x9D, 0x02, 0x00, 0x15,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x41, 0x01,  0x1C, 0x48, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x11,
+  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x3F, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x41, 0x01, 0x1C,
+  0x48, 0x12, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x16,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x42,  0x01, 0x1C, 0x48, 0x4C,
+  0x12, 0x9D, 0x02, 0x00,  0x11, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x40,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x42, 0x01,  0x1C, 0x48, 0x12, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x30,
+  0x00, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x36, 0x01, 0x4E, 0x48,  0x12, 0x4C, 0x9D, 0x02,  0x00, 0x15, 0x00, 0x17,  0x96, 0x07, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x37,  0x01, 0x4E, 0x48, 0x12,
+  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x35, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x47, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x07, 0x00, 0x08,  0x13, 0x07, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x08, 0x00,  0x09, 0x1F, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x08, 0x00, 0x09, 0x36,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x08, 0x00,  0x09, 0x37, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x4F, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x44, 0x01, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x72, 0x65, 0x63, 0x74,  0x00, 0xF4, 0x01, 0x96,
+  0x0A, 0x00, 0x09, 0x45,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x34, 0x01, 0x53, 0x3C,  0x96, 0x07, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x43,  0x01, 0x52, 0x4C, 0x9D,
+  0x02, 0x00, 0x14, 0x00,  0x17, 0x96, 0x08, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x09, 0x3A, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x52,  0x12, 0x9D, 0x02, 0x00,  0x1C, 0x00, 0x96, 0x08,
+  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x09, 0x45,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x35, 0x01,
+  0x52, 0x17, 0x96, 0x03,  0x00, 0x09, 0x45, 0x01,  0x1C, 0x3E, 0x96, 0x03,  0x00, 0x09, 0x45, 0x01,
+  0x1C, 0x96, 0x05, 0x00,  0x08, 0x13, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x08, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x09, 0x25, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x46, 0x01, 0x52, 0x4F,
+  0x96, 0x03, 0x00, 0x09,  0x45, 0x01, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x1F,  0x01, 0x09, 0x3A, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x08, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x09, 0x25, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x46, 0x01, 0x52,  0x4F, 0x96, 0x03, 0x00,  0x09, 0x45, 0x01, 0x1C,
+  0x96, 0x06, 0x00, 0x09,  0x36, 0x01, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x3A, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x36,  0x01, 0x4E, 0x47, 0x96,
   0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4E,  0x47, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x29,
-  0x01, 0x53, 0x3E, 0x96,  0x0A, 0x00, 0x09, 0x61,  0x01, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x40, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x07, 0x52, 0x17,  0x9B, 0x0A, 0x00, 0x00,
-  0x01, 0x00, 0x73, 0x69,  0x7A, 0x65, 0x00, 0x2D,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x05, 0x00, 0x09, 0x42,  0x01, 0x08, 0xEB, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x09, 0x43, 0x01, 0x08,  0xEB, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x4F, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x34, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x42, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x29, 0x01,
-  0x53, 0x3E, 0x96, 0x09,  0x00, 0x08, 0xEB, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x40, 0x01,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x07,  0x52, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x62,  0x01, 0x9B, 0x19, 0x00,
-  0x00, 0x06, 0x00, 0x70,  0x61, 0x00, 0x70, 0x62,  0x00, 0x70, 0x63, 0x00,  0x70, 0x64, 0x00, 0x70,
-  0x74, 0x78, 0x00, 0x70,  0x74, 0x79, 0x00, 0x90,  0x00, 0x96, 0x03, 0x00,  0x09, 0x2A, 0x01, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x12, 0x9D,  0x02, 0x00, 0x6A, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x08, 0x6C, 0x09,  0x64, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x2D, 0x01,  0x09, 0x65, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x12,  0x01, 0x09, 0x66, 0x01,  0x1C, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x59, 0x01, 0x09, 0x67,  0x01, 0x1C, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x68, 0x01, 0x09,  0x69, 0x01, 0x1C, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x6A, 0x01,  0x09, 0x6B, 0x01, 0x1C,
-  0x4F, 0x99, 0x02, 0x00,  0x13, 0x00, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x63, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x62,  0x01, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x38, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,
-  0x67, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x6A, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x68, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x59, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x12,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x2D, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x6C, 0x4E, 0x96,
-  0x07, 0x00, 0x07, 0x06,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x62, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x62,  0x01, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x6C, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,
-  0x6F, 0x74, 0x68, 0x65,  0x72, 0x00, 0x9E, 0x02,  0x96, 0x04, 0x00, 0x08,  0x6C, 0x08, 0x0B, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x6C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x6C, 0x4E, 0x0C,  0x3C, 0x96, 0x05, 0x00,  0x09, 0x59, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x59, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x59, 0x01, 0x4E, 0x0C,  0x3C, 0x96, 0x08, 0x00,  0x09, 0x2D, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x3C, 0x96, 0x08, 0x00,  0x09, 0x12, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x3C, 0x96, 0x05, 0x00,
-  0x09, 0x68, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x68, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x37, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x6C, 0x4E, 0x0C, 0x96,  0x03, 0x00, 0x09, 0x37,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x68, 0x01,  0x4E, 0x47, 0x3C, 0x96,  0x05, 0x00, 0x09, 0x6A,
-  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x6A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x37,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x59, 0x01,  0x4E, 0x0C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x6A, 0x01, 0x4E,  0x47, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,
-  0x12, 0x4C, 0x9D, 0x02,  0x00, 0x18, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x12, 0x01,  0x4E, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x12, 0x4C,
-  0x9D, 0x02, 0x00, 0x19,  0x00, 0x17, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x2D, 0x01, 0x4E,  0x96, 0x05, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x49, 0x12, 0x4C, 0x9D,
-  0x02, 0x00, 0x19, 0x00,  0x17, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x12, 0x01, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,  0x12, 0x12, 0x9D, 0x02,
-  0x00, 0x0F, 0x01, 0x96,  0x02, 0x00, 0x08, 0x6C,  0x4C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x37,  0x01, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x12, 0x01,  0x4E, 0x0C, 0x47, 0x1D,  0x96, 0x03, 0x00, 0x09,  0x59, 0x01, 0x4C, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x12, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x0C,  0x47, 0x1D, 0x96, 0x05,
-  0x00, 0x09, 0x2D, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x6C,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x0C,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2D, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x59, 0x01, 0x4E, 0x0C,  0x47, 0x1D, 0x96, 0x05,  0x00, 0x09, 0x12, 0x01,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x12,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x6C, 0x4E, 0x0C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x59, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x12, 0x01, 0x4E, 0x0C,  0x47, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x68, 0x01,  0x4C, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x6A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x37,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x12, 0x01,  0x4E, 0x0C, 0x47, 0x1D,  0x96, 0x03, 0x00, 0x09,
-  0x6A, 0x01, 0x4C, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x68, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x0C,
-  0x47, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,  0x6C, 0x08, 0x6C, 0x1C,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x2D,  0x01, 0x09, 0x2D, 0x01,
-  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x12, 0x01, 0x09, 0x12,
-  0x01, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x59, 0x01, 0x09,
-  0x59, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x68, 0x01,
-  0x09, 0x68, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x6A,
-  0x01, 0x09, 0x6A, 0x01,  0x1C, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x28, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x62, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x6D, 0x01, 0x9B,  0x20, 0x00, 0x00, 0x05,  0x00, 0x73, 0x63, 0x61,
-  0x6C, 0x65, 0x58, 0x00,  0x73, 0x63, 0x61, 0x6C,  0x65, 0x59, 0x00, 0x72,  0x6F, 0x74, 0x61, 0x74,
-  0x69, 0x6F, 0x6E, 0x00,  0x78, 0x00, 0x79, 0x00,  0xC6, 0x00, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x63, 0x01, 0x52,  0x17, 0x96, 0x08, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x09, 0x2A, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,
-  0x9D, 0x02, 0x00, 0x0D,  0x00, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x99, 0x02, 0x00,
-  0x07, 0x00, 0x96, 0x03,  0x00, 0x09, 0x6E, 0x01,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x6F, 0x01, 0x52, 0x17,  0x96, 0x03, 0x00, 0x09,
-  0x71, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x70,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x72, 0x01, 0x52,  0x17, 0x96, 0x08, 0x00,
-  0x07, 0x03, 0x00, 0x00,  0x00, 0x09, 0x2A, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,
-  0x12, 0x9D, 0x02, 0x00,  0x10, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,
-  0x68, 0x01, 0x08, 0x13,  0x1C, 0x4F, 0x96, 0x08,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x09, 0x2A,
-  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,  0x00, 0x11, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x6A, 0x01, 0x09,  0x2B, 0x01, 0x1C, 0x4F,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x62, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x73,
-  0x01, 0x9B, 0x1F, 0x00,  0x00, 0x05, 0x00, 0x77,  0x69, 0x64, 0x74, 0x68,  0x00, 0x68, 0x65, 0x69,
-  0x67, 0x68, 0x74, 0x00,  0x72, 0x6F, 0x74, 0x61,  0x74, 0x69, 0x6F, 0x6E,  0x00, 0x78, 0x00, 0x79,
-  0x00, 0xE0, 0x00, 0x96,  0x08, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x09,  0x2A, 0x01, 0x1C, 0x96,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,  0x47, 0x96, 0x08, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x09, 0x25, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x47, 0x01, 0x52,  0x96, 0x03, 0x00, 0x09,
+  0x45, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x0B, 0x4F, 0x96,  0x03, 0x00, 0x09, 0x45,
+  0x01, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x37, 0x01,  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
+  0x4E, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x4E,  0x47, 0x96, 0x08, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x09, 0x25, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x47, 0x01, 0x52,
+  0x96, 0x03, 0x00, 0x09,  0x45, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x0B, 0x4F,
+  0x96, 0x08, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x09, 0x45, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x36, 0x01, 0x4E, 0x48,  0x12, 0x4C, 0x9D, 0x02,  0x00, 0x16, 0x00, 0x17,  0x96, 0x08, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x09, 0x45, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4E, 0x48,
+  0x12, 0x12, 0x9D, 0x02,  0x00, 0x14, 0x00, 0x96,  0x08, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,
+  0x45, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x35,  0x01, 0x52, 0x17, 0x96,  0x03, 0x00, 0x09, 0x45,
+  0x01, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x34, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x48, 0x01,  0x9B, 0x0A, 0x00, 0x00,  0x01, 0x00, 0x72, 0x65,  0x63, 0x74, 0x00, 0x27,
+  0x00, 0x96, 0x08, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x07, 0x00,
+  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x44, 0x01, 0x52, 0x96,
+  0x03, 0x00, 0x09, 0x43,  0x01, 0x52, 0x12, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x49,  0x01, 0x9B, 0x0A, 0x00,  0x00, 0x01, 0x00, 0x72,
+  0x65, 0x63, 0x74, 0x00,  0xB3, 0x01, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x43, 0x01, 0x52,  0x12, 0x9D, 0x02, 0x00,  0x14, 0x00, 0x96, 0x08,
+  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2C, 0x01,
+  0x52, 0x3E, 0x96, 0x08,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x09, 0x3A,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x43, 0x01,  0x52, 0x12, 0x9D, 0x02,  0x00, 0x13, 0x00, 0x96,  0x07, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2C, 0x01,  0x52, 0x3E, 0x96, 0x0A,
+  0x00, 0x09, 0x49, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x53, 0x3C, 0x96,  0x03, 0x00, 0x09, 0x49,
+  0x01, 0x1C, 0x96, 0x05,  0x00, 0x08, 0x13, 0x09,  0x3A, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x08, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x09, 0x25, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x47, 0x01, 0x52,
+  0x4F, 0x96, 0x03, 0x00,  0x09, 0x49, 0x01, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x1F, 0x01, 0x09, 0x3A,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x08,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x09, 0x25,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x47, 0x01,  0x52, 0x4F, 0x96, 0x03,  0x00, 0x09, 0x49, 0x01,
+  0x1C, 0x96, 0x06, 0x00,  0x09, 0x36, 0x01, 0x09,  0x3A, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x3A, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x36, 0x01, 0x4E, 0x47,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x36, 0x01,  0x4E, 0x47, 0x96, 0x08,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x09, 0x25,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x46, 0x01,  0x52, 0x96, 0x03, 0x00,
+  0x09, 0x49, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0B, 0x4F,  0x96, 0x03, 0x00, 0x09,
+  0x49, 0x01, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x37,  0x01, 0x09, 0x3A, 0x01,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x3A, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x37,
+  0x01, 0x4E, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,  0x4E, 0x47, 0x96, 0x08,
+  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x09, 0x25,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x46, 0x01,
+  0x52, 0x96, 0x03, 0x00,  0x09, 0x49, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x0B,
+  0x4F, 0x96, 0x03, 0x00,  0x09, 0x49, 0x01, 0x1C,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x30, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x02, 0x00,
+  0x64, 0x78, 0x00, 0x64,  0x79, 0x00, 0x3A, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,
+  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x4A, 0x01, 0x1C,  0x47, 0x96, 0x02, 0x00,
+  0x08, 0x13, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x1F,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x4B, 0x01,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4D, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x34, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x4C, 0x01, 0x9B,  0x07, 0x00, 0x00, 0x01,  0x00, 0x64, 0x00, 0x47,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x4D, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x47,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x4D, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4D, 0x4F,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x4E,  0x01, 0x9B, 0x0B, 0x00,  0x00, 0x02, 0x00, 0x64,  0x78, 0x00, 0x64, 0x79,
+  0x00, 0x82, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x4A, 0x01, 0x1C, 0x0B,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x36, 0x01,  0x4E, 0x96, 0x08, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x09, 0x4A, 0x01,  0x1C, 0x0C, 0x47, 0x96,  0x03, 0x00, 0x09, 0x36,
+  0x01, 0x4D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x4B, 0x01, 0x1C,  0x0B, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4D,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4E, 0x96,
+  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,  0x4B, 0x01, 0x1C, 0x0C,  0x47, 0x96, 0x03, 0x00,
+  0x09, 0x37, 0x01, 0x4D,  0x4F, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x4F, 0x01, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,  0x64, 0x00, 0x9C, 0x00,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x4D, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0B, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,
+  0x96, 0x08, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x09, 0x4D, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x13, 0x4E, 0x0C, 0x47,  0x96, 0x03, 0x00, 0x09,  0x36, 0x01, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x4D, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x0B, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4D,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x4C,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4E, 0x96,
+  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,  0x4D, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,
+  0x01, 0x4E, 0x0C, 0x47,  0x96, 0x03, 0x00, 0x09,  0x37, 0x01, 0x4D, 0x4F,  0x4F, 0x9B, 0x0A, 0x00,
+  0x00, 0x01, 0x00, 0x6C,  0x65, 0x66, 0x74, 0x00,  0x3B, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x4C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x50, 0x01, 0x1C, 0x0B,  0x47, 0x96, 0x03, 0x00,
+  0x09, 0x36, 0x01, 0x4D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x05, 0x00, 0x08, 0x13,
+  0x09, 0x50, 0x01, 0x1C,  0x4F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x0D,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x3E, 0x96, 0x0A,  0x00, 0x09, 0x50, 0x01,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x52, 0x17, 0x9B,  0x0B, 0x00, 0x00, 0x01,  0x00, 0x72, 0x69, 0x67,  0x68, 0x74, 0x00, 0x1E,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x36,  0x01, 0x09, 0x51, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x4E, 0x0B, 0x4F, 0x9B,
+  0x05, 0x00, 0x00, 0x00,  0x00, 0x1B, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x13, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,
+  0x47, 0x3E, 0x96, 0x0A,  0x00, 0x09, 0x51, 0x01,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x07, 0x52, 0x17, 0x9B,  0x09, 0x00, 0x00, 0x01,
+  0x00, 0x74, 0x6F, 0x70,  0x00, 0x3D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x03,
+  0x00, 0x09, 0x37, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x52, 0x01,  0x1C, 0x0B, 0x47, 0x96,  0x03, 0x00, 0x09, 0x37,
+  0x01, 0x4D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x1F, 0x01, 0x09,
+  0x52, 0x01, 0x1C, 0x4F,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x3E, 0x96, 0x0A,  0x00, 0x09, 0x52, 0x01,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x34,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x52, 0x17, 0x9B,  0x0C, 0x00, 0x00, 0x01,  0x00, 0x62, 0x6F, 0x74,  0x74, 0x6F, 0x6D, 0x00,
+  0x1F, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x37, 0x01, 0x09, 0x53,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x0B,
+  0x4F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1C,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x37, 0x01, 0x4E, 0x47,  0x3E, 0x96, 0x0A, 0x00,  0x09, 0x53, 0x01, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x34, 0x01,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x07,  0x52, 0x17, 0x9B, 0x0D,
+  0x00, 0x00, 0x01, 0x00,  0x74, 0x6F, 0x70, 0x4C,  0x65, 0x66, 0x74, 0x00,  0x92, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x54, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x13,  0x4E, 0x0B, 0x47, 0x96,  0x03, 0x00, 0x09, 0x36,  0x01, 0x4D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x4C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x54, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x0B, 0x47, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
+  0x4D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x08,  0x13, 0x09, 0x54, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,
+  0x00, 0x09, 0x1F, 0x01,  0x09, 0x54, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x4F,
+  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x33, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1D,  0x01, 0x53, 0x3E, 0x96,  0x0A, 0x00, 0x09, 0x54,
+  0x01, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x34, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x07, 0x52, 0x17,  0x9B, 0x11, 0x00, 0x00,  0x01, 0x00, 0x62, 0x6F,  0x74, 0x74, 0x6F, 0x6D,
+  0x52, 0x69, 0x67, 0x68,  0x74, 0x00, 0x4A, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,
+  0x00, 0x09, 0x36, 0x01,  0x09, 0x55, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0B, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x37, 0x01,  0x09, 0x55, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,
+  0x0B, 0x4F, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x4F, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x37, 0x01, 0x4E,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x36,  0x01, 0x4E, 0x47, 0x96,
+  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x53,  0x3E, 0x96, 0x0A, 0x00,  0x09, 0x55, 0x01, 0x07,
+  0x03, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0x34, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x07,
+  0x52, 0x17, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x73, 0x69, 0x7A, 0x65,  0x00, 0x2D, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x09, 0x36, 0x01, 0x08,  0xE1, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x13, 0x4E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x37,
+  0x01, 0x08, 0xE1, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x4F,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x34, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x37, 0x01,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x36,  0x01, 0x4E, 0x96, 0x07,
+  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x1D, 0x01, 0x53, 0x3E,  0x96, 0x09, 0x00, 0x08,  0xE1, 0x07, 0x03, 0x00,
+  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x34, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x07, 0x52, 0x17,
+  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x56, 0x01, 0x9B,  0x19, 0x00, 0x00, 0x06,  0x00, 0x70, 0x61, 0x00,  0x70, 0x62, 0x00, 0x70,
+  0x63, 0x00, 0x70, 0x64,  0x00, 0x70, 0x74, 0x78,  0x00, 0x70, 0x74, 0x79,  0x00, 0x90, 0x00, 0x96,
+  0x03, 0x00, 0x09, 0x1E,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x12, 0x9D, 0x02, 0x00,
+  0x6A, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x08,  0x62, 0x09, 0x58, 0x01,
+  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x21, 0x01, 0x09, 0x59,
+  0x01, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x08, 0x01, 0x09,
+  0x5A, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x4D, 0x01,
+  0x09, 0x5B, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x5C,
+  0x01, 0x09, 0x5D, 0x01,  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,
+  0x5E, 0x01, 0x09, 0x5F,  0x01, 0x1C, 0x4F, 0x99,  0x02, 0x00, 0x13, 0x00,  0x96, 0x07, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x57,  0x01, 0x52, 0x17, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x56, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x2C, 0x01,
+  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x67, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x5E, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x5C,
+  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x08, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x62,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x06, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,  0x01, 0x53, 0x3E, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x56, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x60, 0x01,
+  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x6F, 0x74,  0x68, 0x65, 0x72, 0x00,  0x9E, 0x02, 0x96, 0x04,
+  0x00, 0x08, 0x62, 0x08,  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x62, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x2B, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x62,  0x4E, 0x0C, 0x3C, 0x96,  0x05, 0x00, 0x09, 0x4D,
+  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x4D, 0x01,  0x4E, 0x0C, 0x3C, 0x96,  0x08, 0x00, 0x09, 0x21,
+  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,  0x08, 0x00, 0x09, 0x08,  0x01, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x3C, 0x96,  0x05, 0x00, 0x09, 0x5C,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x5C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x62, 0x4E,
+  0x0C, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x5C, 0x01, 0x4E, 0x47,
+  0x3C, 0x96, 0x05, 0x00,  0x09, 0x5E, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x5E, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x4E, 0x0C,
+  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x5E,  0x01, 0x4E, 0x47, 0x3C,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,  0x4E, 0x96, 0x05, 0x00,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x12, 0x4C,  0x9D, 0x02, 0x00, 0x18,  0x00, 0x17, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x08, 0x01, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x49,  0x12, 0x4C, 0x9D, 0x02,  0x00, 0x19, 0x00, 0x17,  0x96, 0x03, 0x00, 0x09,
+  0x2B, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x21,  0x01, 0x4E, 0x96, 0x05,  0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0x12,  0x4C, 0x9D, 0x02, 0x00,  0x19, 0x00, 0x17, 0x96,  0x03, 0x00, 0x09, 0x2B,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x08, 0x01,  0x4E, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x0F,  0x01, 0x96, 0x02, 0x00,  0x08, 0x62, 0x4C, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x2B, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x08, 0x01, 0x4E, 0x0C,  0x47, 0x1D, 0x96, 0x03,
+  0x00, 0x09, 0x4D, 0x01,  0x4C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x08, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,
+  0x4E, 0x0C, 0x47, 0x1D,  0x96, 0x05, 0x00, 0x09,  0x21, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x62, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,
+  0x4E, 0x0C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x21, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x4D, 0x01,  0x4E, 0x0C, 0x47, 0x1D,
+  0x96, 0x05, 0x00, 0x09,  0x08, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x08, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x62,  0x4E, 0x0C, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x08, 0x01,  0x4E, 0x0C, 0x47, 0x1D,  0x96, 0x03, 0x00, 0x09,
+  0x5C, 0x01, 0x4C, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x5E, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x2B, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x08, 0x01, 0x4E, 0x0C,
+  0x47, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x5E, 0x01,  0x4C, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x5C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x2B,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x21, 0x01,  0x4E, 0x0C, 0x47, 0x1D,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,
+  0x00, 0x08, 0x62, 0x08,  0x62, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,
+  0x09, 0x21, 0x01, 0x09,  0x21, 0x01, 0x1C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,
+  0x00, 0x09, 0x08, 0x01,  0x09, 0x08, 0x01, 0x1C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x06, 0x00, 0x09, 0x4D,  0x01, 0x09, 0x4D, 0x01,  0x1C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x06, 0x00, 0x09,  0x5C, 0x01, 0x09, 0x5C,  0x01, 0x1C, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x06, 0x00,  0x09, 0x5E, 0x01, 0x09,  0x5E, 0x01, 0x1C, 0x4F,  0x4F, 0x96, 0x02, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x56, 0x01,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x61,  0x01, 0x9B, 0x20, 0x00,
+  0x00, 0x05, 0x00, 0x73,  0x63, 0x61, 0x6C, 0x65,  0x58, 0x00, 0x73, 0x63,  0x61, 0x6C, 0x65, 0x59,
+  0x00, 0x72, 0x6F, 0x74,  0x61, 0x74, 0x69, 0x6F,  0x6E, 0x00, 0x78, 0x00,  0x79, 0x00, 0xC6, 0x00,
+  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x57,
+  0x01, 0x52, 0x17, 0x96,  0x08, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x09,  0x1E, 0x01, 0x1C, 0x96,
   0x02, 0x00, 0x08, 0x19,  0x4E, 0x48, 0x9D, 0x02,  0x00, 0x0D, 0x00, 0x96,  0x05, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x99,  0x02, 0x00, 0x07, 0x00,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x43,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x0D, 0x47,
-  0x96, 0x08, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x09, 0x2A, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x19, 0x4E, 0x48, 0x9D,  0x02, 0x00, 0x0D, 0x00,  0x96, 0x05, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x99, 0x02, 0x00, 0x06,  0x00, 0x96, 0x02, 0x00,  0x08, 0x13, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x42,
-  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x0D, 0x47,  0x96, 0x08, 0x00, 0x07,
-  0x02, 0x00, 0x00, 0x00,  0x09, 0x2A, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x9D,
-  0x02, 0x00, 0x0D, 0x00,  0x96, 0x05, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x99, 0x02, 0x00, 0x07,
-  0x00, 0x96, 0x03, 0x00,  0x09, 0x6E, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x43, 0x01, 0x1C, 0x96,
-  0x09, 0x00, 0x06, 0x99,  0x99, 0x99, 0x40, 0x9A,  0x99, 0x99, 0x99, 0x0D,  0x96, 0x03, 0x00, 0x09,
-  0x42, 0x01, 0x1C, 0x96,  0x09, 0x00, 0x06, 0x99,  0x99, 0x99, 0x40, 0x9A,  0x99, 0x99, 0x99, 0x0D,
-  0x96, 0x07, 0x00, 0x07,  0x05, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x6D,
-  0x01, 0x52, 0x17, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x62, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x74, 0x01,  0x9B, 0x07, 0x00, 0x00,  0x01, 0x00, 0x70, 0x00,  0x89, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x59, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x75,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x2B, 0x01,  0x4E, 0x0C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2D, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x75,  0x01, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x13, 0x4E,  0x0C, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x6C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x75, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x0C,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x12, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x75, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x0C,  0x47, 0x96, 0x07, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x29,  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x62, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x63, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x6F, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x6C, 0x08,  0x0B, 0x1C, 0x96, 0x08,
-  0x00, 0x09, 0x59, 0x01,  0x07, 0x01, 0x00, 0x00,  0x00, 0x87, 0x01, 0x00,  0x00, 0x4F, 0x96, 0x02,
-  0x00, 0x04, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x2D, 0x01,
-  0x08, 0x0B, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x12,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,
-  0x68, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x08, 0x00,  0x09, 0x6A, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x99,  0x02, 0x00, 0x07, 0x00,  0x96, 0x03, 0x00, 0x09,  0x62, 0x01, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x63, 0x01,
+  0x52, 0x17, 0x96, 0x03,  0x00, 0x09, 0x65, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x64, 0x01, 0x1C,
+  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x66,
+  0x01, 0x52, 0x17, 0x96,  0x08, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x09,  0x1E, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x19,  0x4E, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x10, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x5C, 0x01,  0x08, 0x13, 0x1C, 0x4F,  0x96, 0x08, 0x00, 0x07,
+  0x04, 0x00, 0x00, 0x00,  0x09, 0x1E, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,
+  0x9D, 0x02, 0x00, 0x11,  0x00, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x5E,
+  0x01, 0x09, 0x1F, 0x01,  0x1C, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x56, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x67, 0x01, 0x9B,  0x1F, 0x00, 0x00, 0x05,  0x00, 0x77, 0x69, 0x64,
+  0x74, 0x68, 0x00, 0x68,  0x65, 0x69, 0x67, 0x68,  0x74, 0x00, 0x72, 0x6F,  0x74, 0x61, 0x74, 0x69,
+  0x6F, 0x6E, 0x00, 0x78,  0x00, 0x79, 0x00, 0xE0,  0x00, 0x96, 0x08, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x09, 0x1E, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,  0x9D, 0x02, 0x00, 0x0D,
+  0x00, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x99, 0x02, 0x00,  0x07, 0x00, 0x96, 0x03,
+  0x00, 0x09, 0x1F, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x37, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x0D, 0x47, 0x96, 0x08,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x09, 0x1E,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x48, 0x9D, 0x02, 0x00,  0x0D, 0x00, 0x96, 0x05,
+  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x99, 0x02,  0x00, 0x06, 0x00, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x36, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x0D, 0x47, 0x96, 0x08,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x09, 0x1E,  0x01, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x19, 0x4E,  0x48, 0x9D, 0x02, 0x00,  0x0D, 0x00, 0x96, 0x05,  0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x99, 0x02,  0x00, 0x07, 0x00, 0x96,  0x03, 0x00, 0x09, 0x62,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x37, 0x01,  0x1C, 0x96, 0x09, 0x00,  0x06, 0x99, 0x99, 0x99,  0x40, 0x9A, 0x99, 0x99,
+  0x99, 0x0D, 0x96, 0x03,  0x00, 0x09, 0x36, 0x01,  0x1C, 0x96, 0x09, 0x00,  0x06, 0x99, 0x99, 0x99,
+  0x40, 0x9A, 0x99, 0x99,  0x99, 0x0D, 0x96, 0x07,  0x00, 0x07, 0x05, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x61, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x68, 0x01, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,
+  0x70, 0x00, 0x89, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x4D, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x69, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1F, 0x01, 0x4E, 0x0C,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x21, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x69, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x13, 0x4E, 0x0C, 0x47,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x62, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x69, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x13,  0x4E, 0x0C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x08, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x69,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,
+  0x4E, 0x0C, 0x47, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1D, 0x01, 0x53,  0x3E, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,
+  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x57, 0x01, 0x9B, 0x05,
+  0x00, 0x00, 0x00, 0x00,  0x6F, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x04, 0x00, 0x08,
+  0x62, 0x08, 0x0B, 0x1C,  0x96, 0x08, 0x00, 0x09,  0x4D, 0x01, 0x07, 0x01,  0x00, 0x00, 0x00, 0x87,
+  0x01, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x04,  0x00, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x05, 0x00, 0x09,  0x21, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x09, 0x08, 0x01, 0x08,
+  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x5C, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x08, 0x00, 0x09, 0x5E,
+  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x87, 0x01,  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x04, 0x00,
   0x87, 0x01, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x04, 0x00, 0x87, 0x01,  0x00, 0x00, 0x4F, 0x96,
-  0x02, 0x00, 0x04, 0x00,  0x87, 0x01, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x04, 0x00, 0x4F, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x62, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x76, 0x01,
-  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x98, 0x02,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x2D, 0x01,  0x4E, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x4C, 0x12,
-  0x9D, 0x02, 0x00, 0x17,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x12, 0x01, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x49,  0x12, 0x9D, 0x02, 0x00,
-  0xBD, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x09, 0x00, 0x08,  0x6C, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x6C, 0x4E, 0x0D,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x0A, 0x00, 0x09, 0x59,  0x01, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x59, 0x01, 0x4E,  0x0D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x05, 0x00, 0x09,  0x2D, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x08, 0x00,  0x09, 0x12, 0x01, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x87, 0x01, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x04, 0x00, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x05, 0x00,  0x09, 0x68, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x6C, 0x4E,  0x96, 0x05, 0x00, 0x07,  0xFF, 0xFF, 0xFF, 0xFF,  0x0C, 0x96, 0x02, 0x00,
-  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x68,  0x01, 0x4E, 0x0C, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x6A, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x59,
-  0x01, 0x4E, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,  0xFF, 0xFF, 0x0C, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x6A, 0x01, 0x4E,  0x0C, 0x4F, 0x96, 0x01,  0x00, 0x03, 0x3E, 0x96,
-  0x04, 0x00, 0x08, 0x6C,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x6C,  0x4E, 0x3C, 0x96, 0x05,
-  0x00, 0x09, 0x2D, 0x01,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x2D,  0x01, 0x4E, 0x3C, 0x96,
-  0x05, 0x00, 0x09, 0x12,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x12, 0x01, 0x4E, 0x3C,
-  0x96, 0x05, 0x00, 0x09,  0x59, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x59, 0x01, 0x4E,
-  0x3C, 0x96, 0x05, 0x00,  0x09, 0x77, 0x01, 0x08,  0x6C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x59, 0x01,
-  0x1C, 0x0C, 0x96, 0x03,  0x00, 0x09, 0x2D, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x12, 0x01, 0x1C,
-  0x0C, 0x0B, 0x3C, 0x96,  0x03, 0x00, 0x09, 0x77,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x18,  0x00, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x63, 0x01, 0x52, 0x17,  0x96, 0x01, 0x00, 0x03,
-  0x3E, 0x96, 0x0B, 0x00,  0x09, 0x77, 0x01, 0x07,  0x01, 0x00, 0x00, 0x00,  0x09, 0x77, 0x01, 0x1C,
-  0x0D, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x08,  0x6C, 0x09, 0x59, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x77, 0x01, 0x1C,  0x0C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x06, 0x00, 0x09,  0x2D, 0x01, 0x09, 0x2D,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x0C, 0x96,  0x03, 0x00, 0x09, 0x77,  0x01, 0x1C, 0x0C, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x12, 0x01,  0x09, 0x12, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF,  0x0C, 0x96, 0x03, 0x00,  0x09, 0x77, 0x01, 0x1C,  0x0C, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,  0x59, 0x01, 0x08, 0x6C,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x77, 0x01, 0x1C,  0x0C, 0x4F, 0x96, 0x05,  0x00, 0x09, 0x75, 0x01,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x6A,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x68, 0x01, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x53,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x74,  0x01, 0x52, 0x3C, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x68, 0x01, 0x09,  0x75, 0x01, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0x13,  0x4E, 0x96, 0x05, 0x00,  0x07, 0xFF, 0xFF, 0xFF,  0xFF, 0x0C, 0x4F, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x06, 0x00,  0x09, 0x6A, 0x01, 0x09,  0x75, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x2B,  0x01, 0x4E, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,  0xFF, 0xFF, 0x0C, 0x4F,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x62, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x6F,
-  0x01, 0x9B, 0x0C, 0x00,  0x00, 0x01, 0x00, 0x61,  0x6D, 0x6F, 0x75, 0x6E,  0x74, 0x00, 0x97, 0x00,
-  0x96, 0x06, 0x00, 0x09,  0x33, 0x01, 0x09, 0x78,  0x01, 0x1C, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x09, 0x31,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x33, 0x01,  0x52, 0x3C, 0x96, 0x06,
-  0x00, 0x09, 0x34, 0x01,  0x09, 0x78, 0x01, 0x1C,  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x09, 0x31, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x34, 0x01, 0x52, 0x3C,  0x96, 0x0D, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x09, 0x33, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x34, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x07,  0xFF, 0xFF, 0xFF, 0xFF,  0x0C, 0x96, 0x03, 0x00,
-  0x09, 0x34, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x33, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x06,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x62, 0x01, 0x53,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x6C,  0x01, 0x52, 0x17, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x62, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x72, 0x01,  0x9B, 0x09, 0x00, 0x00,  0x02, 0x00, 0x78, 0x00,
-  0x79, 0x00, 0x4D, 0x00,  0x96, 0x0D, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0x2B, 0x01,  0x1C, 0x96, 0x0C, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x13,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x06, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x62,  0x01, 0x53, 0x96, 0x07,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x6C, 0x01, 0x52,
-  0x17, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x62,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x79, 0x01, 0x9B, 0x07,  0x00, 0x00, 0x01, 0x00,  0x70, 0x00, 0xA5, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x59, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x75, 0x01, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x0C,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x2D, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x75, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x13, 0x4E, 0x0C, 0x47,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x6A, 0x01,
-  0x4E, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x6C, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x75, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x0C,  0x96, 0x02, 0x00, 0x08,
-  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x12, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x75, 0x01, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2B, 0x01, 0x4E, 0x0C,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x68,  0x01, 0x4E, 0x47, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x29, 0x01, 0x53,
-  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x28, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x62,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x7A, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x02, 0x00,  0x64, 0x78, 0x00, 0x64,  0x79, 0x00, 0x3C, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x68,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x56, 0x01,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0x68, 0x01,  0x4D, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,  0x09, 0x6A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x57, 0x01, 0x1C, 0x47,  0x96, 0x03, 0x00, 0x09,  0x6A, 0x01, 0x4D, 0x4F,  0x4F, 0x96, 0x02, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x62, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0F,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x81, 0x00,  0x96, 0x05, 0x00, 0x09,  0x7B, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x6C, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x7C, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x2D, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x7D, 0x01, 0x47,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x12, 0x01,  0x4E, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x7E, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x59,
-  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x7F,  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x68, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x80, 0x01, 0x47, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x6A, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,
-  0x09, 0x3F, 0x01, 0x47,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x28, 0x01, 0x4E, 0x96,  0x14, 0x00, 0x09, 0x81,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x51,
-  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x81, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0F, 0x9B,  0x05, 0x00, 0x00, 0x00,
-  0x00, 0xAC, 0x00, 0x96,  0x05, 0x00, 0x09, 0x82,  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x83, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x84, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x85, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x86, 0x01, 0x47,
-  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x87, 0x01,  0x4E, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0x88, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x89,
-  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x8A,  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x8C, 0x01, 0x47, 0x96,
-  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8D, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,
-  0x09, 0x8E, 0x01, 0x47,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8F, 0x01,
-  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x90, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x91,  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x3F,  0x01, 0x47, 0x3E, 0x4F,
-  0x96, 0x0F, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x09, 0x92, 0x01, 0x07,  0x51, 0x04, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x81, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,
-  0x02, 0x3D, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x65,  0x00, 0x00, 0x00, 0x09,  0x93, 0x01, 0x07, 0x51,
-  0x04, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x81, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
-  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x28, 0x01, 0x4E, 0x96,  0x14, 0x00, 0x09, 0x94,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x52,
-  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x0F, 0x00, 0x07,
-  0x65, 0x00, 0x00, 0x00,  0x09, 0x95, 0x01, 0x07,  0x52, 0x04, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x28,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x94, 0x01,  0x4E, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,
-  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x07, 0x00,  0x08, 0xD8, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xD8,  0x4E, 0x96, 0x14, 0x00,
-  0x09, 0x96, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x4C, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0xD8, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x96, 0x01,  0x4E, 0x96, 0x08, 0x00,  0x09, 0x97, 0x01, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xD8,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x96, 0x01, 0x4E,  0x96, 0x08, 0x00, 0x09,  0x98, 0x01, 0x07, 0x02,
-  0x00, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xD8, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x96, 0x01, 0x4E, 0x96,  0x08, 0x00, 0x09, 0x99,  0x01, 0x07, 0x04, 0x00,
-  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD8, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x96,  0x01, 0x4E, 0x96, 0x08,  0x00, 0x09, 0x9A, 0x01,  0x07, 0x08, 0x00, 0x00,
-  0x00, 0x4F, 0x96, 0x0F,  0x00, 0x07, 0x28, 0x00,  0x00, 0x00, 0x09, 0x9B,  0x01, 0x07, 0x4C, 0x04,
-  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD8, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x96,
-  0x01, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x02,  0x3D, 0x17, 0x96, 0x0F,
-  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0x9C,  0x01, 0x07, 0x4C, 0x04,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0xD8, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x96,  0x01, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,
-  0x96, 0x0F, 0x00, 0x07,  0x64, 0x00, 0x00, 0x00,  0x09, 0x9D, 0x01, 0x07,  0x4C, 0x04, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xD8,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x96, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,
-  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x08, 0x00, 0x09,  0x9E, 0x01, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x00, 0x00,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xA0, 0x01, 0x9B,  0x1A, 0x00, 0x00, 0x03,
-  0x00, 0x6E, 0x61, 0x6D,  0x65, 0x00, 0x69, 0x6E,  0x73, 0x74, 0x61, 0x6E,  0x63, 0x65, 0x00, 0x6D,
-  0x65, 0x74, 0x68, 0x6F,  0x64, 0x00, 0xC3, 0x00,  0x96, 0x02, 0x00, 0x08,  0xA1, 0x1C, 0x12, 0x4C,
-  0x9D, 0x02, 0x00, 0x1D,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x9E, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xA1, 0x01,
-  0x4E, 0x12, 0x12, 0x9D,  0x02, 0x00, 0x06, 0x00,  0x96, 0x02, 0x00, 0x05,  0x00, 0x3E, 0x96, 0x07,
-  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA2,  0x01, 0x52, 0x17, 0x9B,
-  0x0D, 0x00, 0x00, 0x01,  0x00, 0x72, 0x65, 0x71,  0x75, 0x65, 0x73, 0x74,  0x00, 0x35, 0x00, 0x96,
-  0x03, 0x00, 0x09, 0xA4,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xA1, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0xA3, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0xA5, 0x01, 0x52, 0x3E,  0x96, 0x02, 0x00, 0x08,  0x0E, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x9F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA6,  0x01, 0x52, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0xA7, 0x01, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x6E, 0x61, 0x6D, 0x65,
-  0x00, 0xF1, 0x02, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA1,  0x01, 0x4E, 0x12, 0x12,
-  0x9D, 0x02, 0x00, 0x05,  0x00, 0x96, 0x01, 0x00,  0x02, 0x3E, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x9F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA2,  0x01, 0x52, 0x17, 0x96,  0x06, 0x00, 0x09, 0xA4,
-  0x01, 0x09, 0xA8, 0x01,  0x3C, 0x96, 0x0A, 0x00,  0x09, 0xAA, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0xA9, 0x01, 0x52,  0x3C, 0x96, 0x03, 0x00,  0x09, 0xAA, 0x01, 0x1C,
-  0x96, 0x01, 0x00, 0x02,  0x49, 0x12, 0x12, 0x9D,  0x02, 0x00, 0x18, 0x00,  0x96, 0x03, 0x00, 0x09,
-  0xA4, 0x01, 0x4C, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xAA, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xAB,
-  0x01, 0x47, 0x47, 0x1D,  0x96, 0x03, 0x00, 0x09,  0xA4, 0x01, 0x4C, 0x1C,  0x96, 0x05, 0x00, 0x09,
-  0xAC, 0x01, 0x08, 0x0E,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0xAD, 0x01,  0x47, 0x47, 0x1D, 0x96,
-  0x07, 0x00, 0x08, 0x18,  0x07, 0x01, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x2A, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,  0x4E, 0x48, 0x12, 0x9D,
-  0x02, 0x00, 0x68, 0x00,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x18, 0x1C, 0x48,
-  0x12, 0x9D, 0x02, 0x00,  0x10, 0x00, 0x96, 0x03,  0x00, 0x09, 0xA4, 0x01,  0x4C, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0xAE, 0x01,  0x47, 0x1D, 0x96, 0x03,  0x00, 0x09, 0xA4, 0x01,  0x4C, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x2A, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xAF, 0x01, 0x52,  0x47, 0x1D, 0x96, 0x02,
-  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x7E, 0xFF,  0x96, 0x03, 0x00, 0x09,
-  0xA4, 0x01, 0x4C, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xB0, 0x01, 0x47, 0x1D,  0x96, 0x03, 0x00, 0x09,
-  0xAA, 0x01, 0x1C, 0x96,  0x01, 0x00, 0x02, 0x49,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x10, 0x00, 0x96,
-  0x03, 0x00, 0x09, 0xA4,  0x01, 0x4C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x3F,  0x01, 0x47, 0x1D, 0x96,
-  0x03, 0x00, 0x09, 0xA4,  0x01, 0x4C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xB1,  0x01, 0x47, 0x1D, 0x96,
-  0x03, 0x00, 0x09, 0xAA,  0x01, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x15,
-  0x00, 0x96, 0x03, 0x00,  0x09, 0xA4, 0x01, 0x4C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xB3, 0x01, 0x47,
-  0x1D, 0x99, 0x02, 0x00,  0x18, 0x00, 0x96, 0x03,  0x00, 0x09, 0xA4, 0x01,  0x4C, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0xAA, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xB2, 0x01, 0x47,  0x47, 0x1D, 0x96, 0x05,
-  0x00, 0x08, 0xF1, 0x09,  0xA4, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0xB4, 0x01, 0x52, 0x3C,  0x96, 0x02, 0x00, 0x08,  0xF1, 0x1C, 0x96, 0x01,
-  0x00, 0x02, 0x49, 0x12,  0x9D, 0x02, 0x00, 0x6E,  0x00, 0x96, 0x08, 0x00,  0x09, 0xA4, 0x01, 0x09,
-  0xB5, 0x01, 0x08, 0x0E,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0xB6, 0x01,  0x47, 0x96, 0x03, 0x00,
-  0x09, 0x2A, 0x01, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xB7, 0x01, 0x52,  0x47, 0x96, 0x03, 0x00,  0x09, 0xB8, 0x01, 0x47,  0x1D, 0x96, 0x05, 0x00,
-  0x08, 0xF1, 0x09, 0xA4,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xB9,  0x01, 0x52, 0x1D, 0x96,  0x02, 0x00, 0x08, 0xF1,  0x1C, 0x96, 0x01, 0x00,
-  0x02, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x05, 0x00,  0x96, 0x01, 0x00, 0x02,  0x3E, 0x96, 0x0A, 0x00,
-  0x09, 0xBA, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x51, 0x40, 0x3C,  0x96, 0x03, 0x00, 0x09,
-  0xBA, 0x01, 0x1C, 0x96,  0x05, 0x00, 0x09, 0xBB,  0x01, 0x05, 0x01, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0xF1, 0x1C, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0xBA,  0x01, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x59, 0x52,  0x17, 0x96, 0x03, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0xBC, 0x01, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0xBD, 0x01, 0x52, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xA5, 0x01, 0x9B,
-  0x1D, 0x00, 0x00, 0x03,  0x00, 0x69, 0x6E, 0x73,  0x74, 0x61, 0x6E, 0x63,  0x65, 0x00, 0x6D, 0x65,
-  0x74, 0x68, 0x6F, 0x64,  0x00, 0x72, 0x65, 0x71,  0x75, 0x65, 0x73, 0x74,  0x00, 0x96, 0x01, 0x96,
-  0x0A, 0x00, 0x09, 0xBA,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x51,  0x40, 0x3C, 0x96, 0x03,
-  0x00, 0x09, 0xBA, 0x01,  0x1C, 0x96, 0x05, 0x00,  0x09, 0xBB, 0x01, 0x05,  0x01, 0x4F, 0x96, 0x03,
-  0x00, 0x09, 0xA4, 0x01,  0x1C, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0xBA, 0x01,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x59, 0x52, 0x17,  0x96, 0x04, 0x00, 0x09,  0xBE, 0x01, 0x02, 0x3C,
-  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x18,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xBC, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xBF,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,
-  0x00, 0x64, 0x00, 0x96,  0x03, 0x00, 0x09, 0xBA,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBC, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xC0,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x2A, 0x01,  0x49, 0x12, 0x9D, 0x02,
-  0x00, 0x26, 0x00, 0x96,  0x06, 0x00, 0x09, 0xBE,  0x01, 0x09, 0xBA, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0xBC, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xBF, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,
-  0x1C, 0x4E, 0x1D, 0x17,  0x99, 0x02, 0x00, 0x0E,  0x00, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,
-  0x50, 0x1D, 0x99, 0x02,  0x00, 0x74, 0xFF, 0x96,  0x05, 0x00, 0x08, 0xF1,  0x09, 0xBE, 0x01, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xC1, 0x01, 0x52,
-  0x96, 0x03, 0x00, 0x09,  0xA3, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
-  0xA1, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xC2, 0x01,  0x52, 0x3C, 0x96, 0x03,  0x00, 0x09, 0xBA, 0x01,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0xBC, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xC3, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xC4,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xC5, 0x01,  0x49, 0x9D, 0x02, 0x00,
-  0x2C, 0x00, 0x96, 0x02,  0x00, 0x08, 0xF1, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0xC6, 0x01, 0x52,  0x3E, 0x99, 0x02, 0x00,  0x27, 0x00, 0x96, 0x02,
-  0x00, 0x08, 0xF1, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xAF, 0x01, 0x52,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x9E, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xC7, 0x01,
-  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x61, 0x72,  0x72, 0x61, 0x79, 0x00,  0x9D, 0x00, 0x96, 0x06,
-  0x00, 0x09, 0xC9, 0x01,  0x09, 0xC8, 0x01, 0x3C,  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xCA, 0x01, 0x1C,
-  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x5F,  0x00, 0x96, 0x03, 0x00,
-  0x09, 0xC9, 0x01, 0x4C,  0x1C, 0x96, 0x05, 0x00,  0x09, 0xCB, 0x01, 0x08,  0x18, 0x1C, 0x47, 0x96,
-  0x03, 0x00, 0x09, 0xCC,  0x01, 0x47, 0x96, 0x03,  0x00, 0x09, 0xCA, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xC6, 0x01, 0x52,  0x47, 0x96, 0x03, 0x00,  0x09, 0xCD, 0x01, 0x47,  0x47, 0x1D, 0x96, 0x02,
-  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x87, 0xFF,  0x96, 0x03, 0x00, 0x09,
-  0xC9, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xCE,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0xB7, 0x01, 0x9B, 0x0A,  0x00, 0x00, 0x01, 0x00,  0x61, 0x72, 0x67, 0x73,
-  0x00, 0x84, 0x00, 0x96,  0x06, 0x00, 0x09, 0xC9,  0x01, 0x09, 0xCF, 0x01,  0x3C, 0x96, 0x07, 0x00,
-  0x08, 0x18, 0x07, 0x00,  0x00, 0x00, 0x00, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0xBE, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,  0x12, 0x9D, 0x02, 0x00,
-  0x46, 0x00, 0x96, 0x03,  0x00, 0x09, 0xC9, 0x01,  0x4C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBE, 0x01,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0xC6, 0x01, 0x52,  0x47, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,
-  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0xA0, 0xFF,  0x96, 0x03, 0x00, 0x09,  0xC9, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0xD0,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0xD1, 0x01, 0x9B, 0x09,  0x00, 0x00, 0x01, 0x00,  0x6F, 0x62, 0x6A, 0x00,  0x8C, 0x00, 0x96, 0x06,
-  0x00, 0x09, 0xC9, 0x01,  0x09, 0xD2, 0x01, 0x3C,  0x96, 0x03, 0x00, 0x09,  0xD3, 0x01, 0x46, 0x87,
-  0x01, 0x00, 0x00, 0x96,  0x01, 0x00, 0x02, 0x49,  0x9D, 0x02, 0x00, 0x5E,  0x00, 0x96, 0x04, 0x00,
-  0x08, 0xC3, 0x04, 0x00,  0x3C, 0x96, 0x03, 0x00,  0x09, 0xC9, 0x01, 0x4C,  0x1C, 0x96, 0x05, 0x00,
-  0x09, 0xCB, 0x01, 0x08,  0xC3, 0x1C, 0x47, 0x96,  0x03, 0x00, 0x09, 0xCC,  0x01, 0x47, 0x96, 0x03,
-  0x00, 0x09, 0xD3, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC3, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xC6, 0x01, 0x52,  0x47, 0x96, 0x03, 0x00,
-  0x09, 0xCD, 0x01, 0x47,  0x47, 0x1D, 0x99, 0x02,  0x00, 0x94, 0xFF, 0x96,  0x03, 0x00, 0x09, 0xC9,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xD4, 0x01,  0x47, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xC6,  0x01, 0x9B, 0x0B, 0x00,  0x00, 0x01, 0x00, 0x76,  0x61, 0x6C, 0x75, 0x65,
-  0x00, 0x71, 0x01, 0x96,  0x04, 0x00, 0x08, 0xA7,  0x08, 0x67, 0x1C, 0x44,  0x3C, 0x96, 0x02, 0x00,
-  0x08, 0xA7, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x66,  0x49, 0x9D, 0x02, 0x00,  0x24, 0x01, 0x96, 0x02,
-  0x00, 0x08, 0xA7, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0A, 0x49, 0x9D, 0x02,  0x00, 0x07, 0x01, 0x96,
-  0x02, 0x00, 0x08, 0xA7,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xD9, 0x01, 0x49,  0x9D, 0x02, 0x00, 0xDE,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x96,  0x01, 0x00, 0x02, 0x49,  0x9D, 0x02, 0x00, 0xC2,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xDD,  0x01, 0x49, 0x9D, 0x02,
-  0x00, 0x8E, 0x00, 0x96,  0x09, 0x00, 0x08, 0x19,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x67, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0xE0, 0x01, 0x52, 0x9D,  0x02, 0x00, 0x49, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0xA7, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xC1, 0x49,  0x9D, 0x02, 0x00, 0x0C,  0x00, 0x96, 0x03, 0x00,
-  0x09, 0xDC, 0x01, 0x3E,  0x99, 0x02, 0x00, 0x27,  0x00, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x96,
-  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xD1, 0x01, 0x52, 0x3E,
-  0x99, 0x02, 0x00, 0x27,  0x00, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xC7, 0x01, 0x52, 0x3E,  0x99, 0x02, 0x00, 0x1D,
-  0x00, 0x96, 0x02, 0x00,  0x08, 0x67, 0x1C, 0x9D,  0x02, 0x00, 0x0B, 0x00,  0x96, 0x03, 0x00, 0x09,
-  0xDF, 0x01, 0x99, 0x02,  0x00, 0x06, 0x00, 0x96,  0x03, 0x00, 0x09, 0xDE,  0x01, 0x3E, 0x99, 0x02,
-  0x00, 0x07, 0x00, 0x96,  0x03, 0x00, 0x09, 0xDC,  0x01, 0x3E, 0x99, 0x02,  0x00, 0x12, 0x00, 0x96,
-  0x05, 0x00, 0x09, 0xDA,  0x01, 0x08, 0x67, 0x1C,  0x47, 0x96, 0x03, 0x00,  0x09, 0xDB, 0x01, 0x47,
-  0x3E, 0x99, 0x02, 0x00,  0x07, 0x00, 0x96, 0x03,  0x00, 0x09, 0xD8, 0x01,  0x3E, 0x99, 0x02, 0x00,
-  0x32, 0x00, 0x96, 0x05,  0x00, 0x09, 0xD5, 0x01,  0x08, 0x67, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xD6, 0x01, 0x52, 0x47,  0x96, 0x03, 0x00, 0x09,
-  0xD7, 0x01, 0x47, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xE1, 0x01, 0x9B,
-  0x09, 0x00, 0x00, 0x01,  0x00, 0x78, 0x6D, 0x6C,  0x00, 0xDC, 0x00, 0x96,  0x07, 0x00, 0x08, 0x1C,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x3C, 0x96,  0x07, 0x00, 0x08, 0x18,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xBA, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0xBF,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,
-  0x00, 0x9D, 0x00, 0x96,  0x03, 0x00, 0x09, 0xBA,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBF, 0x01,
-  0x4E, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xC0, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xE2,  0x01, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x66, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0x1C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBA, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xC3,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0xAA, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0xBF, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xBC, 0x01,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x9E, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9F,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xBD, 0x01,
-  0x52, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x42, 0xFF,
-  0x96, 0x02, 0x00, 0x08,  0x1C, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0xE3, 0x01, 0x9B, 0x09,  0x00, 0x00, 0x01, 0x00,  0x78, 0x6D, 0x6C, 0x00,  0xDC, 0x00, 0x96, 0x07,
-  0x00, 0x08, 0x6C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x42, 0x3C, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x1D, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xBA,
-  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBF, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,
-  0x12, 0x9D, 0x02, 0x00,  0x9D, 0x00, 0x96, 0x03,  0x00, 0x09, 0xBA, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0xBF, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xC0,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xE2, 0x01,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x66, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0x6C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0xBF, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xC3, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0xAA, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xBA, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0xBF,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xBC, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xBD, 0x01, 0x52,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,
-  0x00, 0x42, 0xFF, 0x96,  0x02, 0x00, 0x08, 0x6C,  0x1C, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xBD,  0x01, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x78,  0x6D, 0x6C, 0x00, 0xC1,
-  0x01, 0x96, 0x05, 0x00,  0x08, 0xA7, 0x09, 0xBA,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xC0, 0x01,
-  0x4E, 0x3C, 0x96, 0x02,  0x00, 0x08, 0xA7, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xD9, 0x01, 0x49, 0x9D,
-  0x02, 0x00, 0x78, 0x01,  0x96, 0x02, 0x00, 0x08,  0xA7, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x66, 0x49,
-  0x9D, 0x02, 0x00, 0x27,  0x01, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,  0x02, 0x00, 0x08, 0xE3,
-  0x49, 0x9D, 0x02, 0x00,  0x0B, 0x01, 0x96, 0x02,  0x00, 0x08, 0xA7, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0xE2, 0x49, 0x9D, 0x02,  0x00, 0xEF, 0x00, 0x96,  0x02, 0x00, 0x08, 0xA7,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xF2, 0x49, 0x9D,  0x02, 0x00, 0xD4, 0x00,  0x96, 0x02, 0x00, 0x08,  0xA7, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0A, 0x49,  0x9D, 0x02, 0x00, 0xB9,  0x00, 0x96, 0x02, 0x00,  0x08, 0xA7, 0x1C, 0x96,
-  0x02, 0x00, 0x08, 0xC1,  0x49, 0x9D, 0x02, 0x00,  0x7B, 0x00, 0x96, 0x02,  0x00, 0x08, 0xA7, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0xCA, 0x01, 0x49, 0x9D,  0x02, 0x00, 0x3C, 0x00,  0x96, 0x02, 0x00, 0x08,
-  0xA7, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xE7, 0x01,  0x49, 0x9D, 0x02, 0x00,  0x0A, 0x00, 0x96, 0x01,
-  0x00, 0x03, 0x3E, 0x99,  0x02, 0x00, 0x1B, 0x00,  0x96, 0x03, 0x00, 0x09,  0xBA, 0x01, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0xBC,  0x01, 0x4E, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0xE5,
-  0x01, 0x3D, 0x3E, 0x99,  0x02, 0x00, 0x28, 0x00,  0x96, 0x03, 0x00, 0x09,  0xBA, 0x01, 0x1C, 0x96,
-  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xE3, 0x01, 0x52, 0x3E,
-  0x99, 0x02, 0x00, 0x28,  0x00, 0x96, 0x03, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xE1, 0x01, 0x52,  0x3E, 0x99, 0x02, 0x00,
-  0x05, 0x00, 0x96, 0x01,  0x00, 0x03, 0x3E, 0x99,  0x02, 0x00, 0x05, 0x00,  0x96, 0x01, 0x00, 0x02,
-  0x3E, 0x99, 0x02, 0x00,  0x06, 0x00, 0x96, 0x02,  0x00, 0x05, 0x01, 0x3E,  0x99, 0x02, 0x00, 0x06,
-  0x00, 0x96, 0x02, 0x00,  0x05, 0x00, 0x3E, 0x99,  0x02, 0x00, 0x3B, 0x00,  0x96, 0x03, 0x00, 0x09,
-  0xBA, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xBC,  0x01, 0x4E, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x09, 0xE5,  0x01, 0x3D, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0xE6,  0x01, 0x52, 0x3E, 0x99,  0x02, 0x00, 0x26, 0x00,  0x96, 0x08, 0x00, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x09, 0xBA, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xBC, 0x01, 0x4E, 0x96,
-  0x02, 0x00, 0x08, 0x0F,  0x52, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0xE4, 0x01,
-  0x3D, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9E, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x9F, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xC1,  0x01, 0x9B, 0x09, 0x00,
-  0x00, 0x01, 0x00, 0x78,  0x6D, 0x6C, 0x00, 0x97,  0x00, 0x96, 0x08, 0x00,  0x09, 0xBE, 0x01, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x42, 0x3C, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xBA,  0x01, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0xBF, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,  0x12, 0x9D, 0x02, 0x00,
-  0x56, 0x00, 0x96, 0x03,  0x00, 0x09, 0xBA, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x4E,
+  0x02, 0x00, 0x04, 0x00,  0x4F, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x6A, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x98, 0x02, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x21, 0x01, 0x4E, 0x96,  0x05, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x49,  0x4C, 0x12, 0x9D, 0x02,  0x00, 0x17, 0x00, 0x17,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x08, 0x01,  0x4E, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0x12, 0x9D,  0x02, 0x00, 0xBD, 0x00,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x09,
+  0x00, 0x08, 0x62, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x62,
+  0x4E, 0x0D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x0A, 0x00,  0x09, 0x4D, 0x01, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x4D,  0x01, 0x4E, 0x0D, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x21, 0x01,  0x08, 0x0B, 0x1C, 0x96,
+  0x08, 0x00, 0x09, 0x08,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x87, 0x01,  0x00, 0x00, 0x4F, 0x96,
+  0x02, 0x00, 0x04, 0x00,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x05, 0x00, 0x09, 0x5C,
+  0x01, 0x08, 0x0B, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x62, 0x4E, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x0C, 0x96,  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x5C, 0x01, 0x4E,
+  0x0C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x05, 0x00, 0x09,  0x5E, 0x01, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x4D, 0x01, 0x4E,  0x96, 0x05, 0x00, 0x07,  0xFF, 0xFF, 0xFF, 0xFF,
+  0x0C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x5E,  0x01, 0x4E, 0x0C, 0x4F,
+  0x96, 0x01, 0x00, 0x03,  0x3E, 0x96, 0x04, 0x00,  0x08, 0x62, 0x08, 0x0B,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x62, 0x4E, 0x3C,  0x96, 0x05, 0x00, 0x09,  0x21, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x21, 0x01, 0x4E,  0x3C, 0x96, 0x05, 0x00,  0x09, 0x08, 0x01, 0x08,  0x0B, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x08, 0x01,  0x4E, 0x3C, 0x96, 0x05,  0x00, 0x09, 0x4D, 0x01,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x4D,  0x01, 0x4E, 0x3C, 0x96,  0x05, 0x00, 0x09, 0x6B,  0x01, 0x08, 0x62, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x1C, 0x0C,  0x96, 0x03, 0x00, 0x09,  0x21, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x08,  0x01, 0x1C, 0x0C, 0x0B,  0x3C, 0x96, 0x03, 0x00,  0x09, 0x6B, 0x01, 0x1C,
+  0x96, 0x05, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x18, 0x00, 0x96,
+  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x57, 0x01,
+  0x52, 0x17, 0x96, 0x01,  0x00, 0x03, 0x3E, 0x96,  0x0B, 0x00, 0x09, 0x6B,  0x01, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0x6B,  0x01, 0x1C, 0x0D, 0x1D,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x05,
+  0x00, 0x08, 0x62, 0x09,  0x4D, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x6B,  0x01, 0x1C, 0x0C, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x06,  0x00, 0x09, 0x21, 0x01,  0x09, 0x21, 0x01, 0x1C,
+  0x96, 0x05, 0x00, 0x07,  0xFF, 0xFF, 0xFF, 0xFF,  0x0C, 0x96, 0x03, 0x00,  0x09, 0x6B, 0x01, 0x1C,
+  0x0C, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x06, 0x00, 0x09,  0x08, 0x01, 0x09, 0x08,
+  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,  0xFF, 0xFF, 0x0C, 0x96,  0x03, 0x00, 0x09, 0x6B,
+  0x01, 0x1C, 0x0C, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x05,  0x00, 0x09, 0x4D, 0x01,
+  0x08, 0x62, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x6B,  0x01, 0x1C, 0x0C, 0x4F,  0x96, 0x05, 0x00, 0x09,
+  0x69, 0x01, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x5E, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x5C, 0x01,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1D,
+  0x01, 0x53, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x68, 0x01, 0x52,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x5C,
+  0x01, 0x09, 0x69, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x13, 0x4E, 0x96,  0x05, 0x00, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x0C,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x06, 0x00, 0x09, 0x5E,
+  0x01, 0x09, 0x69, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1F, 0x01, 0x4E,  0x96, 0x05, 0x00, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF,  0x0C, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x56, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x63, 0x01, 0x9B,  0x0C, 0x00, 0x00, 0x01,  0x00, 0x61, 0x6D, 0x6F,
+  0x75, 0x6E, 0x74, 0x00,  0x97, 0x00, 0x96, 0x06,  0x00, 0x09, 0x27, 0x01,  0x09, 0x6C, 0x01, 0x1C,
+  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x09, 0x25, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x27, 0x01, 0x52, 0x3C,  0x96, 0x06, 0x00, 0x09,  0x28, 0x01, 0x09, 0x6C,  0x01, 0x1C, 0x96, 0x08,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0x25,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x28, 0x01,
+  0x52, 0x3C, 0x96, 0x0D,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,
+  0x27, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x0C, 0x96,  0x03, 0x00, 0x09, 0x28,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x27, 0x01,
+  0x1C, 0x96, 0x07, 0x00,  0x07, 0x06, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,  0x01, 0x53, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x60, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x56,
+  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x66, 0x01, 0x9B, 0x09,
+  0x00, 0x00, 0x02, 0x00,  0x78, 0x00, 0x79, 0x00,  0x4D, 0x00, 0x96, 0x0D,  0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,  0x1F, 0x01, 0x1C, 0x96,  0x0C, 0x00, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x13, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x06,
+  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x56, 0x01, 0x53,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0B, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x60,  0x01, 0x52, 0x17, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x56, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x6D, 0x01,  0x9B, 0x07, 0x00, 0x00,  0x01, 0x00, 0x70, 0x00,
+  0xA5, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x4D, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x69,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x0C, 0x96, 0x02,
+  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x21, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x69,
+  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x4E,  0x0C, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x5E, 0x01, 0x4E, 0x47,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x62, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x69, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,
+  0x4E, 0x0C, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x08, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x69,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1F, 0x01,  0x4E, 0x0C, 0x47, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x5C, 0x01, 0x4E,  0x47, 0x96, 0x07, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x1D,  0x01, 0x53, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x56, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x6E, 0x01,  0x9B, 0x0B, 0x00, 0x00,  0x02, 0x00, 0x64, 0x78,
+  0x00, 0x64, 0x79, 0x00,  0x3C, 0x00, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x4C, 0x96, 0x03, 0x00,
+  0x09, 0x5C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x4A, 0x01, 0x1C, 0x47,  0x96, 0x03, 0x00, 0x09,
+  0x5C, 0x01, 0x4D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x4C, 0x96,  0x03, 0x00, 0x09, 0x5E,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x4B, 0x01,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0x5E, 0x01,
+  0x4D, 0x4F, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x56, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0F, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x81, 0x00, 0x96, 0x05,  0x00, 0x09, 0x6F, 0x01,
+  0x08, 0x0B, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x62,  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x70, 0x01,
+  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x21,  0x01, 0x4E, 0x47, 0x96,
+  0x03, 0x00, 0x09, 0x71,  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x08, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x72, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x4D, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x73, 0x01, 0x47,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x5C, 0x01,  0x4E, 0x47, 0x96, 0x03,
+  0x00, 0x09, 0x74, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x5E,
+  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x33,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x14, 0x00,  0x09, 0x75, 0x01, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x07, 0x51, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
+  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x1C, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x75,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0F, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0xAC,  0x00, 0x96, 0x05, 0x00,  0x09, 0x76, 0x01, 0x08,
+  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x77, 0x01,  0x4E, 0x47, 0x96, 0x03,  0x00, 0x09, 0x78, 0x01,
+  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x79,  0x01, 0x4E, 0x47, 0x96,
+  0x03, 0x00, 0x09, 0x7A,  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x7B, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x7C, 0x01, 0x47, 0x96,  0x02, 0x00, 0x08, 0x0B,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x7D, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,  0x09, 0x7E, 0x01, 0x47,
+  0x96, 0x02, 0x00, 0x08,  0x0B, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x7F, 0x01,  0x4E, 0x47, 0x96, 0x03,
+  0x00, 0x09, 0x80, 0x01,  0x47, 0x96, 0x02, 0x00,  0x08, 0x0B, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x81,
+  0x01, 0x4E, 0x47, 0x96,  0x03, 0x00, 0x09, 0x82,  0x01, 0x47, 0x96, 0x02,  0x00, 0x08, 0x0B, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0x83, 0x01, 0x4E, 0x47,  0x96, 0x03, 0x00, 0x09,  0x84, 0x01, 0x47, 0x96,
+  0x02, 0x00, 0x08, 0x0B,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x85, 0x01, 0x4E,  0x47, 0x96, 0x03, 0x00,
+  0x09, 0x33, 0x01, 0x47,  0x3E, 0x4F, 0x96, 0x0F,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0x86,
+  0x01, 0x07, 0x51, 0x04,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x75, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,
+  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x0F, 0x00,  0x07, 0x65, 0x00, 0x00,
+  0x00, 0x09, 0x87, 0x01,  0x07, 0x51, 0x04, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x1C, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x75,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
+  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x1C, 0x01,  0x4E, 0x96, 0x14, 0x00,  0x09, 0x88, 0x01, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x07, 0x52, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
+  0x3D, 0x4F, 0x96, 0x0F,  0x00, 0x07, 0x65, 0x00,  0x00, 0x00, 0x09, 0x89,  0x01, 0x07, 0x52, 0x04,
+  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x88, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x08, 0x00, 0x09, 0x8A,
+  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8C, 0x01, 0x9B, 0x1A,
+  0x00, 0x00, 0x03, 0x00,  0x6E, 0x61, 0x6D, 0x65,  0x00, 0x69, 0x6E, 0x73,  0x74, 0x61, 0x6E, 0x63,
+  0x65, 0x00, 0x6D, 0x65,  0x74, 0x68, 0x6F, 0x64,  0x00, 0xC3, 0x00, 0x96,  0x02, 0x00, 0x08, 0x97,
+  0x1C, 0x12, 0x4C, 0x9D,  0x02, 0x00, 0x1D, 0x00,  0x17, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x8A,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8B, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x8D, 0x01, 0x4E,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x06, 0x00, 0x96,  0x02, 0x00, 0x05, 0x00,
+  0x3E, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8E, 0x01,
+  0x52, 0x17, 0x9B, 0x0D,  0x00, 0x00, 0x01, 0x00,  0x72, 0x65, 0x71, 0x75,  0x65, 0x73, 0x74, 0x00,
+  0x35, 0x00, 0x96, 0x03,  0x00, 0x09, 0x90, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x97, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x8F,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x91,  0x01, 0x52, 0x3E, 0x96,  0x02, 0x00, 0x08, 0x0E,  0x1C, 0x96, 0x07, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x8B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x92, 0x01,  0x52, 0x3E, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x93,  0x01, 0x9B, 0x0A, 0x00,  0x00, 0x01, 0x00, 0x6E,
+  0x61, 0x6D, 0x65, 0x00,  0xF1, 0x02, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8D, 0x01,
+  0x4E, 0x12, 0x12, 0x9D,  0x02, 0x00, 0x05, 0x00,  0x96, 0x01, 0x00, 0x02,  0x3E, 0x96, 0x07, 0x00,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0x8B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8E, 0x01,  0x52, 0x17, 0x96, 0x06,
+  0x00, 0x09, 0x90, 0x01,  0x09, 0x94, 0x01, 0x3C,  0x96, 0x0A, 0x00, 0x09,  0x96, 0x01, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x95, 0x01, 0x52, 0x3C,  0x96, 0x03, 0x00, 0x09,
+  0x96, 0x01, 0x1C, 0x96,  0x01, 0x00, 0x02, 0x49,  0x12, 0x12, 0x9D, 0x02,  0x00, 0x18, 0x00, 0x96,
+  0x03, 0x00, 0x09, 0x90,  0x01, 0x4C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x96,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x97, 0x01,  0x47, 0x47, 0x1D, 0x96,  0x03, 0x00, 0x09, 0x90,  0x01, 0x4C, 0x1C, 0x96,
+  0x05, 0x00, 0x09, 0x98,  0x01, 0x08, 0x0E, 0x1C,  0x47, 0x96, 0x03, 0x00,  0x09, 0x99, 0x01, 0x47,
+  0x47, 0x1D, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,  0x01, 0x00, 0x00, 0x00,  0x3C, 0x96, 0x02, 0x00,
+  0x08, 0x18, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x1E,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,
+  0x48, 0x12, 0x9D, 0x02,  0x00, 0x68, 0x00, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x18, 0x1C, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x10,  0x00, 0x96, 0x03, 0x00,  0x09, 0x90, 0x01, 0x4C,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9A, 0x01, 0x47,  0x1D, 0x96, 0x03, 0x00,  0x09, 0x90, 0x01, 0x4C,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x1E, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x9B, 0x01, 0x52, 0x47,
+  0x1D, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,  0x00, 0x7E, 0xFF, 0x96,
+  0x03, 0x00, 0x09, 0x90,  0x01, 0x4C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9C,  0x01, 0x47, 0x1D, 0x96,
+  0x03, 0x00, 0x09, 0x96,  0x01, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x12,  0x12, 0x9D, 0x02, 0x00,
+  0x10, 0x00, 0x96, 0x03,  0x00, 0x09, 0x90, 0x01,  0x4C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x33, 0x01,
+  0x47, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x90, 0x01,  0x4C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9D, 0x01,
+  0x47, 0x1D, 0x96, 0x03,  0x00, 0x09, 0x96, 0x01,  0x1C, 0x96, 0x01, 0x00,  0x02, 0x49, 0x12, 0x9D,
+  0x02, 0x00, 0x15, 0x00,  0x96, 0x03, 0x00, 0x09,  0x90, 0x01, 0x4C, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x9F, 0x01, 0x47, 0x1D,  0x99, 0x02, 0x00, 0x18,  0x00, 0x96, 0x03, 0x00,  0x09, 0x90, 0x01, 0x4C,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x96, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x9E, 0x01, 0x47, 0x47,
+  0x1D, 0x96, 0x05, 0x00,  0x08, 0xE7, 0x09, 0x90,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA0,  0x01, 0x52, 0x3C, 0x96,  0x02, 0x00, 0x08, 0xE7,
+  0x1C, 0x96, 0x01, 0x00,  0x02, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x6E, 0x00,  0x96, 0x08, 0x00, 0x09,
+  0x90, 0x01, 0x09, 0xA1,  0x01, 0x08, 0x0E, 0x1C,  0x47, 0x96, 0x03, 0x00,  0x09, 0xA2, 0x01, 0x47,
+  0x96, 0x03, 0x00, 0x09,  0x1E, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0xA3, 0x01, 0x52, 0x47,  0x96, 0x03, 0x00, 0x09,  0xA4, 0x01, 0x47, 0x1D,
+  0x96, 0x05, 0x00, 0x08,  0xE7, 0x09, 0x90, 0x01,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xA5, 0x01,  0x52, 0x1D, 0x96, 0x02,  0x00, 0x08, 0xE7, 0x1C,
+  0x96, 0x01, 0x00, 0x02,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x05, 0x00, 0x96,  0x01, 0x00, 0x02, 0x3E,
+  0x96, 0x0A, 0x00, 0x09,  0xA6, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x49, 0x40, 0x3C, 0x96,
+  0x03, 0x00, 0x09, 0xA6,  0x01, 0x1C, 0x96, 0x05,  0x00, 0x09, 0xA7, 0x01,  0x05, 0x01, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0xE7,  0x1C, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0xA6, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x4F, 0x52, 0x17,  0x96, 0x03, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0xA8,  0x01, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0xA9,  0x01, 0x52, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x91, 0x01, 0x9B, 0x1D,  0x00, 0x00, 0x03, 0x00,  0x69, 0x6E, 0x73, 0x74,  0x61, 0x6E, 0x63, 0x65,
+  0x00, 0x6D, 0x65, 0x74,  0x68, 0x6F, 0x64, 0x00,  0x72, 0x65, 0x71, 0x75,  0x65, 0x73, 0x74, 0x00,
+  0x96, 0x01, 0x96, 0x0A,  0x00, 0x09, 0xA6, 0x01,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x49, 0x40,
+  0x3C, 0x96, 0x03, 0x00,  0x09, 0xA6, 0x01, 0x1C,  0x96, 0x05, 0x00, 0x09,  0xA7, 0x01, 0x05, 0x01,
+  0x4F, 0x96, 0x03, 0x00,  0x09, 0x90, 0x01, 0x1C,  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x09, 0xA6, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x4F, 0x52, 0x17, 0x96,  0x04, 0x00, 0x09, 0xAA,
+  0x01, 0x02, 0x3C, 0x96,  0x07, 0x00, 0x08, 0x18,  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,
+  0x00, 0x08, 0x18, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xA8,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xAB, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,
+  0x12, 0x9D, 0x02, 0x00,  0x64, 0x00, 0x96, 0x03,  0x00, 0x09, 0xA6, 0x01,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0xA8, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xAB, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,
+  0x1C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xAC, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1E, 0x01, 0x49,
+  0x12, 0x9D, 0x02, 0x00,  0x26, 0x00, 0x96, 0x06,  0x00, 0x09, 0xAA, 0x01,  0x09, 0xA6, 0x01, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0xA8, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xAB,  0x01, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x18, 0x1C,  0x4E, 0x1D, 0x17, 0x99,  0x02, 0x00, 0x0E, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x18, 0x4C, 0x1C, 0x50,  0x1D, 0x99, 0x02, 0x00,  0x74, 0xFF, 0x96, 0x05,  0x00, 0x08, 0xE7, 0x09,
+  0xAA, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0xAD, 0x01, 0x52, 0x96,  0x03, 0x00, 0x09, 0x8F,  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x97,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xAE, 0x01, 0x52,  0x3C, 0x96, 0x03, 0x00,
+  0x09, 0xA6, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xA8, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xAF,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xB0, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xB1, 0x01, 0x49,
+  0x9D, 0x02, 0x00, 0x2C,  0x00, 0x96, 0x02, 0x00,  0x08, 0xE7, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xB2, 0x01, 0x52, 0x3E,  0x99, 0x02, 0x00, 0x27,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0xE7, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x9B, 0x01, 0x52, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x8A,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8B, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0xB3, 0x01, 0x9B,  0x0B, 0x00, 0x00, 0x01,  0x00, 0x61, 0x72, 0x72,  0x61, 0x79, 0x00, 0x9D,
+  0x00, 0x96, 0x06, 0x00,  0x09, 0xB5, 0x01, 0x09,  0xB4, 0x01, 0x3C, 0x96,  0x07, 0x00, 0x08, 0x18,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0xB6, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,  0x4E, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x5F, 0x00,
+  0x96, 0x03, 0x00, 0x09,  0xB5, 0x01, 0x4C, 0x1C,  0x96, 0x05, 0x00, 0x09,  0xB7, 0x01, 0x08, 0x18,
+  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0xB8, 0x01,  0x47, 0x96, 0x03, 0x00,  0x09, 0xB6, 0x01, 0x1C,
   0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0xBD, 0x01, 0x52, 0x96,  0x08, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,
-  0xBE, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x16,  0x52, 0x17, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,
-  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x89, 0xFF,  0x96, 0x03, 0x00, 0x09,  0xBE, 0x01, 0x1C, 0x3E,
-  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xE8, 0x01, 0x9B,  0x0B, 0x00, 0x00, 0x01,
-  0x00, 0x61, 0x72, 0x72,  0x61, 0x79, 0x00, 0xAB,  0x00, 0x96, 0x06, 0x00,  0x09, 0xC9, 0x01, 0x09,
-  0xE9, 0x01, 0x3C, 0x96,  0x07, 0x00, 0x08, 0x18,  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,
-  0x00, 0x08, 0x18, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xCA, 0x01, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x19,
-  0x4E, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x6D, 0x00,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x96, 0x05,
-  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x49, 0x12,  0x12, 0x9D, 0x02, 0x00,  0x10, 0x00, 0x96, 0x03,
-  0x00, 0x09, 0xC9, 0x01,  0x4C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xAE, 0x01,  0x47, 0x1D, 0x96, 0x03,
-  0x00, 0x09, 0xC9, 0x01,  0x4C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xCA, 0x01,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0xEA, 0x01, 0x1C,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x9E, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9F,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0xAF, 0x01,  0x52, 0x47, 0x1D, 0x96,  0x02, 0x00, 0x08, 0x18,  0x4C, 0x1C, 0x50, 0x1D,
-  0x99, 0x02, 0x00, 0x79,  0xFF, 0x96, 0x03, 0x00,  0x09, 0xC9, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0xEB, 0x01, 0x47, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xEC, 0x01, 0x9B,
-  0x09, 0x00, 0x00, 0x01,  0x00, 0x6F, 0x62, 0x6A,  0x00, 0xB0, 0x00, 0x96,  0x06, 0x00, 0x09, 0xC9,
-  0x01, 0x09, 0xED, 0x01,  0x3C, 0x96, 0x05, 0x00,  0x09, 0xEE, 0x01, 0x05,  0x00, 0x3C, 0x96, 0x03,
-  0x00, 0x09, 0xD3, 0x01,  0x46, 0x87, 0x01, 0x00,  0x00, 0x96, 0x01, 0x00,  0x02, 0x49, 0x9D, 0x02,
-  0x00, 0x79, 0x00, 0x96,  0x04, 0x00, 0x08, 0xC3,  0x04, 0x00, 0x3C, 0x96,  0x03, 0x00, 0x09, 0xEE,
-  0x01, 0x1C, 0x12, 0x9D,  0x02, 0x00, 0x10, 0x00,  0x96, 0x03, 0x00, 0x09,  0xC9, 0x01, 0x4C, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0xAE, 0x01, 0x47, 0x1D,  0x96, 0x05, 0x00, 0x09,  0xEE, 0x01, 0x05, 0x01,
-  0x1D, 0x96, 0x03, 0x00,  0x09, 0xC9, 0x01, 0x4C,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC3, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0xEF,  0x01, 0x47, 0x96, 0x03,  0x00, 0x09, 0xD3, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0xC3, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0xAF, 0x01, 0x52,  0x47, 0x47, 0x1D, 0x99,  0x02, 0x00, 0x79, 0xFF,  0x96, 0x03, 0x00, 0x09,
-  0xC9, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xF0,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9F, 0x01, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0xAF, 0x01, 0x9B, 0x0B,  0x00, 0x00, 0x01, 0x00,  0x76, 0x61, 0x6C, 0x75,
-  0x65, 0x00, 0x00, 0x01,  0x96, 0x04, 0x00, 0x08,  0xA7, 0x08, 0x67, 0x1C,  0x44, 0x3C, 0x96, 0x02,
-  0x00, 0x08, 0xA7, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x66, 0x49, 0x9D, 0x02,  0x00, 0x93, 0x00, 0x96,
-  0x02, 0x00, 0x08, 0xA7,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xC1, 0x49, 0x9D,  0x02, 0x00, 0x18, 0x00,
-  0x96, 0x02, 0x00, 0x08,  0x67, 0x1C, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0xE5,
-  0x01, 0x3D, 0x3E, 0x99,  0x02, 0x00, 0x65, 0x00,  0x96, 0x02, 0x00, 0x08,  0x67, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x64, 0x1C,  0x54, 0x9D, 0x02, 0x00,  0x2C, 0x00, 0x96, 0x02,  0x00, 0x08, 0x67, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,
-  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xEC, 0x01, 0x52,
-  0x3E, 0x99, 0x02, 0x00,  0x27, 0x00, 0x96, 0x02,  0x00, 0x08, 0x67, 0x1C,  0x96, 0x07, 0x00, 0x07,
-  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x9F, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xE8, 0x01, 0x52,  0x3E, 0x99, 0x02, 0x00,
-  0x52, 0x00, 0x96, 0x05,  0x00, 0x09, 0xF1, 0x01,  0x08, 0x67, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xE6, 0x01, 0x52, 0x96,  0x07, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xF2, 0x01, 0x52, 0x47,  0x96, 0x03, 0x00, 0x09,
-  0xF1, 0x01, 0x47, 0x3E,  0x4F, 0x96, 0x0A, 0x00,  0x09, 0xF3, 0x01, 0x07,  0x0E, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9E,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x9F, 0x01,
-  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x02, 0x3D,  0x17, 0x96, 0x0F, 0x00,
-  0x07, 0x64, 0x00, 0x00,  0x00, 0x09, 0xF4, 0x01,  0x07, 0x0E, 0x00, 0x00,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x9E, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9F,  0x01, 0x4E, 0x96, 0x07,
-  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x08,  0x00, 0x07, 0x07, 0x10,
-  0x00, 0x00, 0x02, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x9E, 0x01,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x9F, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
-  0x96, 0x03, 0x00, 0x09,  0xF5, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x1D, 0x96,
-  0x03, 0x00, 0x09, 0xF5,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xF6, 0x01,  0x9B, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0x00,  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,
-  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xF7,
-  0x01, 0x52, 0x17, 0x4F,  0x96, 0x03, 0x00, 0x09,  0xF5, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xF8,
-  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1F,  0x00, 0x96, 0x07, 0x00,  0x08, 0x1C, 0x07, 0x00,
-  0x00, 0x00, 0x00, 0x43,  0x3C, 0x96, 0x07, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x1C, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0xF9, 0x01, 0x52, 0x17,  0x4F, 0x96, 0x03, 0x00,  0x09, 0xF5, 0x01, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0xFA, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x1F, 0x00, 0x96, 0x07,
-  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xFB, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x03,
-  0x00, 0x09, 0xF5, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xFC, 0x01, 0x9B,  0x05, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0x00, 0x96,  0x07, 0x00, 0x08, 0x1C,  0x07, 0x00, 0x00, 0x00,  0x00, 0x43, 0x3C, 0x96,
-  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xFD, 0x01,
-  0x52, 0x17, 0x4F, 0x96,  0x0B, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0xFE, 0x01, 0x09, 0xF5,
-  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x0B,
-  0x00, 0x09, 0xFF, 0x01,  0x07, 0x3A, 0x08, 0x00,  0x00, 0x09, 0xF5, 0x01,  0x1C, 0x96, 0x02, 0x00,
-  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x02, 0x3D, 0x17, 0x96,
-  0x09, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x02,  0x09, 0xF5, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x00,  0x3D, 0x17, 0x96, 0x03,
-  0x00, 0x09, 0x00, 0x02,  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x6E, 0x61,  0x6D, 0x65, 0x73, 0x00,
-  0x5A, 0x00, 0x96, 0x0D,  0x00, 0x09, 0x02, 0x02,  0x09, 0xAE, 0x01, 0x07,  0x01, 0x00, 0x00, 0x00,
-  0x08, 0xCE, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x01,  0x02, 0x52, 0x96, 0x02,  0x00, 0x08, 0x19, 0x4E,
-  0x3C, 0x96, 0x07, 0x00,  0x08, 0x18, 0x07, 0x00,  0x00, 0x00, 0x00, 0x3C,  0x96, 0x02, 0x00, 0x08,
-  0x18, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x02, 0x02,  0x1C, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x1C, 0x00,
-  0x96, 0x09, 0x00, 0x08,  0xCD, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x08,  0x40, 0x3C, 0x96, 0x02,
-  0x00, 0x08, 0x18, 0x4C,  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0xD0, 0xFF,  0x1D, 0x96, 0x03, 0x00,
-  0x09, 0x03, 0x02, 0x9B,  0x05, 0x00, 0x00, 0x00,  0x00, 0x00, 0x00, 0x1D,  0x96, 0x03, 0x00, 0x09,
-  0x03, 0x02, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x04,  0x02, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1F,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0xB2, 0x01, 0x52, 0x47,  0x96, 0x03, 0x00, 0x09,  0xB9, 0x01, 0x47, 0x47,
+  0x1D, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,  0x00, 0x87, 0xFF, 0x96,
+  0x03, 0x00, 0x09, 0xB5,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBA, 0x01,  0x47, 0x3E, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA3,  0x01, 0x9B, 0x0A, 0x00,  0x00, 0x01, 0x00, 0x61,
+  0x72, 0x67, 0x73, 0x00,  0x84, 0x00, 0x96, 0x06,  0x00, 0x09, 0xB5, 0x01,  0x09, 0xBB, 0x01, 0x3C,
+  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,  0x02, 0x00, 0x08, 0x18,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0xAA, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,
+  0x9D, 0x02, 0x00, 0x46,  0x00, 0x96, 0x03, 0x00,  0x09, 0xB5, 0x01, 0x4C,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0xAA, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xB2, 0x01, 0x52, 0x47,  0x1D, 0x96, 0x02, 0x00,
+  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,  0x00, 0xA0, 0xFF, 0x96,  0x03, 0x00, 0x09, 0xB5,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xBC, 0x01,  0x47, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0xBD,  0x01, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x6F,  0x62, 0x6A, 0x00, 0x8C,
+  0x00, 0x96, 0x06, 0x00,  0x09, 0xB5, 0x01, 0x09,  0xBE, 0x01, 0x3C, 0x96,  0x03, 0x00, 0x09, 0xBF,
+  0x01, 0x46, 0x87, 0x01,  0x00, 0x00, 0x96, 0x01,  0x00, 0x02, 0x49, 0x9D,  0x02, 0x00, 0x5E, 0x00,
+  0x96, 0x04, 0x00, 0x08,  0xB9, 0x04, 0x00, 0x3C,  0x96, 0x03, 0x00, 0x09,  0xB5, 0x01, 0x4C, 0x1C,
+  0x96, 0x05, 0x00, 0x09,  0xB7, 0x01, 0x08, 0xB9,  0x1C, 0x47, 0x96, 0x03,  0x00, 0x09, 0xB8, 0x01,
+  0x47, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xB2, 0x01, 0x52, 0x47,
+  0x96, 0x03, 0x00, 0x09,  0xB9, 0x01, 0x47, 0x47,  0x1D, 0x99, 0x02, 0x00,  0x94, 0xFF, 0x96, 0x03,
+  0x00, 0x09, 0xB5, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xC0, 0x01, 0x47,  0x3E, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xB2, 0x01,  0x9B, 0x0B, 0x00, 0x00,  0x01, 0x00, 0x76, 0x61,
+  0x6C, 0x75, 0x65, 0x00,  0x71, 0x01, 0x96, 0x04,  0x00, 0x08, 0x9D, 0x08,  0x5D, 0x1C, 0x44, 0x3C,
+  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x5C, 0x49,  0x9D, 0x02, 0x00, 0x24,
+  0x01, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x0A,  0x49, 0x9D, 0x02, 0x00,
+  0x07, 0x01, 0x96, 0x02,  0x00, 0x08, 0x9D, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xC5, 0x01, 0x49, 0x9D,
+  0x02, 0x00, 0xDE, 0x00,  0x96, 0x02, 0x00, 0x08,  0x5D, 0x1C, 0x96, 0x01,  0x00, 0x02, 0x49, 0x9D,
+  0x02, 0x00, 0xC2, 0x00,  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xC9, 0x01,
+  0x49, 0x9D, 0x02, 0x00,  0x8E, 0x00, 0x96, 0x09,  0x00, 0x08, 0x19, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x08, 0x5D, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xCC,  0x01, 0x52, 0x9D, 0x02,  0x00, 0x49, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x02, 0x00,  0x08, 0xB7, 0x49, 0x9D,  0x02, 0x00, 0x0C, 0x00,
+  0x96, 0x03, 0x00, 0x09,  0xC8, 0x01, 0x3E, 0x99,  0x02, 0x00, 0x27, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x5D, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xBD,
+  0x01, 0x52, 0x3E, 0x99,  0x02, 0x00, 0x27, 0x00,  0x96, 0x02, 0x00, 0x08,  0x5D, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xB3,  0x01, 0x52, 0x3E, 0x99,
+  0x02, 0x00, 0x1D, 0x00,  0x96, 0x02, 0x00, 0x08,  0x5D, 0x1C, 0x9D, 0x02,  0x00, 0x0B, 0x00, 0x96,
+  0x03, 0x00, 0x09, 0xCB,  0x01, 0x99, 0x02, 0x00,  0x06, 0x00, 0x96, 0x03,  0x00, 0x09, 0xCA, 0x01,
+  0x3E, 0x99, 0x02, 0x00,  0x07, 0x00, 0x96, 0x03,  0x00, 0x09, 0xC8, 0x01,  0x3E, 0x99, 0x02, 0x00,
+  0x12, 0x00, 0x96, 0x05,  0x00, 0x09, 0xC6, 0x01,  0x08, 0x5D, 0x1C, 0x47,  0x96, 0x03, 0x00, 0x09,
+  0xC7, 0x01, 0x47, 0x3E,  0x99, 0x02, 0x00, 0x07,  0x00, 0x96, 0x03, 0x00,  0x09, 0xC4, 0x01, 0x3E,
+  0x99, 0x02, 0x00, 0x32,  0x00, 0x96, 0x05, 0x00,  0x09, 0xC1, 0x01, 0x08,  0x5D, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xC2,  0x01, 0x52, 0x47, 0x96,
+  0x03, 0x00, 0x09, 0xC3,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0xCD, 0x01, 0x9B, 0x09,  0x00, 0x00, 0x01, 0x00,  0x78, 0x6D, 0x6C, 0x00,  0xDC, 0x00, 0x96, 0x07,
+  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x43, 0x3C, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x1D, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xA6,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xAB, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x4E, 0x48,
+  0x12, 0x9D, 0x02, 0x00,  0x9D, 0x00, 0x96, 0x03,  0x00, 0x09, 0xA6, 0x01,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0xAB, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xAC,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xCE, 0x01,  0x49, 0x12, 0x9D, 0x02,  0x00, 0x66, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xA6, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0xAB, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xAF, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x96, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0xAB,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0xA8, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0x8A,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8B, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0xA9, 0x01, 0x52,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,
+  0x00, 0x42, 0xFF, 0x96,  0x02, 0x00, 0x08, 0x1C,  0x1C, 0x3E, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,
+  0x03, 0x00, 0x09, 0xCF,  0x01, 0x9B, 0x09, 0x00,  0x00, 0x01, 0x00, 0x78,  0x6D, 0x6C, 0x00, 0xDC,
+  0x00, 0x96, 0x07, 0x00,  0x08, 0x62, 0x07, 0x00,  0x00, 0x00, 0x00, 0x42,  0x3C, 0x96, 0x07, 0x00,
+  0x08, 0x18, 0x07, 0x00,  0x00, 0x00, 0x00, 0x1D,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0xA6, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xAB, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x19, 0x4E, 0x48, 0x12,  0x9D, 0x02, 0x00, 0x9D,  0x00, 0x96, 0x03, 0x00,  0x09, 0xA6, 0x01, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0xAB, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x03,
+  0x00, 0x09, 0xAC, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0xCE, 0x01, 0x49,  0x12, 0x9D, 0x02, 0x00,
+  0x66, 0x00, 0x96, 0x02,  0x00, 0x08, 0x62, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0xAB,  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x18, 0x1C,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0xAF, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x96, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA6,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xAB, 0x01,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0xA8, 0x01, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0xA9, 0x01, 0x52, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x18, 0x4C, 0x1C, 0x50,
+  0x1D, 0x99, 0x02, 0x00,  0x42, 0xFF, 0x96, 0x02,  0x00, 0x08, 0x62, 0x1C,  0x3E, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xA9, 0x01,  0x9B, 0x09, 0x00, 0x00,  0x01, 0x00, 0x78, 0x6D,
+  0x6C, 0x00, 0xC1, 0x01,  0x96, 0x05, 0x00, 0x08,  0x9D, 0x09, 0xA6, 0x01,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0xAC, 0x01, 0x4E,  0x3C, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xC5,
+  0x01, 0x49, 0x9D, 0x02,  0x00, 0x78, 0x01, 0x96,  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x5C, 0x49, 0x9D,  0x02, 0x00, 0x27, 0x01,  0x96, 0x02, 0x00, 0x08,  0x9D, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0xD9, 0x49,  0x9D, 0x02, 0x00, 0x0B,  0x01, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0xD8,  0x49, 0x9D, 0x02, 0x00,  0xEF, 0x00, 0x96, 0x02,  0x00, 0x08, 0x9D, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xE8, 0x49, 0x9D, 0x02,  0x00, 0xD4, 0x00, 0x96,  0x02, 0x00, 0x08, 0x9D,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x49, 0x9D,  0x02, 0x00, 0xB9, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x9D, 0x1C, 0x96, 0x02,  0x00, 0x08, 0xB7, 0x49,  0x9D, 0x02, 0x00, 0x7B,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x9D, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xB6,  0x01, 0x49, 0x9D, 0x02,  0x00, 0x3C, 0x00, 0x96,
+  0x02, 0x00, 0x08, 0x9D,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xD3, 0x01, 0x49,  0x9D, 0x02, 0x00, 0x0A,
+  0x00, 0x96, 0x01, 0x00,  0x03, 0x3E, 0x99, 0x02,  0x00, 0x1B, 0x00, 0x96,  0x03, 0x00, 0x09, 0xA6,
+  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xA8, 0x01,  0x4E, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0xD1, 0x01,  0x3D, 0x3E, 0x99, 0x02,  0x00, 0x28, 0x00, 0x96,  0x03, 0x00, 0x09, 0xA6,
+  0x01, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xCF,
+  0x01, 0x52, 0x3E, 0x99,  0x02, 0x00, 0x28, 0x00,  0x96, 0x03, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xCD, 0x01, 0x52, 0x3E,
+  0x99, 0x02, 0x00, 0x05,  0x00, 0x96, 0x01, 0x00,  0x03, 0x3E, 0x99, 0x02,  0x00, 0x05, 0x00, 0x96,
+  0x01, 0x00, 0x02, 0x3E,  0x99, 0x02, 0x00, 0x06,  0x00, 0x96, 0x02, 0x00,  0x05, 0x01, 0x3E, 0x99,
+  0x02, 0x00, 0x06, 0x00,  0x96, 0x02, 0x00, 0x05,  0x00, 0x3E, 0x99, 0x02,  0x00, 0x3B, 0x00, 0x96,
+  0x03, 0x00, 0x09, 0xA6,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xA8, 0x01,  0x4E, 0x96, 0x08, 0x00,
+  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0xD1, 0x01,  0x3D, 0x96, 0x07, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,
+  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xD2, 0x01,  0x52, 0x3E, 0x99, 0x02,  0x00, 0x26, 0x00, 0x96,
+  0x08, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x09,  0xA6, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xA8,
+  0x01, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0F, 0x52,  0x96, 0x08, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x09, 0xD0, 0x01, 0x3D,  0x3E, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0x8A, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x8B,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0xAD, 0x01,
+  0x9B, 0x09, 0x00, 0x00,  0x01, 0x00, 0x78, 0x6D,  0x6C, 0x00, 0x97, 0x00,  0x96, 0x08, 0x00, 0x09,
+  0xAA, 0x01, 0x07, 0x00,  0x00, 0x00, 0x00, 0x42,  0x3C, 0x96, 0x07, 0x00,  0x08, 0x18, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x3C,  0x96, 0x02, 0x00, 0x08,  0x18, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xA6, 0x01,
+  0x1C, 0x96, 0x03, 0x00,  0x09, 0xAB, 0x01, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x19, 0x4E, 0x48, 0x12,
+  0x9D, 0x02, 0x00, 0x56,  0x00, 0x96, 0x03, 0x00,  0x09, 0xA6, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,
+  0xAB, 0x01, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x1C, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xA9,  0x01, 0x52, 0x96, 0x08,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x09, 0xAA,  0x01, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x16, 0x52,  0x17, 0x96, 0x02, 0x00,
+  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,  0x00, 0x89, 0xFF, 0x96,  0x03, 0x00, 0x09, 0xAA,
+  0x01, 0x1C, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xD4, 0x01, 0x9B, 0x0B,
+  0x00, 0x00, 0x01, 0x00,  0x61, 0x72, 0x72, 0x61,  0x79, 0x00, 0xAB, 0x00,  0x96, 0x06, 0x00, 0x09,
+  0xB5, 0x01, 0x09, 0xD5,  0x01, 0x3C, 0x96, 0x07,  0x00, 0x08, 0x18, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xB6,  0x01, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x19, 0x4E,  0x48, 0x12, 0x9D, 0x02,  0x00, 0x6D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x18,
+  0x1C, 0x96, 0x05, 0x00,  0x07, 0x00, 0x00, 0x00,  0x00, 0x49, 0x12, 0x12,  0x9D, 0x02, 0x00, 0x10,
+  0x00, 0x96, 0x03, 0x00,  0x09, 0xB5, 0x01, 0x4C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x9A, 0x01, 0x47,
+  0x1D, 0x96, 0x03, 0x00,  0x09, 0xB5, 0x01, 0x4C,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xB6, 0x01, 0x1C,
+  0x96, 0x03, 0x00, 0x09,  0xD6, 0x01, 0x1C, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x8A,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8B, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x9B, 0x01, 0x52,  0x47, 0x1D, 0x96, 0x02,  0x00, 0x08, 0x18, 0x4C,
+  0x1C, 0x50, 0x1D, 0x99,  0x02, 0x00, 0x79, 0xFF,  0x96, 0x03, 0x00, 0x09,  0xB5, 0x01, 0x1C, 0x96,
+  0x03, 0x00, 0x09, 0xD7,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0xD8, 0x01, 0x9B, 0x09,  0x00, 0x00, 0x01, 0x00,  0x6F, 0x62, 0x6A, 0x00,  0xB0, 0x00, 0x96, 0x06,
+  0x00, 0x09, 0xB5, 0x01,  0x09, 0xD9, 0x01, 0x3C,  0x96, 0x05, 0x00, 0x09,  0xDA, 0x01, 0x05, 0x00,
+  0x3C, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x46,  0x87, 0x01, 0x00, 0x00,  0x96, 0x01, 0x00, 0x02,
+  0x49, 0x9D, 0x02, 0x00,  0x79, 0x00, 0x96, 0x04,  0x00, 0x08, 0xB9, 0x04,  0x00, 0x3C, 0x96, 0x03,
+  0x00, 0x09, 0xDA, 0x01,  0x1C, 0x12, 0x9D, 0x02,  0x00, 0x10, 0x00, 0x96,  0x03, 0x00, 0x09, 0xB5,
+  0x01, 0x4C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x9A,  0x01, 0x47, 0x1D, 0x96,  0x05, 0x00, 0x09, 0xDA,
+  0x01, 0x05, 0x01, 0x1D,  0x96, 0x03, 0x00, 0x09,  0xB5, 0x01, 0x4C, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0xB9, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xDB, 0x01,  0x47, 0x96, 0x03, 0x00,  0x09, 0xBF, 0x01, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0xB9, 0x1C, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x9B, 0x01, 0x52, 0x47,  0x47, 0x1D, 0x99, 0x02,  0x00, 0x79, 0xFF, 0x96,
+  0x03, 0x00, 0x09, 0xB5,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xDC, 0x01,  0x47, 0x3E, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x9B,  0x01, 0x9B, 0x0B, 0x00,  0x00, 0x01, 0x00, 0x76,
+  0x61, 0x6C, 0x75, 0x65,  0x00, 0x00, 0x01, 0x96,  0x04, 0x00, 0x08, 0x9D,  0x08, 0x5D, 0x1C, 0x44,
+  0x3C, 0x96, 0x02, 0x00,  0x08, 0x9D, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x5C,  0x49, 0x9D, 0x02, 0x00,
+  0x93, 0x00, 0x96, 0x02,  0x00, 0x08, 0x9D, 0x1C,  0x96, 0x02, 0x00, 0x08,  0xB7, 0x49, 0x9D, 0x02,
+  0x00, 0x18, 0x00, 0x96,  0x02, 0x00, 0x08, 0x5D,  0x1C, 0x96, 0x08, 0x00,  0x07, 0x01, 0x00, 0x00,
+  0x00, 0x09, 0xD1, 0x01,  0x3D, 0x3E, 0x99, 0x02,  0x00, 0x65, 0x00, 0x96,  0x02, 0x00, 0x08, 0x5D,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x5A, 0x1C, 0x54,  0x9D, 0x02, 0x00, 0x2C,  0x00, 0x96, 0x02, 0x00,
+  0x08, 0x5D, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,
+  0xD8, 0x01, 0x52, 0x3E,  0x99, 0x02, 0x00, 0x27,  0x00, 0x96, 0x02, 0x00,  0x08, 0x5D, 0x1C, 0x96,
+  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,
+  0x4E, 0x96, 0x03, 0x00,  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x03, 0x00, 0x09,  0xD4, 0x01, 0x52, 0x3E,
+  0x99, 0x02, 0x00, 0x52,  0x00, 0x96, 0x05, 0x00,  0x09, 0xDD, 0x01, 0x08,  0x5D, 0x1C, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xD2,  0x01, 0x52, 0x96, 0x07,
+  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x03, 0x00, 0x09, 0xDE,  0x01, 0x52, 0x47, 0x96,
+  0x03, 0x00, 0x09, 0xDD,  0x01, 0x47, 0x3E, 0x4F,  0x96, 0x0A, 0x00, 0x09,  0xDF, 0x01, 0x07, 0x0E,
+  0x00, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x8A, 0x01,  0x4E, 0x96, 0x03, 0x00,
+  0x09, 0x8B, 0x01, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,
+  0x96, 0x0F, 0x00, 0x07,  0x64, 0x00, 0x00, 0x00,  0x09, 0xE0, 0x01, 0x07,  0x0E, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x8A,  0x01, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x8B, 0x01,
+  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x03, 0x3D,  0x17, 0x96, 0x08, 0x00,
+  0x07, 0x07, 0x10, 0x00,  0x00, 0x02, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x8A, 0x01, 0x4E,
+  0x96, 0x03, 0x00, 0x09,  0x8B, 0x01, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x17, 0x96,  0x03, 0x00, 0x09, 0xE1,  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1D, 0x96, 0x03,  0x00, 0x09, 0xE1, 0x01,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xE2, 0x01, 0x9B,
+  0x05, 0x00, 0x00, 0x00,  0x00, 0x1F, 0x00, 0x96,  0x07, 0x00, 0x08, 0x1C,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x43, 0x3C, 0x96,  0x07, 0x00, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x1C, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0xE3, 0x01,  0x52, 0x17, 0x4F, 0x96,  0x03, 0x00, 0x09, 0xE1,  0x01, 0x1C, 0x96, 0x03,
+  0x00, 0x09, 0xE4, 0x01,  0x9B, 0x05, 0x00, 0x00,  0x00, 0x00, 0x1F, 0x00,  0x96, 0x07, 0x00, 0x08,
+  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x08, 0x1C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xE5,  0x01, 0x52, 0x17, 0x4F,  0x96, 0x03, 0x00, 0x09,
+  0xE1, 0x01, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xE6,  0x01, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x1F,
   0x00, 0x96, 0x07, 0x00,  0x08, 0x1C, 0x07, 0x00,  0x00, 0x00, 0x00, 0x43,  0x3C, 0x96, 0x07, 0x00,
-  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x05, 0x02, 0x52, 0x17,
-  0x4F, 0x96, 0x0B, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0x04, 0x02,  0x09, 0x03, 0x02, 0x1C,
-  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x14, 0x00, 0x09,
-  0x06, 0x02, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x69, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x3A, 0x3D,  0x1D, 0x96, 0x03, 0x00,  0x09, 0x06, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0x9E, 0x05,  0x01, 0x4F, 0x96, 0x03,  0x00, 0x09, 0x06, 0x02,
-  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x04, 0x00, 0x08, 0x9F,  0x05, 0x01, 0x4F, 0x96,
-  0x03, 0x00, 0x09, 0x06,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x14, 0x00, 0x09,
-  0x07, 0x02, 0x07, 0x03,  0x00, 0x00, 0x00, 0x07,  0x69, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
-  0x00, 0x08, 0x01, 0x3D,  0x4F, 0x96, 0x10, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x09, 0x08, 0x02,
-  0x07, 0x69, 0x00, 0x00,  0x00, 0x09, 0x06, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
-  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x17, 0x96,  0x0F, 0x00, 0x07, 0xC8,
-  0x00, 0x00, 0x00, 0x08,  0xBD, 0x07, 0x84, 0x03,  0x00, 0x00, 0x09, 0x06,  0x02, 0x1C, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x08,  0x00, 0x09, 0x09, 0x02,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x09, 0x02, 0x4E,
-  0x96, 0x14, 0x00, 0x09,  0x0A, 0x02, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x58, 0x04, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x3A, 0x3D,  0x4F, 0x96, 0x0F, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x09, 0x0B, 0x02,  0x07, 0x58, 0x04, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x0A,  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x02, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x14, 0x00,  0x09, 0x0C, 0x02, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x07, 0x53, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x0C,  0x02, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x0D, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x09,  0x02, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x0A, 0x02,
-  0x53, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x0C,  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x53, 0x3A, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0x0D, 0x02, 0x07, 0x53,
-  0x04, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x0C, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
-  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x09, 0x02, 0x4E, 0x96,  0x14, 0x00, 0x09, 0x0E,  0x02, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x4E,
-  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x0E, 0x02, 0x4E,
-  0x96, 0x09, 0x00, 0x08,  0x0D, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,
-  0x09, 0x09, 0x02, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x0A, 0x02, 0x53, 0x4F,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x0E, 0x02, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x53, 0x3A,  0x17, 0x96, 0x0F, 0x00,
-  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0x0F, 0x02,  0x07, 0x4E, 0x04, 0x00,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x0E,  0x02, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x14, 0x00,
-  0x09, 0x10, 0x02, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x56, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x10,  0x02, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x0D, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x09,  0x02, 0x4E, 0x96, 0x03,
-  0x00, 0x09, 0x0A, 0x02,  0x53, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x10,  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x53, 0x3A, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,
-  0x11, 0x02, 0x07, 0x56,  0x04, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x10, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,
-  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x14, 0x00, 0x09, 0x12,  0x02, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x55,  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x12, 0x02, 0x4E,  0x96, 0x09, 0x00, 0x08,  0x0D, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x04,
-  0x1C, 0x96, 0x03, 0x00,  0x09, 0x09, 0x02, 0x4E,  0x96, 0x03, 0x00, 0x09,  0x0A, 0x02, 0x53, 0x4F,
-  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,
-  0x09, 0x12, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x53, 0x3A,
-  0x17, 0x96, 0x0F, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0x13, 0x02,  0x07, 0x55, 0x04, 0x00,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x12,
-  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
-  0x08, 0x03, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,
-  0x4E, 0x96, 0x14, 0x00,  0x09, 0x14, 0x02, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x57, 0x04, 0x00,
-  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x14,  0x02, 0x4E, 0x96, 0x09,
-  0x00, 0x08, 0x0D, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x09,
-  0x02, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x0A, 0x02,  0x53, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x14,  0x02, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x53, 0x3A, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x09,  0x15, 0x02, 0x07, 0x57,  0x04, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x14, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x14, 0x00, 0x09, 0x16,
-  0x02, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x4D,  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
-  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x16, 0x02, 0x4E,  0x96, 0x09, 0x00, 0x08,  0x0D, 0x07, 0x00, 0x00,
-  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x09, 0x02, 0x4E,  0x96, 0x03, 0x00, 0x09,
-  0x0A, 0x02, 0x53, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,
-  0x4E, 0x96, 0x03, 0x00,  0x09, 0x16, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x53, 0x3A,  0x17, 0x96, 0x0F, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x09, 0x17, 0x02,
-  0x07, 0x4D, 0x04, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x16,  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x07, 0x00, 0x07,
-  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x14, 0x00,  0x09, 0x18, 0x02, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x07, 0x4F, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,  0x3D, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x18,
-  0x02, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x0D, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x04, 0x1C, 0x96,
-  0x03, 0x00, 0x09, 0x09,  0x02, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x0A, 0x02,  0x53, 0x4F, 0x96, 0x02,
-  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x18,
-  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x53, 0x3A, 0x17, 0x96,
-  0x0F, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x09,  0x19, 0x02, 0x07, 0x4F,  0x04, 0x00, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x18, 0x02, 0x4E,
-  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,
-  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,
-  0x14, 0x00, 0x09, 0x1A,  0x02, 0x07, 0xE8, 0x03,  0x00, 0x00, 0x07, 0x54,  0x04, 0x00, 0x00, 0x07,
-  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1A, 0x02, 0x4E,  0x96, 0x09, 0x00, 0x08,
-  0x0D, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x03, 0x00,  0x09, 0x09, 0x02, 0x4E,
-  0x96, 0x03, 0x00, 0x09,  0x0A, 0x02, 0x53, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1A, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x53, 0x3A,  0x17, 0x96, 0x0F, 0x00,  0x07, 0x01, 0x00, 0x00,
-  0x00, 0x09, 0x1B, 0x02,  0x07, 0x54, 0x04, 0x00,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,
-  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1A,  0x02, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0D, 0x4E,
-  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x03, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,
-  0x04, 0x1C, 0x96, 0x03,  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x14, 0x00,  0x09, 0x1C, 0x02, 0x07,
-  0x00, 0x00, 0x00, 0x00,  0x07, 0x54, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x3A,
-  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,
-  0x03, 0x00, 0x09, 0x1C,  0x02, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x0D, 0x07,  0x00, 0x00, 0x00, 0x00,
-  0x08, 0x04, 0x1C, 0x96,  0x03, 0x00, 0x09, 0x09,  0x02, 0x4E, 0x96, 0x03,  0x00, 0x09, 0x0A, 0x02,
-  0x53, 0x4C, 0x96, 0x02,  0x00, 0x08, 0x1C, 0x4D,  0x1D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x04, 0x1C,
-  0x96, 0x03, 0x00, 0x09,  0x09, 0x02, 0x4E, 0x96,  0x03, 0x00, 0x09, 0x1C,  0x02, 0x4E, 0x96, 0x02,
-  0x00, 0x08, 0x0D, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x53, 0x3A, 0x17, 0x96,  0x0F, 0x00, 0x07, 0x01,
-  0x00, 0x00, 0x00, 0x09,  0x1B, 0x02, 0x07, 0x54,  0x04, 0x00, 0x00, 0x08,  0x04, 0x1C, 0x96, 0x03,
-  0x00, 0x09, 0x09, 0x02,  0x4E, 0x96, 0x03, 0x00,  0x09, 0x1C, 0x02, 0x4E,  0x96, 0x02, 0x00, 0x08,
-  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x14,
-  0x00, 0x09, 0x1D, 0x02,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0xFA, 0x00,  0x00, 0x00, 0x07, 0x02,
-  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x1D, 0x96,  0x14, 0x00, 0x09, 0x1E,  0x02, 0x07, 0x01, 0x00,
-  0x00, 0x00, 0x07, 0xFA,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x1D,
-  0x96, 0x14, 0x00, 0x09,  0x1F, 0x02, 0x07, 0x02,  0x00, 0x00, 0x00, 0x07,  0xFA, 0x00, 0x00, 0x00,
-  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x1D, 0x96, 0x06, 0x00,  0x09, 0x20, 0x02, 0x09,
-  0x1E, 0x02, 0x1C, 0x1D,  0x96, 0x14, 0x00, 0x09,  0x21, 0x02, 0x07, 0x01,  0x00, 0x00, 0x00, 0x07,
-  0xFD, 0x03, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,  0x1D, 0x96, 0x14, 0x00,
-  0x09, 0x22, 0x02, 0x07,  0x04, 0x00, 0x00, 0x00,  0x07, 0x64, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,
-  0x00, 0x00, 0x08, 0x01,  0x3D, 0x1D, 0x96, 0x14,  0x00, 0x09, 0x23, 0x02,  0x07, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x09, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x1D, 0x96,
-  0x03, 0x00, 0x08, 0x1C,  0x02, 0x1D, 0x96, 0x09,  0x00, 0x07, 0x00, 0x10,  0x00, 0x00, 0x08, 0x04,
-  0x08, 0x0B, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,
-  0x09, 0x00, 0x07, 0x80,  0x00, 0x00, 0x00, 0x08,  0x07, 0x08, 0x05, 0x1C,  0x96, 0x07, 0x00, 0x07,
-  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x08, 0x00, 0x07,  0x83, 0x00, 0x00, 0x00,
-  0x02, 0x08, 0x10, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,
-  0x96, 0x0D, 0x00, 0x07,  0x06, 0x00, 0x00, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x02, 0x08, 0x0B,
-  0x1C, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x00
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x1C, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xE7, 0x01, 0x52, 0x17,
+  0x4F, 0x96, 0x03, 0x00,  0x09, 0xE1, 0x01, 0x1C,  0x96, 0x03, 0x00, 0x09,  0xE8, 0x01, 0x9B, 0x05,
+  0x00, 0x00, 0x00, 0x00,  0x1F, 0x00, 0x96, 0x07,  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x43, 0x3C, 0x96, 0x07,  0x00, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x1C,  0x1C, 0x96, 0x03, 0x00,
+  0x09, 0xE9, 0x01, 0x52,  0x17, 0x4F, 0x96, 0x0B,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x09, 0xEA,
+  0x01, 0x09, 0xE1, 0x01,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,
+  0x17, 0x96, 0x0B, 0x00,  0x09, 0xEB, 0x01, 0x07,  0x3A, 0x08, 0x00, 0x00,  0x09, 0xE1, 0x01, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x08, 0x02,
+  0x3D, 0x17, 0x96, 0x09,  0x00, 0x07, 0x03, 0x00,  0x00, 0x00, 0x02, 0x09,  0xE1, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,
+  0x17, 0x96, 0x03, 0x00,  0x09, 0xEC, 0x01, 0x9B,  0x0B, 0x00, 0x00, 0x01,  0x00, 0x6E, 0x61, 0x6D,
+  0x65, 0x73, 0x00, 0x5A,  0x00, 0x96, 0x0D, 0x00,  0x09, 0xEE, 0x01, 0x09,  0x9A, 0x01, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0xC4, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xED, 0x01,  0x52, 0x96, 0x02, 0x00,
+  0x08, 0x19, 0x4E, 0x3C,  0x96, 0x07, 0x00, 0x08,  0x18, 0x07, 0x00, 0x00,  0x00, 0x00, 0x3C, 0x96,
+  0x02, 0x00, 0x08, 0x18,  0x1C, 0x96, 0x03, 0x00,  0x09, 0xEE, 0x01, 0x1C,  0x48, 0x12, 0x9D, 0x02,
+  0x00, 0x1C, 0x00, 0x96,  0x09, 0x00, 0x08, 0xC3,  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x08, 0x40,
+  0x3C, 0x96, 0x02, 0x00,  0x08, 0x18, 0x4C, 0x1C,  0x50, 0x1D, 0x99, 0x02,  0x00, 0xD0, 0xFF, 0x1D,
+  0x96, 0x03, 0x00, 0x09,  0xEF, 0x01, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x00, 0x00, 0x1D, 0x96,
+  0x03, 0x00, 0x09, 0xEF,  0x01, 0x1C, 0x96, 0x03,  0x00, 0x09, 0xF0, 0x01,  0x9B, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0x00,  0x96, 0x07, 0x00, 0x08,  0x1C, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x3C,
+  0x96, 0x07, 0x00, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x1C, 0x96,  0x03, 0x00, 0x09, 0xF1,
+  0x01, 0x52, 0x17, 0x4F,  0x96, 0x0B, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x09, 0xF0, 0x01, 0x09,
+  0xEF, 0x01, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,
+  0x14, 0x00, 0x09, 0xF2,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x69,  0x00, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x3A, 0x3D, 0x1D,  0x96, 0x03, 0x00, 0x09,  0xF2, 0x01, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x0D,  0x4E, 0x96, 0x04, 0x00,  0x08, 0x94, 0x05, 0x01,  0x4F, 0x96, 0x03, 0x00,
+  0x09, 0xF2, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x0D, 0x4E, 0x96, 0x04,  0x00, 0x08, 0x95, 0x05,
+  0x01, 0x4F, 0x96, 0x03,  0x00, 0x09, 0xF2, 0x01,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,
+  0x14, 0x00, 0x09, 0xF3,  0x01, 0x07, 0x03, 0x00,  0x00, 0x00, 0x07, 0x69,  0x00, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x10, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
+  0x09, 0xF4, 0x01, 0x07,  0x69, 0x00, 0x00, 0x00,  0x09, 0xF2, 0x01, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x0D, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x03,  0x3D, 0x17, 0x96, 0x0F,
+  0x00, 0x07, 0xC8, 0x00,  0x00, 0x00, 0x08, 0xB3,  0x07, 0x84, 0x03, 0x00,  0x00, 0x09, 0xF2, 0x01,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x0D, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,
+  0x03, 0x3D, 0x17, 0x96,  0x14, 0x00, 0x09, 0xF5,  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0xFA,
+  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x1D,  0x96, 0x14, 0x00, 0x09,
+  0xF6, 0x01, 0x07, 0x01,  0x00, 0x00, 0x00, 0x07,  0xFA, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x01, 0x3D,  0x1D, 0x96, 0x14, 0x00,  0x09, 0xF7, 0x01, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x07, 0xFA, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,  0x3D, 0x1D, 0x96, 0x06,
+  0x00, 0x09, 0xF8, 0x01,  0x09, 0xF6, 0x01, 0x1C,  0x1D, 0x96, 0x14, 0x00,  0x09, 0xF9, 0x01, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x07, 0xFD, 0x03, 0x00,  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x1D, 0x96, 0x14,  0x00, 0x09, 0xFA, 0x01,  0x07, 0x04, 0x00, 0x00,  0x00, 0x07, 0x64, 0x00,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x1D, 0x96,  0x14, 0x00, 0x09, 0xFB,
+  0x01, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x09,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x3D, 0x1D,  0x96, 0x03, 0x00, 0x08,  0x1C, 0x02, 0x1D, 0x96,  0x09, 0x00, 0x07, 0x00,
+  0x10, 0x00, 0x00, 0x08,  0x04, 0x08, 0x0B, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x3D, 0x17,  0x96, 0x09, 0x00, 0x07,  0x80, 0x00, 0x00, 0x00,  0x08, 0x07, 0x08, 0x05,
+  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x08, 0x00,
+  0x07, 0x83, 0x00, 0x00,  0x00, 0x02, 0x08, 0x10,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x0D, 0x00,  0x07, 0x06, 0x00, 0x00,  0x00, 0x07, 0x01, 0x00,
+  0x00, 0x00, 0x02, 0x08,  0x0B, 0x1C, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x00,
+  0x3D, 0x17, 0x00
+};
+
+/* compiled from swfdec_initialize_xml_node.as */
+static const unsigned char swfdec_initialize_xml_node[] = {
+  0x88, 0x9C, 0x00, 0x0C,  0x00, 0x41, 0x53, 0x6E,  0x61, 0x74, 0x69, 0x76,  0x65, 0x00, 0x70, 0x72,
+  0x6F, 0x74, 0x6F, 0x74,  0x79, 0x70, 0x65, 0x00,  0x74, 0x6F, 0x53, 0x74,  0x72, 0x69, 0x6E, 0x67,
+  0x00, 0x41, 0x53, 0x63,  0x6F, 0x6E, 0x73, 0x74,  0x72, 0x75, 0x63, 0x74,  0x6F, 0x72, 0x00, 0x58,
+  0x4D, 0x4C, 0x4E, 0x6F,  0x64, 0x65, 0x00, 0x63,  0x6C, 0x6F, 0x6E, 0x65,  0x4E, 0x6F, 0x64, 0x65,
+  0x00, 0x72, 0x65, 0x6D,  0x6F, 0x76, 0x65, 0x4E,  0x6F, 0x64, 0x65, 0x00,  0x69, 0x6E, 0x73, 0x65,
+  0x72, 0x74, 0x42, 0x65,  0x66, 0x6F, 0x72, 0x65,  0x00, 0x61, 0x70, 0x70,  0x65, 0x6E, 0x64, 0x43,
+  0x68, 0x69, 0x6C, 0x64,  0x00, 0x68, 0x61, 0x73,  0x43, 0x68, 0x69, 0x6C,  0x64, 0x4E, 0x6F, 0x64,
+  0x65, 0x73, 0x00, 0x67,  0x65, 0x74, 0x4E, 0x61,  0x6D, 0x65, 0x73, 0x70,  0x61, 0x63, 0x65, 0x46,
+  0x6F, 0x72, 0x50, 0x72,  0x65, 0x66, 0x69, 0x78,  0x00, 0x67, 0x65, 0x74,  0x50, 0x72, 0x65, 0x66,
+  0x69, 0x78, 0x46, 0x6F,  0x72, 0x4E, 0x61, 0x6D,  0x65, 0x73, 0x70, 0x61,  0x63, 0x65, 0x00, 0x96,
+  0x13, 0x00, 0x08, 0x04,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x03, 0x3D, 0x1D, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x05,  0x07, 0x01, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x06,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x07,
+  0x07, 0x03, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,
+  0x13, 0x00, 0x08, 0x08,  0x07, 0x04, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x09,  0x07, 0x05, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x02,  0x07, 0x06, 0x00, 0x00,
+  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x0A,
+  0x07, 0x07, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x04,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x01, 0x4E, 0x96,
+  0x13, 0x00, 0x08, 0x0B,  0x07, 0x08, 0x00, 0x00,  0x00, 0x07, 0xFD, 0x00,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x4F, 0x00
+};
+
+/* compiled from swfdec_initialize_xml.as */
+static const unsigned char swfdec_initialize_xml[] = {
+  0x88, 0x2A, 0x01, 0x21,  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x50, 0x72,  0x6F, 0x70, 0x46, 0x6C,
+  0x61, 0x67, 0x73, 0x00,  0x41, 0x53, 0x6E, 0x61,  0x74, 0x69, 0x76, 0x65,  0x00, 0x75, 0x6E, 0x64,
+  0x65, 0x66, 0x69, 0x6E,  0x65, 0x64, 0x00, 0x74,  0x68, 0x69, 0x73, 0x00,  0x70, 0x72, 0x6F, 0x74,
+  0x6F, 0x74, 0x79, 0x70,  0x65, 0x00, 0x70, 0x75,  0x73, 0x68, 0x00, 0x69,  0x00, 0x6C, 0x65, 0x6E,
+  0x67, 0x74, 0x68, 0x00,  0x41, 0x53, 0x63, 0x6F,  0x6E, 0x73, 0x74, 0x72,  0x75, 0x63, 0x74, 0x6F,
+  0x72, 0x00, 0x58, 0x4D,  0x4C, 0x4E, 0x6F, 0x64,  0x65, 0x00, 0x58, 0x4D,  0x4C, 0x00, 0x00, 0x63,
+  0x6F, 0x6E, 0x73, 0x74,  0x72, 0x75, 0x63, 0x74,  0x6F, 0x72, 0x00, 0x6C,  0x6F, 0x61, 0x64, 0x00,
+  0x73, 0x65, 0x6E, 0x64,  0x00, 0x73, 0x65, 0x6E,  0x64, 0x41, 0x6E, 0x64,  0x4C, 0x6F, 0x61, 0x64,
+  0x00, 0x63, 0x72, 0x65,  0x61, 0x74, 0x65, 0x45,  0x6C, 0x65, 0x6D, 0x65,  0x6E, 0x74, 0x00, 0x63,
+  0x72, 0x65, 0x61, 0x74,  0x65, 0x54, 0x65, 0x78,  0x74, 0x4E, 0x6F, 0x64,  0x65, 0x00, 0x70, 0x61,
+  0x72, 0x73, 0x65, 0x58,  0x4D, 0x4C, 0x00, 0x6F,  0x6E, 0x4C, 0x6F, 0x61,  0x64, 0x00, 0x6F, 0x6E,
+  0x44, 0x61, 0x74, 0x61,  0x00, 0x73, 0x72, 0x63,  0x00, 0x6C, 0x6F, 0x61,  0x64, 0x65, 0x64, 0x00,
+  0x67, 0x65, 0x74, 0x42,  0x79, 0x74, 0x65, 0x73,  0x4C, 0x6F, 0x61, 0x64,  0x65, 0x64, 0x00, 0x5F,
+  0x62, 0x79, 0x74, 0x65,  0x73, 0x4C, 0x6F, 0x61,  0x64, 0x65, 0x64, 0x00,  0x67, 0x65, 0x74, 0x42,
+  0x79, 0x74, 0x65, 0x73,  0x54, 0x6F, 0x74, 0x61,  0x6C, 0x00, 0x5F, 0x62,  0x79, 0x74, 0x65, 0x73,
+  0x54, 0x6F, 0x74, 0x61,  0x6C, 0x00, 0x61, 0x64,  0x64, 0x52, 0x65, 0x71,  0x75, 0x65, 0x73, 0x74,
+  0x48, 0x65, 0x61, 0x64,  0x65, 0x72, 0x00, 0x5F,  0x63, 0x75, 0x73, 0x74,  0x6F, 0x6D, 0x48, 0x65,
+  0x61, 0x64, 0x65, 0x72,  0x73, 0x00, 0x41, 0x72,  0x72, 0x61, 0x79, 0x00,  0x6B, 0x65, 0x79, 0x00,
+  0x73, 0x74, 0x72, 0x69,  0x6E, 0x67, 0x00, 0x76,  0x61, 0x6C, 0x75, 0x65,  0x00, 0x96, 0x13, 0x00,
+  0x08, 0x0A, 0x07, 0x09,  0x00, 0x00, 0x00, 0x07,  0xFD, 0x00, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x08, 0x3D,  0x1D, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x1C, 0x96,  0x10, 0x00, 0x08, 0x04,
+  0x08, 0x0B, 0x07, 0x01,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x09, 0x40, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0C, 0x3A, 0x17, 0x96,  0x09, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,  0x04, 0x08, 0x0A, 0x1C,
+  0x96, 0x07, 0x00, 0x07,  0x03, 0x00, 0x00, 0x00,  0x08, 0x00, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,
+  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x13, 0x00, 0x08,  0x0D, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x13, 0x00, 0x08,
+  0x0E, 0x07, 0x01, 0x00,  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,
+  0x96, 0x13, 0x00, 0x08,  0x0F, 0x07, 0x02, 0x00,  0x00, 0x00, 0x07, 0x2D,  0x01, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x04, 0x4E,  0x96, 0x13, 0x00, 0x08,  0x10, 0x07, 0x0A, 0x00,  0x00, 0x00, 0x07, 0xFD,
+  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x13, 0x00, 0x08,  0x11, 0x07, 0x0B, 0x00,
+  0x00, 0x00, 0x07, 0xFD,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x13, 0x00, 0x08,
+  0x12, 0x07, 0x0C, 0x00,  0x00, 0x00, 0x07, 0xFD,  0x00, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x13, 0x9B, 0x05, 0x00,  0x00, 0x00, 0x00, 0x00,  0x00, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0A, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x04, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x14, 0x9B,
+  0x09, 0x00, 0x00, 0x01,  0x00, 0x73, 0x72, 0x63,  0x00, 0x72, 0x00, 0x96,  0x02, 0x00, 0x08, 0x15,
+  0x1C, 0x96, 0x01, 0x00,  0x02, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x27, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x03, 0x1C, 0x96, 0x04,  0x00, 0x08, 0x16, 0x05,  0x00, 0x4F, 0x96, 0x09,  0x00, 0x05, 0x00, 0x07,
+  0x01, 0x00, 0x00, 0x00,  0x08, 0x03, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x13,  0x52, 0x17, 0x99, 0x02,
+  0x00, 0x3A, 0x00, 0x96,  0x02, 0x00, 0x08, 0x03,  0x1C, 0x96, 0x04, 0x00,  0x08, 0x16, 0x05, 0x01,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x15, 0x1C, 0x96,  0x07, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x03, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x12, 0x52,  0x17, 0x96, 0x09, 0x00,  0x05, 0x01, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x08,  0x03, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x13, 0x52,  0x17, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x0A, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x04, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x17, 0x9B,
+  0x05, 0x00, 0x00, 0x00,  0x00, 0x0D, 0x00, 0x96,  0x02, 0x00, 0x08, 0x03,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x18, 0x4E, 0x3E,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x0A, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x04,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x19, 0x9B, 0x05,  0x00, 0x00, 0x00, 0x00,  0x0D, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0x03, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x1A, 0x4E, 0x3E, 0x4F,  0x96, 0x02, 0x00, 0x08,
+  0x0A, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x04, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x1B, 0x9B, 0x0F, 0x00,
+  0x00, 0x02, 0x00, 0x6B,  0x65, 0x79, 0x00, 0x76,  0x61, 0x6C, 0x75, 0x65,  0x00, 0x21, 0x01, 0x96,
+  0x02, 0x00, 0x08, 0x03,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x1C, 0x4E, 0x44,  0x96, 0x02, 0x00, 0x08,
+  0x02, 0x49, 0x12, 0x9D,  0x02, 0x00, 0x2D, 0x00,  0x96, 0x02, 0x00, 0x08,  0x03, 0x1C, 0x96, 0x09,
+  0x00, 0x08, 0x1C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x08, 0x1D, 0x40, 0x4F,  0x96, 0x09, 0x00, 0x07,
+  0x83, 0x00, 0x00, 0x00,  0x08, 0x1C, 0x08, 0x03,  0x1C, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x1E, 0x1C, 0x44,  0x96, 0x02, 0x00, 0x08,
+  0x1F, 0x49, 0x4C, 0x12,  0x9D, 0x02, 0x00, 0x0E,  0x00, 0x17, 0x96, 0x02,  0x00, 0x08, 0x20, 0x1C,
+  0x44, 0x96, 0x02, 0x00,  0x08, 0x1F, 0x49, 0x9D,  0x02, 0x00, 0x90, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x1E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1D, 0x1C,  0x54, 0x12, 0x9D, 0x02,  0x00, 0x78, 0x00, 0x96,
+  0x07, 0x00, 0x08, 0x06,  0x07, 0x00, 0x00, 0x00,  0x00, 0x3C, 0x96, 0x02,  0x00, 0x08, 0x06, 0x1C,
+  0x96, 0x05, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x47, 0x96, 0x02, 0x00,  0x08, 0x1E, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x07,  0x4E, 0x48, 0x12, 0x9D,  0x02, 0x00, 0x4B, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x1E, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x06, 0x1C,  0x96, 0x05, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x47, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x1E, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x06, 0x1C, 0x4E, 0x96,
+  0x07, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x03, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1B, 0x52,
+  0x17, 0x96, 0x02, 0x00,  0x08, 0x06, 0x4C, 0x1C,  0x96, 0x05, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x47, 0x1D, 0x99, 0x02,  0x00, 0x93, 0xFF, 0x99,  0x02, 0x00, 0x24, 0x00,  0x96, 0x02, 0x00, 0x08,
+  0x20, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x1E, 0x1C,  0x96, 0x07, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x1C,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x05, 0x52, 0x17,
+  0x4F, 0x00
+};
+
+/* compiled from swfdec_initialize_text_format.as */
+static const unsigned char swfdec_initialize_text_format[] = {
+  0x88, 0x1B, 0x00, 0x02,  0x00, 0x41, 0x53, 0x63,  0x6F, 0x6E, 0x73, 0x74,  0x72, 0x75, 0x63, 0x74,
+  0x6F, 0x72, 0x00, 0x54,  0x65, 0x78, 0x74, 0x46,  0x6F, 0x72, 0x6D, 0x61,  0x74, 0x00, 0x96, 0x13,
+  0x00, 0x08, 0x01, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x6E, 0x00, 0x00,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x00,  0x3D, 0x1D, 0x00
+};
+
+/* compiled from swfdec_initialize_local_connection.as */
+static const unsigned char swfdec_initialize_local_connection[] = {
+  0x88, 0x55, 0x00, 0x05,  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x50, 0x72,  0x6F, 0x70, 0x46, 0x6C,
+  0x61, 0x67, 0x73, 0x00,  0x41, 0x53, 0x53, 0x65,  0x74, 0x4E, 0x61, 0x74,  0x69, 0x76, 0x65, 0x00,
+  0x70, 0x72, 0x6F, 0x74,  0x6F, 0x74, 0x79, 0x70,  0x65, 0x00, 0x4C, 0x6F,  0x63, 0x61, 0x6C, 0x43,
+  0x6F, 0x6E, 0x6E, 0x65,  0x63, 0x74, 0x69, 0x6F,  0x6E, 0x00, 0x36, 0x63,  0x6F, 0x6E, 0x6E, 0x65,
+  0x63, 0x74, 0x2C, 0x36,  0x73, 0x65, 0x6E, 0x64,  0x2C, 0x36, 0x63, 0x6C,  0x6F, 0x73, 0x65, 0x2C,
+  0x36, 0x64, 0x6F, 0x6D,  0x61, 0x69, 0x6E, 0x00,  0x96, 0x02, 0x00, 0x08,  0x03, 0x9B, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00,  0x00, 0x1D, 0x96, 0x09,  0x00, 0x08, 0x04, 0x07,  0x98, 0x08, 0x00, 0x00,
+  0x08, 0x03, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x02,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x03, 0x00, 0x00,
+  0x00, 0x08, 0x01, 0x3D,  0x17, 0x96, 0x08, 0x00,  0x07, 0x03, 0x00, 0x00,  0x00, 0x02, 0x08, 0x03,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x02, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x03,  0x00, 0x00, 0x00, 0x08,
+  0x00, 0x3D, 0x17, 0x00
+};
+
+/* compiled from swfdec_initialize_bitmap_data.as */
+static const unsigned char swfdec_initialize_bitmap_data[] = {
+  0x88, 0xCB, 0x01, 0x0E,  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x4E, 0x61,  0x74, 0x69, 0x76, 0x65,
+  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x4E, 0x61,  0x74, 0x69, 0x76, 0x65,  0x41, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x6F, 0x72,  0x00, 0x66, 0x6C, 0x61,  0x73, 0x68, 0x00, 0x70,  0x72, 0x6F, 0x74, 0x6F,
+  0x74, 0x79, 0x70, 0x65,  0x00, 0x41, 0x53, 0x63,  0x6F, 0x6E, 0x73, 0x74,  0x72, 0x75, 0x63, 0x74,
+  0x6F, 0x72, 0x00, 0x64,  0x69, 0x73, 0x70, 0x6C,  0x61, 0x79, 0x00, 0x42,  0x69, 0x74, 0x6D, 0x61,
+  0x70, 0x44, 0x61, 0x74,  0x61, 0x00, 0x52, 0x45,  0x44, 0x5F, 0x43, 0x48,  0x41, 0x4E, 0x4E, 0x45,
+  0x4C, 0x00, 0x47, 0x52,  0x45, 0x45, 0x4E, 0x5F,  0x43, 0x48, 0x41, 0x4E,  0x4E, 0x45, 0x4C, 0x00,
+  0x42, 0x4C, 0x55, 0x45,  0x5F, 0x43, 0x48, 0x41,  0x4E, 0x4E, 0x45, 0x4C,  0x00, 0x41, 0x4C, 0x50,
+  0x48, 0x41, 0x5F, 0x43,  0x48, 0x41, 0x4E, 0x4E,  0x45, 0x4C, 0x00, 0x38,  0x6C, 0x6F, 0x61, 0x64,
+  0x42, 0x69, 0x74, 0x6D,  0x61, 0x70, 0x00, 0x38,  0x67, 0x65, 0x74, 0x50,  0x69, 0x78, 0x65, 0x6C,
+  0x2C, 0x38, 0x73, 0x65,  0x74, 0x50, 0x69, 0x78,  0x65, 0x6C, 0x2C, 0x38,  0x66, 0x69, 0x6C, 0x6C,
+  0x52, 0x65, 0x63, 0x74,  0x2C, 0x38, 0x63, 0x6F,  0x70, 0x79, 0x50, 0x69,  0x78, 0x65, 0x6C, 0x73,
+  0x2C, 0x38, 0x61, 0x70,  0x70, 0x6C, 0x79, 0x46,  0x69, 0x6C, 0x74, 0x65,  0x72, 0x2C, 0x38, 0x73,
+  0x63, 0x72, 0x6F, 0x6C,  0x6C, 0x2C, 0x38, 0x74,  0x68, 0x72, 0x65, 0x73,  0x68, 0x6F, 0x6C, 0x64,
+  0x2C, 0x38, 0x64, 0x72,  0x61, 0x77, 0x2C, 0x38,  0x70, 0x69, 0x78, 0x65,  0x6C, 0x44, 0x69, 0x73,
+  0x73, 0x6F, 0x6C, 0x76,  0x65, 0x2C, 0x38, 0x67,  0x65, 0x74, 0x50, 0x69,  0x78, 0x65, 0x6C, 0x33,
+  0x32, 0x2C, 0x38, 0x73,  0x65, 0x74, 0x50, 0x69,  0x78, 0x65, 0x6C, 0x33,  0x32, 0x2C, 0x38, 0x66,
+  0x6C, 0x6F, 0x6F, 0x64,  0x46, 0x69, 0x6C, 0x6C,  0x2C, 0x38, 0x67, 0x65,  0x74, 0x43, 0x6F, 0x6C,
+  0x6F, 0x72, 0x42, 0x6F,  0x75, 0x6E, 0x64, 0x73,  0x52, 0x65, 0x63, 0x74,  0x2C, 0x38, 0x70, 0x65,
+  0x72, 0x6C, 0x69, 0x6E,  0x4E, 0x6F, 0x69, 0x73,  0x65, 0x2C, 0x38, 0x63,  0x6F, 0x6C, 0x6F, 0x72,
+  0x54, 0x72, 0x61, 0x6E,  0x73, 0x66, 0x6F, 0x72,  0x6D, 0x2C, 0x38, 0x68,  0x69, 0x74, 0x54, 0x65,
+  0x73, 0x74, 0x2C, 0x38,  0x70, 0x61, 0x6C, 0x65,  0x74, 0x74, 0x65, 0x4D,  0x61, 0x70, 0x2C, 0x38,
+  0x6D, 0x65, 0x72, 0x67,  0x65, 0x2C, 0x38, 0x6E,  0x6F, 0x69, 0x73, 0x65,  0x2C, 0x38, 0x63, 0x6F,
+  0x70, 0x79, 0x43, 0x68,  0x61, 0x6E, 0x6E, 0x65,  0x6C, 0x2C, 0x38, 0x63,  0x6C, 0x6F, 0x6E, 0x65,
+  0x2C, 0x38, 0x64, 0x69,  0x73, 0x70, 0x6F, 0x73,  0x65, 0x2C, 0x38, 0x67,  0x65, 0x6E, 0x65, 0x72,
+  0x61, 0x74, 0x65, 0x46,  0x69, 0x6C, 0x74, 0x65,  0x72, 0x52, 0x65, 0x63,  0x74, 0x2C, 0x38, 0x63,
+  0x6F, 0x6D, 0x70, 0x61,  0x72, 0x65, 0x00, 0x38,  0x77, 0x69, 0x64, 0x74,  0x68, 0x2C, 0x38, 0x68,
+  0x65, 0x69, 0x67, 0x68,  0x74, 0x2C, 0x38, 0x72,  0x65, 0x63, 0x74, 0x61,  0x6E, 0x67, 0x6C, 0x65,
+  0x2C, 0x38, 0x74, 0x72,  0x61, 0x6E, 0x73, 0x70,  0x61, 0x72, 0x65, 0x6E,  0x74, 0x00, 0x96, 0x02,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x07, 0x00, 0x08,  0x05, 0x07, 0x00, 0x00,  0x00, 0x00, 0x43, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x05, 0x4E,  0x96, 0x13, 0x00, 0x08,
+  0x06, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x4C,  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x05, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x06, 0x4E, 0x96, 0x07,  0x00, 0x08, 0x07, 0x07,  0x01, 0x00, 0x00, 0x00,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x05,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x06, 0x4E, 0x96,  0x07, 0x00, 0x08, 0x08,  0x07, 0x02, 0x00, 0x00,  0x00, 0x4F, 0x96, 0x02,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x05, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x06, 0x4E,
+  0x96, 0x07, 0x00, 0x08,  0x09, 0x07, 0x04, 0x00,  0x00, 0x00, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x05, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x06,  0x4E, 0x96, 0x07, 0x00,
+  0x08, 0x0A, 0x07, 0x08,  0x00, 0x00, 0x00, 0x4F,  0x96, 0x0E, 0x00, 0x07,  0x28, 0x00, 0x00, 0x00,
+  0x08, 0x0B, 0x07, 0x4C,  0x04, 0x00, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x05, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x06, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x00,
+  0x3D, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0C,  0x07, 0x4C, 0x04, 0x00,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x05, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x06, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x00,
+  0x3D, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x64, 0x00,  0x00, 0x00, 0x08, 0x0D,  0x07, 0x4C, 0x04, 0x00,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x05, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x06, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x17, 0x00
+};
+
+/* compiled from swfdec_initialize_filters.as */
+static const unsigned char swfdec_initialize_filters[] = {
+  0x88, 0x2E, 0x03, 0x1B,  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x4E, 0x61,  0x74, 0x69, 0x76, 0x65,
+  0x00, 0x41, 0x53, 0x53,  0x65, 0x74, 0x4E, 0x61,  0x74, 0x69, 0x76, 0x65,  0x41, 0x63, 0x63, 0x65,
+  0x73, 0x73, 0x6F, 0x72,  0x00, 0x66, 0x6C, 0x61,  0x73, 0x68, 0x00, 0x70,  0x72, 0x6F, 0x74, 0x6F,
+  0x74, 0x79, 0x70, 0x65,  0x00, 0x6F, 0x00, 0x41,  0x53, 0x63, 0x6F, 0x6E,  0x73, 0x74, 0x72, 0x75,
+  0x63, 0x74, 0x6F, 0x72,  0x00, 0x63, 0x6F, 0x6E,  0x73, 0x74, 0x72, 0x75,  0x63, 0x74, 0x6F, 0x72,
+  0x00, 0x66, 0x69, 0x6C,  0x74, 0x65, 0x72, 0x73,  0x00, 0x42, 0x69, 0x74,  0x6D, 0x61, 0x70, 0x46,
+  0x69, 0x6C, 0x74, 0x65,  0x72, 0x00, 0x38, 0x63,  0x6C, 0x6F, 0x6E, 0x65,  0x00, 0x42, 0x65, 0x76,
+  0x65, 0x6C, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x64, 0x69,  0x73, 0x74, 0x61, 0x6E,
+  0x63, 0x65, 0x2C, 0x38,  0x61, 0x6E, 0x67, 0x6C,  0x65, 0x2C, 0x38, 0x68,  0x69, 0x67, 0x68, 0x6C,
+  0x69, 0x67, 0x68, 0x74,  0x43, 0x6F, 0x6C, 0x6F,  0x72, 0x2C, 0x38, 0x68,  0x69, 0x67, 0x68, 0x6C,
+  0x69, 0x67, 0x68, 0x74,  0x41, 0x6C, 0x70, 0x68,  0x61, 0x2C, 0x38, 0x73,  0x68, 0x61, 0x64, 0x6F,
+  0x77, 0x43, 0x6F, 0x6C,  0x6F, 0x72, 0x2C, 0x38,  0x73, 0x68, 0x61, 0x64,  0x6F, 0x77, 0x41, 0x6C,
+  0x70, 0x68, 0x61, 0x2C,  0x38, 0x71, 0x75, 0x61,  0x6C, 0x69, 0x74, 0x79,  0x2C, 0x38, 0x73, 0x74,
+  0x72, 0x65, 0x6E, 0x67,  0x74, 0x68, 0x2C, 0x38,  0x6B, 0x6E, 0x6F, 0x63,  0x6B, 0x6F, 0x75, 0x74,
+  0x2C, 0x38, 0x62, 0x6C,  0x75, 0x72, 0x58, 0x2C,  0x38, 0x62, 0x6C, 0x75,  0x72, 0x59, 0x2C, 0x38,
+  0x74, 0x79, 0x70, 0x65,  0x00, 0x42, 0x6C, 0x75,  0x72, 0x46, 0x69, 0x6C,  0x74, 0x65, 0x72, 0x00,
+  0x38, 0x62, 0x6C, 0x75,  0x72, 0x58, 0x2C, 0x38,  0x62, 0x6C, 0x75, 0x72,  0x59, 0x2C, 0x38, 0x71,
+  0x75, 0x61, 0x6C, 0x69,  0x74, 0x79, 0x00, 0x43,  0x6F, 0x6C, 0x6F, 0x72,  0x4D, 0x61, 0x74, 0x72,
+  0x69, 0x78, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,  0x00, 0x38, 0x6D, 0x61,  0x74, 0x72, 0x69, 0x78,
+  0x00, 0x43, 0x6F, 0x6E,  0x76, 0x6F, 0x6C, 0x75,  0x74, 0x69, 0x6F, 0x6E,  0x46, 0x69, 0x6C, 0x74,
+  0x65, 0x72, 0x00, 0x38,  0x6D, 0x61, 0x74, 0x72,  0x69, 0x78, 0x58, 0x2C,  0x38, 0x6D, 0x61, 0x74,
+  0x72, 0x69, 0x78, 0x59,  0x2C, 0x38, 0x6D, 0x61,  0x74, 0x72, 0x69, 0x78,  0x2C, 0x38, 0x64, 0x69,
+  0x76, 0x69, 0x73, 0x6F,  0x72, 0x2C, 0x38, 0x62,  0x69, 0x61, 0x73, 0x2C,  0x38, 0x70, 0x72, 0x65,
+  0x73, 0x65, 0x72, 0x76,  0x65, 0x41, 0x6C, 0x70,  0x68, 0x61, 0x2C, 0x38,  0x63, 0x6C, 0x61, 0x6D,
+  0x70, 0x2C, 0x38, 0x63,  0x6F, 0x6C, 0x6F, 0x72,  0x2C, 0x38, 0x61, 0x6C,  0x70, 0x68, 0x61, 0x00,
+  0x44, 0x69, 0x73, 0x70,  0x6C, 0x61, 0x63, 0x65,  0x6D, 0x65, 0x6E, 0x74,  0x4D, 0x61, 0x70, 0x46,
+  0x69, 0x6C, 0x74, 0x65,  0x72, 0x00, 0x38, 0x6D,  0x61, 0x70, 0x42, 0x69,  0x74, 0x6D, 0x61, 0x70,
+  0x2C, 0x38, 0x6D, 0x61,  0x70, 0x50, 0x6F, 0x69,  0x6E, 0x74, 0x2C, 0x38,  0x63, 0x6F, 0x6D, 0x70,
+  0x6F, 0x6E, 0x65, 0x6E,  0x74, 0x58, 0x2C, 0x38,  0x63, 0x6F, 0x6D, 0x70,  0x6F, 0x6E, 0x65, 0x6E,
+  0x74, 0x59, 0x2C, 0x38,  0x73, 0x63, 0x61, 0x6C,  0x65, 0x58, 0x2C, 0x38,  0x73, 0x63, 0x61, 0x6C,
+  0x65, 0x59, 0x2C, 0x38,  0x6D, 0x6F, 0x64, 0x65,  0x2C, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x2C,
+  0x38, 0x61, 0x6C, 0x70,  0x68, 0x61, 0x00, 0x44,  0x72, 0x6F, 0x70, 0x53,  0x68, 0x61, 0x64, 0x6F,
+  0x77, 0x46, 0x69, 0x6C,  0x74, 0x65, 0x72, 0x00,  0x38, 0x64, 0x69, 0x73,  0x74, 0x61, 0x6E, 0x63,
+  0x65, 0x2C, 0x38, 0x61,  0x6E, 0x67, 0x6C, 0x65,  0x2C, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x2C,
+  0x38, 0x61, 0x6C, 0x70,  0x68, 0x61, 0x2C, 0x38,  0x71, 0x75, 0x61, 0x6C,  0x69, 0x74, 0x79, 0x2C,
+  0x38, 0x69, 0x6E, 0x6E,  0x65, 0x72, 0x2C, 0x38,  0x6B, 0x6E, 0x6F, 0x63,  0x6B, 0x6F, 0x75, 0x74,
+  0x2C, 0x38, 0x62, 0x6C,  0x75, 0x72, 0x58, 0x2C,  0x38, 0x62, 0x6C, 0x75,  0x72, 0x59, 0x2C, 0x38,
+  0x73, 0x74, 0x72, 0x65,  0x6E, 0x67, 0x74, 0x68,  0x2C, 0x38, 0x68, 0x69,  0x64, 0x65, 0x4F, 0x62,
+  0x6A, 0x65, 0x63, 0x74,  0x00, 0x47, 0x6C, 0x6F,  0x77, 0x46, 0x69, 0x6C,  0x74, 0x65, 0x72, 0x00,
+  0x38, 0x63, 0x6F, 0x6C,  0x6F, 0x72, 0x2C, 0x38,  0x61, 0x6C, 0x70, 0x68,  0x61, 0x2C, 0x38, 0x71,
+  0x75, 0x61, 0x6C, 0x69,  0x74, 0x79, 0x2C, 0x38,  0x69, 0x6E, 0x6E, 0x65,  0x72, 0x2C, 0x38, 0x6B,
+  0x6E, 0x6F, 0x63, 0x6B,  0x6F, 0x75, 0x74, 0x2C,  0x38, 0x62, 0x6C, 0x75,  0x72, 0x58, 0x2C, 0x38,
+  0x62, 0x6C, 0x75, 0x72,  0x59, 0x2C, 0x38, 0x73,  0x74, 0x72, 0x65, 0x6E,  0x67, 0x74, 0x68, 0x00,
+  0x47, 0x72, 0x61, 0x64,  0x69, 0x65, 0x6E, 0x74,  0x42, 0x65, 0x76, 0x65,  0x6C, 0x46, 0x69, 0x6C,
+  0x74, 0x65, 0x72, 0x00,  0x38, 0x64, 0x69, 0x73,  0x74, 0x61, 0x6E, 0x63,  0x65, 0x2C, 0x38, 0x61,
+  0x6E, 0x67, 0x6C, 0x65,  0x2C, 0x38, 0x63, 0x6F,  0x6C, 0x6F, 0x72, 0x73,  0x2C, 0x38, 0x61, 0x6C,
+  0x70, 0x68, 0x61, 0x73,  0x2C, 0x38, 0x72, 0x61,  0x74, 0x69, 0x6F, 0x73,  0x2C, 0x38, 0x62, 0x6C,
+  0x75, 0x72, 0x58, 0x2C,  0x38, 0x62, 0x6C, 0x75,  0x72, 0x59, 0x2C, 0x38,  0x71, 0x75, 0x61, 0x6C,
+  0x69, 0x74, 0x79, 0x2C,  0x38, 0x73, 0x74, 0x72,  0x65, 0x6E, 0x67, 0x74,  0x68, 0x2C, 0x38, 0x6B,
+  0x6E, 0x6F, 0x63, 0x6B,  0x6F, 0x75, 0x74, 0x2C,  0x38, 0x74, 0x79, 0x70,  0x65, 0x00, 0x47, 0x72,
+  0x61, 0x64, 0x69, 0x65,  0x6E, 0x74, 0x47, 0x6C,  0x6F, 0x77, 0x46, 0x69,  0x6C, 0x74, 0x65, 0x72,
+  0x00, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x07, 0x00, 0x08, 0x07,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x43, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x13, 0x00, 0x08, 0x08,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x58, 0x04,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x05, 0x3D, 0x4F, 0x96,  0x0E, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,
+  0x09, 0x07, 0x58, 0x04,  0x00, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x08,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x03, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,
+  0x00, 0x00, 0x00, 0x08,  0x00, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x07, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x0A,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x53, 0x04,
+  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,  0x05, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0A,  0x4E, 0x96, 0x09, 0x00,
+  0x08, 0x03, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x08, 0x53, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x0A,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x03, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x06,  0x3A, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x0B,
+  0x07, 0x53, 0x04, 0x00,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x0A, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
+  0x00, 0x00, 0x08, 0x01,  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x4E, 0x96, 0x13,  0x00, 0x08, 0x0C, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x4E, 0x04, 0x00,
+  0x00, 0x07, 0x02, 0x00,  0x00, 0x00, 0x08, 0x05,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,
+  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0C, 0x4E,  0x96, 0x09, 0x00, 0x08,
+  0x03, 0x07, 0x00, 0x00,  0x00, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x08,  0x53, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x0C, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x06, 0x3A,  0x17, 0x96, 0x0E, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x0D, 0x07,
+  0x4E, 0x04, 0x00, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x0C, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x03,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,
+  0x00, 0x08, 0x01, 0x3D,  0x17, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,
+  0x4E, 0x96, 0x13, 0x00,  0x08, 0x0E, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x56, 0x04, 0x00, 0x00,
+  0x07, 0x02, 0x00, 0x00,  0x00, 0x08, 0x05, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,
+  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0E, 0x4E, 0x96,  0x09, 0x00, 0x08, 0x03,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x08, 0x53,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x0E, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x03,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x06, 0x3A, 0x17,  0x96, 0x0E, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x0F, 0x07, 0x56,
+  0x04, 0x00, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x0E, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x03, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,
+  0x08, 0x01, 0x3D, 0x17,  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,
+  0x96, 0x13, 0x00, 0x08,  0x10, 0x07, 0x00, 0x00,  0x00, 0x00, 0x07, 0x55,  0x04, 0x00, 0x00, 0x07,
+  0x02, 0x00, 0x00, 0x00,  0x08, 0x05, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,
+  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x10, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x03, 0x07,
+  0x00, 0x00, 0x00, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x08, 0x53, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x10, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x03, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x06, 0x3A, 0x17, 0x96,  0x0E, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x11, 0x07, 0x55, 0x04,
+  0x00, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x10,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x03, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,
+  0x01, 0x3D, 0x17, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x13, 0x00, 0x08, 0x12,  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x57, 0x04,  0x00, 0x00, 0x07, 0x02,
+  0x00, 0x00, 0x00, 0x08,  0x05, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x12,  0x4E, 0x96, 0x09, 0x00,  0x08, 0x03, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x08, 0x53, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x12,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x03, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x06,
+  0x3A, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x13,  0x07, 0x57, 0x04, 0x00,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x12, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,  0x00, 0x00, 0x08, 0x01,
+  0x3D, 0x17, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x13,
+  0x00, 0x08, 0x14, 0x07,  0x00, 0x00, 0x00, 0x00,  0x07, 0x4D, 0x04, 0x00,  0x00, 0x07, 0x02, 0x00,
+  0x00, 0x00, 0x08, 0x05,  0x3D, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,
+  0x07, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x14, 0x4E,  0x96, 0x09, 0x00, 0x08,  0x03, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x08,
+  0x53, 0x4F, 0x96, 0x02,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x14, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x06, 0x3A,
+  0x17, 0x96, 0x0E, 0x00,  0x07, 0x01, 0x00, 0x00,  0x00, 0x08, 0x15, 0x07,  0x4D, 0x04, 0x00, 0x00,
+  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x14, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x03,  0x4E, 0x96, 0x07, 0x00,  0x07, 0x04, 0x00, 0x00,  0x00, 0x08, 0x01, 0x3D,
+  0x17, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x13, 0x00,
+  0x08, 0x16, 0x07, 0x00,  0x00, 0x00, 0x00, 0x07,  0x4F, 0x04, 0x00, 0x00,  0x07, 0x02, 0x00, 0x00,
+  0x00, 0x08, 0x05, 0x3D,  0x4F, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,
+  0x4E, 0x96, 0x02, 0x00,  0x08, 0x16, 0x4E, 0x96,  0x09, 0x00, 0x08, 0x03,  0x07, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x08, 0x53,
+  0x4F, 0x96, 0x02, 0x00,  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x16, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x03,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x06, 0x3A, 0x17,
+  0x96, 0x0E, 0x00, 0x07,  0x01, 0x00, 0x00, 0x00,  0x08, 0x17, 0x07, 0x4F,  0x04, 0x00, 0x00, 0x08,
+  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x16, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x03, 0x4E,  0x96, 0x07, 0x00, 0x07,  0x04, 0x00, 0x00, 0x00,  0x08, 0x01, 0x3D, 0x17,
+  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x13, 0x00, 0x08,
+  0x18, 0x07, 0xE8, 0x03,  0x00, 0x00, 0x07, 0x54,  0x04, 0x00, 0x00, 0x07,  0x02, 0x00, 0x00, 0x00,
+  0x08, 0x05, 0x3D, 0x4F,  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,
+  0x96, 0x02, 0x00, 0x08,  0x18, 0x4E, 0x96, 0x09,  0x00, 0x08, 0x03, 0x07,  0x00, 0x00, 0x00, 0x00,
+  0x08, 0x02, 0x1C, 0x96,  0x02, 0x00, 0x08, 0x07,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x08, 0x53, 0x4F,
+  0x96, 0x02, 0x00, 0x08,  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,
+  0x18, 0x4E, 0x96, 0x02,  0x00, 0x08, 0x03, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x06, 0x3A, 0x17, 0x96,
+  0x0E, 0x00, 0x07, 0x01,  0x00, 0x00, 0x00, 0x08,  0x19, 0x07, 0x54, 0x04,  0x00, 0x00, 0x08, 0x02,
+  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x18,  0x4E, 0x96, 0x02, 0x00,
+  0x08, 0x03, 0x4E, 0x96,  0x07, 0x00, 0x07, 0x04,  0x00, 0x00, 0x00, 0x08,  0x01, 0x3D, 0x17, 0x96,
+  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,  0x13, 0x00, 0x08, 0x1A,
+  0x07, 0x00, 0x00, 0x00,  0x00, 0x07, 0x54, 0x04,  0x00, 0x00, 0x07, 0x02,  0x00, 0x00, 0x00, 0x08,
+  0x05, 0x3D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,  0x08, 0x07, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x1A,  0x4E, 0x96, 0x09, 0x00,  0x08, 0x03, 0x07, 0x00,  0x00, 0x00, 0x00, 0x08,
+  0x02, 0x1C, 0x96, 0x02,  0x00, 0x08, 0x07, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x08, 0x53, 0x4C, 0x96,
+  0x02, 0x00, 0x08, 0x04,  0x4D, 0x1D, 0x4F, 0x96,  0x02, 0x00, 0x08, 0x02,  0x1C, 0x96, 0x02, 0x00,
+  0x08, 0x07, 0x4E, 0x96,  0x02, 0x00, 0x08, 0x1A,  0x4E, 0x96, 0x02, 0x00,  0x08, 0x03, 0x4E, 0x96,
+  0x02, 0x00, 0x08, 0x06,  0x3A, 0x17, 0x96, 0x0E,  0x00, 0x07, 0x01, 0x00,  0x00, 0x00, 0x08, 0x19,
+  0x07, 0x54, 0x04, 0x00,  0x00, 0x08, 0x02, 0x1C,  0x96, 0x02, 0x00, 0x08,  0x07, 0x4E, 0x96, 0x02,
+  0x00, 0x08, 0x1A, 0x4E,  0x96, 0x02, 0x00, 0x08,  0x03, 0x4E, 0x96, 0x07,  0x00, 0x07, 0x04, 0x00,
+  0x00, 0x00, 0x08, 0x01,  0x3D, 0x17, 0x00
 };
 
@@ -0,0 +1,40 @@
+/* Swfdec
+ * Copyright (C) 2007-2008 Benjamin Otte <otte@gnome.org>
+ *               2007 Pekka Lampila <pekka.lampila@iki.fi>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+/* This script is not run at startup but the first time a script looks up
+ * flash.display. It runs in a scope object of its own that provides ASnative,
+ * ASconstructor, ASSetNative, ASSetNativeAccessor, ASSetPropFlags and an
+ * empty flash object.
+ * Variables it sets end up in that scope, only flash.display is read back. */
+
+/* BitmapData */
+
+flash.display = {};
+flash.display.BitmapData = ASconstructor (1100, 0);
+
+flash.display.BitmapData.RED_CHANNEL = 1;
+flash.display.BitmapData.GREEN_CHANNEL = 2;
+flash.display.BitmapData.BLUE_CHANNEL = 4;
+flash.display.BitmapData.ALPHA_CHANNEL = 8;
+
+ASSetNative (flash.display.BitmapData, 1100, "8loadBitmap", 40);
+
+ASSetNative (flash.display.BitmapData.prototype, 1100, "8getPixel,8setPixel,8fillRect,8copyPixels,8applyFilter,8scroll,8threshold,8draw,8pixelDissolve,8getPixel32,8setPixel32,8floodFill,8getColorBoundsRect,8perlinNoise,8colorTransform,8hitTest,8paletteMap,8merge,8noise,8copyChannel,8clone,8dispose,8generateFilterRect,8compare", 1);
+ASSetNativeAccessor(flash.display.BitmapData.prototype, 1100, "8width,8height,8rectangle,8transparent", 100);
@@ -0,0 +1,104 @@
+/* Swfdec
+ * Copyright (C) 2007-2008 Benjamin Otte <otte@gnome.org>
+ *               2007 Pekka Lampila <pekka.lampila@iki.fi>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+/* This script is not run at startup but the first time a script looks up
+ * flash.filters. It runs in a scope object of its own that provides ASnative,
+ * ASconstructor, ASSetNative, ASSetNativeAccessor, ASSetPropFlags and an
+ * empty flash object.
+ * Variables it sets end up in that scope, only flash.filters is read back. */
+
+/* BitmapFilter */
+
+flash.filters = {};
+
+flash.filters.BitmapFilter = ASconstructor(1112, 0);
+
+ASSetNative(flash.filters.BitmapFilter.prototype, 1112, "8clone", 1);
+
+/* BevelFilter */
+
+flash.filters.BevelFilter = ASconstructor (1107, 0);
+flash.filters.BevelFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.BevelFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.BevelFilter.prototype, 1107, "8distance,8angle,8highlightColor,8highlightAlpha,8shadowColor,8shadowAlpha,8quality,8strength,8knockout,8blurX,8blurY,8type", 1);
+
+/* BlurFilter */
+
+flash.filters.BlurFilter = ASconstructor (1102, 0);
+flash.filters.BlurFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.BlurFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.BlurFilter.prototype, 1102, "8blurX,8blurY,8quality", 1);
+
+/* ColorMatrixFilter */
+
+flash.filters.ColorMatrixFilter = ASconstructor (1110, 0);
+flash.filters.ColorMatrixFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.ColorMatrixFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.ColorMatrixFilter.prototype, 1110, "8matrix", 1);
+
+/* ConvolutionFilter */
+
+flash.filters.ConvolutionFilter = ASconstructor (1109, 0);
+flash.filters.ConvolutionFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.ConvolutionFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.ConvolutionFilter.prototype, 1109, "8matrixX,8matrixY,8matrix,8divisor,8bias,8preserveAlpha,8clamp,8color,8alpha", 1);
+
+/* DisplacementMapFilter */
+
+flash.filters.DisplacementMapFilter = ASconstructor (1111, 0);
+flash.filters.DisplacementMapFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.DisplacementMapFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.DisplacementMapFilter.prototype, 1111, "8mapBitmap,8mapPoint,8componentX,8componentY,8scaleX,8scaleY,8mode,8color,8alpha", 1);
+
+/* DropShadowFilter */
+
+flash.filters.DropShadowFilter = ASconstructor (1101, 0);
+flash.filters.DropShadowFilter.prototype = new flash.filters.BitmapFilter();
+delete flash.filters.DropShadowFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.DropShadowFilter.prototype, 1101, "8distance,8angle,8color,8alpha,8quality,8inner,8knockout,8blurX,8blurY,8strength,8hideObject", 1);
+
+/* GlowFilter */
+
+flash.filters.GlowFilter = ASconstructor (1103, 0);
+flash.filters.GlowFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.GlowFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.GlowFilter.prototype, 1103, "8color,8alpha,8quality,8inner,8knockout,8blurX,8blurY,8strength", 1);
+
+/* GradientBevelFilter */
+
+flash.filters.GradientBevelFilter = ASconstructor (1108, 1000);
+flash.filters.GradientBevelFilter.prototype = new flash.filters.BitmapFilter ();
+delete flash.filters.GradientBevelFilter.prototype.constructor;
+
+ASSetNativeAccessor (flash.filters.GradientBevelFilter.prototype, 1108, "8distance,8angle,8colors,8alphas,8ratios,8blurX,8blurY,8quality,8strength,8knockout,8type", 1);
+
+/* GradientGlowFilter */
+
+flash.filters.GradientGlowFilter = ASconstructor (1108, 0);
+flash.filters.GradientGlowFilter.prototype = o = new flash.filters.BitmapFilter ();
+delete flash.filters.GradientGlowFilter.prototype.constructor;
+ASSetNativeAccessor (flash.filters.GradientGlowFilter.prototype, 1108, "8distance,8angle,8colors,8alphas,8ratios,8blurX,8blurY,8quality,8strength,8knockout,8type", 1);
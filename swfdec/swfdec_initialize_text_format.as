@@ -0,0 +1,28 @@
+/* Swfdec
+ * Copyright (C) 2007-2008 Benjamin Otte <otte@gnome.org>
+ *               2007 Pekka Lampila <pekka.lampila@iki.fi>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+/* This script is not run at startup but the first time a script looks up
+ * TextFormat. It runs in a scope object of its own that provides ASnative,
+ * ASconstructor, ASSetNative, ASSetNativeAccessor and ASSetPropFlags.
+ * Variables it sets end up in that scope, only TextFormat is read back. */
+
+/* TextFormat */
+
+TextFormat = ASconstructor (110, 0);
@@ -0,0 +1,76 @@
+/* Swfdec
+ * Copyright (C) 2007-2008 Benjamin Otte <otte@gnome.org>
+ *               2007 Pekka Lampila <pekka.lampila@iki.fi>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+/* This script is not run at startup but the first time a script looks up
+ * XML. It runs in a scope object of its own that provides ASnative,
+ * ASconstructor, ASSetNative, ASSetNativeAccessor and ASSetPropFlags.
+ * Variables it sets end up in that scope, only XML is read back. */
+
+/*** XML ***/
+
+XML = ASconstructor (253, 9);
+
+XML.prototype = new XMLNode (1, "");
+delete XML.prototype.constructor;
+ASSetPropFlags (XML, "prototype", 3);
+
+XML.prototype.load = ASnative (301, 0);
+XML.prototype.send = ASnative (301, 1);
+XML.prototype.sendAndLoad = ASnative (301, 2);
+XML.prototype.createElement = ASnative (253, 10);
+XML.prototype.createTextNode = ASnative (253, 11);
+XML.prototype.parseXML = ASnative (253, 12);
+
+XML.prototype.onLoad = function () {
+};
+
+// Note: handling of loaded is different here than in LoadVars
+XML.prototype.onData = function (src) {
+  if (src != null) {
+    this.loaded = true;
+    this.parseXML (src);
+    this.onLoad (true);
+  } else {
+    this.loaded = false;
+    this.onLoad (false);
+  }
+};
+
+XML.prototype.getBytesLoaded = function () {
+  return this._bytesLoaded;
+};
+
+XML.prototype.getBytesTotal = function () {
+  return this._bytesTotal;
+};
+
+XML.prototype.addRequestHeader = function (key, value) {
+  if (typeof (this._customHeaders) == "undefined") {
+    this._customHeaders = new Array ();
+    ASSetPropFlags (this, "_customHeaders", 131);
+  }
+  if (typeof (key) == "string" && typeof (value) == "string") {
+    this._customHeaders.push (key, value);
+  } else if (key instanceof Array) {
+    for (var i = 0; i + 1 < key.length; i += 2) {
+      this.addRequestHeader (key[i], key[i + 1]);
+    }
+  }
+};
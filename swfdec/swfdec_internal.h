@@ -33,6 +33,8 @@ G_BEGIN_DECLS
 
 void			swfdec_player_preinit_global		(SwfdecAsContext *	context);
 void			swfdec_net_stream_init_context		(SwfdecPlayer *		player);
+void			swfdec_player_init_class_scope		(SwfdecAsContext *	context,
+								 SwfdecAsObject *	scope);
 
 /* functions that shouldn't go into public headers */
 
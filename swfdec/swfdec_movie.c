@@ -31,6 +31,7 @@
 #include "swfdec_as_internal.h"
 #include "swfdec_as_strings.h"
 #include "swfdec_button_movie.h"
+#include "swfdec_cached_movie.h"
 #include "swfdec_debug.h"
 #include "swfdec_draw.h"
 #include "swfdec_event.h"
@@ -69,9 +70,14 @@ static guint signals[LAST_SIGNAL] = { 0, };
 
 G_DEFINE_ABSTRACT_TYPE (SwfdecMovie, swfdec_movie, SWFDEC_TYPE_AS_RELAY)
 
+/* NB: cache versions are unique across all movies, so cache entries of dead 
+ * movies never match a new movie that happens to get the same address */
+static guint swfdec_movie_cache_serial = 0;
+
 static void
 swfdec_movie_init (SwfdecMovie * movie)
 {
+  movie->cache_version = ++swfdec_movie_cache_serial;
   movie->blend_mode = SWFDEC_BLEND_MODE_NORMAL;
 
   movie->xscale = 100;
@@ -137,10 +143,17 @@ swfdec_movie_invalidate (SwfdecMovie *movie, const cairo_matrix_t *parent_to_glo
 void
 swfdec_movie_invalidate_last (SwfdecMovie *movie)
 {
+  SwfdecMovie *walk;
   cairo_matrix_t matrix;
 
   g_return_if_fail (SWFDEC_IS_MOVIE (movie));
 
+  /* The movie is about to change, so cached surfaces of it and all the movies
+   * containing it are outdated. This has to happen even if the movie was 
+   * already invalidated, as the cache might have been refilled since. */
+  for (walk = movie; walk; walk = walk->parent)
+    walk->cache_version = ++swfdec_movie_cache_serial;
+
   if (movie->invalidate_last)
     return;
 
@@ -208,14 +221,20 @@ swfdec_movie_update_extents (SwfdecMovie *movie)
       movie->image->height * SWFDEC_TWIPS_SCALE_FACTOR };
     swfdec_rect_union (rect, rect, &image_extents);
   }
+  /* filters draw outside the extents, so we can't skip rendering those */
+  movie->cullable = movie->filters == NULL;
   for (walk = movie->list; walk; walk = walk->next) {
-    swfdec_rect_union (rect, rect, &SWFDEC_MOVIE (walk->data)->extents);
+    SwfdecMovie *child = walk->data;
+    swfdec_rect_union (rect, rect, &child->extents);
+    if (!child->cullable)
+      movie->cullable = FALSE;
   }
   klass = SWFDEC_MOVIE_GET_CLASS (movie);
   if (klass->update_extents)
     klass->update_extents (movie, rect);
   if (swfdec_rect_is_empty (rect)) {
     *extents = *rect;
+    swfdec_movie_update_index (movie);
     return;
   }
   swfdec_rect_transform (extents, rect, &movie->matrix);
@@ -223,12 +242,17 @@ swfdec_movie_update_extents (SwfdecMovie *movie)
     /* no need to invalidate here */
     movie->parent->cache_state = SWFDEC_MOVIE_INVALID_EXTENTS;
   }
+  swfdec_movie_update_index (movie);
 }
 
 void
 swfdec_movie_begin_update_matrix (SwfdecMovie *movie)
 {
+  guint version = movie->cache_version;
+
   swfdec_movie_invalidate_next (movie);
+  /* the movie's own contents don't change when moving it, only its parents' */
+  movie->cache_version = version;
 }
 
 void
@@ -422,11 +446,18 @@ swfdec_movie_destroy (SwfdecMovie *movie)
   while (movie->list) {
     swfdec_movie_destroy (movie->list->data);
   }
+  if (movie->index) {
+    swfdec_spatial_index_free (movie->index);
+    movie->index = NULL;
+  }
   if (movie->parent) {
     movie->parent->list = g_list_remove (movie->parent->list, movie);
+    if (movie->parent->index)
+      swfdec_spatial_index_remove (movie->parent->index, movie);
   } else {
     player->priv->roots = g_list_remove (player->priv->roots, movie);
   }
+  SWFDEC_AS_CONTEXT (player)->movie_epoch++;
   /* unset masks */
   if (movie->masked_by)
     movie->masked_by->mask_of = NULL;
@@ -602,45 +633,122 @@ swfdec_movie_get_movie_at (SwfdecMovie *movie, double x, double y, gboolean even
   return ret;
 }
 
-static SwfdecMovie *
-swfdec_movie_do_contains (SwfdecMovie *movie, double x, double y, gboolean events)
+/* movies with at least this many children use an index for hit testing */
+#define SWFDEC_MOVIE_INDEX_THRESHOLD 32
+/* 64 pixels at 100% zoom */
+#define SWFDEC_MOVIE_INDEX_CELL_SIZE (64 * SWFDEC_TWIPS_SCALE_FACTOR)
+
+/**
+ * swfdec_movie_update_index:
+ * @movie: a #SwfdecMovie
+ *
+ * Updates the entry for @movie in its parent's hit testing index. This must be
+ * called whenever @movie's extents or clip depth change.
+ **/
+void
+swfdec_movie_update_index (SwfdecMovie *movie)
+{
+  g_return_if_fail (SWFDEC_IS_MOVIE (movie));
+
+  if (movie->parent == NULL || movie->parent->index == NULL)
+    return;
+
+  /* movies that clip others need to be checked even when not hit, because
+   * they hide the movies they clip */
+  swfdec_spatial_index_insert (movie->parent->index, movie,
+      movie->clip_depth ? NULL : &movie->extents);
+}
+
+static void
+swfdec_movie_ensure_index (SwfdecMovie *movie)
 {
   GList *walk;
-  GSList *walk2;
-  SwfdecMovie *ret, *got;
+  guint i;
 
-  ret = NULL;
+  if (movie->index)
+    return;
+
+  for (walk = movie->list, i = 0; walk && i < SWFDEC_MOVIE_INDEX_THRESHOLD;
+      walk = walk->next, i++);
+  if (i < SWFDEC_MOVIE_INDEX_THRESHOLD)
+    return;
+
+  SWFDEC_DEBUG ("creating hit test index for %s %s", 
+      G_OBJECT_TYPE_NAME (movie), movie->name);
+  movie->index = swfdec_spatial_index_new (SWFDEC_MOVIE_INDEX_CELL_SIZE);
   for (walk = movie->list; walk; walk = walk->next) {
-    SwfdecMovie *child = walk->data;
-    
-    if (!child->visible) {
-      SWFDEC_LOG ("%s %s (depth %d) is invisible, ignoring", G_OBJECT_TYPE_NAME (movie), movie->name, movie->depth);
-      continue;
-    }
-    got = swfdec_movie_get_movie_at (child, x, y, events);
-    if (got != NULL) {
-      if (events) {
-	/* set the return value to the topmost movie */
-	if (SWFDEC_IS_ACTOR (got) && swfdec_actor_get_mouse_events (SWFDEC_ACTOR (got))) {
-	  ret = got;
-	} else if (ret == NULL) {
-	  ret = movie;
-	}
-      } else {
-	/* if thie is not a clipped movie, we've found something */
-	if (child->clip_depth == 0)
-	  return movie;
+    swfdec_movie_update_index (walk->data);
+  }
+}
+
+/* checks if child is hit. Returns TRUE if no more children need to be checked */
+static gboolean
+swfdec_movie_contains_child (SwfdecMovie *movie, SwfdecMovie *child, 
+    double x, double y, gboolean events, SwfdecMovie **ret, int *skip_depth)
+{
+  SwfdecMovie *got;
+
+  /* skip obscured movies */
+  if (child->depth <= *skip_depth)
+    return FALSE;
+  if (!child->visible) {
+    SWFDEC_LOG ("%s %s (depth %d) is invisible, ignoring", G_OBJECT_TYPE_NAME (movie), movie->name, movie->depth);
+    return FALSE;
+  }
+  got = swfdec_movie_get_movie_at (child, x, y, events);
+  if (got != NULL) {
+    if (events) {
+      /* set the return value to the topmost movie */
+      if (SWFDEC_IS_ACTOR (got) && swfdec_actor_get_mouse_events (SWFDEC_ACTOR (got))) {
+	*ret = got;
+      } else if (*ret == NULL) {
+	*ret = movie;
       }
     } else {
-      if (child->clip_depth) {
-	/* skip obscured movies */
-	SwfdecMovie *tmp = walk->next ? walk->next->data : NULL;
-	while (tmp && tmp->depth <= child->clip_depth) {
-	  walk = walk->next;
-	  tmp = walk->next ? walk->next->data : NULL;
-	}
+      /* if thie is not a clipped movie, we've found something */
+      if (child->clip_depth == 0) {
+	*ret = movie;
+	return TRUE;
       }
     }
+  } else if (child->clip_depth) {
+    *skip_depth = child->clip_depth;
+  }
+  return FALSE;
+}
+
+static SwfdecMovie *
+swfdec_movie_do_contains (SwfdecMovie *movie, double x, double y, gboolean events)
+{
+  GSList *walk2;
+  SwfdecMovie *ret;
+  int skip_depth = G_MININT;
+
+  ret = NULL;
+  swfdec_movie_ensure_index (movie);
+  if (movie->index) {
+    GSList *candidates;
+
+    /* the index requires up-to-date extents of all children */
+    if (movie->cache_state != SWFDEC_MOVIE_UP_TO_DATE)
+      swfdec_movie_update (movie);
+    /* children that aren't returned can't be hit */
+    candidates = swfdec_spatial_index_query (movie->index, x, y);
+    candidates = g_slist_sort (candidates, swfdec_movie_compare_depths);
+    for (walk2 = candidates; walk2; walk2 = walk2->next) {
+      if (swfdec_movie_contains_child (movie, walk2->data, x, y, events, 
+	    &ret, &skip_depth))
+	break;
+    }
+    g_slist_free (candidates);
+  } else {
+    GList *walk;
+
+    for (walk = movie->list; walk; walk = walk->next) {
+      if (swfdec_movie_contains_child (movie, walk->data, x, y, events, 
+	    &ret, &skip_depth))
+	break;
+    }
   }
   if (ret)
     return ret;
@@ -766,6 +874,185 @@ swfdec_paint_with_blend_mode (cairo_t *cr, guint blend_mode)
   }
 }
 
+/* Flash refuses to cache bitmaps larger than this */
+#define SWFDEC_MOVIE_MAX_CACHED_SIZE 2880
+
+typedef struct {
+  guint				version;	/* cache version of the movie */
+  const SwfdecColorTransform *	trans;		/* color transform to render with */
+  const cairo_matrix_t *	matrix;		/* movie => stage matrix */
+} SwfdecMovieCacheLookup;
+
+static gboolean
+swfdec_movie_find_cached (SwfdecCached *cached, gpointer data)
+{
+  SwfdecMovieCacheLookup *lookup = data;
+
+  if (!SWFDEC_IS_CACHED_MOVIE (cached))
+    return FALSE;
+  return swfdec_cached_movie_matches (SWFDEC_CACHED_MOVIE (cached),
+      lookup->version, lookup->trans, lookup->matrix);
+}
+
+/* renders the movie into a new surface and puts it into the renderer's cache.
+ * Returns NULL if the movie is empty or too big to cache, in which case @area
+ * tells which one it was. */
+static cairo_surface_t *
+swfdec_movie_render_to_cache (SwfdecMovie *movie, SwfdecRenderer *renderer,
+    const SwfdecColorTransform *trans, const cairo_matrix_t *matrix, 
+    SwfdecRectangle *area)
+{
+  SwfdecCachedMovie *cached;
+  SwfdecMovieClass *klass;
+  cairo_surface_t *surface;
+  SwfdecRect rect;
+  GSList *walk;
+  cairo_t *cr;
+  gsize size;
+
+  swfdec_rect_transform (&rect, &movie->original_extents, matrix);
+  swfdec_rectangle_init_rect (area, &rect);
+  if (movie->filters) {
+    SwfdecPlayer *player = SWFDEC_PLAYER (swfdec_gc_object_get_context (movie));
+    double xscale, yscale;
+
+    /* same hack as in swfdec_movie_apply_filters() */
+    area->width++;
+    area->height++;
+    xscale = player->priv->global_to_stage.xx * SWFDEC_TWIPS_SCALE_FACTOR;
+    yscale = player->priv->global_to_stage.yy * SWFDEC_TWIPS_SCALE_FACTOR;
+    for (walk = movie->filters; walk; walk = walk->next) {
+      swfdec_filter_get_rectangle (walk->data, area, xscale, yscale, area);
+    }
+  }
+  if (swfdec_rectangle_is_empty (area))
+    return NULL;
+  size = (gsize) area->width * area->height * 4;
+  if (area->width > SWFDEC_MOVIE_MAX_CACHED_SIZE || 
+      area->height > SWFDEC_MOVIE_MAX_CACHED_SIZE ||
+      size > swfdec_renderer_get_max_cache_size (renderer) / 2) {
+    SWFDEC_INFO ("%s %s is too big to cache: %dx%d", G_OBJECT_TYPE_NAME (movie),
+	movie->name, area->width, area->height);
+    return NULL;
+  }
+
+  /* render the movie in stage coordinates, with the stage origin moved so that
+   * the top left corner of area ends up at the surface's origin */
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32, 
+      area->width, area->height);
+  cr = cairo_create (surface);
+  cairo_translate (cr, -area->x, -area->y);
+  swfdec_renderer_attach (renderer, cr);
+  cairo_transform (cr, matrix);
+  klass = SWFDEC_MOVIE_GET_CLASS (movie);
+  klass->render (movie, cr, trans);
+  if (cairo_status (cr) != CAIRO_STATUS_SUCCESS) {
+    g_warning ("error rendering with cairo: %s", cairo_status_to_string (cairo_status (cr)));
+  }
+  cairo_destroy (cr);
+
+  /* cache the filtered result, not the source */
+  if (movie->filters) {
+    cairo_pattern_t *pattern;
+    cairo_matrix_t mat;
+
+    pattern = cairo_pattern_create_for_surface (surface);
+    cairo_surface_destroy (surface);
+    cairo_matrix_init_translate (&mat, -area->x, -area->y);
+    cairo_pattern_set_matrix (pattern, &mat);
+    pattern = swfdec_movie_apply_filters (movie, pattern);
+
+    surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32, 
+	area->width, area->height);
+    cr = cairo_create (surface);
+    cairo_translate (cr, -area->x, -area->y);
+    cairo_set_source (cr, pattern);
+    cairo_paint (cr);
+    cairo_destroy (cr);
+    cairo_pattern_destroy (pattern);
+  }
+
+  surface = swfdec_renderer_create_similar (renderer, surface);
+  cached = swfdec_cached_movie_new (surface, size, movie->cache_version,
+      matrix, area->x, area->y);
+  swfdec_cached_image_set_color_transform (SWFDEC_CACHED_IMAGE (cached), trans);
+  /* replace, older versions are outdated */
+  swfdec_renderer_add_cache (renderer, TRUE, movie, SWFDEC_CACHED (cached));
+  g_object_unref (cached);
+  return surface;
+}
+
+/**
+ * swfdec_movie_render_cached:
+ * @movie: the movie to render
+ * @cr: the cairo context to render to
+ * @trans: the color transform to use, already including @movie's own transform
+ *
+ * Renders @movie and its children via a surface in @cr's renderer's cache. 
+ * The surface is reused as long as neither @movie nor any of its children
+ * changed and @movie has only been moved by full pixels. For movies with 
+ * filters the surface contains the result of applying the filters.
+ *
+ * Returns: %FALSE if the movie could not be cached and must be rendered 
+ *          normally.
+ **/
+static gboolean
+swfdec_movie_render_cached (SwfdecMovie *movie, cairo_t *cr,
+    const SwfdecColorTransform *trans)
+{
+  SwfdecMovieCacheLookup lookup;
+  SwfdecRenderer *renderer;
+  SwfdecCached *cached;
+  cairo_surface_t *surface;
+  cairo_matrix_t matrix, stage;
+  SwfdecRectangle area;
+
+  renderer = swfdec_renderer_get (cr);
+  if (renderer == NULL)
+    return FALSE;
+
+  /* compute the movie => stage matrix */
+  cairo_save (cr);
+  cairo_transform (cr, &movie->matrix);
+  cairo_get_matrix (cr, &matrix);
+  swfdec_renderer_reset_matrix (cr);
+  cairo_get_matrix (cr, &stage);
+  cairo_restore (cr);
+  if (cairo_matrix_invert (&stage) != CAIRO_STATUS_SUCCESS)
+    return FALSE;
+  cairo_matrix_multiply (&matrix, &matrix, &stage);
+  /* like in Flash, cached bitmaps are aligned to full pixels */
+  matrix.x0 = floor (matrix.x0 + 0.5);
+  matrix.y0 = floor (matrix.y0 + 0.5);
+
+  lookup.version = movie->cache_version;
+  lookup.trans = trans;
+  lookup.matrix = &matrix;
+  cached = swfdec_renderer_get_cache (renderer, movie, 
+      swfdec_movie_find_cached, &lookup);
+  if (cached) {
+    SWFDEC_LOG ("using cached surface for %s %s", G_OBJECT_TYPE_NAME (movie),
+	movie->name);
+    swfdec_cached_use (cached);
+    surface = swfdec_cached_image_get_surface (SWFDEC_CACHED_IMAGE (cached));
+    swfdec_cached_movie_get_position (SWFDEC_CACHED_MOVIE (cached), &matrix,
+	&area.x, &area.y);
+  } else {
+    SWFDEC_LOG ("caching %s %s", G_OBJECT_TYPE_NAME (movie), movie->name);
+    surface = swfdec_movie_render_to_cache (movie, renderer, trans, &matrix, &area);
+    if (surface == NULL)
+      return swfdec_rectangle_is_empty (&area);
+  }
+
+  cairo_save (cr);
+  swfdec_renderer_reset_matrix (cr);
+  cairo_set_source_surface (cr, surface, area.x, area.y);
+  swfdec_paint_with_blend_mode (cr, movie->blend_mode);
+  cairo_restore (cr);
+  cairo_surface_destroy (surface);
+  return TRUE;
+}
+
 /**
  * swfdec_movie_mask:
  * @movie: The movie to act as the mask
@@ -800,6 +1087,25 @@ swfdec_movie_mask (cairo_t *cr, SwfdecMovie *movie,
   return cairo_pop_group (cr);
 }
 
+/* checks if @movie's mask doesn't overlap it, so nothing would be visible */
+static gboolean
+swfdec_movie_is_masked_out (SwfdecMovie *movie)
+{
+  SwfdecMovie *mask = movie->masked_by;
+  SwfdecRect rect, mask_rect;
+
+  if (!movie->cullable || !mask->cullable)
+    return FALSE;
+
+  rect = movie->extents;
+  if (movie->parent)
+    swfdec_movie_rect_local_to_global (movie->parent, &rect);
+  mask_rect = mask->extents;
+  if (mask->parent)
+    swfdec_movie_rect_local_to_global (mask->parent, &mask_rect);
+  return !swfdec_rect_intersect (NULL, &rect, &mask_rect);
+}
+
 void
 swfdec_movie_render (SwfdecMovie *movie, cairo_t *cr,
     const SwfdecColorTransform *color_transform)
@@ -822,16 +1128,31 @@ swfdec_movie_render (SwfdecMovie *movie, cairo_t *cr,
     return;
   }
 
+  /* yes, movie with filters, don't get masked */
+  needs_mask = movie->masked_by != NULL && movie->filters == NULL;
+  if (needs_mask && swfdec_movie_is_masked_out (movie)) {
+    SWFDEC_LOG ("not rendering %s %s, mask doesn't cover it",
+	G_OBJECT_TYPE_NAME (movie), movie->name);
+    return;
+  }
+
   group = swfdec_movie_needs_group (movie);
+  /* masks and masked movies are rendered normally, caching them would need
+   * to take the mask into account */
+  if ((group == SWFDEC_GROUP_CACHED || group == SWFDEC_GROUP_FILTERS) &&
+      movie->masked_by == NULL && !swfdec_color_transform_is_mask (color_transform)) {
+    swfdec_color_transform_chain (&trans, &movie->color_transform, color_transform);
+    if (swfdec_movie_render_cached (movie, cr, &trans))
+      return;
+  }
   if (group == SWFDEC_GROUP_NORMAL) {
     SWFDEC_DEBUG ("pushing group for blend mode %u", movie->blend_mode);
     cairo_push_group (cr);
   } else if (group != SWFDEC_GROUP_NONE) {
-    SWFDEC_FIXME ("implement cache-as-bitmap here");
+    SWFDEC_DEBUG ("pushing uncached group for %s %s", 
+	G_OBJECT_TYPE_NAME (movie), movie->name);
     cairo_push_group (cr);
   }
-  /* yes, movie with filters, don't get masked */
-  needs_mask = movie->masked_by != NULL && movie->filters == NULL;
   if (needs_mask) {
     cairo_push_group (cr);
   }
@@ -965,12 +1286,16 @@ swfdec_movie_set_property (GObject *object, guint param_id, const GValue *value,
       movie->parent = g_value_get_object (value);
       /* parent holds a reference */
       g_object_ref (movie);
+      cx->movie_epoch++;
       if (movie->parent) {
 	movie->parent->list = g_list_insert_sorted (movie->parent->list, movie, swfdec_movie_compare_depths);
+	swfdec_movie_update_index (movie);
 	SWFDEC_DEBUG ("inserting %s %p into %s %p", G_OBJECT_TYPE_NAME (movie), movie,
 	    G_OBJECT_TYPE_NAME (movie->parent), movie->parent);
 	/* invalidate the parent, so it gets visible */
 	swfdec_movie_queue_update (movie->parent, SWFDEC_MOVIE_INVALID_CHILDREN);
+	/* cached surfaces of the parents don't contain the new child */
+	swfdec_movie_invalidate_last (movie);
       } else {
 	SwfdecPlayerPrivate *priv = SWFDEC_PLAYER (cx)->priv;
 	priv->roots = g_list_insert_sorted (priv->roots, movie, swfdec_movie_compare_depths);
@@ -994,6 +1319,10 @@ swfdec_movie_dispose (GObject *object)
   g_assert (movie->list == NULL);
 
   SWFDEC_LOG ("disposing movie %s (depth %d)", movie->name, movie->depth);
+  if (movie->index) {
+    swfdec_spatial_index_free (movie->index);
+    movie->index = NULL;
+  }
   if (movie->graphic) {
     g_object_unref (movie->graphic);
     movie->graphic = NULL;
@@ -1181,19 +1510,88 @@ typedef struct {
   int			depth;
 } ClipEntry;
 
+static gboolean
+swfdec_movie_image_intersects (SwfdecMovie *movie, const SwfdecRect *rect)
+{
+  SwfdecRect image_extents = { 0, 0, 
+    movie->image->width * SWFDEC_TWIPS_SCALE_FACTOR,
+    movie->image->height * SWFDEC_TWIPS_SCALE_FACTOR };
+
+  return swfdec_rect_intersect (NULL, &image_extents, rect);
+}
+
+/* the clip extents in device coordinates */
+static void
+swfdec_movie_get_device_clip (cairo_t *cr, SwfdecRect *clip)
+{
+  cairo_save (cr);
+  cairo_identity_matrix (cr);
+  cairo_clip_extents (cr, &clip->x0, &clip->y0, &clip->x1, &clip->y1);
+  cairo_restore (cr);
+}
+
+/* checks if rendering @movie can be skipped, because it is completely outside
+ * of @clip. @matrix converts from @movie's parent to device coordinates. */
+static gboolean
+swfdec_movie_is_clipped (SwfdecMovie *movie, const cairo_matrix_t *matrix,
+    const SwfdecRect *clip)
+{
+  SwfdecRect rect;
+
+  if (!movie->cullable)
+    return FALSE;
+  if (swfdec_rect_is_empty (&movie->extents))
+    return TRUE;
+
+  swfdec_rect_transform (&rect, &movie->extents, matrix);
+  /* be generous, antialiasing and textfield borders can exceed extents */
+  rect.x0 -= 1;
+  rect.y0 -= 1;
+  rect.x1 += 1;
+  rect.y1 += 1;
+  return !swfdec_rect_intersect (NULL, &rect, clip);
+}
+
+/* checks if any of the movies masked by the clipping movie at @list will be 
+ * rendered, so the group for the clip needs to be pushed */
+static gboolean
+swfdec_movie_needs_clip (GList *list, const cairo_matrix_t *matrix,
+    const SwfdecRect *clip)
+{
+  SwfdecMovie *mask = list->data;
+  GList *walk;
+
+  if (swfdec_movie_is_clipped (mask, matrix, clip))
+    return FALSE;
+
+  for (walk = list->next; walk; walk = walk->next) {
+    SwfdecMovie *child = walk->data;
+
+    if (child->depth > mask->clip_depth)
+      break;
+    /* nested clips are complicated, be safe */
+    if (child->clip_depth)
+      return TRUE;
+    if (child->visible && !swfdec_movie_is_clipped (child, matrix, clip))
+      return TRUE;
+  }
+  return FALSE;
+}
+
 static void
 swfdec_movie_do_render (SwfdecMovie *movie, cairo_t *cr,
     const SwfdecColorTransform *ctrans)
 {
   static const cairo_matrix_t ident = { 1, 0, 0, 1, 0, 0};
+  cairo_matrix_t to_device;
+  SwfdecRect inval, clip_extents;
   GList *g;
   GSList *walk;
   GSList *clips = NULL;
   ClipEntry *clip = NULL;
+  int skip_depth = G_MININT;
 
   if (movie->draws || movie->image) {
-    SwfdecRect inval;
-
     cairo_clip_extents (cr, &inval.x0, &inval.y0, &inval.x1, &inval.y1);
 
     /* exeute the movie's drawing commands */
@@ -1207,8 +1605,7 @@ swfdec_movie_do_render (SwfdecMovie *movie, cairo_t *cr,
     }
 
     /* if the movie loaded an image, draw it here now */
-    /* FIXME: add check to only draw if inside clip extents */
-    if (movie->image) {
+    if (movie->image && swfdec_movie_image_intersects (movie, &inval)) {
       SwfdecRenderer *renderer = swfdec_renderer_get (cr);
       cairo_surface_t *surface;
       cairo_pattern_t *pattern;
@@ -1238,6 +1635,12 @@ swfdec_movie_do_render (SwfdecMovie *movie, cairo_t *cr,
     }
   }
 
+  if (movie->list == NULL)
+    return;
+  /* children that are completely outside the clip are skipped */
+  cairo_get_matrix (cr, &to_device);
+  swfdec_movie_get_device_clip (cr, &clip_extents);
+
   /* draw the children movies */
   for (g = movie->list; g; g = g_list_next (g)) {
     SwfdecMovie *child = g->data;
@@ -1255,7 +1658,19 @@ swfdec_movie_do_render (SwfdecMovie *movie, cairo_t *cr,
       clip = clips ? clips->data : NULL;
     }
 
+    /* movies clipped by an invisible clip */
+    if (child->depth <= skip_depth) {
+      if (child->clip_depth)
+	skip_depth = MAX (skip_depth, child->clip_depth);
+      continue;
+    }
+
     if (child->clip_depth) {
+      if (!swfdec_movie_needs_clip (g, &to_device, &clip_extents)) {
+	SWFDEC_LOG ("skipping clip depth %d, nothing visible", child->clip_depth);
+	skip_depth = child->clip_depth;
+	continue;
+      }
       clip = g_slice_new (ClipEntry);
       clips = g_slist_prepend (clips, clip);
       clip->movie = child;
@@ -1266,9 +1681,14 @@ swfdec_movie_do_render (SwfdecMovie *movie, cairo_t *cr,
       continue;
     }
 
+    if (!child->visible)
+      continue;
+    if (swfdec_movie_is_clipped (child, &to_device, &clip_extents)) {
+      SWFDEC_LOG ("skipping %p with depth %d, outside of clip", child, child->depth);
+      continue;
+    }
     SWFDEC_LOG ("rendering %p with depth %d", child, child->depth);
-    if (child->visible)
-      swfdec_movie_render (child, cr, ctrans);
+    swfdec_movie_render (child, cr, ctrans);
   }
   while (clip) {
     cairo_pattern_t *mask;
@@ -1420,6 +1840,7 @@ swfdec_movie_set_depth (SwfdecMovie *movie, int depth)
 
   swfdec_movie_invalidate_last (movie);
   movie->depth = depth;
+  swfdec_gc_object_get_context (movie)->movie_epoch++;
   if (movie->parent) {
     movie->parent->list = g_list_sort (movie->parent->list, swfdec_movie_compare_depths);
   } else {
@@ -1516,6 +1937,7 @@ swfdec_movie_set_static_properties (SwfdecMovie *movie, const cairo_matrix_t *tr
   }
   if (clip_depth && clip_depth != movie->clip_depth) {
     movie->clip_depth = clip_depth;
+    swfdec_movie_update_index (movie);
     /* FIXME: is this correct? */
     swfdec_movie_invalidate_last (movie->parent ? movie->parent : movie);
   }
@@ -27,6 +27,7 @@
 #include <swfdec/swfdec.h>
 #include <swfdec/swfdec_event.h>
 #include <swfdec/swfdec_rect.h>
+#include <swfdec/swfdec_spatial_index.h>
 #include <swfdec/swfdec_types.h>
 
 G_BEGIN_DECLS
@@ -124,6 +125,7 @@ struct _SwfdecMovie {
   SwfdecGraphic *	graphic;		/* graphic represented by this movie or NULL if script-created */
   const char *		name;		/* name of movie - GC'd */
   GList *		list;			/* our contained movie clips (ordered by depth) */
+  SwfdecSpatialIndex *	index;			/* index of the children's extents for hit testing or NULL */
   int			depth;			/* depth of movie (equals content->depth unless explicitly set) */
   SwfdecMovieCacheState	cache_state;		/* whether we are up to date */
   SwfdecMovieState	state;			/* state the movie is in */
@@ -145,6 +147,7 @@ struct _SwfdecMovie {
   /* positioning - the values are applied in this order */
   SwfdecRect		extents;		/* the extents occupied after transform is applied */
   SwfdecRect		original_extents;	/* the extents from all children - unmodified */
+  gboolean		cullable;		/* nothing is rendered outside of extents (no filters) */
   gboolean		modified;		/* TRUE if the transform has been modified by scripts */
   double		xscale;			/* x scale in percent */
   double		yscale;			/* y scale in percent */
@@ -162,6 +165,7 @@ struct _SwfdecMovie {
   SwfdecMovie *		masked_by;		/* movie we are masked by or NULL if none */
   GSList *		filters;		/* filters to apply to movie */
   gboolean		cache_as_bitmap;	/* the movie should be cached */
+  guint			cache_version;		/* changes whenever the rendered contents change */
   /* FIXME: could it be that shape drawing (SwfdecGraphicMovie etc) uses these same objects? */
   SwfdecImage *		image;			/* image loaded via loadMovie */
   SwfdecRect		draw_extents;		/* extents of the items in the following list */
@@ -293,6 +297,7 @@ void		swfdec_movie_render		(SwfdecMovie *		movie,
 gboolean	swfdec_movie_is_scriptable	(SwfdecMovie *		movie);
 guint		swfdec_movie_get_version	(SwfdecMovie *		movie);
 
+void		swfdec_movie_update_index	(SwfdecMovie *		movie);
 int		swfdec_movie_compare_depths	(gconstpointer		a,
 						 gconstpointer		b);
 SwfdecDepthClass
@@ -146,7 +146,11 @@ mc_name_get (SwfdecMovie *movie)
 static void
 mc_name_set (SwfdecMovie *movie, SwfdecAsValue val)
 {
-  movie->name = swfdec_as_value_to_string (swfdec_gc_object_get_context (movie), val);
+  SwfdecAsContext *cx = swfdec_gc_object_get_context (movie);
+
+  movie->name = swfdec_as_value_to_string (cx, val);
+  /* property caches remember the names a movie doesn't have */
+  cx->movie_epoch++;
 }
 
 static SwfdecAsValue
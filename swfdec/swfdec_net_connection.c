@@ -107,7 +107,7 @@ swfdec_net_connection_do_connect (SwfdecAsContext *cx, SwfdecAsObject *object,
   SWFDEC_AS_CHECK (SWFDEC_TYPE_NET_CONNECTION, &conn, "v", &val);
 
   if (SWFDEC_AS_VALUE_IS_STRING (val)) {
-    url = SWFDEC_AS_VALUE_GET_STRING (val);
+    url = SWFDEC_AS_VALUE_GET_FLAT_STRING (val);
   } else if (SWFDEC_AS_VALUE_IS_NULL (val)) {
     url = NULL;
   } else {
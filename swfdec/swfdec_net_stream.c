@@ -249,7 +249,7 @@ swfdec_net_stream_video_goto (SwfdecNetStream *stream, guint timestamp)
 	SWFDEC_ERROR ("could not parse data tag");
       } else {
 	swfdec_as_relay_call (SWFDEC_AS_RELAY (stream), 
-	    SWFDEC_AS_VALUE_GET_STRING (name), 1, &value, NULL);
+	    SWFDEC_AS_VALUE_GET_FLAT_STRING (name), 1, &value, NULL);
       }
       swfdec_sandbox_unuse (stream->sandbox);
     }
@@ -304,20 +304,21 @@ swfdec_net_stream_construct (SwfdecAsContext *cx, SwfdecAsObject *obj, guint arg
   SWFDEC_AS_VALUE_SET_OBJECT (rval, obj);
 }
 
-void
-swfdec_net_stream_init_context (SwfdecPlayer *player)
+/* builds the NetStream class the first time a script uses it */
+static void
+swfdec_net_stream_build (SwfdecAsContext *context, SwfdecAsObject *global,
+    guint argc, SwfdecAsValue *argv, SwfdecAsValue *rval)
 {
-  SwfdecAsContext *context;
   SwfdecAsObject *stream, *proto;
   SwfdecAsValue val;
 
-  g_return_if_fail (SWFDEC_IS_PLAYER (player));
+  if (global == NULL)
+    return;
 
-  context = SWFDEC_AS_CONTEXT (player);
   proto = swfdec_as_object_new_empty (context);
   stream = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (
-	swfdec_as_object_add_function (context->global, 
-	  SWFDEC_AS_STR_NetStream, swfdec_net_stream_construct)));
+	swfdec_as_native_function_new (context, SWFDEC_AS_STR_NetStream, 
+	  swfdec_net_stream_construct)));
   /* set the right properties on the NetStream.prototype object */
   swfdec_as_object_add_function (proto, SWFDEC_AS_STR_pause, swfdec_net_stream_pause);
   swfdec_as_object_add_function (proto, SWFDEC_AS_STR_play, swfdec_net_stream_play);
@@ -325,7 +326,7 @@ swfdec_net_stream_init_context (SwfdecPlayer *player)
   SWFDEC_AS_VALUE_SET_OBJECT (&val, stream);
   swfdec_as_object_set_variable_and_flags (proto, SWFDEC_AS_STR_constructor,
       &val, SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
-  swfdec_as_object_get_variable (context->global, SWFDEC_AS_STR_Object, &val);
+  swfdec_as_object_get_variable (global, SWFDEC_AS_STR_Object, &val);
   if (SWFDEC_AS_VALUE_IS_OBJECT (val)) {
     swfdec_as_object_get_variable (SWFDEC_AS_VALUE_GET_OBJECT (val),
 	SWFDEC_AS_STR_prototype, &val);
@@ -335,5 +336,18 @@ swfdec_net_stream_init_context (SwfdecPlayer *player)
     swfdec_as_object_set_variable_and_flags (stream, SWFDEC_AS_STR_prototype, &val,
 	SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
   }
+  SWFDEC_AS_VALUE_SET_OBJECT (rval, stream);
 }
 
+void
+swfdec_net_stream_init_context (SwfdecPlayer *player)
+{
+  SwfdecAsContext *context;
+
+  g_return_if_fail (SWFDEC_IS_PLAYER (player));
+
+  context = SWFDEC_AS_CONTEXT (player);
+  swfdec_as_object_add_lazy_variable (context->global, SWFDEC_AS_STR_NetStream,
+      swfdec_net_stream_build, 
+      SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+}
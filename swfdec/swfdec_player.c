@@ -502,6 +502,7 @@ swfdec_player_remove_all_actions (SwfdecPlayer *player, SwfdecActor *actor)
       }
     }
   }
+  swfdec_as_context_drop_suspended (SWFDEC_AS_CONTEXT (player), SWFDEC_MOVIE (actor));
 }
 
 static gboolean
@@ -523,7 +524,15 @@ swfdec_player_do_action (SwfdecPlayer *player)
 	SwfdecSandbox *sandbox = SWFDEC_MOVIE (action->actor)->resource->sandbox;
 	SwfdecAsObject *object = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (action->actor));
 	swfdec_sandbox_use (sandbox);
-	swfdec_as_object_run (object, action->script);
+	if (priv->script_budget) {
+	  /* scripts started from inside another script count for the outer one */
+	  if (SWFDEC_AS_CONTEXT (player)->frame == NULL) {
+	    priv->script_start = g_timer_elapsed (priv->runtime, NULL) * 1000;
+	    priv->script_runtime = 0;
+	  }
+	  swfdec_as_object_run_resumable (object, action->script);
+	} else
+	  swfdec_as_object_run (object, action->script);
 	swfdec_sandbox_unuse (sandbox);
       } else {
 	swfdec_actor_execute (action->actor, action->event, action->key);
@@ -669,6 +678,7 @@ enum {
   PROP_SCRIPTING,
   PROP_SYSTEM,
   PROP_MAX_RUNTIME,
+  PROP_SCRIPT_BUDGET,
   PROP_LOADER_TYPE,
   PROP_SOCKET_TYPE,
   PROP_BASE_URL,
@@ -784,6 +794,9 @@ swfdec_player_get_property (GObject *object, guint param_id, GValue *value,
     case PROP_MAX_RUNTIME:
       g_value_set_ulong (value, priv->max_runtime);
       break;
+    case PROP_SCRIPT_BUDGET:
+      g_value_set_ulong (value, priv->script_budget);
+      break;
     case PROP_LOADER_TYPE:
       g_value_set_gtype (value, priv->loader_type);
       break;
@@ -827,10 +840,11 @@ swfdec_player_emit_signals (SwfdecPlayer *player)
   GList *walk;
 
   /* emit invalidate signal */
-  if (priv->invalidations->len != 0) {
+  if (!swfdec_region_is_empty (priv->invalidations)) {
     g_signal_emit (player, signals[INVALIDATE], 0,
-	priv->invalidations->data, priv->invalidations->len);
-    g_array_set_size (priv->invalidations, 0);
+	swfdec_region_get_rectangles (priv->invalidations), 
+	swfdec_region_get_n_rectangles (priv->invalidations));
+    swfdec_region_clear (priv->invalidations);
   }
 
   /* emit audio-added for all added audio streams */
@@ -978,6 +992,9 @@ swfdec_player_set_property (GObject *object, guint param_id, const GValue *value
     case PROP_MAX_RUNTIME:
       swfdec_player_set_maximum_runtime (player, g_value_get_ulong (value));
       break;
+    case PROP_SCRIPT_BUDGET:
+      swfdec_player_set_script_budget (player, g_value_get_ulong (value));
+      break;
     case PROP_LOADER_TYPE:
       g_return_if_fail (G_TYPE_IS_INSTANTIATABLE (g_value_get_gtype (value)));
       priv->loader_type = g_value_get_gtype (value);
@@ -1096,7 +1113,7 @@ swfdec_player_dispose (GObject *object)
     g_object_unref (priv->system);
     priv->system = NULL;
   }
-  g_array_free (priv->invalidations, TRUE);
+  swfdec_region_free (priv->invalidations);
   priv->invalidations = NULL;
   if (priv->renderer) {
     g_object_unref (priv->renderer);
@@ -1804,6 +1821,31 @@ swfdec_player_advance_audio (SwfdecPlayer *player, guint samples)
   }
 }
 
+/* continues the scripts that were suspended during the last advance */
+static void
+swfdec_player_resume_scripts (SwfdecPlayer *player)
+{
+  SwfdecAsContext *context = SWFDEC_AS_CONTEXT (player);
+  SwfdecPlayerPrivate *priv = player->priv;
+  SwfdecSandbox *sandbox;
+  SwfdecAsFrame *frame;
+  guint i;
+
+  /* only resume the frames that are suspended now, frames that suspend 
+   * again have to wait for the next advance */
+  for (i = g_slist_length (context->suspended); i > 0 && context->suspended; i--) {
+    frame = context->suspended->data;
+    sandbox = frame->target->resource->sandbox;
+    swfdec_sandbox_use (sandbox);
+    priv->script_start = g_timer_elapsed (priv->runtime, NULL) * 1000;
+    priv->script_runtime = frame->runtime;
+    swfdec_as_context_resume (context, frame);
+    priv->script_runtime = 0;
+    swfdec_sandbox_unuse (sandbox);
+    swfdec_player_perform_actions (player);
+  }
+}
+
 static void
 swfdec_player_do_advance (SwfdecPlayer *player, gulong msecs, guint audio_samples)
 {
@@ -1821,6 +1863,7 @@ swfdec_player_do_advance (SwfdecPlayer *player, gulong msecs, guint audio_sample
 
   timeout = priv->timeouts->data;
   swfdec_player_advance_audio (player, audio_samples);
+  swfdec_player_resume_scripts (player);
   if (timeout->timestamp <= target_time) {
     priv->timeouts = g_list_remove (priv->timeouts, timeout);
     priv->time = timeout->timestamp;
@@ -1849,7 +1892,7 @@ swfdec_player_lock_soft (SwfdecPlayer *player)
 {
   g_return_if_fail (SWFDEC_IS_PLAYER (player));
   g_assert (!swfdec_player_is_locked (player));
-  g_assert (player->priv->invalidations->len == 0);
+  g_assert (swfdec_region_is_empty (player->priv->invalidations));
 
   g_object_freeze_notify (G_OBJECT (player));
   g_timer_start (player->priv->runtime);
@@ -2110,9 +2153,33 @@ swfdec_player_check_continue (SwfdecAsContext *context)
   SwfdecPlayer *player = SWFDEC_PLAYER (context);
   SwfdecPlayerPrivate *priv = player->priv;
 
+  double elapsed;
+
   if (priv->max_runtime == 0)
     return TRUE;
-  return g_timer_elapsed (priv->runtime, NULL) * 1000 <= priv->max_runtime;
+  elapsed = g_timer_elapsed (priv->runtime, NULL) * 1000;
+  if (elapsed > priv->max_runtime)
+    return FALSE;
+  /* a resumed script also counts the time it ran in earlier advances */
+  return priv->script_runtime + elapsed - priv->script_start <= priv->max_runtime;
+}
+
+static gboolean
+swfdec_player_check_yield (SwfdecAsContext *context)
+{
+  SwfdecPlayer *player = SWFDEC_PLAYER (context);
+  SwfdecPlayerPrivate *priv = player->priv;
+
+  double elapsed;
+
+  if (priv->script_budget == 0)
+    return FALSE;
+  elapsed = g_timer_elapsed (priv->runtime, NULL) * 1000;
+  if (elapsed <= priv->script_budget)
+    return FALSE;
+  /* the frame gets suspended now, remember how long it has run in total */
+  context->frame->runtime = priv->script_runtime + elapsed - priv->script_start;
+  return TRUE;
 }
 
 static gboolean
@@ -2187,6 +2254,9 @@ swfdec_player_class_init (SwfdecPlayerClass *klass)
   g_object_class_install_property (object_class, PROP_MAX_RUNTIME,
       g_param_spec_ulong ("max-runtime", "maximum runtime", "maximum time in msecs scripts may run in the player before aborting",
 	  0, G_MAXULONG, 10 * 1000, G_PARAM_READWRITE));
+  g_object_class_install_property (object_class, PROP_SCRIPT_BUDGET,
+      g_param_spec_ulong ("script-budget", "script budget", "time in msecs scripts may run per advance before being suspended or 0 to never suspend",
+	  0, G_MAXULONG, 0, G_PARAM_READWRITE));
   g_object_class_install_property (object_class, PROP_LOADER_TYPE,
       g_param_spec_gtype ("loader-type", "loader type", "type to use for creating loaders",
 	  SWFDEC_TYPE_LOADER, G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY));
@@ -2225,8 +2295,8 @@ swfdec_player_class_init (SwfdecPlayerClass *klass)
   /**
    * SwfdecPlayer::invalidate:
    * @player: the #SwfdecPlayer affected
-   * @rectangles: a number of smaller rectangles for fine-grained control over 
-   *              changes
+   * @rectangles: a number of smaller, non-overlapping rectangles for 
+   *              fine-grained control over changes
    * @n_rectangles: number of rectangles in @rectangles
    *
    * This signal is emitted whenever graphical elements inside the player have 
@@ -2402,6 +2472,7 @@ swfdec_player_class_init (SwfdecPlayerClass *klass)
   context_class->mark = swfdec_player_mark;
   context_class->get_time = swfdec_player_get_time;
   context_class->check_continue = swfdec_player_check_continue;
+  context_class->check_yield = swfdec_player_check_yield;
 
   klass->advance = swfdec_player_do_advance;
   klass->handle_key = swfdec_player_do_handle_key;
@@ -2433,7 +2504,7 @@ swfdec_player_init (SwfdecPlayer *player)
   priv->runtime = g_timer_new ();
   g_timer_stop (priv->runtime);
   priv->max_runtime = 10 * 1000;
-  priv->invalidations = g_array_new (FALSE, FALSE, sizeof (SwfdecRectangle));
+  priv->invalidations = swfdec_region_new ();
   priv->mouse_visible = TRUE;
   priv->mouse_cursor = SWFDEC_MOUSE_CURSOR_NORMAL;
   priv->stage_width = -1;
@@ -2517,7 +2588,6 @@ swfdec_player_invalidate (SwfdecPlayer *player, SwfdecMovie *movie, const Swfdec
   SwfdecPlayerPrivate *priv;
   SwfdecRectangle r;
   SwfdecRect tmp;
-  guint i;
 
   g_return_if_fail (SWFDEC_IS_PLAYER (player));
 
@@ -2544,22 +2614,10 @@ swfdec_player_invalidate (SwfdecPlayer *player, SwfdecMovie *movie, const Swfdec
   }
 
   SWFDEC_LOG ("  invalidating %d %d  %d %d", r.x, r.y, r.width, r.height);
-  /* FIXME: get region code into swfdec? */
-  for (i = 0; i < priv->invalidations->len; i++) {
-    SwfdecRectangle *cur = &g_array_index (priv->invalidations, SwfdecRectangle, i);
-    if (swfdec_rectangle_contains (cur, &r))
-      break;
-    if (swfdec_rectangle_contains (&r, cur)) {
-      *cur = r;
-      break;
-    }
-  }
-  if (i == priv->invalidations->len) {
-    g_array_append_val (priv->invalidations, r);
-  }
+  swfdec_region_add_rectangle (priv->invalidations, &r);
   SWFDEC_DEBUG ("toplevel invalidation of %d %d  %d %d - now %u subregions",
       r.x, r.y, r.width, r.height,
-      priv->invalidations->len);
+      swfdec_region_get_n_rectangles (priv->invalidations));
 }
 
 void
@@ -3559,6 +3617,53 @@ swfdec_player_set_maximum_runtime (SwfdecPlayer *player, gulong msecs)
   g_object_notify (G_OBJECT (player), "max-runtime");
 }
 
+/**
+ * swfdec_player_get_script_budget:
+ * @player: a #SwfdecPlayer
+ *
+ * Queries how long scripts may run during one call to swfdec_player_advance()
+ * before they are suspended. See swfdec_player_set_script_budget() for 
+ * details.
+ *
+ * Returns: the script budget in milliseconds or 0 if scripts are never 
+ *          suspended
+ **/
+gulong
+swfdec_player_get_script_budget (SwfdecPlayer *player)
+{
+  g_return_val_if_fail (SWFDEC_IS_PLAYER (player), 0);
+
+  return player->priv->script_budget;
+}
+
+/**
+ * swfdec_player_set_script_budget:
+ * @player: a #SwfdecPlayer
+ * @msecs: time in milliseconds scripts may run per advance or 0 to never
+ *         suspend scripts
+ *
+ * Sets a time budget for the scripts executed during an advance. Unlike 
+ * swfdec_player_set_maximum_runtime(), exceeding this budget does not abort
+ * the player. Instead, a frame script that runs out of time is suspended at
+ * its next backwards jump and continues on the next call to 
+ * swfdec_player_advance(). This keeps the frame rate steady when a Flash file
+ * runs long computations at the expense of compatibility: other scripts may 
+ * run while a suspended script has not finished yet, which never happens in
+ * the Adobe Flash player. Only scripts from the action queue that are not 
+ * inside a With or Try block can be suspended, so the budget is a hint and not
+ * a guarantee. The time a suspended script runs is summed up over all advances,
+ * and the script is aborted once that sum exceeds the maximum runtime. The 
+ * default value is 0.
+ **/
+void
+swfdec_player_set_script_budget (SwfdecPlayer *player, gulong msecs)
+{
+  g_return_if_fail (SWFDEC_IS_PLAYER (player));
+
+  player->priv->script_budget = msecs;
+  g_object_notify (G_OBJECT (player), "script-budget");
+}
+
 /**
  * swfdec_player_get_scripting:
  * @player: a #SwfdecPlayer
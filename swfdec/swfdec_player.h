@@ -132,6 +132,9 @@ gulong		swfdec_player_get_maximum_runtime
 void		swfdec_player_set_maximum_runtime 
 						(SwfdecPlayer *		player,
 						 gulong			msecs);
+gulong		swfdec_player_get_script_budget	(SwfdecPlayer *		player);
+void		swfdec_player_set_script_budget	(SwfdecPlayer *		player,
+						 gulong			msecs);
 const SwfdecURL *
 		swfdec_player_get_url		(SwfdecPlayer *		player);
 void		swfdec_player_set_url    	(SwfdecPlayer *		player,
@@ -172,6 +172,7 @@ swfdec_get_asnative (SwfdecAsContext *cx, guint x, guint y)
     if (native_funcs[i].x == x && native_funcs[i].y == y) {
       SwfdecAsFunction *fun = swfdec_as_native_function_new (cx, native_funcs[i].name,
 	  native_funcs[i].func);
+      swfdec_as_native_function_set_fast (fun, native_funcs[i].fast);
       return fun;
     }
   }
@@ -371,3 +372,35 @@ swfdec_player_preinit_global (SwfdecAsContext *context)
   swfdec_as_object_set_variable_and_flags (context->global, SWFDEC_AS_STR_enableDebugConsole,
       &val, SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
 }
+
+/* Sets the functions the init scripts use to define classes on @scope.
+ * Classes that are built on first use run their scripts with this scope, so
+ * they don't pick up functions the movie replaced in the meantime. */
+void
+swfdec_player_init_class_scope (SwfdecAsContext *context, SwfdecAsObject *scope)
+{
+  SwfdecAsFunction *f;
+  SwfdecAsValue val;
+
+  f = swfdec_as_native_function_new (context, SWFDEC_AS_STR_ASnative,
+      swfdec_player_ASnative);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (f)));
+  swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_ASnative, &val);
+
+  f = swfdec_as_native_function_new (context, SWFDEC_AS_STR_ASconstructor,
+      swfdec_player_ASconstructor);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (f)));
+  swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_ASconstructor, &val);
+
+  f = swfdec_get_asnative (context, 1, 0);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (f)));
+  swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_ASSetPropFlags, &val);
+
+  f = swfdec_get_asnative (context, 4, 0);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (f)));
+  swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_ASSetNative, &val);
+
+  f = swfdec_get_asnative (context, 4, 1);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (f)));
+  swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_ASSetNativeAccessor, &val);
+}
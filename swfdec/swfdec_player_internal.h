@@ -28,6 +28,7 @@
 #include <swfdec/swfdec_loader.h>
 #include <swfdec/swfdec_player_scripting.h>
 #include <swfdec/swfdec_rect.h>
+#include <swfdec/swfdec_region.h>
 #include <swfdec/swfdec_ringbuffer.h>
 #include <swfdec/swfdec_socket.h>
 #include <swfdec/swfdec_sound_matrix.h>
@@ -108,7 +109,7 @@ struct _SwfdecPlayerPrivate
   GSList *		xml_sockets;		/* all XMLSockets currently in use */
 
   /* rendering */
-  GArray *		invalidations;		/* fine-grained areas in need of redraw */
+  SwfdecRegion *	invalidations;		/* fine-grained areas in need of redraw */
   GSList *		invalid_pending;	/* pending invalidations due to invalidate_last */
   gboolean		fullscreen;		/* TRUE if the player has gone fullscreen */
 
@@ -147,6 +148,9 @@ struct _SwfdecPlayerPrivate
   SwfdecTimeout		iterate_timeout;      	/* callback for iterating */
   GTimer *		runtime;		/* for checking how long we've been running */
   gulong		max_runtime;		/* maximum number of seconds the player may run */
+  gulong		script_budget;		/* msecs scripts may run per advance before being suspended or 0 */
+  double		script_start;		/* msecs of runtime when the current resumable script started */
+  double		script_runtime;		/* msecs the current resumable script ran in earlier advances */
   SwfdecRingBuffer *	external_actions;     	/* external actions we've queued up, like resize or loader stuff */
   SwfdecTimeout		external_timeout;      	/* callback for iterating */
   /* iterating */
@@ -117,7 +117,7 @@ swfdec_rectangle_intersect (SwfdecRectangle *dest, const SwfdecRectangle *a,
   tmp.width = MIN (a->x + a->width, b->x + b->width) - tmp.x;
   tmp.height = MIN (a->y + a->height, b->y + b->height) - tmp.y;
 
-  if (tmp.width <= 0 && tmp.height <= 0) {
+  if (tmp.width <= 0 || tmp.height <= 0) {
     if (dest)
       dest->x = dest->y = dest->width = dest->height = 0;
     return FALSE;
@@ -0,0 +1,242 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec_region.h"
+#include "swfdec_debug.h"
+
+/* A region is a small set of non-overlapping rectangles. When adding a 
+ * rectangle, it is merged with existing rectangles if drawing the area the 
+ * merge adds is cheaper than drawing another rectangle. Other overlaps are
+ * cut away from the new rectangle. The number of rectangles is limited, so
+ * that regions stay cheap to use as a clip. */
+
+/* maximum number of rectangles in a region */
+#define SWFDEC_REGION_MAX_RECTANGLES 16
+/* number of pixels we'd rather draw than use another rectangle */
+#define SWFDEC_REGION_RECTANGLE_COST 4096
+
+#define RECT(region, i) (&g_array_index ((region)->rectangles, SwfdecRectangle, (i)))
+
+SwfdecRegion *
+swfdec_region_new (void)
+{
+  SwfdecRegion *region;
+
+  region = g_new (SwfdecRegion, 1);
+  region->rectangles = g_array_new (FALSE, FALSE, sizeof (SwfdecRectangle));
+
+  return region;
+}
+
+void
+swfdec_region_free (SwfdecRegion *region)
+{
+  g_return_if_fail (region != NULL);
+
+  g_array_free (region->rectangles, TRUE);
+  g_free (region);
+}
+
+void
+swfdec_region_clear (SwfdecRegion *region)
+{
+  g_return_if_fail (region != NULL);
+
+  g_array_set_size (region->rectangles, 0);
+}
+
+gboolean
+swfdec_region_is_empty (const SwfdecRegion *region)
+{
+  g_return_val_if_fail (region != NULL, TRUE);
+
+  return region->rectangles->len == 0;
+}
+
+guint
+swfdec_region_get_n_rectangles (const SwfdecRegion *region)
+{
+  g_return_val_if_fail (region != NULL, 0);
+
+  return region->rectangles->len;
+}
+
+/**
+ * swfdec_region_get_rectangles:
+ * @region: a region
+ *
+ * Gets the rectangles making up the @region. The rectangles do not overlap.
+ * Use swfdec_region_get_n_rectangles() to query their number. The returned
+ * array is only valid until the @region is modified.
+ *
+ * Returns: the rectangles of @region
+ **/
+const SwfdecRectangle *
+swfdec_region_get_rectangles (const SwfdecRegion *region)
+{
+  g_return_val_if_fail (region != NULL, NULL);
+
+  return (const SwfdecRectangle *) region->rectangles->data;
+}
+
+static gsize
+swfdec_rectangle_get_area (const SwfdecRectangle *rect)
+{
+  return (gsize) rect->width * rect->height;
+}
+
+/* the number of pixels that get drawn in vain when merging a and b */
+static gsize
+swfdec_region_get_merge_cost (const SwfdecRectangle *a, const SwfdecRectangle *b)
+{
+  SwfdecRectangle tmp;
+  gsize area;
+
+  swfdec_rectangle_union (&tmp, a, b);
+  area = swfdec_rectangle_get_area (&tmp);
+  if (swfdec_rectangle_intersect (&tmp, a, b))
+    area += swfdec_rectangle_get_area (&tmp);
+  return area - swfdec_rectangle_get_area (a) - swfdec_rectangle_get_area (b);
+}
+
+typedef enum {
+  SWFDEC_REGION_MERGE_CHEAP,	/* merge if the merge cost is low */
+  SWFDEC_REGION_MERGE_ALWAYS,	/* merge all overlapping rectangles */
+  SWFDEC_REGION_MERGE_NEVER	/* cut away overlapping parts */
+} SwfdecRegionMerge;
+
+/* NB: Merging never increases the number of rectangles, and the parts that 
+ * are cut away are never merged. Otherwise this function would not be 
+ * guaranteed to terminate. */
+static void
+swfdec_region_do_add (SwfdecRegion *region, const SwfdecRectangle *rect,
+    SwfdecRegionMerge merge)
+{
+  SwfdecRectangle r = *rect;
+  guint i = 0;
+
+  while (i < region->rectangles->len) {
+    SwfdecRectangle *cur = RECT (region, i);
+    gboolean overlap;
+
+    if (swfdec_rectangle_contains (cur, &r))
+      return;
+    if (swfdec_rectangle_contains (&r, cur)) {
+      g_array_remove_index_fast (region->rectangles, i);
+      continue;
+    }
+    overlap = swfdec_rectangle_intersect (NULL, cur, &r);
+    if ((merge == SWFDEC_REGION_MERGE_ALWAYS && overlap) ||
+	(merge == SWFDEC_REGION_MERGE_CHEAP && 
+	 swfdec_region_get_merge_cost (cur, &r) <= SWFDEC_REGION_RECTANGLE_COST)) {
+      swfdec_rectangle_union (&r, &r, cur);
+      g_array_remove_index_fast (region->rectangles, i);
+      /* the bigger rectangle might now overlap rectangles we already checked */
+      i = 0;
+      continue;
+    }
+    if (overlap) {
+      SwfdecRectangle c = *cur, part;
+      /* add the parts of r that are outside of cur */
+      if (c.y > r.y) {
+	part.x = r.x;
+	part.y = r.y;
+	part.width = r.width;
+	part.height = c.y - r.y;
+	swfdec_region_do_add (region, &part, SWFDEC_REGION_MERGE_NEVER);
+      }
+      if (c.y + c.height < r.y + r.height) {
+	part.x = r.x;
+	part.y = c.y + c.height;
+	part.width = r.width;
+	part.height = r.y + r.height - part.y;
+	swfdec_region_do_add (region, &part, SWFDEC_REGION_MERGE_NEVER);
+      }
+      part.y = MAX (r.y, c.y);
+      part.height = MIN (r.y + r.height, c.y + c.height) - part.y;
+      if (c.x > r.x) {
+	part.x = r.x;
+	part.width = c.x - r.x;
+	swfdec_region_do_add (region, &part, SWFDEC_REGION_MERGE_NEVER);
+      }
+      if (c.x + c.width < r.x + r.width) {
+	part.x = c.x + c.width;
+	part.width = r.x + r.width - part.x;
+	swfdec_region_do_add (region, &part, SWFDEC_REGION_MERGE_NEVER);
+      }
+      return;
+    }
+    i++;
+  }
+  g_array_append_val (region->rectangles, r);
+}
+
+/* merges the rectangles that are cheapest to merge until the region is small 
+ * enough */
+static void
+swfdec_region_reduce (SwfdecRegion *region)
+{
+  while (region->rectangles->len > SWFDEC_REGION_MAX_RECTANGLES) {
+    SwfdecRectangle merged;
+    guint i, j, best_i = 0, best_j = 1;
+    gsize cost, best_cost = G_MAXSIZE;
+
+    for (i = 0; i < region->rectangles->len; i++) {
+      for (j = i + 1; j < region->rectangles->len; j++) {
+	cost = swfdec_region_get_merge_cost (RECT (region, i), RECT (region, j));
+	if (cost < best_cost) {
+	  best_cost = cost;
+	  best_i = i;
+	  best_j = j;
+	}
+      }
+    }
+    swfdec_rectangle_union (&merged, RECT (region, best_i), RECT (region, best_j));
+    /* remove j first, it's the bigger index */
+    g_array_remove_index_fast (region->rectangles, best_j);
+    g_array_remove_index_fast (region->rectangles, best_i);
+    swfdec_region_do_add (region, &merged, SWFDEC_REGION_MERGE_ALWAYS);
+  }
+}
+
+/**
+ * swfdec_region_add_rectangle:
+ * @region: a region
+ * @rect: the rectangle to add
+ *
+ * Adds the area covered by @rect to @region. The resulting region will 
+ * contain at least the union of the old region and @rect, but it may be 
+ * bigger when merging rectangles is deemed cheaper.
+ **/
+void
+swfdec_region_add_rectangle (SwfdecRegion *region, const SwfdecRectangle *rect)
+{
+  g_return_if_fail (region != NULL);
+  g_return_if_fail (rect != NULL);
+
+  if (swfdec_rectangle_is_empty (rect))
+    return;
+
+  swfdec_region_do_add (region, rect, SWFDEC_REGION_MERGE_CHEAP);
+  swfdec_region_reduce (region);
+}
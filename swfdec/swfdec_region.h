@@ -0,0 +1,49 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef __SWFDEC_REGION_H__
+#define __SWFDEC_REGION_H__
+
+#include <swfdec/swfdec_rectangle.h>
+
+G_BEGIN_DECLS
+
+
+typedef struct _SwfdecRegion SwfdecRegion;
+
+struct _SwfdecRegion
+{
+  GArray *		rectangles;	/* non-overlapping SwfdecRectangles */
+};
+
+SwfdecRegion *		swfdec_region_new		(void);
+void			swfdec_region_free		(SwfdecRegion *		region);
+
+void			swfdec_region_clear		(SwfdecRegion *		region);
+gboolean		swfdec_region_is_empty		(const SwfdecRegion *	region);
+void			swfdec_region_add_rectangle	(SwfdecRegion *		region,
+							 const SwfdecRectangle *rect);
+
+guint			swfdec_region_get_n_rectangles	(const SwfdecRegion *	region);
+const SwfdecRectangle *	swfdec_region_get_rectangles	(const SwfdecRegion *	region);
+
+
+G_END_DECLS
+
+#endif
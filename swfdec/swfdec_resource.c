@@ -544,7 +544,7 @@ swfdec_resource_create_movie (SwfdecResource *resource, SwfdecResourceLoad *load
     else
       movie = NULL;
   } else if (SWFDEC_AS_VALUE_IS_STRING (load->target)) {
-    int level = swfdec_player_get_level (player, SWFDEC_AS_VALUE_GET_STRING (load->target), 7);
+    int level = swfdec_player_get_level (player, SWFDEC_AS_VALUE_GET_FLAT_STRING (load->target), 7);
     if (level >= 0) {
       movie = swfdec_player_get_movie_at_level (player, level);
       if (movie)
@@ -650,8 +650,8 @@ swfdec_resource_load_request (gpointer loadp, gpointer playerp)
 
   /* LAUNCH command (aka getURL) */
   if (SWFDEC_AS_VALUE_IS_STRING (load->target) && swfdec_player_get_level (player, 
-	SWFDEC_AS_VALUE_GET_STRING (load->target), 7) < 0) {
-    swfdec_player_launch (player, load->url, SWFDEC_AS_VALUE_GET_STRING (load->target), load->buffer);
+	SWFDEC_AS_VALUE_GET_FLAT_STRING (load->target), 7) < 0) {
+    swfdec_player_launch (player, load->url, SWFDEC_AS_VALUE_GET_FLAT_STRING (load->target), load->buffer);
     swfdec_player_unroot (player, load);
     return;
   }
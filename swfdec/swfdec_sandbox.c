@@ -22,11 +22,15 @@
 #endif
 
 #include "swfdec_sandbox.h"
+#include "swfdec_as_cloner.h"
 #include "swfdec_as_internal.h"
+#include "swfdec_as_native_function.h"
+#include "swfdec_as_strings.h"
 #include "swfdec_debug.h"
 #include "swfdec_initialize.h"
 #include "swfdec_internal.h"
 #include "swfdec_player_internal.h"
+#include "swfdec_script_internal.h"
 
 /*** GTK-DOC ***/
 
@@ -56,12 +60,26 @@ swfdec_sandbox_dispose (GObject *object)
   G_OBJECT_CLASS (swfdec_sandbox_parent_class)->dispose (object);
 }
 
+static void
+swfdec_sandbox_mark (SwfdecGcObject *object)
+{
+  SwfdecSandbox *sandbox = SWFDEC_SANDBOX (object);
+
+  if (sandbox->snapshot)
+    swfdec_as_object_mark (sandbox->snapshot);
+
+  SWFDEC_GC_OBJECT_CLASS (swfdec_sandbox_parent_class)->mark (object);
+}
+
 static void
 swfdec_sandbox_class_init (SwfdecSandboxClass *klass)
 {
   GObjectClass *object_class = G_OBJECT_CLASS (klass);
+  SwfdecGcObjectClass *gc_class = SWFDEC_GC_OBJECT_CLASS (klass);
 
   object_class->dispose = swfdec_sandbox_dispose;
+
+  gc_class->mark = swfdec_sandbox_mark;
 }
 
 static void
@@ -70,13 +88,207 @@ swfdec_sandbox_init (SwfdecSandbox *sandbox)
   sandbox->type = SWFDEC_SANDBOX_NONE;
 }
 
+/* Running the initialization scripts takes a long time. Most players only 
+ * ever create one sandbox per Flash version, so nothing special is done for 
+ * it. Once a second sandbox is created for the same version, its global 
+ * object is copied right after the scripts ran, before any other script can
+ * modify it. Later sandboxes for that version copy the snapshot instead of
+ * running the scripts again. Snapshots cannot be shared between players, 
+ * because objects belong to their context. */
+static gboolean
+swfdec_sandbox_has_version (SwfdecPlayer *player, SwfdecSandbox *sandbox,
+    guint version)
+{
+  GSList *walk;
+
+  for (walk = player->priv->sandboxes; walk; walk = walk->next) {
+    SwfdecSandbox *cur = walk->data;
+    if (cur != sandbox && cur->flash_version == version)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+static SwfdecSandbox *
+swfdec_sandbox_find_snapshot (SwfdecPlayer *player, guint version)
+{
+  GSList *walk;
+
+  for (walk = player->priv->sandboxes; walk; walk = walk->next) {
+    SwfdecSandbox *sandbox = walk->data;
+    if (sandbox->snapshot && sandbox->flash_version == version)
+      return sandbox;
+  }
+  return NULL;
+}
+
+static void
+swfdec_sandbox_take_snapshot (SwfdecSandbox *sandbox)
+{
+  SwfdecAsContext *context = swfdec_gc_object_get_context (sandbox);
+  SwfdecAsCloner *cloner;
+  SwfdecAsObject *snapshot;
+
+  snapshot = swfdec_as_object_new_empty (context);
+  cloner = swfdec_as_cloner_new (context);
+  /* functions in the snapshot still belong to this sandbox */
+  swfdec_as_cloner_add_relay (cloner, SWFDEC_AS_RELAY (sandbox), 
+      SWFDEC_AS_RELAY (sandbox));
+  if (swfdec_as_cloner_copy (cloner, 
+	swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (sandbox)), snapshot)) {
+    sandbox->snapshot = snapshot;
+  } else {
+    SWFDEC_INFO ("global object for version %u cannot be copied", 
+	sandbox->flash_version);
+  }
+  swfdec_as_cloner_free (cloner);
+}
+
+static gboolean
+swfdec_sandbox_restore_snapshot (SwfdecSandbox *sandbox, SwfdecSandbox *from)
+{
+  SwfdecAsContext *context = swfdec_gc_object_get_context (sandbox);
+  SwfdecAsCloner *cloner;
+  gboolean ret;
+
+  cloner = swfdec_as_cloner_new (context);
+  swfdec_as_cloner_add_relay (cloner, SWFDEC_AS_RELAY (from), 
+      SWFDEC_AS_RELAY (sandbox));
+  ret = swfdec_as_cloner_copy (cloner, from->snapshot,
+      swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (sandbox)));
+  swfdec_as_cloner_free (cloner);
+
+  return ret;
+}
+
+/* Classes that most movies never use are not defined by the initialization 
+ * script. They have scripts of their own that are run the first time the 
+ * class is looked up. */
+typedef struct {
+  const char *		name;		/* name of the variable holding the class */
+  gboolean		flash;		/* variable is in the flash object, not the global one */
+  const unsigned char *	script;		/* script defining the class */
+  gsize			length;		/* length of script */
+} SwfdecLazyClass;
+
+static const SwfdecLazyClass lazy_classes[] = {
+  { SWFDEC_AS_STR_XMLNode, FALSE, swfdec_initialize_xml_node, sizeof (swfdec_initialize_xml_node) },
+  { SWFDEC_AS_STR_XML, FALSE, swfdec_initialize_xml, sizeof (swfdec_initialize_xml) },
+  { SWFDEC_AS_STR_TextFormat, FALSE, swfdec_initialize_text_format, sizeof (swfdec_initialize_text_format) },
+  { SWFDEC_AS_STR_LocalConnection, FALSE, swfdec_initialize_local_connection, sizeof (swfdec_initialize_local_connection) },
+  { SWFDEC_AS_STR_display, TRUE, swfdec_initialize_bitmap_data, sizeof (swfdec_initialize_bitmap_data) },
+  { SWFDEC_AS_STR_filters, TRUE, swfdec_initialize_filters, sizeof (swfdec_initialize_filters) }
+};
+
+/* The script is run in a scope object of its own, so variables it sets don't 
+ * end up in the global object. The class is read back from that scope or
+ * from the flash object inside it. */
+static void
+swfdec_sandbox_build_class (SwfdecAsContext *cx, SwfdecAsObject *object,
+    guint argc, SwfdecAsValue *argv, SwfdecAsValue *rval)
+{
+  const SwfdecLazyClass *lazy;
+  SwfdecSandbox *sandbox, *old;
+  SwfdecAsObject *scope, *owner;
+  SwfdecScript *script;
+  SwfdecBits bits;
+  SwfdecAsValue val;
+  guint i;
+
+  if (object == NULL || argc < 1 || !SWFDEC_AS_VALUE_IS_INT (argv[0]))
+    return;
+  i = SWFDEC_AS_VALUE_GET_INT (argv[0]);
+  if (i >= G_N_ELEMENTS (lazy_classes))
+    return;
+  lazy = &lazy_classes[i];
+
+  /* build global classes in the sandbox they belong to */
+  old = cx->global ? SWFDEC_SANDBOX (cx->global->relay) : NULL;
+  if (SWFDEC_IS_SANDBOX (object->relay))
+    sandbox = SWFDEC_SANDBOX (object->relay);
+  else
+    sandbox = old;
+  if (sandbox == NULL) {
+    SWFDEC_ERROR ("no sandbox to build %s in", lazy->name);
+    return;
+  }
+  if (sandbox != old) {
+    if (old)
+      swfdec_sandbox_unuse (old);
+    swfdec_sandbox_use (sandbox);
+  }
+
+  swfdec_bits_init_data (&bits, lazy->script, lazy->length);
+  script = swfdec_script_new_from_bits (&bits, lazy->name, sandbox->flash_version);
+  if (script) {
+    scope = swfdec_as_object_new_empty (cx);
+    swfdec_player_init_class_scope (cx, scope);
+    if (lazy->flash) {
+      owner = swfdec_as_object_new_empty (cx);
+      SWFDEC_AS_VALUE_SET_OBJECT (&val, owner);
+      swfdec_as_object_set_variable (scope, SWFDEC_AS_STR_flash, &val);
+    } else {
+      owner = scope;
+    }
+    swfdec_as_object_run (scope, script);
+    swfdec_script_unref (script);
+    swfdec_as_object_get_variable (owner, lazy->name, rval);
+  } else {
+    SWFDEC_ERROR ("script defining %s is invalid", lazy->name);
+  }
+
+  if (sandbox != old) {
+    swfdec_sandbox_unuse (sandbox);
+    if (old)
+      swfdec_sandbox_use (old);
+  }
+}
+
+static void
+swfdec_sandbox_init_lazy_classes (SwfdecSandbox *sandbox)
+{
+  SwfdecAsContext *context = swfdec_gc_object_get_context (sandbox);
+  SwfdecAsObject *global, *flash;
+  SwfdecAsFunction *build;
+  SwfdecAsValue val;
+  guint i;
+
+  global = swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (sandbox));
+  flash = NULL;
+  if (swfdec_as_object_get_variable (global, SWFDEC_AS_STR_flash, &val) &&
+      SWFDEC_AS_VALUE_IS_OBJECT (val))
+    flash = SWFDEC_AS_VALUE_GET_OBJECT (val);
+  build = swfdec_as_native_function_new (context, "build_class",
+      swfdec_sandbox_build_class);
+
+  for (i = 0; i < G_N_ELEMENTS (lazy_classes); i++) {
+    val = swfdec_as_value_from_integer (context, i);
+    if (!lazy_classes[i].flash) {
+      swfdec_as_object_add_lazy_variable_function (global, lazy_classes[i].name,
+	  build, &val, SWFDEC_AS_VARIABLE_HIDDEN);
+    } else if (flash) {
+      swfdec_as_object_add_lazy_variable_function (flash, lazy_classes[i].name,
+	  build, &val, 0);
+    }
+  }
+}
+
 static void
 swfdec_sandbox_initialize (SwfdecSandbox *sandbox, guint version)
 {
   SwfdecAsContext *context = swfdec_gc_object_get_context (sandbox);
   SwfdecPlayer *player = SWFDEC_PLAYER (context);
+  SwfdecSandbox *from;
 
+  sandbox->flash_version = version;
   swfdec_sandbox_use (sandbox);
+  from = swfdec_sandbox_find_snapshot (player, version);
+  if (from && swfdec_sandbox_restore_snapshot (sandbox, from)) {
+    SWFDEC_LOG ("initialized sandbox from snapshot for version %u", version);
+    swfdec_sandbox_unuse (sandbox);
+    return;
+  }
+
   if (context->state == SWFDEC_AS_CONTEXT_RUNNING)
     context->state = SWFDEC_AS_CONTEXT_NEW;
   swfdec_as_context_startup (context);
@@ -87,9 +299,14 @@ swfdec_sandbox_initialize (SwfdecSandbox *sandbox, guint version)
 
   swfdec_as_context_run_init_script (context, swfdec_initialize, 
       sizeof (swfdec_initialize), version);
+  if (version > 4)
+    swfdec_sandbox_init_lazy_classes (sandbox);
 
-  if (context->state == SWFDEC_AS_CONTEXT_NEW)
+  if (context->state == SWFDEC_AS_CONTEXT_NEW) {
     context->state = SWFDEC_AS_CONTEXT_RUNNING;
+    if (from == NULL && swfdec_sandbox_has_version (player, sandbox, version))
+      swfdec_sandbox_take_snapshot (sandbox);
+  }
   swfdec_sandbox_unuse (sandbox);
 }
 
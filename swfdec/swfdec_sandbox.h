@@ -52,6 +52,8 @@ struct _SwfdecSandbox
   SwfdecSandboxType	type;			/* type of this sandbox */
   SwfdecURL *		url;			/* URL this sandbox acts for */
   guint			as_version;		/* Actionscript version */
+  guint			flash_version;		/* version the initialization scripts were run with */
+  SwfdecAsObject *	snapshot;		/* copy of the global object after initialization or NULL */
 };
 
 struct _SwfdecSandboxClass
@@ -21,9 +21,11 @@
 #include "config.h"
 #endif
 
+#include <string.h>
 #include "swfdec_script.h"
 #include "swfdec_script_internal.h"
 #include "swfdec_as_context.h"
+#include "swfdec_as_internal.h"
 #include "swfdec_as_interpret.h"
 #include "swfdec_debug.h"
 
@@ -202,6 +204,11 @@ swfdec_script_unref (SwfdecScript *script)
     g_free (script->arguments[i].name);
   }
   g_free (script->arguments);
+  for (i = 0; i < script->n_instructions; i++) {
+    if (script->instructions[i].cache)
+      swfdec_as_property_cache_free (script->instructions[i].cache);
+  }
+  g_free (script->instructions);
   g_free (script);
 }
 
@@ -222,6 +229,341 @@ swfdec_script_get_version (SwfdecScript *script)
   return script->version;
 }
 
+/*** VERIFICATION ***/
+
+/* scripts needing a bigger stack than this are not verified */
+#define SWFDEC_SCRIPT_MAX_STACK 1024
+
+typedef struct {
+  int			lo;			/* minimum stack depth or -1 if not reached yet */
+  int			hi;			/* maximum stack depth */
+  gboolean		queued;			/* TRUE if the instruction needs to be looked at */
+} SwfdecScriptDepth;
+
+/* counts the values pushed by a Push action, returns -1 if unknown */
+static int
+swfdec_script_count_push (const guint8 *data, guint len)
+{
+  static const guint sizes[10] = { 0, 4, 0, 0, 1, 1, 8, 4, 1, 2 };
+  const guint8 *end = data + len;
+  const guint8 *s;
+  int count = 0;
+
+  while (data < end) {
+    guint type = *data++;
+    if (type == 0) {
+      s = memchr (data, 0, end - data);
+      if (s == NULL)
+	return -1;
+      data = s + 1;
+    } else if (type < G_N_ELEMENTS (sizes)) {
+      data += MIN (sizes[type], (guint) (end - data));
+    } else {
+      /* the interpreter skips unknown types without pushing anything and 
+       * continues with the next byte as a new type */
+      return -1;
+    }
+    count++;
+  }
+  return count;
+}
+
+/* computes how the stack depth changes when executing insn, returns FALSE if
+ * that can't be determined */
+static gboolean
+swfdec_script_verify_effect (const SwfdecScriptInstruction *insn, 
+    int *remove, int *add_lo, int *add_hi)
+{
+  if (insn->op == SWFDEC_SCRIPT_OP_SKIP) {
+    *remove = *add_lo = *add_hi = 0;
+    return TRUE;
+  }
+  *remove = insn->spec->remove;
+  switch (insn->action) {
+    case SWFDEC_AS_ACTION_PUSH:
+      *add_lo = *add_hi = swfdec_script_count_push (insn->data, insn->len);
+      return *add_lo >= 0;
+    case SWFDEC_AS_ACTION_DEFINE_FUNCTION:
+    case SWFDEC_AS_ACTION_DEFINE_FUNCTION2:
+      /* anonymous functions are pushed, unless defining them fails */
+      *add_lo = 0;
+      *add_hi = (insn->len > 0 && insn->data[0] == 0) ? 1 : 0;
+      return TRUE;
+    case SWFDEC_AS_ACTION_JUMP:
+    case SWFDEC_AS_ACTION_IF:
+      /* jumps that weren't decoded */
+      if (insn->op == SWFDEC_SCRIPT_OP_EXEC)
+	return FALSE;
+      break;
+    /* these modify the pc in ways the verifier doesn't track */
+    case SWFDEC_AS_ACTION_WAIT_FOR_FRAME:
+    case SWFDEC_AS_ACTION_WAIT_FOR_FRAME2:
+    case SWFDEC_AS_ACTION_TRY:
+      return FALSE;
+    default:
+      break;
+  }
+  *add_lo = *add_hi = insn->spec->add;
+  return *add_lo >= 0;
+}
+
+static gboolean
+swfdec_script_verify_merge (SwfdecScriptDepth *depth, int lo, int hi, 
+    guint *todo, guint *n_todo, guint id)
+{
+  if (hi > SWFDEC_SCRIPT_MAX_STACK)
+    return FALSE;
+  if (depth[id].lo < 0) {
+    depth[id].lo = lo;
+    depth[id].hi = hi;
+  } else if (lo < depth[id].lo || hi > depth[id].hi) {
+    depth[id].lo = MIN (lo, depth[id].lo);
+    depth[id].hi = MAX (hi, depth[id].hi);
+  } else {
+    return TRUE;
+  }
+  if (!depth[id].queued) {
+    depth[id].queued = TRUE;
+    todo[(*n_todo)++] = id;
+  }
+  return TRUE;
+}
+
+/* Verifies the pre-decoded instructions ahead of time: All reachable 
+ * instructions must be decodable, all their jump targets must be known and 
+ * the stack depth must be bounded. The interpreter can skip the checks for 
+ * stack underflow and overflow on instructions marked %SWFDEC_SCRIPT_OP_LEAN
+ * when it ensured the script has max_stack free values before starting it. */
+static void
+swfdec_script_verify (SwfdecScript *script)
+{
+  SwfdecScriptInstruction *insns = script->instructions;
+  SwfdecScriptDepth *depth;
+  guint *todo, n_todo, i, id, max_stack;
+  int remove, add_lo, add_hi, lo, hi;
+  gboolean ret = TRUE;
+
+  if (insns[script->n_instructions - 1].op != SWFDEC_SCRIPT_OP_EXIT)
+    return;
+
+  /* propagate the possible stack depths through the script until nothing
+   * changes anymore. This terminates because depths only ever widen and are
+   * bounded by SWFDEC_SCRIPT_MAX_STACK. */
+  depth = g_new0 (SwfdecScriptDepth, script->n_instructions);
+  for (i = 0; i < script->n_instructions; i++)
+    depth[i].lo = -1;
+  todo = g_new (guint, script->n_instructions);
+  n_todo = 0;
+  max_stack = 0;
+  swfdec_script_verify_merge (depth, 0, 0, todo, &n_todo, 0);
+  while (ret && n_todo > 0) {
+    id = todo[--n_todo];
+    depth[id].queued = FALSE;
+    if (insns[id].op == SWFDEC_SCRIPT_OP_EXIT)
+      continue;
+    if (!swfdec_script_verify_effect (&insns[id], &remove, &add_lo, &add_hi)) {
+      ret = FALSE;
+      break;
+    }
+    if (remove >= 0) {
+      lo = MAX (depth[id].lo - remove, 0) + add_lo;
+      hi = MAX (depth[id].hi, remove) - remove + add_hi;
+    } else {
+      lo = add_lo;
+      hi = depth[id].hi + add_hi;
+    }
+    max_stack = MAX (max_stack, (guint) hi);
+    switch (insns[id].action) {
+      case SWFDEC_AS_ACTION_RETURN:
+      case SWFDEC_AS_ACTION_THROW:
+	break;
+      case SWFDEC_AS_ACTION_WITH:
+	script->blocks = TRUE;
+	/* fall through */
+      case SWFDEC_AS_ACTION_JUMP:
+      case SWFDEC_AS_ACTION_IF:
+      case SWFDEC_AS_ACTION_DEFINE_FUNCTION:
+      case SWFDEC_AS_ACTION_DEFINE_FUNCTION2:
+	if (insns[id].target == NULL) {
+	  ret = FALSE;
+	  break;
+	}
+	ret = swfdec_script_verify_merge (depth, lo, hi, todo, &n_todo, 
+	    insns[id].target - insns);
+	if (insns[id].action == SWFDEC_AS_ACTION_JUMP)
+	  break;
+	/* fall through */
+      default:
+	ret = ret && swfdec_script_verify_merge (depth, lo, hi, todo, &n_todo, id + 1);
+	break;
+    }
+  }
+
+  if (ret) {
+    for (i = 0; i < script->n_instructions; i++) {
+      if (depth[i].lo < 0 || insns[i].op != SWFDEC_SCRIPT_OP_EXEC)
+	continue;
+      swfdec_script_verify_effect (&insns[i], &remove, &add_lo, &add_hi);
+      if (remove >= 0 && depth[i].lo >= remove)
+	insns[i].op = SWFDEC_SCRIPT_OP_LEAN;
+    }
+    script->max_stack = max_stack;
+    script->verified = TRUE;
+    SWFDEC_LOG ("verified script %s, maximum stack depth is %u", script->name,
+	script->max_stack);
+  } else {
+    script->blocks = FALSE;
+    SWFDEC_LOG ("could not verify script %s", script->name);
+  }
+  g_free (todo);
+  g_free (depth);
+}
+
+/*** PRE-DECODED INSTRUCTIONS ***/
+
+static void
+swfdec_script_decode (SwfdecScript *script)
+{
+  GArray *array;
+  SwfdecScriptInstruction insn;
+  const guint8 *pc, *endpc, *nextpc;
+  guint i;
+  int offset;
+
+  array = g_array_new (FALSE, TRUE, sizeof (SwfdecScriptInstruction));
+  endpc = script->buffer->data + script->buffer->length;
+  pc = script->main;
+  /* decode exactly like swfdec_as_context_run() would */
+  while (pc < script->exit) {
+    memset (&insn, 0, sizeof (SwfdecScriptInstruction));
+    insn.pc = pc;
+    insn.action = *pc;
+    insn.spec = swfdec_as_actions + insn.action;
+    if (insn.action & 0x80) {
+      if (pc + 2 >= endpc)
+	break;
+      insn.data = pc + 3;
+      insn.len = pc[1] | pc[2] << 8;
+      if (insn.data + insn.len > endpc)
+	break;
+      nextpc = pc + 3 + insn.len;
+    } else {
+      nextpc = pc + 1;
+    }
+    if (insn.spec->exec == NULL) {
+      insn.op = SWFDEC_SCRIPT_OP_SKIP;
+    } else {
+      if (script->version < insn.spec->version) {
+	SWFDEC_WARNING ("cannot interpret action %3u 0x%02X %s for version %u, using version %u instead",
+	    insn.action, insn.action, insn.spec->name ? insn.spec->name : "Unknown", 
+	    script->version, insn.spec->version);
+      }
+      insn.op = SWFDEC_SCRIPT_OP_EXEC;
+      switch (insn.action) {
+	case SWFDEC_AS_ACTION_JUMP:
+	case SWFDEC_AS_ACTION_IF:
+	  if (insn.len != 2)
+	    break;
+	  offset = (gint16) (insn.data[0] | (insn.data[1] << 8));
+	  /* a jump to itself looks like no jump at all to the interpreter */
+	  if (offset == -5)
+	    break;
+	  insn.target_pc = pc + 5 + offset;
+	  insn.op = insn.action == SWFDEC_AS_ACTION_JUMP ? 
+	    SWFDEC_SCRIPT_OP_JUMP : SWFDEC_SCRIPT_OP_IF;
+	  break;
+	case SWFDEC_AS_ACTION_DEFINE_FUNCTION:
+	case SWFDEC_AS_ACTION_DEFINE_FUNCTION2:
+	  /* the function body follows the action, its size is the last field */
+	  if (insn.len >= 2)
+	    insn.target_pc = nextpc + (insn.data[insn.len - 2] | (insn.data[insn.len - 1] << 8));
+	  break;
+	case SWFDEC_AS_ACTION_WITH:
+	  if (insn.len == 2)
+	    insn.target_pc = nextpc + (insn.data[0] | (insn.data[1] << 8));
+	  break;
+	default:
+	  break;
+      }
+    }
+    g_array_append_val (array, insn);
+    pc = nextpc;
+  }
+  /* the final instruction is the exit point or the point where decoding failed */
+  memset (&insn, 0, sizeof (SwfdecScriptInstruction));
+  insn.pc = pc;
+  insn.op = pc == script->exit ? SWFDEC_SCRIPT_OP_EXIT : SWFDEC_SCRIPT_OP_INVALID;
+  g_array_append_val (array, insn);
+
+  script->n_instructions = array->len;
+  script->instructions = (SwfdecScriptInstruction *) (void *) g_array_free (array, FALSE);
+  /* resolve jump targets */
+  for (i = 0; i < script->n_instructions; i++) {
+    if (script->instructions[i].target_pc) {
+      script->instructions[i].target = swfdec_script_lookup_instruction (script,
+	  script->instructions[i].target_pc);
+    }
+  }
+  swfdec_script_verify (script);
+}
+
+/**
+ * swfdec_script_get_instructions:
+ * @script: a script
+ *
+ * Gets the pre-decoded instructions of @script for use by the threaded 
+ * interpreter. The script is decoded the first time this function is called.
+ * The last instruction is always of type %SWFDEC_SCRIPT_OP_EXIT or 
+ * %SWFDEC_SCRIPT_OP_INVALID.
+ *
+ * Returns: the first instruction of @script
+ **/
+SwfdecScriptInstruction *
+swfdec_script_get_instructions (SwfdecScript *script)
+{
+  g_return_val_if_fail (script != NULL, NULL);
+
+  if (script->instructions == NULL)
+    swfdec_script_decode (script);
+
+  return script->instructions;
+}
+
+/**
+ * swfdec_script_lookup_instruction:
+ * @script: a script
+ * @pc: program counter to look up
+ *
+ * Finds the pre-decoded instruction starting at @pc.
+ *
+ * Returns: the instruction at @pc or %NULL if no instruction starts there.
+ **/
+SwfdecScriptInstruction *
+swfdec_script_lookup_instruction (SwfdecScript *script, const guint8 *pc)
+{
+  SwfdecScriptInstruction *insns;
+  guint min, max, mid;
+
+  g_return_val_if_fail (script != NULL, NULL);
+
+  insns = swfdec_script_get_instructions (script);
+  if (pc < script->main || pc > insns[script->n_instructions - 1].pc)
+    return NULL;
+
+  min = 0;
+  max = script->n_instructions;
+  while (min < max) {
+    mid = (min + max) / 2;
+    if (insns[mid].pc < pc)
+      min = mid + 1;
+    else
+      max = mid;
+  }
+  if (min < script->n_instructions && insns[min].pc == pc)
+    return &insns[min];
+  return NULL;
+}
+
 /*** UTILITY FUNCTIONS ***/
 
 const char *
@@ -25,10 +25,12 @@
 #include <swfdec/swfdec_types.h>
 #include <swfdec/swfdec_bits.h>
 #include <swfdec/swfdec_constant_pool.h>
+#include <swfdec/swfdec_as_interpret.h>
 
 G_BEGIN_DECLS
 
 typedef struct _SwfdecScriptArgument SwfdecScriptArgument;
+typedef struct _SwfdecScriptInstruction SwfdecScriptInstruction;
 
 typedef enum {
   SWFDEC_SCRIPT_PRELOAD_THIS = (1 << 0),
@@ -42,6 +44,17 @@ typedef enum {
   SWFDEC_SCRIPT_PRELOAD_GLOBAL = (1 << 8)
 } SwfdecScriptFlag;
 
+/* how the threaded interpreter executes an instruction */
+typedef enum {
+  SWFDEC_SCRIPT_OP_EXEC,		/* call the action's exec function */
+  SWFDEC_SCRIPT_OP_LEAN,		/* like EXEC, but the stack was verified to be big enough */
+  SWFDEC_SCRIPT_OP_SKIP,		/* unknown action, skip it */
+  SWFDEC_SCRIPT_OP_JUMP,		/* Jump to target */
+  SWFDEC_SCRIPT_OP_IF,			/* If to target */
+  SWFDEC_SCRIPT_OP_EXIT,		/* exit point of the script */
+  SWFDEC_SCRIPT_OP_INVALID		/* can't be decoded, use the slow path */
+} SwfdecScriptOp;
+
 typedef gboolean (* SwfdecScriptForeachFunc) (gconstpointer bytecode, guint action, 
     const guint8 *data, guint len, gpointer user_data);
 
@@ -58,6 +71,23 @@ struct _SwfdecScript {
   guint			flags;			/* SwfdecScriptFlags */
   guint			n_arguments;  		/* number of arguments */
   SwfdecScriptArgument *arguments;		/* arguments or NULL if none */
+  SwfdecScriptInstruction *instructions;	/* pre-decoded script or NULL if not decoded yet */
+  guint			n_instructions;		/* number of instructions including the final one */
+  gboolean		verified;		/* TRUE if the instructions passed verification */
+  guint			max_stack;		/* maximum stack depth of a verified script */
+  gboolean		blocks;			/* TRUE if a verified script can enter blocks */
+};
+
+struct _SwfdecScriptInstruction {
+  SwfdecScriptOp	op;			/* how to execute this instruction */
+  guint			action;			/* the action */
+  const SwfdecActionSpec *spec;			/* spec for action */
+  const guint8 *	pc;			/* location of action in the script buffer */
+  const guint8 *	data;			/* data for action or NULL if none */
+  guint			len;			/* length of data */
+  const guint8 *	target_pc;		/* known jump target or NULL */
+  SwfdecScriptInstruction *target;		/* instruction at target_pc or NULL */
+  gpointer		cache;			/* SwfdecAsPropertyCache used by action or NULL */
 };
 
 struct _SwfdecScriptArgument {
@@ -75,6 +105,11 @@ SwfdecScript *	swfdec_script_new_from_bits   		(SwfdecBits *			bits,
 gboolean	swfdec_script_foreach			(SwfdecScript *			script,
 							 SwfdecScriptForeachFunc	func,
 							 gpointer			user_data);
+SwfdecScriptInstruction *
+		swfdec_script_get_instructions		(SwfdecScript *			script);
+SwfdecScriptInstruction *
+		swfdec_script_lookup_instruction	(SwfdecScript *			script,
+							 const guint8 *			pc);
 
 G_END_DECLS
 
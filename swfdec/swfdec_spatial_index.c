@@ -0,0 +1,255 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+
+#include "swfdec_spatial_index.h"
+#include "swfdec_debug.h"
+
+/* The index is a hash of grid cells. Every item is put into all cells its
+ * rectangle touches. Items that would touch too many cells are kept in a 
+ * separate list that is checked on every query. */
+
+/* maximum number of cells an item may touch before it's considered big */
+#define SWFDEC_SPATIAL_INDEX_MAX_CELLS 64
+
+typedef struct {
+  gpointer		item;		/* the item that was inserted */
+  SwfdecRect		rect;		/* its area */
+  gboolean		everywhere;	/* the item was inserted without a rectangle */
+  gboolean		big;		/* TRUE if in the big list, not in cells */
+  int			x0, y0, x1, y1;	/* range of cells the item is in (inclusive) */
+} SwfdecSpatialEntry;
+
+struct _SwfdecSpatialIndex {
+  double		cell_size;	/* width and height of a cell */
+  GHashTable *		items;		/* item => SwfdecSpatialEntry */
+  GHashTable *		cells;		/* cell key => GSList of SwfdecSpatialEntry */
+  GSList *		big;		/* entries that aren't in cells */
+};
+
+/* NB: different cells may share the same key, queries check the rectangle
+ * anyway. The cells of a single entry never share a key. */
+#define CELL_KEY(x, y) GUINT_TO_POINTER (((guint) (x) & 0xFFFF) | ((guint) (y) << 16))
+
+static void
+swfdec_spatial_entry_free (gpointer entry)
+{
+  g_slice_free (SwfdecSpatialEntry, entry);
+}
+
+/**
+ * swfdec_spatial_index_new:
+ * @cell_size: size of the grid cells. Items should usually be smaller than
+ *             this.
+ *
+ * Creates a new index that can be queried for all items at a given point.
+ *
+ * Returns: a new index
+ **/
+SwfdecSpatialIndex *
+swfdec_spatial_index_new (double cell_size)
+{
+  SwfdecSpatialIndex *index;
+
+  g_return_val_if_fail (cell_size > 0, NULL);
+
+  index = g_slice_new (SwfdecSpatialIndex);
+  index->cell_size = cell_size;
+  index->items = g_hash_table_new_full (g_direct_hash, g_direct_equal, 
+      NULL, swfdec_spatial_entry_free);
+  index->cells = g_hash_table_new_full (g_direct_hash, g_direct_equal, 
+      NULL, (GDestroyNotify) g_slist_free);
+  index->big = NULL;
+
+  return index;
+}
+
+void
+swfdec_spatial_index_free (SwfdecSpatialIndex *index)
+{
+  g_return_if_fail (index != NULL);
+
+  g_hash_table_destroy (index->cells);
+  g_hash_table_destroy (index->items);
+  g_slist_free (index->big);
+  g_slice_free (SwfdecSpatialIndex, index);
+}
+
+static void
+swfdec_spatial_index_unlink (SwfdecSpatialIndex *index, SwfdecSpatialEntry *entry)
+{
+  GSList *list;
+  gpointer key;
+  int x, y;
+
+  if (entry->big) {
+    index->big = g_slist_remove (index->big, entry);
+    return;
+  }
+  for (y = entry->y0; y <= entry->y1; y++) {
+    for (x = entry->x0; x <= entry->x1; x++) {
+      key = CELL_KEY (x, y);
+      list = g_hash_table_lookup (index->cells, key);
+      list = g_slist_remove (list, entry);
+      g_hash_table_steal (index->cells, key);
+      if (list)
+	g_hash_table_insert (index->cells, key, list);
+    }
+  }
+}
+
+static void
+swfdec_spatial_index_link (SwfdecSpatialIndex *index, SwfdecSpatialEntry *entry)
+{
+  GSList *list;
+  gpointer key;
+  int x, y;
+
+  if (entry->big) {
+    index->big = g_slist_prepend (index->big, entry);
+    return;
+  }
+  for (y = entry->y0; y <= entry->y1; y++) {
+    for (x = entry->x0; x <= entry->x1; x++) {
+      key = CELL_KEY (x, y);
+      list = g_hash_table_lookup (index->cells, key);
+      g_hash_table_steal (index->cells, key);
+      g_hash_table_insert (index->cells, key, g_slist_prepend (list, entry));
+    }
+  }
+}
+
+/**
+ * swfdec_spatial_index_insert:
+ * @index: the index
+ * @item: the item to insert
+ * @rect: the area occupied by @item or %NULL if the item should be returned by 
+ *        every query
+ *
+ * Inserts @item into @index or updates its area if it was already inserted.
+ **/
+void
+swfdec_spatial_index_insert (SwfdecSpatialIndex *index, gpointer item,
+    const SwfdecRect *rect)
+{
+  SwfdecSpatialEntry *entry;
+  double x0, y0, x1, y1;
+
+  g_return_if_fail (index != NULL);
+  g_return_if_fail (item != NULL);
+
+  entry = g_hash_table_lookup (index->items, item);
+  if (entry) {
+    swfdec_spatial_index_unlink (index, entry);
+  } else {
+    entry = g_slice_new (SwfdecSpatialEntry);
+    entry->item = item;
+    g_hash_table_insert (index->items, item, entry);
+  }
+
+  entry->everywhere = rect == NULL;
+  if (rect == NULL) {
+    swfdec_rect_init_empty (&entry->rect);
+    entry->big = TRUE;
+  } else if (swfdec_rect_is_empty (rect)) {
+    /* can never be hit, keep it out of the cells */
+    entry->rect = *rect;
+    entry->big = FALSE;
+    entry->x0 = entry->y0 = 0;
+    entry->x1 = entry->y1 = -1;
+  } else {
+    entry->rect = *rect;
+    x0 = floor (rect->x0 / index->cell_size);
+    y0 = floor (rect->y0 / index->cell_size);
+    x1 = floor (rect->x1 / index->cell_size);
+    y1 = floor (rect->y1 / index->cell_size);
+    /* NB: this check also catches NaN and infinite rectangles */
+    entry->big = !((x1 - x0 + 1) * (y1 - y0 + 1) <= SWFDEC_SPATIAL_INDEX_MAX_CELLS &&
+	fabs (x0) < G_MAXINT / 2 && fabs (y0) < G_MAXINT / 2);
+    if (!entry->big) {
+      entry->x0 = x0;
+      entry->y0 = y0;
+      entry->x1 = x1;
+      entry->y1 = y1;
+    }
+  }
+  swfdec_spatial_index_link (index, entry);
+}
+
+void
+swfdec_spatial_index_remove (SwfdecSpatialIndex *index, gpointer item)
+{
+  SwfdecSpatialEntry *entry;
+
+  g_return_if_fail (index != NULL);
+  g_return_if_fail (item != NULL);
+
+  entry = g_hash_table_lookup (index->items, item);
+  if (entry == NULL)
+    return;
+
+  swfdec_spatial_index_unlink (index, entry);
+  g_hash_table_remove (index->items, item);
+}
+
+/**
+ * swfdec_spatial_index_query:
+ * @index: the index
+ * @x: x coordinate
+ * @y: y coordinate
+ *
+ * Finds all items whose area contains the given point. This includes items 
+ * that were inserted without a rectangle. The items are returned in no 
+ * particular order.
+ *
+ * Returns: a new list of the items. Free it with g_slist_free().
+ **/
+GSList *
+swfdec_spatial_index_query (SwfdecSpatialIndex *index, double x, double y)
+{
+  SwfdecSpatialEntry *entry;
+  GSList *walk, *ret = NULL;
+  double cx, cy;
+
+  g_return_val_if_fail (index != NULL, NULL);
+
+  for (walk = index->big; walk; walk = walk->next) {
+    entry = walk->data;
+    if (entry->everywhere || swfdec_rect_contains (&entry->rect, x, y))
+      ret = g_slist_prepend (ret, entry->item);
+  }
+
+  cx = floor (x / index->cell_size);
+  cy = floor (y / index->cell_size);
+  if (!(fabs (cx) < G_MAXINT / 2 && fabs (cy) < G_MAXINT / 2))
+    return ret;
+  walk = g_hash_table_lookup (index->cells, CELL_KEY ((int) cx, (int) cy));
+  for (; walk; walk = walk->next) {
+    entry = walk->data;
+    if (swfdec_rect_contains (&entry->rect, x, y))
+      ret = g_slist_prepend (ret, entry->item);
+  }
+
+  return ret;
+}
@@ -0,0 +1,44 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * 
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, 
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifndef _SWFDEC_SPATIAL_INDEX_H_
+#define _SWFDEC_SPATIAL_INDEX_H_
+
+#include <swfdec/swfdec_rect.h>
+
+G_BEGIN_DECLS
+
+
+typedef struct _SwfdecSpatialIndex SwfdecSpatialIndex;
+
+SwfdecSpatialIndex *	swfdec_spatial_index_new	(double			cell_size);
+void			swfdec_spatial_index_free	(SwfdecSpatialIndex *	index);
+
+void			swfdec_spatial_index_insert	(SwfdecSpatialIndex *	index,
+							 gpointer		item,
+							 const SwfdecRect *	rect);
+void			swfdec_spatial_index_remove	(SwfdecSpatialIndex *	index,
+							 gpointer		item);
+GSList *		swfdec_spatial_index_query	(SwfdecSpatialIndex *	index,
+							 double			x,
+							 double			y);
+
+
+G_END_DECLS
+#endif
@@ -149,7 +149,7 @@ swfdec_sprite_movie_perform_place (SwfdecSpriteMovie *movie, SwfdecBits *bits, g
   gboolean has_character;
   gboolean move;
   int depth;
-  gboolean cache;
+  gboolean cache = FALSE;
   gboolean has_blend_mode = 0;
   gboolean has_filter = 0;
   int clip_depth;
@@ -350,8 +350,13 @@ out:
     if (cur->filters)
       g_slist_free (cur->filters);
     swfdec_movie_invalidate_next (cur);
+    swfdec_movie_queue_update (cur, SWFDEC_MOVIE_INVALID_EXTENTS);
     cur->filters = filters;
   }
+  if (cache && cur && !cur->cache_as_bitmap) {
+    swfdec_movie_invalidate_last (cur);
+    cur->cache_as_bitmap = TRUE;
+  }
 
   if (events)
     swfdec_event_list_free (events);
@@ -586,6 +591,7 @@ swfdec_sprite_movie_goto (SwfdecSpriteMovie *movie, guint goto_frame)
       /* do nothing */
     }
     old = walk;
+    SWFDEC_AS_CONTEXT (player)->movie_epoch++;
     mov->list = my_g_list_split (mov->list, old);
     for (walk = old; walk && 
 	swfdec_depth_classify (SWFDEC_MOVIE (walk->data)->depth) == SWFDEC_DEPTH_CLASS_TIMELINE;
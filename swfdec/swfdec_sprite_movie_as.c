@@ -89,7 +89,11 @@ void
 swfdec_sprite_movie_get_cacheAsBitmap (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *rval)
 {
-  SWFDEC_STUB ("MovieClip.cacheAsBitmap (get)");
+  SwfdecMovie *movie;
+
+  SWFDEC_AS_CHECK (SWFDEC_TYPE_MOVIE, &movie, "");
+
+  SWFDEC_AS_VALUE_SET_BOOLEAN (rval, movie->cache_as_bitmap);
 }
 
 SWFDEC_AS_NATIVE (900, 402, swfdec_sprite_movie_set_cacheAsBitmap)
@@ -97,7 +101,15 @@ void
 swfdec_sprite_movie_set_cacheAsBitmap (SwfdecAsContext *cx, SwfdecAsObject *object,
     guint argc, SwfdecAsValue *argv, SwfdecAsValue *rval)
 {
-  SWFDEC_STUB ("MovieClip.cacheAsBitmap (set)");
+  SwfdecMovie *movie;
+  gboolean cache;
+
+  SWFDEC_AS_CHECK (SWFDEC_TYPE_MOVIE, &movie, "b", &cache);
+
+  if (cache != movie->cache_as_bitmap) {
+    swfdec_movie_invalidate_last (movie);
+    movie->cache_as_bitmap = cache;
+  }
 }
 
 SWFDEC_AS_NATIVE (900, 403, swfdec_sprite_movie_get_opaqueBackground)
@@ -172,6 +184,7 @@ swfdec_sprite_movie_set_filters (SwfdecAsContext *cx, SwfdecAsObject *object,
   }
   g_slist_free (movie->filters);
   movie->filters = list;
+  swfdec_movie_queue_update (movie, SWFDEC_MOVIE_INVALID_EXTENTS);
 }
 
 SWFDEC_AS_NATIVE (900, 419, swfdec_sprite_movie_get_transform)
@@ -245,7 +258,7 @@ swfdec_sprite_movie_set_blendMode (SwfdecAsContext *cx, SwfdecAsObject *object,
     blend_mode = SWFDEC_AS_VALUE_GET_NUMBER (val);
   } else if (SWFDEC_AS_VALUE_IS_STRING (val)) {
     blend_mode = 0;
-    str = SWFDEC_AS_VALUE_GET_STRING (val);
+    str = SWFDEC_AS_VALUE_GET_FLAT_STRING (val);
     for (i = 0; i < num_blend_mode_names; i++) {
       if (str == blend_mode_names[i]) { // case-sensitive
 	blend_mode = i + 1;
@@ -502,7 +515,7 @@ swfdec_sprite_movie_do_goto (SwfdecSpriteMovie *movie, SwfdecAsValue *target)
   g_return_if_fail (movie->sprite != NULL);
 
   if (SWFDEC_AS_VALUE_IS_STRING (*target)) {
-    const char *label = SWFDEC_AS_VALUE_GET_STRING (*target);
+    const char *label = SWFDEC_AS_VALUE_GET_FLAT_STRING (*target);
     frame = swfdec_sprite_get_frame (movie->sprite, label);
     /* FIXME: nonexisting frames? */
     if (frame == -1)
@@ -958,6 +971,7 @@ swfdec_sprite_movie_setMask (SwfdecAsContext *cx, SwfdecAsObject *object,
     g_assert (movie->parent);
     swfdec_movie_invalidate_last (movie->parent);
     movie->clip_depth = 0;
+    swfdec_movie_update_index (movie);
   } else {
     swfdec_movie_invalidate_last (movie);
   }
@@ -973,6 +987,7 @@ swfdec_sprite_movie_setMask (SwfdecAsContext *cx, SwfdecAsObject *object,
       g_assert (mask->parent);
       swfdec_movie_invalidate_last (mask->parent);
       mask->clip_depth = 0;
+      swfdec_movie_update_index (mask);
     } else {
       swfdec_movie_invalidate_last (mask);
     }
@@ -328,7 +328,7 @@ swfdec_system_query (SwfdecAsContext *cx, SwfdecAsObject *object,
       } else if (SWFDEC_AS_VALUE_IS_NUMBER (val)) {
 	g_string_append_printf (server, "%d", (int) SWFDEC_AS_VALUE_GET_NUMBER (val));
       } else if (SWFDEC_AS_VALUE_IS_STRING (val)) {
-	char *s = swfdec_as_string_escape (cx, SWFDEC_AS_VALUE_GET_STRING (val));
+	char *s = swfdec_as_string_escape (cx, SWFDEC_AS_VALUE_GET_FLAT_STRING (val));
 	g_string_append (server, s);
 	g_free (s);
       } else {
@@ -753,7 +753,7 @@ swfdec_text_format_do_set_tab_stops (SwfdecAsContext *cx,
     gsize i;
 
     // special case: empty strings mean null
-    if (SWFDEC_AS_VALUE_GET_STRING (argv[0]) == SWFDEC_AS_STR_EMPTY) {
+    if (SWFDEC_AS_VALUE_GET_FLAT_STRING (argv[0]) == SWFDEC_AS_STR_EMPTY) {
       g_free (format->attr.tab_stops);
       format->attr.tab_stops = NULL;
       format->attr.n_tab_stops = 0;
@@ -761,7 +761,7 @@ swfdec_text_format_do_set_tab_stops (SwfdecAsContext *cx,
     } else {
       int n = cx->version >= 8 ? G_MININT : 0;
       SWFDEC_TEXT_ATTRIBUTE_SET (format->values_set, SWFDEC_TEXT_ATTRIBUTE_TAB_STOPS);
-      format->attr.n_tab_stops = strlen (SWFDEC_AS_VALUE_GET_STRING (argv[0]));
+      format->attr.n_tab_stops = strlen (SWFDEC_AS_VALUE_GET_FLAT_STRING (argv[0]));
       format->attr.tab_stops = g_new (guint, format->attr.n_tab_stops);
       for (i = 0; i < format->attr.n_tab_stops; i++) {
 	format->attr.tab_stops[i] = n;
@@ -27,6 +27,7 @@
 #include "swfdec_xml_node.h"
 #include "swfdec_xml.h"
 #include "swfdec_as_array.h"
+#include "swfdec_as_cloner.h"
 #include "swfdec_as_native_function.h"
 #include "swfdec_as_object.h"
 #include "swfdec_as_strings.h"
@@ -59,12 +60,42 @@ swfdec_xml_node_mark (SwfdecGcObject *object)
   SWFDEC_GC_OBJECT_CLASS (swfdec_xml_node_parent_class)->mark (object);
 }
 
+static SwfdecAsRelay *
+swfdec_xml_node_clone_relay (SwfdecAsRelay *relay, SwfdecAsCloner *cloner)
+{
+  SwfdecXmlNode *node = SWFDEC_XML_NODE (relay);
+  SwfdecXmlNode *copy;
+
+  /* SwfdecXml contains more data */
+  if (G_OBJECT_TYPE (relay) != SWFDEC_TYPE_XML_NODE)
+    return NULL;
+
+  copy = g_object_new (SWFDEC_TYPE_XML_NODE, "context", 
+      swfdec_as_cloner_get_context (cloner), NULL);
+  copy->valid = node->valid;
+  copy->type = node->type;
+  copy->name = node->name;
+  copy->value = node->value;
+  copy->parent = swfdec_as_cloner_map_relay (cloner, node->parent);
+  if (node->children)
+    copy->children = swfdec_as_cloner_map_object (cloner, node->children);
+  if (node->attributes)
+    copy->attributes = swfdec_as_cloner_map_object (cloner, node->attributes);
+  if (node->child_nodes)
+    copy->child_nodes = swfdec_as_cloner_map_object (cloner, node->child_nodes);
+
+  return SWFDEC_AS_RELAY (copy);
+}
+
 static void
 swfdec_xml_node_class_init (SwfdecXmlNodeClass *klass)
 {
   SwfdecGcObjectClass *gc_class = SWFDEC_GC_OBJECT_CLASS (klass);
+  SwfdecAsRelayClass *relay_class = SWFDEC_AS_RELAY_CLASS (klass);
 
   gc_class->mark = swfdec_xml_node_mark;
+
+  relay_class->clone = swfdec_xml_node_clone_relay;
 }
 
 static void
@@ -0,0 +1,83 @@
+// makeswf -v 7 -s 200x150 -r 1 -o array-elements.swf array-elements.as
+
+trace ("Check arrays with holes, splice and sort");
+
+show = function (a) {
+  var s = a.length + ":";
+  for (var i = 0; i < a.length; i++) {
+    if (a[i] == undefined) {
+      s += " -";
+    } else {
+      s += " " + a[i];
+    }
+  }
+  return s;
+};
+
+count = function (a) {
+  var n = 0;
+  for (var p in a) {
+    n++;
+  }
+  return n;
+};
+
+/* holes */
+a = new Array ();
+a[0] = "a";
+a[3] = "d";
+trace (show (a));
+trace (count (a));
+a[2] = "c";
+trace (show (a));
+trace (count (a));
+delete a[3];
+trace (show (a));
+trace (count (a));
+a.length = 2;
+trace (show (a));
+trace (a[2]);
+a.length = 4;
+trace (show (a));
+trace (count (a));
+a[200] = "far";
+trace (a.length);
+trace (a[200]);
+trace (a[0]);
+trace (count (a));
+
+/* splice */
+b = new Array (1, 2, 3, 4, 5, 6);
+r = b.splice (1, 2);
+trace (show (r));
+trace (show (b));
+r = b.splice (2, 0, "x", "y");
+trace (show (r));
+trace (show (b));
+r = b.splice (-2, 1, "z");
+trace (show (r));
+trace (show (b));
+r = b.splice (3);
+trace (show (r));
+trace (show (b));
+h = new Array ();
+h[1] = "b";
+h[3] = "d";
+h.splice (1, 1);
+trace (show (h));
+
+/* sort */
+c = new Array (3, 1, 10, 2);
+c.sort ();
+trace (show (c));
+c.sort (function (x, y) { return x - y; });
+trace (show (c));
+c.sort (function (x, y) { return y - x; });
+trace (show (c));
+c.reverse ();
+trace (show (c));
+c.push (0);
+c.sort (function (x, y) { return x - y; });
+trace (show (c));
+
+loadMovie ("FSCommand:quit", "");
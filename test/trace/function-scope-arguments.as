@@ -0,0 +1,79 @@
+// makeswf -v 7 -s 200x150 -r 1 -o function-scope-arguments.swf function-scope-arguments.as
+
+trace ("Check arguments of functions in nested scopes");
+function outer (a, b) {
+  var x = a + b;
+  return function () {
+    return x + arguments.length;
+  };
+}
+f = outer ("a", "b");
+g = outer ("c", "d", "e");
+trace (f ());
+trace (f (1, 2));
+trace (g ());
+
+function count () {
+  var inner = function () {
+    return arguments.length;
+  };
+  return arguments.length + ":" + inner (1, 2, 3);
+}
+trace (count ());
+trace (count ("x"));
+
+function fact (n) {
+  if (n <= 1)
+    return 1;
+  return n * arguments.callee (n - 1);
+}
+trace (fact (5));
+
+function keep () {
+  var args = arguments;
+  return function () {
+    return args[0] + args.length;
+  };
+}
+k = keep ("kept");
+keep ("other", "values");
+trace (k ());
+
+function getThis () {
+  return this;
+}
+function peek (a, b) {
+  var get = getThis;
+  var act = get ();
+  trace (act.arguments.length + ":" + act.arguments[1]);
+  return act;
+}
+function leak (a, b) {
+  var get = getThis;
+  return get ();
+}
+p = peek ("p", "q");
+trace (p.arguments[0] + p.arguments.length);
+l = leak ("l", "m", "n");
+peek ();
+trace (l.arguments[2] + l.arguments.length);
+trace (l.arguments.callee == leak);
+
+function Base () {
+}
+Base.prototype.who = function () {
+  return "Base";
+};
+function Sub () {
+}
+Sub.prototype = new Base ();
+Sub.prototype.leak = function (a) {
+  var get = getThis;
+  return get ();
+};
+s = new Sub ();
+l = s.leak ("s");
+trace (l.arguments[0] + l.arguments.length);
+trace (l["super"].who ());
+
+loadMovie ("FSCommand:quit", "");
@@ -0,0 +1,25 @@
+// makeswf -v 8 -s 200x150 -r 1 -o lazy-classes.swf lazy-classes.as
+
+trace ("Check that classes built on first use don't use replaced globals");
+
+ASnative = null;
+ASconstructor = null;
+ASSetNative = null;
+ASSetNativeAccessor = null;
+ASSetPropFlags = null;
+
+x = new XML ("<a>b</a>");
+trace (x.firstChild.nodeName);
+trace (x instanceof XMLNode);
+trace (typeof (XML.prototype.onData));
+trace (typeof (TextFormat));
+lc = new LocalConnection ();
+trace (typeof (lc.connect));
+b = new flash.display.BitmapData (2, 2);
+trace (b.width);
+f = new flash.filters.BlurFilter (2, 3);
+trace (f.blurY);
+trace (f instanceof flash.filters.BitmapFilter);
+trace (o);
+
+loadMovie ("FSCommand:quit", "");
@@ -0,0 +1,87 @@
+// makeswf -v 7 -s 200x150 -r 1 -o object-shapes.swf object-shapes.as
+
+trace ("Check variables of objects that share and change their layout");
+
+names = function (o) {
+  var list = new Array ();
+  for (var p in o) {
+    list.push (p + "=" + o[p]);
+  }
+  list.sort ();
+  return list.join (",");
+};
+
+a = new Object ();
+a.x = 1;
+a.y = 2;
+b = new Object ();
+b.x = 3;
+b.y = 4;
+b.z = 5;
+trace (names (a));
+trace (names (b));
+a.z = 6;
+trace (names (a));
+trace (names (b));
+
+/* deleting the last variable */
+trace (delete b.z);
+trace (names (b));
+trace (b.z);
+b.w = 7;
+trace (names (b));
+trace (names (a));
+
+/* deleting a variable in the middle */
+trace (delete a.y);
+trace (names (a));
+trace (a.y);
+a.y = 8;
+trace (names (a));
+trace (delete a.nothing);
+trace (names (b));
+
+/* many variables */
+c = new Object ();
+for (i = 0; i < 100; i++) {
+  c["v" + i] = i;
+}
+for (i = 0; i < 100; i += 2) {
+  delete c["v" + i];
+}
+n = 0;
+sum = 0;
+for (p in c) {
+  n++;
+  sum += c[p];
+}
+trace (n);
+trace (sum);
+trace (c.v51);
+trace (c.v50);
+
+/* deleting everything */
+d = new Object ();
+d.x = 1;
+d.y = 2;
+delete d.x;
+delete d.y;
+trace (names (d));
+d.y = 3;
+trace (names (d));
+
+/* deleting the only variable and adding another one */
+e = new Object ();
+for (i = 0; i < 100; i++) {
+  e.a = i;
+  delete e.a;
+  e.b = i;
+  delete e.b;
+}
+trace (names (e));
+e.c = 9;
+trace (names (e));
+e.a = 10;
+trace (names (e));
+
+loadMovie ("FSCommand:quit", "");
@@ -0,0 +1,62 @@
+// makeswf -v 7 -s 200x150 -r 1 -o string-concat-rope.swf string-concat-rope.as
+
+trace ("Check strings built by long concatenations");
+
+s = "";
+for (i = 0; i < 500; i++) {
+  s += "0123456789";
+}
+trace (s.length);
+trace (s.substr (4995));
+trace (s.charAt (2501));
+
+t = "";
+for (i = 0; i < 200; i++) {
+  t = t + i;
+}
+trace (t.length);
+trace (t.substr (0, 12));
+trace (t.substr (t.length - 6));
+
+u = "";
+for (i = 0; i < 300; i++) {
+  u = "ab" + u;
+}
+trace (u.length);
+trace (u.substr (0, 6));
+
+/* property names */
+key = "";
+for (i = 0; i < 20; i++) {
+  key += "abcdefghij";
+}
+o = new Object ();
+o[key] = "found";
+trace (o[key]);
+trace (o["abcdefghij" + key.substr (10)]);
+for (p in o) {
+  trace (p.length);
+  trace (p == key);
+}
+o["abcdefghij" + key.substr (10)] = "again";
+trace (o[key]);
+o[key + "!"] = "other";
+trace (o[key]);
+trace (o[key.substr (0) + "!"]);
+
+/* comparing with interned strings */
+lit = "0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789";
+rope = "";
+for (i = 0; i < 13; i++) {
+  rope += "0123456789";
+}
+trace (typeof (rope));
+trace (rope);
+trace (rope == lit);
+trace (lit == rope);
+trace (rope != lit);
+trace (rope + "a" == lit + "a");
+trace (rope < lit + "a");
+trace (rope == lit.substr (1));
+
+loadMovie ("FSCommand:quit", "");
@@ -0,0 +1,220 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <math.h>
+#include <string.h>
+
+#include "swfdec/swfdec_blur.h"
+
+/* size of the images used in the tests, small enough that boxes reach over
+ * the whole image */
+#define WIDTH 7
+#define HEIGHT 5
+/* bytes added to each row, they must not be touched */
+#define PADDING 3
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* blurs n values that are step bytes apart with a box of the given size,
+ * values outside the image are transparent */
+static void
+reference_blur_line (guint8 *data, guint n, guint step, double size)
+{
+  double line[MAX (WIDTH, HEIGHT)];
+  double center, edge, sum;
+  guint radius, i;
+  int j, k;
+
+  size = MAX (size, 1);
+  radius = ceil ((size - 1) / 2);
+  if (radius == 0)
+    return;
+  center = 1 / size;
+  edge = center * (1 - (2 * radius + 1 - size) / 2);
+
+  for (i = 0; i < n; i++)
+    line[i] = data[i * step];
+  for (i = 0; i < n; i++) {
+    sum = 0;
+    for (j = - (int) radius; j <= (int) radius; j++) {
+      k = (int) i + j;
+      if (k < 0 || k >= (int) n)
+	continue;
+      sum += line[k] * ((guint) ABS (j) == radius ? edge : center);
+    }
+    data[i * step] = floor (sum + 0.5);
+  }
+}
+
+static void
+reference_blur (guint8 *data, guint stride, guint bpp, double x, double y,
+    guint quality)
+{
+  guint pass, i, c;
+
+  for (pass = 0; pass < quality; pass++) {
+    for (i = 0; i < HEIGHT; i++) {
+      for (c = 0; c < bpp; c++)
+	reference_blur_line (data + i * stride + c, WIDTH, bpp, x);
+    }
+    for (i = 0; i < WIDTH; i++) {
+      for (c = 0; c < bpp; c++)
+	reference_blur_line (data + i * bpp + c, HEIGHT, stride, y);
+    }
+  }
+}
+
+/* fills the image with pseudo-random values and the padding with a pattern */
+static void
+fill_image (guint8 *data, guint stride, guint bpp, guint seed)
+{
+  guint x, y;
+
+  for (y = 0; y < HEIGHT; y++) {
+    for (x = 0; x < WIDTH * bpp; x++) {
+      seed = seed * 1103515245 + 12345;
+      data[y * stride + x] = seed >> 16;
+    }
+    memset (data + y * stride + WIDTH * bpp, 0xAA, PADDING);
+  }
+}
+
+static guint
+check_blur (double x, double y, guint quality, guint bpp, guint seed)
+{
+  guint8 data[HEIGHT * (WIDTH * 4 + PADDING)];
+  guint8 reference[HEIGHT * (WIDTH * 4 + PADDING)];
+  guint stride = WIDTH * bpp + PADDING;
+  guint errors = 0;
+  SwfdecBlur *blur;
+  guint i, diff;
+
+  fill_image (data, stride, bpp, seed);
+  memcpy (reference, data, HEIGHT * stride);
+
+  blur = swfdec_blur_new (x, y, quality);
+  if (bpp == 4)
+    swfdec_blur_apply (blur, WIDTH, HEIGHT, data, stride);
+  else
+    swfdec_blur_apply_alpha (blur, WIDTH, HEIGHT, data, stride);
+  swfdec_blur_free (blur);
+  reference_blur (reference, stride, bpp, x, y, quality);
+
+  for (i = 0; i < HEIGHT * stride; i++) {
+    /* every pass rounds twice and the fixed point weights are slightly
+     * smaller than the exact ones */
+    diff = ABS ((int) data[i] - (int) reference[i]);
+    if (i % stride >= WIDTH * bpp) {
+      if (data[i] != 0xAA) {
+	ERROR ("blur %g %g %u (%u bpp) changed padding at %u %u",
+	    x, y, quality, bpp, i % stride, i / stride);
+	break;
+      }
+    } else if (diff > 2 * quality) {
+      ERROR ("blur %g %g %u (%u bpp) differs at byte %u of row %u: %u, expected %u",
+	  x, y, quality, bpp, i % stride, i / stride, data[i], reference[i]);
+      break;
+    }
+  }
+  return errors;
+}
+
+static guint
+check_sizes (void)
+{
+  /* whole and odd sizes, fractional sizes and boxes larger than the image */
+  static const double sizes[] = { 1, 2, 2.5, 3, 4, 5.5, 7, 12 };
+  guint errors = 0;
+  guint i, quality;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    for (quality = 1; quality <= 3; quality++) {
+      errors += check_blur (sizes[i], sizes[i], quality, 4, i + quality);
+      errors += check_blur (sizes[i], sizes[i], quality, 1, i + quality);
+      errors += check_blur (sizes[i], 1, quality, 1, i);
+      errors += check_blur (1, sizes[i], quality, 4, i);
+    }
+  }
+  return errors;
+}
+
+static guint
+check_edges (void)
+{
+  guint8 data[HEIGHT * WIDTH];
+  guint errors = 0;
+  SwfdecBlur *blur;
+  guint x, y, sum;
+
+  /* a corner pixel spreads into the image only, everything else is lost */
+  memset (data, 0, sizeof (data));
+  data[0] = 255;
+  blur = swfdec_blur_new (3, 3, 1);
+  swfdec_blur_apply_alpha (blur, WIDTH, HEIGHT, data, WIDTH);
+  swfdec_blur_free (blur);
+  sum = 0;
+  for (y = 0; y < HEIGHT; y++) {
+    for (x = 0; x < WIDTH; x++) {
+      if ((x > 1 || y > 1) && data[y * WIDTH + x] != 0) {
+	ERROR ("corner pixel spread to %u %u", x, y);
+      }
+      sum += data[y * WIDTH + x];
+    }
+  }
+  if (sum != 4 * 28) {
+    ERROR ("corner pixel was blurred to a sum of %u, not %u", sum, 4 * 28);
+  }
+
+  /* borders are radius times quality */
+  blur = swfdec_blur_new (1, 1, 3);
+  if (swfdec_blur_get_x_border (blur) != 0 || swfdec_blur_get_y_border (blur) != 0) {
+    ERROR ("blur of size 1 has a border");
+  }
+  swfdec_blur_free (blur);
+
+  blur = swfdec_blur_new (4, 2.5, 2);
+  if (swfdec_blur_get_x_border (blur) != 4 || swfdec_blur_get_y_border (blur) != 2) {
+    ERROR ("blur borders are %u %u, not 4 2", swfdec_blur_get_x_border (blur),
+	swfdec_blur_get_y_border (blur));
+  }
+  swfdec_blur_free (blur);
+
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  errors += check_sizes ();
+  errors += check_edges ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
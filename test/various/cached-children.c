@@ -0,0 +1,190 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <glib/gstdio.h>
+#include <swfdec/swfdec.h>
+
+#define WIDTH 200
+#define HEIGHT 150
+
+#define RED 0xFFFF0000
+#define GREEN 0xFF00FF00
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* version 8, two frames:
+ * p = createEmptyMovieClip ("p", 1);
+ * p.beginFill (0xFF0000);
+ * p.moveTo (0, 0);
+ * p.lineTo (100, 0);
+ * p.lineTo (100, 100);
+ * p.lineTo (0, 100);
+ * p.lineTo (0, 0);
+ * p.endFill ();
+ * p.cacheAsBitmap = true;
+ * //-- frame
+ * p.attachBitmap (new flash.display.BitmapData (50, 50, false, 0x00FF00), 1);
+ * stop ();
+ */
+static const guint8 attach_bitmap[] = {
+  0x43, 0x57, 0x53, 0x08, 0xc7, 0x01, 0x00, 0x00, 0x78, 0x9c, 0x85, 0x90,
+  0x4d, 0x4e, 0xc3, 0x30, 0x10, 0x85, 0x9f, 0x9d, 0xb8, 0xce, 0x82, 0x05,
+  0xac, 0xba, 0x69, 0xc5, 0x82, 0x03, 0x20, 0xb1, 0xaf, 0x28, 0xff, 0x2b,
+  0xa8, 0x04, 0x5c, 0xc0, 0x24, 0x6e, 0x63, 0xc9, 0x49, 0x2c, 0x62, 0x55,
+  0xea, 0x86, 0x75, 0x4f, 0x90, 0xd3, 0x71, 0x17, 0x3a, 0x76, 0x82, 0x8a,
+  0x8a, 0x04, 0x1b, 0x8f, 0xfd, 0x9e, 0x35, 0xf3, 0xe6, 0x2b, 0x71, 0x3a,
+  0x87, 0xf8, 0x04, 0x18, 0xc7, 0x65, 0x72, 0xc6, 0x80, 0xed, 0x03, 0x24,
+  0x1c, 0xf2, 0x77, 0xad, 0xbc, 0xbe, 0xab, 0x9c, 0xdf, 0x3c, 0x36, 0x6b,
+  0xa3, 0x6f, 0xac, 0x71, 0x78, 0xd3, 0x2b, 0x53, 0xdf, 0x1b, 0x6b, 0x51,
+  0x35, 0x6b, 0xfd, 0xda, 0xc0, 0x9a, 0x3a, 0x14, 0x5d, 0x17, 0x51, 0xcd,
+  0x55, 0x5e, 0xea, 0xab, 0xf6, 0xda, 0xf8, 0x4a, 0x39, 0x74, 0xc7, 0xc8,
+  0x20, 0xa9, 0x65, 0x28, 0x3c, 0x14, 0x36, 0x9b, 0x76, 0x47, 0xd4, 0x1e,
+  0x5f, 0xdf, 0xfa, 0xa4, 0xe3, 0xc8, 0xf8, 0xf3, 0xb8, 0x3b, 0x09, 0x32,
+  0x86, 0x83, 0xef, 0xbd, 0xe4, 0x87, 0x57, 0x1c, 0x78, 0x69, 0xef, 0x15,
+  0xff, 0x79, 0x87, 0x3d, 0xd3, 0x3f, 0xe6, 0x05, 0x4f, 0xf6, 0xf2, 0xa0,
+  0x08, 0x52, 0x78, 0x7c, 0xa4, 0xc8, 0x46, 0x82, 0x2d, 0x30, 0x27, 0x54,
+  0x1f, 0xf4, 0x61, 0x7b, 0x8e, 0x11, 0x96, 0x56, 0xb5, 0x25, 0x0a, 0xd3,
+  0x3a, 0xab, 0x36, 0xe8, 0x57, 0xbf, 0x55, 0x5e, 0x11, 0x43, 0xe5, 0x3d,
+  0x01, 0x19, 0x68, 0xb4, 0xbe, 0x21, 0x24, 0xd3, 0x7e, 0x71, 0x49, 0x04,
+  0x20, 0x20, 0x2f, 0xc2, 0x3d, 0x1e, 0xe9, 0x7e, 0x20, 0x7b, 0x8a, 0x50,
+  0x5e, 0x42, 0x8e, 0x98, 0x2c, 0xf9, 0x95, 0x4c, 0xcc, 0xc6, 0x94, 0x02,
+  0xd8, 0x01, 0x2a, 0x8a, 0x47, 0x73
+};
+
+/* creates a player running the given file, the file is removed again
+ * after the player has loaded it */
+static SwfdecPlayer *
+create_player (const guint8 *data, gsize length)
+{
+  SwfdecPlayer *player;
+  SwfdecURL *url;
+  char *filename;
+  GError *error = NULL;
+  int fd;
+
+  fd = g_file_open_tmp ("cached-children-XXXXXX.swf", &filename, &error);
+  if (fd < 0) {
+    g_printerr ("could not create temporary file: %s\n", error->message);
+    g_error_free (error);
+    return NULL;
+  }
+  close (fd);
+  if (!g_file_set_contents (filename, (const char *) data, length, &error)) {
+    g_printerr ("could not write temporary file: %s\n", error->message);
+    g_error_free (error);
+    g_unlink (filename);
+    g_free (filename);
+    return NULL;
+  }
+
+  player = swfdec_player_new (NULL);
+  swfdec_player_set_size (player, WIDTH, HEIGHT);
+  url = swfdec_url_new_from_input (filename);
+  swfdec_player_set_url (player, url);
+  swfdec_url_free (url);
+  /* loads the file and runs the first frame */
+  swfdec_player_advance (player, 0);
+  g_unlink (filename);
+  g_free (filename);
+
+  return player;
+}
+
+static cairo_surface_t *
+render (SwfdecPlayer *player)
+{
+  cairo_surface_t *surface;
+  cairo_t *cr;
+
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32, WIDTH, HEIGHT);
+  cr = cairo_create (surface);
+  swfdec_player_render (player, cr);
+  cairo_destroy (cr);
+  cairo_surface_flush (surface);
+  return surface;
+}
+
+static guint32
+get_pixel (cairo_surface_t *surface, guint x, guint y)
+{
+  guint8 *data = cairo_image_surface_get_data (surface);
+
+  data += y * cairo_image_surface_get_stride (surface) + 4 * x;
+  return *(guint32 *) data;
+}
+
+static guint
+check_attach_bitmap (void)
+{
+  guint errors = 0;
+  SwfdecPlayer *player;
+  cairo_surface_t *surface;
+  guint32 pixel;
+
+  player = create_player (attach_bitmap, sizeof (attach_bitmap));
+  if (player == NULL)
+    return 1;
+
+  /* fills the cache of the parent */
+  surface = render (player);
+  pixel = get_pixel (surface, 25, 25);
+  if (pixel != RED) {
+    ERROR ("pixel is %08X before attaching, not %08X", pixel, RED);
+  }
+  cairo_surface_destroy (surface);
+
+  /* the second frame attaches a bitmap to the cached parent */
+  swfdec_player_advance (player, 1000);
+  surface = render (player);
+  pixel = get_pixel (surface, 25, 25);
+  if (pixel != GREEN) {
+    ERROR ("pixel is %08X after attaching, not %08X", pixel, GREEN);
+  }
+  pixel = get_pixel (surface, 75, 75);
+  if (pixel != RED) {
+    ERROR ("pixel outside of the bitmap is %08X, not %08X", pixel, RED);
+  }
+  cairo_surface_destroy (surface);
+
+  g_object_unref (player);
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  swfdec_init ();
+
+  errors += check_attach_bitmap ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
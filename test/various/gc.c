@@ -0,0 +1,182 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <swfdec/swfdec.h>
+
+/* number of unreachable objects created per test */
+#define N_GARBAGE 5000
+/* number of objects swept per incremental step */
+#define SWEEP_BUDGET 100
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* creates a context without garbage and an object reachable from its global
+ * object */
+static SwfdecAsContext *
+create_context (gboolean incremental, SwfdecAsObject **keep)
+{
+  SwfdecAsContext *context;
+  SwfdecAsValue val;
+
+  context = g_object_new (SWFDEC_TYPE_AS_CONTEXT, "gc-incremental", incremental,
+      "gc-sweep-budget", SWEEP_BUDGET, NULL);
+  swfdec_as_context_startup (context);
+  *keep = swfdec_as_object_new_empty (context);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, *keep);
+  swfdec_as_object_set_variable (context->global,
+      swfdec_as_context_get_string (context, "keep"), &val);
+  swfdec_as_context_gc (context);
+  return context;
+}
+
+static void
+create_garbage (SwfdecAsContext *context)
+{
+  guint i;
+
+  for (i = 0; i < N_GARBAGE; i++) {
+    swfdec_as_object_new_empty (context);
+  }
+  /* make sure the next swfdec_as_context_maybe_gc() starts a collection */
+  g_object_set (context, "memory-until-gc", (gulong) 1, NULL);
+}
+
+static guint
+check_kept (SwfdecAsContext *context, SwfdecAsObject *keep)
+{
+  guint errors = 0;
+  SwfdecAsValue val;
+
+  swfdec_as_object_get_variable (context->global,
+      swfdec_as_context_get_string (context, "keep"), &val);
+  if (!SWFDEC_AS_VALUE_IS_OBJECT (val) || SWFDEC_AS_VALUE_GET_OBJECT (val) != keep) {
+    ERROR ("reachable object was not kept");
+  }
+  return errors;
+}
+
+static guint
+check_incremental (void)
+{
+  guint errors = 0;
+  SwfdecAsContext *context;
+  SwfdecAsObject *keep;
+  gsize memory;
+  guint runs, steps;
+
+  context = create_context (TRUE, &keep);
+  memory = context->memory;
+  runs = context->gc_runs;
+  create_garbage (context);
+
+  /* the first step marks everything and frees a bit of garbage */
+  swfdec_as_context_maybe_gc (context);
+  g_object_set (context, "memory-until-gc", G_MAXULONG, NULL);
+  if (context->gc_runs != runs + 1) {
+    ERROR ("garbage collector ran %u times, not once", context->gc_runs - runs);
+  }
+  if (context->gc_sweep == NULL) {
+    ERROR ("all garbage was freed in one step");
+  }
+  if (context->memory <= memory) {
+    ERROR ("no garbage left after the first step");
+  }
+
+  /* the following steps only sweep */
+  for (steps = 1; context->gc_sweep != NULL && steps <= N_GARBAGE; steps++) {
+    swfdec_as_context_maybe_gc (context);
+  }
+  if (context->gc_sweep != NULL) {
+    ERROR ("sweep did not finish after %u steps", steps);
+  } else if (steps < N_GARBAGE / SWEEP_BUDGET) {
+    ERROR ("sweep took only %u steps, expected at least %u", steps,
+	N_GARBAGE / SWEEP_BUDGET);
+  }
+  if (context->gc_runs != runs + 1) {
+    ERROR ("sweeping marked again, garbage collector ran %u times",
+	context->gc_runs - runs);
+  }
+  if (context->memory > memory) {
+    ERROR ("%"G_GSIZE_FORMAT" bytes of garbage were not freed",
+	context->memory - memory);
+  }
+  if (context->gc_last_pause > context->gc_max_pause ||
+      context->gc_max_pause > context->gc_total_pause) {
+    ERROR ("pause times are inconsistent: last %lu, max %lu, total %"G_GUINT64_FORMAT,
+	context->gc_last_pause, context->gc_max_pause, context->gc_total_pause);
+  }
+  errors += check_kept (context, keep);
+
+  g_object_unref (context);
+  return errors;
+}
+
+static guint
+check_stop_the_world (void)
+{
+  guint errors = 0;
+  SwfdecAsContext *context;
+  SwfdecAsObject *keep;
+  gsize memory;
+  guint runs;
+
+  context = create_context (FALSE, &keep);
+  memory = context->memory;
+  runs = context->gc_runs;
+  create_garbage (context);
+
+  swfdec_as_context_maybe_gc (context);
+  if (context->gc_runs != runs + 1) {
+    ERROR ("garbage collector ran %u times, not once", context->gc_runs - runs);
+  }
+  if (context->gc_sweep != NULL) {
+    ERROR ("garbage is swept incrementally");
+  }
+  if (context->memory > memory) {
+    ERROR ("%"G_GSIZE_FORMAT" bytes of garbage were not freed",
+	context->memory - memory);
+  }
+  errors += check_kept (context, keep);
+
+  g_object_unref (context);
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  swfdec_init ();
+
+  errors += check_incremental ();
+  errors += check_stop_the_world ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
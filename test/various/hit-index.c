@@ -0,0 +1,236 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <glib/gstdio.h>
+#include "swfdec/swfdec_movie.h"
+#include "swfdec/swfdec_player_internal.h"
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* version 8:
+ * function square (name, depth, x, y) {
+ *   var c = createEmptyMovieClip (name, depth);
+ *   c.beginFill (0xFF0000);
+ *   c.moveTo (0, 0);
+ *   c.lineTo (10, 0);
+ *   c.lineTo (10, 10);
+ *   c.lineTo (0, 10);
+ *   c.lineTo (0, 0);
+ *   c.endFill ();
+ *   c._x = x;
+ *   c._y = y;
+ *   c.onPress = function () {};
+ *   return c;
+ * }
+ * for (i = 0; i < 40; i++) {
+ *   square ("c" + i, i, (i % 8) * 20, Math.floor (i / 8) * 20);
+ * }
+ * square ("top", 100, 0, 0);
+ * m = square ("mask", 200, 200, 0);
+ * delete m.onPress;
+ * square ("below", 150, 220, 50);
+ * square ("hidden", 250, 200, 50);
+ * square ("clipped", 260, 220, 50);
+ * square ("above", 350, 240, 50);
+ * stop ();
+ */
+static const guint8 squares[] = {
+  0x43, 0x57, 0x53, 0x08, 0x3a, 0x03, 0x00, 0x00, 0x78, 0x9c, 0x85, 0x51,
+  0x4d, 0x4f, 0xc2, 0x40, 0x10, 0x7d, 0x2d, 0x60, 0x57, 0xa4, 0x2a, 0x88,
+  0x56, 0x4d, 0x8d, 0xf1, 0xe6, 0xd9, 0xa3, 0x11, 0x21, 0x31, 0x7e, 0x5c,
+  0x8c, 0xc6, 0x78, 0x96, 0x14, 0xba, 0x4a, 0x63, 0xbf, 0xa4, 0x88, 0x70,
+  0xf3, 0xe8, 0x89, 0x9b, 0x4d, 0x3c, 0xf8, 0x7f, 0xfc, 0x11, 0xfc, 0x08,
+  0xcf, 0x5e, 0x70, 0x67, 0xa1, 0x56, 0x31, 0xd1, 0x3d, 0x4c, 0x3b, 0xef,
+  0xbd, 0x79, 0x33, 0xb3, 0xdb, 0xc2, 0x66, 0x0d, 0xb9, 0x21, 0xa0, 0x28,
+  0xa8, 0x66, 0xcc, 0x0c, 0xf0, 0xf4, 0x8c, 0x35, 0x34, 0x61, 0xf3, 0xb0,
+  0xd3, 0x82, 0x6f, 0x79, 0x1c, 0xcd, 0x36, 0xb7, 0x3a, 0xfc, 0xd0, 0x0b,
+  0x3b, 0xfd, 0xd3, 0xa0, 0xeb, 0xf0, 0x03, 0xd7, 0x09, 0xd1, 0xe0, 0x37,
+  0x8e, 0x7f, 0xe4, 0xb8, 0x2e, 0xbc, 0xa0, 0xcb, 0x2f, 0x03, 0xb8, 0x8e,
+  0x4f, 0x1f, 0xee, 0xdb, 0x12, 0xad, 0xf7, 0xd0, 0x43, 0xbd, 0x8f, 0x3e,
+  0x02, 0xff, 0xbc, 0xcd, 0xa3, 0x08, 0x0e, 0x4e, 0x2d, 0x61, 0x79, 0xed,
+  0x06, 0x41, 0x1b, 0xd1, 0xdd, 0xbd, 0xd5, 0xe6, 0xe8, 0x04, 0x21, 0x3c,
+  0x78, 0x56, 0x74, 0x2b, 0x0c, 0xdd, 0xe0, 0x01, 0x2d, 0xc7, 0xb6, 0xb9,
+  0x8f, 0xa6, 0x68, 0x11, 0x72, 0x1b, 0x56, 0x43, 0x98, 0x23, 0x22, 0xd9,
+  0x60, 0x2b, 0x29, 0xca, 0x82, 0x8e, 0x1c, 0x6d, 0x32, 0xa6, 0x68, 0x25,
+  0x1a, 0xcd, 0x29, 0x71, 0x16, 0x0c, 0x4c, 0x31, 0x63, 0x15, 0x4c, 0x35,
+  0x63, 0x0d, 0x9a, 0x2a, 0x94, 0x2c, 0x53, 0xd9, 0x8b, 0x0b, 0xd0, 0x80,
+  0x11, 0x34, 0x85, 0x00, 0x48, 0x45, 0xf6, 0xc2, 0x88, 0x8b, 0x04, 0x63,
+  0x12, 0xd4, 0x94, 0xcb, 0x7d, 0xe3, 0xf2, 0x53, 0xdc, 0xcc, 0x98, 0xcb,
+  0xff, 0xc7, 0x4d, 0x7b, 0xce, 0xfc, 0xd1, 0x8f, 0x38, 0x6d, 0x0c, 0x4f,
+  0x10, 0x4d, 0x20, 0xaa, 0x4c, 0xc4, 0x52, 0x8c, 0xcd, 0x9a, 0x67, 0x69,
+  0x9a, 0x67, 0x73, 0x5f, 0xa9, 0x88, 0x85, 0x01, 0x43, 0x72, 0x26, 0xf0,
+  0xbe, 0x70, 0x63, 0xba, 0xf4, 0xdb, 0x20, 0x44, 0x37, 0xe3, 0x1c, 0xb4,
+  0x6d, 0x91, 0x9e, 0x94, 0x5e, 0x55, 0xdc, 0x22, 0x05, 0xa9, 0x56, 0xa7,
+  0xe6, 0xf2, 0x6a, 0xe6, 0xa5, 0xe3, 0xc2, 0x05, 0x31, 0x65, 0x01, 0x14,
+  0x7e, 0x0a, 0xab, 0xd3, 0xb8, 0xbc, 0x71, 0xdd, 0x3c, 0x26, 0x03, 0x7a,
+  0x18, 0xb6, 0x58, 0x31, 0x08, 0xd4, 0x05, 0x78, 0xbe, 0xf1, 0xa2, 0xe2,
+  0x71, 0x14, 0xaf, 0x7e, 0x5f, 0xda, 0x26, 0x51, 0x31, 0xd5, 0xae, 0x83,
+  0x95, 0xc6, 0xcc, 0x5b, 0x12, 0xd8, 0x52, 0x42, 0xcb, 0xd9, 0x4b, 0xe3,
+  0x25, 0x77, 0x0d, 0x32, 0xda, 0x21, 0xd1, 0x90, 0x42, 0x4c, 0x92, 0x72,
+  0x6a, 0x94, 0x90, 0xd2, 0xe6, 0x83, 0xd0, 0xe5, 0xdf, 0xa4, 0xac, 0xcc,
+  0x8a, 0x4d, 0xd9, 0xca, 0x6f, 0xf2, 0x9d, 0xc2, 0x15, 0x91, 0x46, 0x4a,
+  0x26, 0xaf, 0xb2, 0x5a, 0x31, 0x50, 0x13, 0x3f, 0x9f, 0x66, 0xaa, 0x79,
+  0xd8
+};
+
+/* creates a player running the given file, the file is removed again
+ * after the player has loaded it */
+static SwfdecPlayer *
+create_player (const guint8 *data, gsize length)
+{
+  SwfdecPlayer *player;
+  SwfdecURL *url;
+  char *filename;
+  GError *error = NULL;
+  int fd;
+
+  fd = g_file_open_tmp ("hit-index-XXXXXX.swf", &filename, &error);
+  if (fd < 0) {
+    g_printerr ("could not create temporary file: %s\n", error->message);
+    g_error_free (error);
+    return NULL;
+  }
+  close (fd);
+  if (!g_file_set_contents (filename, (const char *) data, length, &error)) {
+    g_printerr ("could not write temporary file: %s\n", error->message);
+    g_error_free (error);
+    g_unlink (filename);
+    g_free (filename);
+    return NULL;
+  }
+
+  player = swfdec_player_new (NULL);
+  url = swfdec_url_new_from_input (filename);
+  swfdec_player_set_url (player, url);
+  swfdec_url_free (url);
+  /* loads the file and runs the first frame */
+  swfdec_player_advance (player, 0);
+  g_unlink (filename);
+  g_free (filename);
+
+  return player;
+}
+
+static SwfdecMovie *
+get_child (SwfdecMovie *movie, const char *name)
+{
+  SwfdecAsContext *cx = swfdec_gc_object_get_context (movie);
+
+  return swfdec_movie_get_by_name (movie, 
+      swfdec_as_context_get_string (cx, name), FALSE);
+}
+
+/* checks that the mouse at the given pixel hits the child with the given name
+ * or nothing if name is NULL */
+static guint
+check_hit (SwfdecMovie *root, double x, double y, const char *name)
+{
+  guint errors = 0;
+  SwfdecMovie *hit;
+
+  hit = swfdec_movie_get_movie_at (root, x * SWFDEC_TWIPS_SCALE_FACTOR,
+      y * SWFDEC_TWIPS_SCALE_FACTOR, TRUE);
+  if (name == NULL) {
+    if (hit != NULL) {
+      ERROR ("%g %g hits %s, not nothing", x, y, hit->name);
+    }
+  } else if (hit == NULL) {
+    ERROR ("%g %g hits nothing, not %s", x, y, name);
+  } else if (!g_str_equal (hit->name, name)) {
+    ERROR ("%g %g hits %s, not %s", x, y, hit->name, name);
+  }
+  return errors;
+}
+
+static guint
+check_index (void)
+{
+  guint errors = 0;
+  SwfdecPlayer *player;
+  SwfdecMovie *root, *movie;
+  SwfdecAsValue val;
+
+  player = create_player (squares, sizeof (squares));
+  if (player == NULL)
+    return 1;
+  root = player->priv->roots->data;
+  if (g_list_length (root->list) < 32) {
+    ERROR ("only %u children were created", g_list_length (root->list));
+    g_object_unref (player);
+    return errors;
+  }
+  /* the mask clips the movies up to depth 300, but not the one below it */
+  movie = get_child (root, "mask");
+  movie->clip_depth = 300;
+
+  /* the first hit test creates the index */
+  errors += check_hit (root, 25, 5, "c1");
+  if (root->index == NULL) {
+    ERROR ("no index was created for %u children", g_list_length (root->list));
+  }
+  errors += check_hit (root, 145, 85, "c39");
+  errors += check_hit (root, 15, 5, NULL);
+  /* overlapping movies: the topmost one wins */
+  errors += check_hit (root, 5, 5, "top");
+  /* the mask doesn't contain the point, so it hides the movies it clips */
+  errors += check_hit (root, 205, 55, NULL);
+  errors += check_hit (root, 225, 55, "below");
+  errors += check_hit (root, 245, 55, "above");
+
+  /* move a movie after the index was built */
+  movie = get_child (root, "c1");
+  val = swfdec_as_value_from_integer (SWFDEC_AS_CONTEXT (player), 300);
+  swfdec_as_object_set_variable (swfdec_as_relay_get_as_object (SWFDEC_AS_RELAY (movie)),
+      swfdec_as_context_get_string (SWFDEC_AS_CONTEXT (player), "_x"), &val);
+  errors += check_hit (root, 25, 5, NULL);
+  errors += check_hit (root, 305, 5, "c1");
+
+  /* remove movies after the index was built */
+  swfdec_movie_remove (get_child (root, "top"));
+  errors += check_hit (root, 5, 5, "c0");
+  swfdec_movie_remove (get_child (root, "c0"));
+  errors += check_hit (root, 5, 5, NULL);
+  errors += check_hit (root, 45, 5, "c2");
+
+  g_object_unref (player);
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  swfdec_init ();
+
+  errors += check_index ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
@@ -0,0 +1,255 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "swfdec/swfdec_region.h"
+
+/* all rectangles used in the tests are inside this area */
+#define SIZE 1000
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* checks that the rectangles of region don't overlap and cover all of rects.
+ * The area covered by the region is returned in parea. */
+static guint
+check_region (const SwfdecRegion *region, const SwfdecRectangle *rects, 
+    guint n_rects, gsize *parea)
+{
+  const SwfdecRectangle *r;
+  guint8 *pixels;
+  guint i, n, x, y;
+  gsize area = 0;
+  guint errors = 0;
+
+  pixels = g_new0 (guint8, SIZE * SIZE);
+  n = swfdec_region_get_n_rectangles (region);
+  r = swfdec_region_get_rectangles (region);
+  if (n > 16) {
+    ERROR ("region contains %u rectangles", n);
+  }
+  for (i = 0; i < n; i++) {
+    if (r[i].width <= 0 || r[i].height <= 0) {
+      ERROR ("rectangle %u is empty", i);
+      continue;
+    }
+    for (y = r[i].y; y < (guint) (r[i].y + r[i].height); y++) {
+      for (x = r[i].x; x < (guint) (r[i].x + r[i].width); x++) {
+	pixels[y * SIZE + x]++;
+      }
+    }
+    area += (gsize) r[i].width * r[i].height;
+  }
+  for (i = 0; i < SIZE * SIZE; i++) {
+    if (pixels[i] > 1) {
+      ERROR ("pixel %u %u is covered %u times", i % SIZE, i / SIZE, pixels[i]);
+      break;
+    }
+  }
+  for (i = 0; i < n_rects; i++) {
+    for (y = rects[i].y; y < (guint) (rects[i].y + rects[i].height); y++) {
+      for (x = rects[i].x; x < (guint) (rects[i].x + rects[i].width); x++) {
+	if (pixels[y * SIZE + x] == 0) {
+	  ERROR ("pixel %u %u of rectangle %u is not covered", x, y, i);
+	  goto out;
+	}
+      }
+    }
+  }
+out:
+  g_free (pixels);
+  if (parea)
+    *parea = area;
+  return errors;
+}
+
+static SwfdecRegion *
+create_region (const SwfdecRectangle *rects, guint n_rects)
+{
+  SwfdecRegion *region;
+  guint i;
+
+  region = swfdec_region_new ();
+  for (i = 0; i < n_rects; i++) {
+    swfdec_region_add_rectangle (region, &rects[i]);
+  }
+  return region;
+}
+
+static guint
+check_intersect (void)
+{
+  guint errors = 0;
+  SwfdecRectangle a = { 0, 0, 10, 10 };
+  SwfdecRectangle overlap = { 5, 5, 10, 10 };
+  SwfdecRectangle x_only = { 5, 20, 10, 10 };
+  SwfdecRectangle y_only = { 20, 5, 10, 10 };
+  SwfdecRectangle touching = { 10, 0, 10, 10 };
+  SwfdecRectangle dest;
+
+  if (!swfdec_rectangle_intersect (&dest, &a, &overlap)) {
+    ERROR ("overlapping rectangles don't intersect");
+  } else if (dest.x != 5 || dest.y != 5 || dest.width != 5 || dest.height != 5) {
+    ERROR ("intersection is %d %d %d %d, not 5 5 5 5",
+	dest.x, dest.y, dest.width, dest.height);
+  }
+  if (swfdec_rectangle_intersect (&dest, &a, &x_only)) {
+    ERROR ("rectangles overlapping only horizontally intersect");
+  } else if (!swfdec_rectangle_is_empty (&dest)) {
+    ERROR ("intersection of rectangles overlapping only horizontally is not empty");
+  }
+  if (swfdec_rectangle_intersect (&dest, &a, &y_only)) {
+    ERROR ("rectangles overlapping only vertically intersect");
+  }
+  if (swfdec_rectangle_intersect (NULL, &a, &touching)) {
+    ERROR ("touching rectangles intersect");
+  }
+
+  return errors;
+}
+
+static guint
+check_merge (void)
+{
+  guint errors = 0;
+  SwfdecRectangle rects[] = { { 0, 0, 10, 10 }, { 20, 0, 10, 10 } };
+  SwfdecRectangle inside[] = { { 100, 100, 200, 200 }, { 150, 150, 10, 10 } };
+  SwfdecRegion *region;
+  const SwfdecRectangle *r;
+  gsize area;
+
+  /* close rectangles are cheaper to draw as one */
+  region = create_region (rects, G_N_ELEMENTS (rects));
+  errors += check_region (region, rects, G_N_ELEMENTS (rects), NULL);
+  if (swfdec_region_get_n_rectangles (region) != 1) {
+    ERROR ("close rectangles were not merged, region has %u rectangles",
+	swfdec_region_get_n_rectangles (region));
+  } else {
+    r = swfdec_region_get_rectangles (region);
+    if (r->x != 0 || r->y != 0 || r->width != 30 || r->height != 10) {
+      ERROR ("merged rectangle is %d %d %d %d, not 0 0 30 10",
+	  r->x, r->y, r->width, r->height);
+    }
+  }
+  swfdec_region_free (region);
+
+  /* contained rectangles don't change anything */
+  region = create_region (inside, G_N_ELEMENTS (inside));
+  errors += check_region (region, inside, G_N_ELEMENTS (inside), &area);
+  if (area != 200 * 200) {
+    ERROR ("contained rectangle changed the region");
+  }
+  swfdec_region_add_rectangle (region, &inside[0]);
+  if (swfdec_region_get_n_rectangles (region) != 1) {
+    ERROR ("adding a rectangle twice creates %u rectangles",
+	swfdec_region_get_n_rectangles (region));
+  }
+  swfdec_region_free (region);
+
+  return errors;
+}
+
+static guint
+check_cut (void)
+{
+  guint errors = 0;
+  SwfdecRectangle rects[] = { { 0, 0, 200, 200 }, { 100, 100, 200, 200 } };
+  SwfdecRectangle cross[] = { { 0, 400, 500, 50 }, { 200, 200, 50, 500 } };
+  SwfdecRegion *region;
+  gsize area;
+
+  /* merging these would draw 20000 pixels in vain, so the overlap gets cut */
+  region = create_region (rects, G_N_ELEMENTS (rects));
+  errors += check_region (region, rects, G_N_ELEMENTS (rects), &area);
+  if (area != 200 * 200 * 2 - 100 * 100) {
+    ERROR ("region covers %"G_GSIZE_FORMAT" pixels, not %u", area, 200 * 200 * 2 - 100 * 100);
+  }
+  swfdec_region_free (region);
+
+  /* the second rectangle gets cut into two parts */
+  region = create_region (cross, G_N_ELEMENTS (cross));
+  errors += check_region (region, cross, G_N_ELEMENTS (cross), &area);
+  if (area != 500 * 50 + 50 * 500 - 50 * 50) {
+    ERROR ("region covers %"G_GSIZE_FORMAT" pixels, not %u", area, 500 * 50 + 50 * 500 - 50 * 50);
+  }
+  if (swfdec_region_get_n_rectangles (region) != 3) {
+    ERROR ("crossing rectangles make %u rectangles, not 3",
+	swfdec_region_get_n_rectangles (region));
+  }
+  swfdec_region_free (region);
+
+  return errors;
+}
+
+static guint
+check_limit (void)
+{
+  guint errors = 0;
+  SwfdecRectangle rects[30];
+  SwfdecRectangle empty = { 500, 500, 0, 10 };
+  SwfdecRegion *region;
+  guint i;
+
+  /* these are too far apart to be merged when added, so the region has to
+   * reduce itself */
+  for (i = 0; i < G_N_ELEMENTS (rects); i++) {
+    rects[i].x = (i % 6) * 150;
+    rects[i].y = (i / 6) * 150;
+    rects[i].width = 50;
+    rects[i].height = 50;
+  }
+  region = create_region (rects, G_N_ELEMENTS (rects));
+  errors += check_region (region, rects, G_N_ELEMENTS (rects), NULL);
+  swfdec_region_free (region);
+
+  region = swfdec_region_new ();
+  swfdec_region_add_rectangle (region, &empty);
+  if (!swfdec_region_is_empty (region)) {
+    ERROR ("adding an empty rectangle makes the region not empty");
+  }
+  swfdec_region_add_rectangle (region, &rects[0]);
+  swfdec_region_clear (region);
+  if (!swfdec_region_is_empty (region)) {
+    ERROR ("clearing the region does not make it empty");
+  }
+  swfdec_region_free (region);
+
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  errors += check_intersect ();
+  errors += check_merge ();
+  errors += check_cut ();
+  errors += check_limit ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
@@ -0,0 +1,188 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <unistd.h>
+#include <glib/gstdio.h>
+#include <swfdec/swfdec.h>
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* maximum number of advances we wait for a suspended script */
+#define MAX_ADVANCES 10000
+
+/* trace ("start"); for (i = 0; i < 200000; i++); trace ("done"); */
+static const guint8 long_loop[] = {
+  0x46, 0x57, 0x53, 0x07, 0x67, 0x00, 0x00, 0x00, 0x68, 0x00, 0x1f, 0x40,
+  0x00, 0x05, 0xdc, 0x00, 0x00, 0x01, 0x01, 0x00, 0x3f, 0x03, 0x49, 0x00,
+  0x00, 0x00, 0x96, 0x07, 0x00, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00,
+  0x26, 0x96, 0x08, 0x00, 0x00, 0x69, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x96, 0x03, 0x00, 0x00, 0x69, 0x00, 0x1c, 0x96, 0x05, 0x00, 0x07,
+  0x40, 0x0d, 0x03, 0x00, 0x48, 0x12, 0x9d, 0x02, 0x00, 0x11, 0x00, 0x96,
+  0x06, 0x00, 0x00, 0x69, 0x00, 0x00, 0x69, 0x00, 0x1c, 0x50, 0x1d, 0x99,
+  0x02, 0x00, 0xd9, 0xff, 0x96, 0x06, 0x00, 0x00, 0x64, 0x6f, 0x6e, 0x65,
+  0x00, 0x26, 0x00, 0x40, 0x00, 0x00, 0x00
+};
+
+/* trace ("start"); while (true); trace ("never"); */
+static const guint8 endless_loop[] = {
+  0x46, 0x57, 0x53, 0x07, 0x36, 0x00, 0x00, 0x00, 0x68, 0x00, 0x1f, 0x40,
+  0x00, 0x05, 0xdc, 0x00, 0x00, 0x01, 0x01, 0x00, 0x1c, 0x03, 0x96, 0x07,
+  0x00, 0x00, 0x73, 0x74, 0x61, 0x72, 0x74, 0x00, 0x26, 0x99, 0x02, 0x00,
+  0xfb, 0xff, 0x96, 0x07, 0x00, 0x00, 0x6e, 0x65, 0x76, 0x65, 0x72, 0x00,
+  0x26, 0x00, 0x40, 0x00, 0x00, 0x00
+};
+
+static void
+trace_cb (SwfdecPlayer *player, const char *message, GString *string)
+{
+  g_string_append (string, message);
+  g_string_append_c (string, '\n');
+}
+
+/* creates a player running the given file, the file is removed again
+ * after the player has loaded it */
+static SwfdecPlayer *
+create_player (const guint8 *data, gsize length, gulong budget,
+    gulong max_runtime, GString *trace)
+{
+  SwfdecPlayer *player;
+  SwfdecURL *url;
+  char *filename;
+  GError *error = NULL;
+  int fd;
+
+  fd = g_file_open_tmp ("script-budget-XXXXXX.swf", &filename, &error);
+  if (fd < 0) {
+    g_printerr ("could not create temporary file: %s\n", error->message);
+    g_error_free (error);
+    return NULL;
+  }
+  close (fd);
+  if (!g_file_set_contents (filename, (const char *) data, length, &error)) {
+    g_printerr ("could not write temporary file: %s\n", error->message);
+    g_error_free (error);
+    g_unlink (filename);
+    g_free (filename);
+    return NULL;
+  }
+
+  player = swfdec_player_new (NULL);
+  g_signal_connect (player, "trace", G_CALLBACK (trace_cb), trace);
+  swfdec_player_set_script_budget (player, budget);
+  swfdec_player_set_maximum_runtime (player, max_runtime);
+  url = swfdec_url_new_from_input (filename);
+  swfdec_player_set_url (player, url);
+  swfdec_url_free (url);
+  /* loads the file and runs the first frame */
+  swfdec_player_advance (player, 0);
+  g_unlink (filename);
+  g_free (filename);
+
+  return player;
+}
+
+static guint
+check_resume (void)
+{
+  guint errors = 0;
+  SwfdecPlayer *player;
+  GString *trace;
+  guint i;
+
+  trace = g_string_new ("");
+  player = create_player (long_loop, sizeof (long_loop), 1, 0, trace);
+  if (player == NULL) {
+    g_string_free (trace, TRUE);
+    return 1;
+  }
+  if (!g_str_equal (trace->str, "start\n")) {
+    ERROR ("script was not suspended, output is \"%s\"", trace->str);
+  }
+  for (i = 0; i < MAX_ADVANCES && g_str_equal (trace->str, "start\n"); i++) {
+    swfdec_player_advance (player, 0);
+  }
+  if (!g_str_equal (trace->str, "start\ndone\n")) {
+    ERROR ("script did not finish after %u advances, output is \"%s\"",
+	i, trace->str);
+  }
+  if (swfdec_as_context_is_aborted (SWFDEC_AS_CONTEXT (player))) {
+    ERROR ("player was aborted");
+  }
+
+  g_object_unref (player);
+  g_string_free (trace, TRUE);
+  return errors;
+}
+
+static guint
+check_abort_over_budget (void)
+{
+  guint errors = 0;
+  SwfdecPlayer *player;
+  GString *trace;
+  guint i;
+
+  /* every advance stays below the maximum runtime, but the script as a whole
+   * does not and must get aborted */
+  trace = g_string_new ("");
+  player = create_player (endless_loop, sizeof (endless_loop), 5, 50, trace);
+  if (player == NULL) {
+    g_string_free (trace, TRUE);
+    return 1;
+  }
+  for (i = 0; i < MAX_ADVANCES &&
+      !swfdec_as_context_is_aborted (SWFDEC_AS_CONTEXT (player)); i++) {
+    swfdec_player_advance (player, 0);
+  }
+  if (!swfdec_as_context_is_aborted (SWFDEC_AS_CONTEXT (player))) {
+    ERROR ("endless script was not aborted after %u advances", i);
+  } else if (i == 0) {
+    ERROR ("endless script was aborted before it was suspended");
+  }
+  if (!g_str_equal (trace->str, "start\n")) {
+    ERROR ("output is \"%s\", not \"start\"", trace->str);
+  }
+
+  g_object_unref (player);
+  g_string_free (trace, TRUE);
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  swfdec_init ();
+
+  errors += check_resume ();
+  errors += check_abort_over_budget ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
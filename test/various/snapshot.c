@@ -0,0 +1,407 @@
+/* Swfdec
+ * Copyright (C) 2008 Benjamin Otte <otte@gnome.org>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <swfdec/swfdec.h>
+#include "swfdec/swfdec_as_cloner.h"
+
+/* more variables than an object keeps in slots */
+#define N_BIG 70
+
+#define ERROR(...) G_STMT_START { \
+  g_printerr ("ERROR (line %u): ", __LINE__); \
+  g_printerr (__VA_ARGS__); \
+  g_printerr ("\n"); \
+  errors++; \
+} G_STMT_END
+
+/* a relay without a clone vfunc, objects using it can't be copied */
+typedef SwfdecAsRelay TestRelay;
+typedef SwfdecAsRelayClass TestRelayClass;
+
+G_DEFINE_TYPE (TestRelay, test_relay, SWFDEC_TYPE_AS_RELAY)
+
+static void
+test_relay_class_init (TestRelayClass *klass)
+{
+}
+
+static void
+test_relay_init (TestRelay *relay)
+{
+}
+
+static void
+native_cb (SwfdecAsContext *cx, SwfdecAsObject *object, guint argc,
+    SwfdecAsValue *argv, SwfdecAsValue *ret)
+{
+}
+
+static SwfdecAsValue
+get_value (SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsValue val;
+
+  if (!swfdec_as_object_get_variable (object,
+	swfdec_as_context_get_string (object->context, name), &val))
+    SWFDEC_AS_VALUE_SET_UNDEFINED (&val);
+  return val;
+}
+
+static SwfdecAsObject *
+get_object (SwfdecAsObject *object, const char *name)
+{
+  SwfdecAsValue val = get_value (object, name);
+
+  if (!SWFDEC_AS_VALUE_IS_OBJECT (val))
+    return NULL;
+  return SWFDEC_AS_VALUE_GET_OBJECT (val);
+}
+
+static void
+set_value (SwfdecAsObject *object, const char *name, SwfdecAsValue val,
+    guint flags)
+{
+  swfdec_as_object_set_variable_and_flags (object,
+      swfdec_as_context_get_string (object->context, name), &val, flags);
+}
+
+static void
+set_object (SwfdecAsObject *object, const char *name, SwfdecAsObject *value)
+{
+  SwfdecAsValue val;
+
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, value);
+  set_value (object, name, val, 0);
+}
+
+/* builds a graph with cycles, shared objects, prototypes, arrays, functions
+ * and an object with too many variables for slots */
+static SwfdecAsObject *
+create_graph (SwfdecAsContext *context)
+{
+  SwfdecAsObject *source, *nested, *proto, *child, *array, *big;
+  SwfdecAsValue val;
+  guint i;
+  char *name;
+
+  source = swfdec_as_object_new_empty (context);
+  set_value (source, "number", swfdec_as_value_from_integer (context, 42),
+      SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT);
+  SWFDEC_AS_VALUE_SET_STRING (&val, swfdec_as_context_get_string (context, "hello"));
+  set_value (source, "string", val, 0);
+
+  nested = swfdec_as_object_new_empty (context);
+  set_value (nested, "value", swfdec_as_value_from_integer (context, 1), 0);
+  set_object (nested, "self", nested);
+  set_object (nested, "parent", source);
+  set_object (source, "a", nested);
+  set_object (source, "b", nested);
+
+  proto = swfdec_as_object_new_empty (context);
+  set_value (proto, "inherited", swfdec_as_value_from_integer (context, 7), 0);
+  child = swfdec_as_object_new_empty (context);
+  set_object (child, "__proto__", proto);
+  set_object (source, "child", child);
+
+  array = swfdec_as_array_new (context);
+  val = swfdec_as_value_from_integer (context, 1);
+  swfdec_as_array_push (array, &val);
+  val = swfdec_as_value_from_integer (context, 2);
+  swfdec_as_array_push (array, &val);
+  SWFDEC_AS_VALUE_SET_OBJECT (&val, nested);
+  swfdec_as_array_push (array, &val);
+  set_object (source, "array", array);
+
+  swfdec_as_object_add_function (source,
+      swfdec_as_context_get_string (context, "fn"), native_cb);
+
+  big = swfdec_as_object_new_empty (context);
+  for (i = 0; i < N_BIG; i++) {
+    name = g_strdup_printf ("v%u", i);
+    set_value (big, name, swfdec_as_value_from_integer (context, i), 0);
+    g_free (name);
+  }
+  set_object (source, "big", big);
+
+  return source;
+}
+
+static gboolean
+copy (SwfdecAsObject *source, SwfdecAsObject *dest)
+{
+  SwfdecAsCloner *cloner;
+  gboolean ret;
+
+  cloner = swfdec_as_cloner_new (source->context);
+  ret = swfdec_as_cloner_copy (cloner, source, dest);
+  swfdec_as_cloner_free (cloner);
+  return ret;
+}
+
+/* checks that copy has the contents create_graph() gave to the graph that
+ * original was copied from, but shares no objects with original */
+static guint
+check_graph (SwfdecAsObject *copy, SwfdecAsObject *original)
+{
+  SwfdecAsContext *context = copy->context;
+  SwfdecAsObject *nested, *child, *array, *big, *fn;
+  SwfdecAsValue val;
+  guint errors = 0;
+  guint flags;
+
+  if (!swfdec_as_object_get_variable_and_flags (copy,
+	swfdec_as_context_get_string (context, "number"), &val, &flags, NULL) ||
+      swfdec_as_value_to_integer (context, val) != 42) {
+    ERROR ("number was not copied");
+  } else if (flags != (SWFDEC_AS_VARIABLE_HIDDEN | SWFDEC_AS_VARIABLE_PERMANENT)) {
+    ERROR ("flags of number are %u after copying", flags);
+  }
+  val = get_value (copy, "string");
+  if (!SWFDEC_AS_VALUE_IS_STRING (val) ||
+      SWFDEC_AS_VALUE_GET_STRING (val) != swfdec_as_context_get_string (context, "hello")) {
+    ERROR ("string was not copied");
+  }
+
+  nested = get_object (copy, "a");
+  if (nested == NULL || nested == get_object (original, "a")) {
+    ERROR ("nested object was not copied");
+    return errors;
+  }
+  if (get_object (copy, "b") != nested) {
+    ERROR ("object referenced twice was copied twice");
+  }
+  if (get_object (nested, "self") != nested) {
+    ERROR ("reference cycle was not kept");
+  }
+  if (get_object (nested, "parent") != copy) {
+    ERROR ("reference to the copied object does not point to the copy");
+  }
+  if (swfdec_as_value_to_integer (context, get_value (nested, "value")) != 1) {
+    ERROR ("value of nested object was not copied");
+  }
+  if (nested->shape != get_object (original, "a")->shape) {
+    ERROR ("nested object has a different shape than the original");
+  }
+
+  child = get_object (copy, "child");
+  if (child == NULL || child->prototype == NULL ||
+      child->prototype == get_object (original, "child")->prototype) {
+    ERROR ("prototype was not copied");
+  } else if (swfdec_as_value_to_integer (context,
+	get_value (child, "inherited")) != 7) {
+    ERROR ("variable of prototype is not inherited");
+  }
+
+  array = get_object (copy, "array");
+  if (array == NULL || !array->array || !array->dense || array->n_elements != 3) {
+    ERROR ("array was not copied with its elements");
+  } else if (get_object (array, "2") != nested) {
+    ERROR ("object in array does not point to the copy");
+  } else if (swfdec_as_value_to_integer (context,
+	get_value (array, "length")) != 3) {
+    ERROR ("array length was not copied");
+  }
+
+  fn = get_object (copy, "fn");
+  if (fn == NULL || fn == get_object (original, "fn") || fn->relay == NULL ||
+      fn->relay == get_object (original, "fn")->relay ||
+      G_OBJECT_TYPE (fn->relay) != G_OBJECT_TYPE (get_object (original, "fn")->relay)) {
+    ERROR ("function was not copied with a new relay");
+  }
+
+  big = get_object (copy, "big");
+  if (big == NULL || big->shape != NULL) {
+    ERROR ("object with %u variables does not use a hash table", N_BIG);
+  } else if (swfdec_as_value_to_integer (context, get_value (big, "v69")) != 69) {
+    ERROR ("last variable of big object was not copied");
+  }
+
+  return errors;
+}
+
+static guint
+check_restore (void)
+{
+  SwfdecAsContext *context;
+  SwfdecAsObject *source, *snapshot, *restored, *holder;
+  SwfdecAsValue val;
+  guint errors = 0;
+  gsize memory;
+
+  context = g_object_new (SWFDEC_TYPE_AS_CONTEXT, NULL);
+  swfdec_as_context_startup (context);
+  /* keeps everything reachable, the variables exist before the memory is
+   * measured */
+  holder = swfdec_as_object_new_empty (context);
+  set_object (context->global, "holder", holder);
+  source = create_graph (context);
+  set_object (holder, "source", source);
+  set_value (holder, "snapshot", SWFDEC_AS_VALUE_NULL, 0);
+  set_value (holder, "restored", SWFDEC_AS_VALUE_NULL, 0);
+
+  snapshot = swfdec_as_object_new_empty (context);
+  if (!copy (source, snapshot)) {
+    ERROR ("could not take a snapshot");
+    g_object_unref (context);
+    return errors;
+  }
+  set_object (holder, "snapshot", snapshot);
+  /* the snapshot must survive on its own */
+  swfdec_as_context_gc (context);
+  errors += check_graph (snapshot, source);
+  if (snapshot->shape != source->shape) {
+    ERROR ("snapshot has a different shape than the original");
+  }
+
+  /* change the original, the snapshot must not be affected */
+  set_value (source, "number", swfdec_as_value_from_integer (context, 1), 0);
+  set_value (get_object (source, "a"), "value",
+      swfdec_as_value_from_integer (context, 2), 0);
+  set_value (source, "added", SWFDEC_AS_VALUE_TRUE, 0);
+  swfdec_as_object_delete_variable (source, swfdec_as_context_get_string (context, "string"));
+  swfdec_as_object_delete_variable (get_object (source, "child")->prototype,
+      swfdec_as_context_get_string (context, "inherited"));
+
+  swfdec_as_context_gc (context);
+  memory = context->memory;
+  restored = swfdec_as_object_new_empty (context);
+  if (!copy (snapshot, restored)) {
+    ERROR ("could not restore the snapshot");
+    g_object_unref (context);
+    return errors;
+  }
+  set_object (holder, "restored", restored);
+  swfdec_as_context_gc (context);
+  errors += check_graph (restored, snapshot);
+  if (restored->shape != snapshot->shape) {
+    ERROR ("restored object has a different shape than the snapshot");
+  }
+  if (restored->shape == source->shape) {
+    ERROR ("restored object has the shape of the changed original");
+  }
+  val = get_value (restored, "added");
+  if (!SWFDEC_AS_VALUE_IS_UNDEFINED (val)) {
+    ERROR ("variable added after the snapshot exists after restoring");
+  }
+
+  /* nothing in the context references the copies but holder */
+  set_value (holder, "restored", SWFDEC_AS_VALUE_NULL, 0);
+  swfdec_as_context_gc (context);
+  if (context->memory > memory) {
+    ERROR ("%"G_GSIZE_FORMAT" bytes of the restored graph were not freed",
+	context->memory - memory);
+  }
+
+  /* the restored graph must not depend on the snapshot staying alive */
+  restored = swfdec_as_object_new_empty (context);
+  if (!copy (snapshot, restored)) {
+    ERROR ("could not restore the snapshot twice");
+    g_object_unref (context);
+    return errors;
+  }
+  set_object (holder, "restored", restored);
+  set_value (holder, "snapshot", SWFDEC_AS_VALUE_NULL, 0);
+  swfdec_as_context_gc (context);
+  errors += check_graph (restored, source);
+
+  g_object_unref (context);
+  return errors;
+}
+
+static guint
+check_failure (void)
+{
+  SwfdecAsContext *context;
+  SwfdecAsObject *source, *dest, *relay;
+  SwfdecAsRelay *test;
+  guint errors = 0;
+  gsize memory;
+
+  context = g_object_new (SWFDEC_TYPE_AS_CONTEXT, NULL);
+  swfdec_as_context_startup (context);
+  source = create_graph (context);
+  set_object (context->global, "source", source);
+  dest = swfdec_as_object_new_empty (context);
+  set_object (context->global, "dest", dest);
+  /* deep inside the graph, so a lot has been copied when the cloner fails */
+  relay = swfdec_as_object_new_empty (context);
+  test = g_object_new (test_relay_get_type (), "context", context, NULL);
+  swfdec_as_object_set_relay (relay, test);
+  set_object (get_object (source, "big"), "relay", relay);
+  swfdec_as_context_gc (context);
+  memory = context->memory;
+
+  if (copy (source, dest)) {
+    ERROR ("object with a relay without clone vfunc was copied");
+  }
+  if (!SWFDEC_AS_VALUE_IS_UNDEFINED (get_value (dest, "number")) ||
+      dest->prototype != NULL || dest->shape != context->empty_shape) {
+    ERROR ("variables were not removed after a failed copy");
+  }
+  swfdec_as_context_gc (context);
+  if (context->memory > memory) {
+    ERROR ("%"G_GSIZE_FORMAT" bytes of a failed copy were not freed",
+	context->memory - memory);
+  }
+
+  g_object_unref (context);
+  return errors;
+}
+
+static guint
+check_global (void)
+{
+  SwfdecAsContext *context;
+  SwfdecAsObject *snapshot;
+  guint errors = 0;
+
+  /* sandboxes copy their global object like this */
+  context = g_object_new (SWFDEC_TYPE_AS_CONTEXT, NULL);
+  swfdec_as_context_startup (context);
+  snapshot = swfdec_as_object_new_empty (context);
+  if (!copy (context->global, snapshot)) {
+    ERROR ("could not copy the global object");
+  } else if (get_object (snapshot, "Object") == NULL ||
+      get_object (snapshot, "Object") == get_object (context->global, "Object") ||
+      get_object (get_object (snapshot, "Object"), "prototype") == NULL) {
+    ERROR ("Object was not copied");
+  }
+
+  g_object_unref (context);
+  return errors;
+}
+
+int
+main (int argc, char **argv)
+{
+  guint errors = 0;
+
+  swfdec_init ();
+
+  errors += check_restore ();
+  errors += check_failure ();
+  errors += check_global ();
+
+  g_print ("TOTAL ERRORS: %u\n", errors);
+  return errors;
+}
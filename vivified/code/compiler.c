@@ -190,6 +190,12 @@ main (int argc, char *argv[])
   assembler = g_object_ref (vivi_code_compiler_get_assembler (compiler));
   g_object_unref (compiler);
 
+  if (optimize > 2) {
+    vivi_code_assembler_allocate_registers (assembler);
+    vivi_code_assembler_fold_constants (assembler);
+    vivi_code_assembler_remove_dead_stores (assembler);
+    vivi_code_assembler_fold_constants (assembler);
+  }
   if (optimize > 0) {
     vivi_code_assembler_pool (assembler);
     if (optimize > 1)
@@ -0,0 +1,9 @@
+trace (1 + 2);
+trace (1.5 * 2);
+trace (0.5 + 0.25);
+trace ("a" + 1);
+trace (1 < "2");
+trace (0 / 0);
+trace (NaN * 2);
+trace (true + 1);
+trace (null == 0);
@@ -0,0 +1,5 @@
+h = function () {
+  trace (z);
+  var z = 2;
+  trace (z);
+};
@@ -0,0 +1,5 @@
+f = function (c) {
+  if (c)
+    var x = 1;
+  trace (x);
+};
@@ -0,0 +1,4 @@
+g = function (a) {
+  var y = a + 1;
+  trace (y);
+};
@@ -0,0 +1,6 @@
+h = function () {
+  var z = 1;
+  return function () {
+    return z;
+  };
+};
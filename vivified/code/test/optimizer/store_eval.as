@@ -0,0 +1,5 @@
+g = function (s) {
+  var y = 1;
+  trace (eval (s));
+  trace (y);
+};
@@ -0,0 +1,6 @@
+f = function (a) {
+  var x = a * 2;
+  if (a)
+    trace (x);
+  trace (a);
+};
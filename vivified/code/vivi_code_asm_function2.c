@@ -271,6 +271,16 @@ vivi_code_asm_function2_get_n_registers (ViviCodeAsmFunction2 *fun)
   return fun->n_registers;
 }
 
+void
+vivi_code_asm_function2_set_n_registers (ViviCodeAsmFunction2 *fun,
+    guint n_registers)
+{
+  g_return_if_fail (VIVI_IS_CODE_ASM_FUNCTION2 (fun));
+  g_return_if_fail (n_registers < 256);
+
+  fun->n_registers = n_registers;
+}
+
 guint
 vivi_code_asm_function2_get_n_arguments	(ViviCodeAsmFunction2 *fun)
 {
@@ -311,3 +321,14 @@ vivi_code_asm_function2_add_argument (ViviCodeAsmFunction2 *fun,
   arg.name = g_strdup (name);
   g_array_append_val (fun->args, arg);
 }
+
+void
+vivi_code_asm_function2_set_argument_preload (ViviCodeAsmFunction2 *fun,
+    guint i, guint preload)
+{
+  g_return_if_fail (VIVI_IS_CODE_ASM_FUNCTION2 (fun));
+  g_return_if_fail (i < fun->args->len);
+  g_return_if_fail (preload < 256);
+
+  g_array_index (fun->args, SwfdecScriptArgument, i).preload = preload;
+}
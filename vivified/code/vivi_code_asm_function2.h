@@ -65,6 +65,8 @@ void		vivi_code_asm_function2_set_label	(ViviCodeAsmFunction2 *	fun,
 const char *  	vivi_code_asm_function2_get_name	(ViviCodeAsmFunction2 *	fun);
 guint		vivi_code_asm_function2_get_flags	(ViviCodeAsmFunction2 *	fun);
 guint		vivi_code_asm_function2_get_n_registers	(ViviCodeAsmFunction2 *	fun);
+void		vivi_code_asm_function2_set_n_registers	(ViviCodeAsmFunction2 *	fun,
+							 guint			n_registers);
 guint		vivi_code_asm_function2_get_n_arguments	(ViviCodeAsmFunction2 *	fun);
 const char *	vivi_code_asm_function2_get_argument_name
 							(ViviCodeAsmFunction2 *	fun,
@@ -72,6 +74,10 @@ const char *	vivi_code_asm_function2_get_argument_name
 guint		vivi_code_asm_function2_get_argument_preload
 							(ViviCodeAsmFunction2 *	fun,
 							 guint			i);
+void		vivi_code_asm_function2_set_argument_preload
+							(ViviCodeAsmFunction2 *	fun,
+							 guint			i,
+							 guint			preload);
 void		vivi_code_asm_function2_add_argument	(ViviCodeAsmFunction2 *	fun,
 							 const char *		name,
 							 guint			preload);
@@ -21,12 +21,18 @@
 #include "config.h"
 #endif
 
+#include <math.h>
 #include <string.h>
 #include <swfdec/swfdec_script_internal.h>
 
 #include "vivi_code_assembler.h"
+#include "vivi_code_asm_code_default.h"
+#include "vivi_code_asm_function2.h"
+#include "vivi_code_asm_if.h"
+#include "vivi_code_asm_jump.h"
 #include "vivi_code_asm_pool.h"
 #include "vivi_code_asm_push.h"
+#include "vivi_code_asm_store.h"
 #include "vivi_code_comment.h"
 #include "vivi_code_compiler.h"
 #include "vivi_code_emitter.h"
@@ -408,6 +414,816 @@ vivi_code_assembler_merge_push (ViviCodeAssembler *assembler, guint max_depth)
   }
 }
 
+/* replaces the code at index i with the n_codes given codes, takes ownership
+ * of the given codes */
+static void
+vivi_code_assembler_replace_code (ViviCodeAssembler *assembler, guint i,
+    guint n_codes, ViviCodeAsm **codes)
+{
+  guint j;
+
+  g_object_unref (g_ptr_array_remove_index (assembler->codes, i));
+  for (j = 0; j < n_codes; j++) {
+    vivi_code_assembler_insert_code (assembler, i + j, codes[j]);
+    g_object_unref (codes[j]);
+  }
+}
+
+static void
+vivi_code_assembler_remove_index (ViviCodeAssembler *assembler, guint i)
+{
+  g_object_unref (g_ptr_array_remove_index (assembler->codes, i));
+}
+
+static SwfdecAsAction
+vivi_code_assembler_get_action (ViviCodeAssembler *assembler, guint i)
+{
+  ViviCodeAsm *code = g_ptr_array_index (assembler->codes, i);
+
+  if (!VIVI_IS_CODE_ASM_CODE (code))
+    return SWFDEC_AS_ACTION_END;
+  return vivi_code_asm_code_get_action (VIVI_CODE_ASM_CODE (code));
+}
+
+/* finds the label ending the function defined at index i */
+static guint
+vivi_code_assembler_get_function_end (ViviCodeAssembler *assembler, guint i)
+{
+  ViviCodeLabel *label;
+
+  label = vivi_code_asm_function2_get_label (
+      VIVI_CODE_ASM_FUNCTION2 (g_ptr_array_index (assembler->codes, i)));
+  for (i++; i < assembler->codes->len; i++) {
+    if (g_ptr_array_index (assembler->codes, i) == (gpointer) label)
+      break;
+  }
+  return i;
+}
+
+static gboolean
+vivi_code_assembler_get_number (ViviCodeAsmPush *push, guint i, double *d)
+{
+  switch (vivi_code_asm_push_get_value_type (push, i)) {
+    case VIVI_CODE_CONSTANT_INTEGER:
+      *d = vivi_code_asm_push_get_integer (push, i);
+      return TRUE;
+    case VIVI_CODE_CONSTANT_DOUBLE:
+      *d = vivi_code_asm_push_get_double (push, i);
+      return TRUE;
+    case VIVI_CODE_CONSTANT_FLOAT:
+      *d = vivi_code_asm_push_get_float (push, i);
+      return TRUE;
+    case VIVI_CODE_CONSTANT_STRING:
+    case VIVI_CODE_CONSTANT_NULL:
+    case VIVI_CODE_CONSTANT_UNDEFINED:
+    case VIVI_CODE_CONSTANT_REGISTER:
+    case VIVI_CODE_CONSTANT_BOOLEAN:
+    case VIVI_CODE_CONSTANT_CONSTANT_POOL:
+    case VIVI_CODE_CONSTANT_CONSTANT_POOL_BIG:
+    default:
+      return FALSE;
+  }
+}
+
+/* applies action to the last two values of push, returns FALSE if that 
+ * can't be done at compile time */
+static gboolean
+vivi_code_assembler_fold_binary (ViviCodeAsmPush *push, SwfdecAsAction action)
+{
+  guint n = vivi_code_asm_push_get_n_values (push);
+  double a, b, d;
+  int b_result = -1;
+
+  if (n < 2 ||
+      !vivi_code_assembler_get_number (push, n - 2, &a) ||
+      !vivi_code_assembler_get_number (push, n - 1, &b) ||
+      isnan (a) || isnan (b))
+    return FALSE;
+
+  switch (action) {
+    case SWFDEC_AS_ACTION_ADD:
+    case SWFDEC_AS_ACTION_ADD2:
+      d = a + b;
+      break;
+    case SWFDEC_AS_ACTION_SUBTRACT:
+      d = a - b;
+      break;
+    case SWFDEC_AS_ACTION_MULTIPLY:
+      d = a * b;
+      break;
+    case SWFDEC_AS_ACTION_DIVIDE:
+      /* Flash 4 returns "#ERROR#" here */
+      if (b == 0)
+	return FALSE;
+      d = a / b;
+      break;
+    case SWFDEC_AS_ACTION_LESS2:
+      b_result = a < b;
+      break;
+    case SWFDEC_AS_ACTION_GREATER:
+      b_result = a > b;
+      break;
+    case SWFDEC_AS_ACTION_EQUALS2:
+    case SWFDEC_AS_ACTION_STRICT_EQUALS:
+      b_result = a == b;
+      break;
+    default:
+      return FALSE;
+  }
+
+  vivi_code_asm_push_remove_value (push, n - 1);
+  vivi_code_asm_push_remove_value (push, n - 2);
+  if (b_result >= 0) {
+    vivi_code_asm_push_add_boolean (push, b_result);
+  } else if (d >= G_MININT32 && d <= G_MAXINT32 && d == (int) d &&
+      (d != 0 || !signbit (d))) {
+    vivi_code_asm_push_add_integer (push, d);
+  } else {
+    vivi_code_asm_push_add_double (push, d);
+  }
+  return TRUE;
+}
+
+/**
+ * vivi_code_assembler_fold_constants:
+ * @assembler: the assembler to optimize
+ *
+ * Does peephole optimizations on the code of @assembler: Neighbouring Push 
+ * actions are merged, values that are pushed and popped again are removed and
+ * arithmetic and comparisons on constant numbers are computed at compile 
+ * time.
+ **/
+void
+vivi_code_assembler_fold_constants (ViviCodeAssembler *assembler)
+{
+  ViviCodeAsmPush *push, *next;
+  SwfdecAsAction action;
+  guint i, j, n;
+
+  g_return_if_fail (VIVI_IS_CODE_ASSEMBLER (assembler));
+
+  i = 0;
+  while (i < assembler->codes->len) {
+    if (!VIVI_IS_CODE_ASM_PUSH (g_ptr_array_index (assembler->codes, i))) {
+      /* PushDuplicate followed by Pop does nothing */
+      if (i + 1 < assembler->codes->len &&
+	  vivi_code_assembler_get_action (assembler, i) == SWFDEC_AS_ACTION_PUSH_DUPLICATE &&
+	  vivi_code_assembler_get_action (assembler, i + 1) == SWFDEC_AS_ACTION_POP) {
+	vivi_code_assembler_remove_index (assembler, i + 1);
+	vivi_code_assembler_remove_index (assembler, i);
+	i = i > 0 ? i - 1 : 0;
+	continue;
+      }
+      i++;
+      continue;
+    }
+    push = g_ptr_array_index (assembler->codes, i);
+    n = vivi_code_asm_push_get_n_values (push);
+    if (n == 0) {
+      vivi_code_assembler_remove_index (assembler, i);
+      i = i > 0 ? i - 1 : 0;
+      continue;
+    }
+    if (i + 1 >= assembler->codes->len)
+      break;
+    if (VIVI_IS_CODE_ASM_PUSH (g_ptr_array_index (assembler->codes, i + 1))) {
+      next = g_ptr_array_index (assembler->codes, i + 1);
+      for (j = 0; j < vivi_code_asm_push_get_n_values (next); j++) {
+	vivi_code_asm_push_copy_value (push, G_MAXUINT, next, j);
+      }
+      vivi_code_assembler_remove_index (assembler, i + 1);
+      continue;
+    }
+    action = vivi_code_assembler_get_action (assembler, i + 1);
+    switch (action) {
+      case SWFDEC_AS_ACTION_POP:
+	vivi_code_asm_push_remove_value (push, n - 1);
+	vivi_code_assembler_remove_index (assembler, i + 1);
+	continue;
+      case SWFDEC_AS_ACTION_PUSH_DUPLICATE:
+	/* copying inside the same push might reallocate the copied value */
+	next = VIVI_CODE_ASM_PUSH (vivi_code_asm_push_new ());
+	vivi_code_asm_push_copy_value (next, G_MAXUINT, push, n - 1);
+	vivi_code_asm_push_copy_value (push, G_MAXUINT, next, 0);
+	g_object_unref (next);
+	vivi_code_assembler_remove_index (assembler, i + 1);
+	continue;
+      case SWFDEC_AS_ACTION_STORE_REGISTER:
+	/* a value that is stored and then popped together with the value 
+	 * below it doesn't need the value below it */
+	if (n >= 2 && i + 3 < assembler->codes->len &&
+	    vivi_code_assembler_get_action (assembler, i + 2) == SWFDEC_AS_ACTION_POP &&
+	    vivi_code_assembler_get_action (assembler, i + 3) == SWFDEC_AS_ACTION_POP) {
+	  vivi_code_asm_push_remove_value (push, n - 2);
+	  vivi_code_assembler_remove_index (assembler, i + 3);
+	  continue;
+	}
+	break;
+      default:
+	if (vivi_code_assembler_fold_binary (push, action)) {
+	  vivi_code_assembler_remove_index (assembler, i + 1);
+	  continue;
+	}
+	break;
+    }
+    i++;
+  }
+}
+
+/**
+ * vivi_code_assembler_remove_dead_stores:
+ * @assembler: the assembler to optimize
+ *
+ * Removes StoreRegister actions from functions defined with DefineFunction2 
+ * if the register stored to is never read inside the function.
+ **/
+void
+vivi_code_assembler_remove_dead_stores (ViviCodeAssembler *assembler)
+{
+  gboolean read[256];
+  ViviCodeAsm *code;
+  guint i, j, k, end;
+
+  g_return_if_fail (VIVI_IS_CODE_ASSEMBLER (assembler));
+
+  for (i = 0; i < assembler->codes->len; i++) {
+    if (!VIVI_IS_CODE_ASM_FUNCTION2 (g_ptr_array_index (assembler->codes, i)))
+      continue;
+    end = vivi_code_assembler_get_function_end (assembler, i);
+    memset (read, 0, sizeof (read));
+    for (j = i + 1; j < end; j++) {
+      code = g_ptr_array_index (assembler->codes, j);
+      /* nested functions may have their own registers, leave them alone */
+      if (VIVI_IS_CODE_ASM_FUNCTION2 (code) ||
+	  vivi_code_assembler_get_action (assembler, j) == SWFDEC_AS_ACTION_DEFINE_FUNCTION)
+	break;
+      if (!VIVI_IS_CODE_ASM_PUSH (code))
+	continue;
+      for (k = 0; k < vivi_code_asm_push_get_n_values (VIVI_CODE_ASM_PUSH (code)); k++) {
+	if (vivi_code_asm_push_get_value_type (VIVI_CODE_ASM_PUSH (code), k) == 
+	    VIVI_CODE_CONSTANT_REGISTER)
+	  read[vivi_code_asm_push_get_register (VIVI_CODE_ASM_PUSH (code), k)] = TRUE;
+      }
+    }
+    if (j < end)
+      continue;
+    for (j = end; j > i + 1; j--) {
+      code = g_ptr_array_index (assembler->codes, j - 1);
+      if (VIVI_IS_CODE_ASM_STORE (code) &&
+	  !read[vivi_code_asm_store_get_register (VIVI_CODE_ASM_STORE (code))])
+	vivi_code_assembler_remove_index (assembler, j - 1);
+    }
+  }
+}
+
+/*** REGISTER ALLOCATION ***/
+
+/* one value on the simulated stack */
+typedef struct {
+  const char *		name;		/* string constant or NULL if unknown */
+  int			integer;	/* integer constant or -1 if unknown */
+  ViviCodeAsmPush *	push;		/* push this value comes from or NULL if moved */
+  guint			index;		/* index of the value in push */
+} ViviStackValue;
+
+typedef enum {
+  VIVI_ACCESS_GET,
+  VIVI_ACCESS_SET,
+  VIVI_ACCESS_DEFINE
+} ViviAccessType;
+
+/* an access to a variable by name that can be replaced with a register */
+typedef struct {
+  ViviAccessType	type;		/* what the access does */
+  ViviCodeAsm *		code;		/* the action accessing the variable */
+  ViviCodeAsmPush *	push;		/* push of the name if it can be removed or NULL */
+  guint			index;		/* index of the name in push */
+} ViviAccess;
+
+/* everything known about a variable name */
+typedef struct {
+  const char *		name;		/* the name */
+  gboolean		defined;	/* TRUE if it's declared before any other access */
+  gboolean		pinned;		/* TRUE if it's accessed in ways that need the name */
+  GArray *		accesses;	/* ViviAccess */
+  guint			reg;		/* register allocated to the variable or 0 */
+} ViviVariable;
+
+typedef struct {
+  ViviCodeAssembler *	assembler;
+  GArray *		stack;		/* ViviStackValue, NULL if unreachable */
+  GHashTable *		labels;		/* ViviCodeLabel => GArray of ViviStackValue */
+  GHashTable *		seen;		/* labels that were passed already */
+  GHashTable *		variables;	/* name => ViviVariable */
+  gboolean		branched;	/* TRUE once code can be reached in different ways */
+} ViviRegisterState;
+
+static void
+vivi_variable_free (gpointer data)
+{
+  ViviVariable *var = data;
+
+  g_array_free (var->accesses, TRUE);
+  g_slice_free (ViviVariable, var);
+}
+
+static void
+vivi_stack_free (gpointer stack)
+{
+  if (stack)
+    g_array_free (stack, TRUE);
+}
+
+static GArray *
+vivi_stack_copy (GArray *stack)
+{
+  GArray *copy = g_array_sized_new (FALSE, FALSE, sizeof (ViviStackValue), stack->len);
+
+  g_array_append_vals (copy, stack->data, stack->len);
+  return copy;
+}
+
+static ViviVariable *
+vivi_register_state_get_variable (ViviRegisterState *state, const char *name)
+{
+  ViviVariable *var = g_hash_table_lookup (state->variables, name);
+
+  if (var == NULL) {
+    var = g_slice_new0 (ViviVariable);
+    var->name = name;
+    var->accesses = g_array_new (FALSE, FALSE, sizeof (ViviAccess));
+    g_hash_table_insert (state->variables, (gpointer) name, var);
+  }
+  return var;
+}
+
+static const ViviStackValue *
+vivi_register_state_peek (ViviRegisterState *state, guint n)
+{
+  if (state->stack->len < n)
+    return NULL;
+  return &g_array_index (state->stack, ViviStackValue, state->stack->len - n);
+}
+
+static gboolean
+vivi_register_state_pop (ViviRegisterState *state, int n)
+{
+  if (n < 0 || (guint) n > state->stack->len)
+    return FALSE;
+  g_array_set_size (state->stack, state->stack->len - n);
+  return TRUE;
+}
+
+static void
+vivi_register_state_push (ViviRegisterState *state, int n)
+{
+  ViviStackValue value = { NULL, -1, NULL, 0 };
+
+  for (; n > 0; n--)
+    g_array_append_val (state->stack, value);
+}
+
+/* merges the current stack into the stack expected at label, returns FALSE
+ * if the stacks don't match */
+static gboolean
+vivi_register_state_merge (ViviRegisterState *state, ViviCodeLabel *label)
+{
+  GArray *target;
+  ViviStackValue *from, *to;
+  guint i;
+
+  target = g_hash_table_lookup (state->labels, label);
+  if (target == NULL) {
+    g_hash_table_insert (state->labels, label, vivi_stack_copy (state->stack));
+    return TRUE;
+  }
+  if (target->len != state->stack->len)
+    return FALSE;
+  for (i = 0; i < target->len; i++) {
+    from = &g_array_index (state->stack, ViviStackValue, i);
+    to = &g_array_index (target, ViviStackValue, i);
+    if (to->name == from->name && to->push == from->push && 
+	to->index == from->index && to->integer == from->integer)
+      continue;
+    /* code after a label that was passed already relied on the value */
+    if (g_hash_table_lookup (state->seen, label) && 
+	(to->name != NULL || to->integer >= 0 || to->push != NULL))
+      return FALSE;
+    to->name = NULL;
+    to->integer = -1;
+    to->push = NULL;
+  }
+  return TRUE;
+}
+
+/* records an access to the variable whose name is the nth value on the stack */
+static gboolean
+vivi_register_state_access (ViviRegisterState *state, ViviCodeAsm *code,
+    guint n, ViviAccessType type, gboolean pin)
+{
+  const ViviStackValue *value;
+  ViviVariable *var;
+  ViviAccess access;
+
+  value = vivi_register_state_peek (state, n);
+  if (value == NULL || value->name == NULL)
+    return FALSE;
+  var = vivi_register_state_get_variable (state, value->name);
+  if (pin) {
+    var->pinned = TRUE;
+    return TRUE;
+  }
+  /* A declaration only makes the name refer to the local variable once it
+   * was executed, so it must come before all other accesses. Checking that
+   * for straight-line code from the start of the function is enough here. */
+  if (type == VIVI_ACCESS_DEFINE && var->accesses->len == 0 && !state->branched)
+    var->defined = TRUE;
+  access.type = type;
+  access.code = code;
+  access.push = value->push;
+  access.index = value->index;
+  g_array_append_val (var->accesses, access);
+  return TRUE;
+}
+
+/* simulates the stack for the code at index i, returns FALSE if the function
+ * can't use registers for its variables */
+static gboolean
+vivi_register_state_simulate (ViviRegisterState *state, guint i)
+{
+  ViviCodeAsm *code = g_ptr_array_index (state->assembler->codes, i);
+  const ViviStackValue *value;
+  ViviStackValue tmp;
+  SwfdecAsAction action;
+  int add, remove, n;
+  guint j;
+
+  if (VIVI_IS_CODE_LABEL (code)) {
+    state->branched = TRUE;
+    if (state->stack) {
+      if (!vivi_register_state_merge (state, VIVI_CODE_LABEL (code)))
+	return FALSE;
+      g_array_free (state->stack, TRUE);
+    }
+    state->stack = g_hash_table_lookup (state->labels, code);
+    /* unreachable code, the compiler doesn't create that */
+    if (state->stack == NULL)
+      return FALSE;
+    state->stack = vivi_stack_copy (state->stack);
+    g_hash_table_insert (state->seen, code, code);
+    return TRUE;
+  }
+  if (!VIVI_IS_CODE_ASM_CODE (code))
+    return TRUE;
+  /* skip unreachable code */
+  if (state->stack == NULL)
+    return TRUE;
+
+  action = vivi_code_asm_code_get_action (VIVI_CODE_ASM_CODE (code));
+  switch (action) {
+    case SWFDEC_AS_ACTION_PUSH:
+      for (j = 0; j < vivi_code_asm_push_get_n_values (VIVI_CODE_ASM_PUSH (code)); j++) {
+	tmp.name = NULL;
+	tmp.integer = -1;
+	tmp.push = VIVI_CODE_ASM_PUSH (code);
+	tmp.index = j;
+	switch (vivi_code_asm_push_get_value_type (tmp.push, j)) {
+	  case VIVI_CODE_CONSTANT_STRING:
+	    tmp.name = vivi_code_asm_push_get_string (tmp.push, j);
+	    break;
+	  case VIVI_CODE_CONSTANT_INTEGER:
+	    tmp.integer = MAX (vivi_code_asm_push_get_integer (tmp.push, j), -1);
+	    break;
+	  default:
+	    break;
+	}
+	g_array_append_val (state->stack, tmp);
+      }
+      return TRUE;
+    case SWFDEC_AS_ACTION_PUSH_DUPLICATE:
+      value = vivi_register_state_peek (state, 1);
+      if (value == NULL)
+	return FALSE;
+      tmp = *value;
+      tmp.push = NULL;
+      g_array_index (state->stack, ViviStackValue, state->stack->len - 1).push = NULL;
+      g_array_append_val (state->stack, tmp);
+      return TRUE;
+    case SWFDEC_AS_ACTION_SWAP:
+      if (state->stack->len < 2)
+	return FALSE;
+      tmp = g_array_index (state->stack, ViviStackValue, state->stack->len - 1);
+      g_array_index (state->stack, ViviStackValue, state->stack->len - 1) = 
+	g_array_index (state->stack, ViviStackValue, state->stack->len - 2);
+      g_array_index (state->stack, ViviStackValue, state->stack->len - 2) = tmp;
+      g_array_index (state->stack, ViviStackValue, state->stack->len - 1).push = NULL;
+      g_array_index (state->stack, ViviStackValue, state->stack->len - 2).push = NULL;
+      return TRUE;
+    case SWFDEC_AS_ACTION_GET_VARIABLE:
+      if (!vivi_register_state_access (state, code, 1, VIVI_ACCESS_GET, FALSE))
+	return FALSE;
+      break;
+    case SWFDEC_AS_ACTION_SET_VARIABLE:
+      if (!vivi_register_state_access (state, code, 2, VIVI_ACCESS_SET, FALSE))
+	return FALSE;
+      break;
+    case SWFDEC_AS_ACTION_DEFINE_LOCAL:
+      if (!vivi_register_state_access (state, code, 2, VIVI_ACCESS_DEFINE, FALSE))
+	return FALSE;
+      break;
+    case SWFDEC_AS_ACTION_DEFINE_LOCAL2:
+      if (!vivi_register_state_access (state, code, 1, VIVI_ACCESS_DEFINE, FALSE))
+	return FALSE;
+      break;
+    case SWFDEC_AS_ACTION_DELETE2:
+      if (!vivi_register_state_access (state, code, 1, VIVI_ACCESS_GET, TRUE))
+	return FALSE;
+      break;
+    case SWFDEC_AS_ACTION_CALL_FUNCTION:
+    case SWFDEC_AS_ACTION_NEW_OBJECT:
+      if (!vivi_register_state_access (state, code, 1, VIVI_ACCESS_GET, TRUE))
+	return FALSE;
+      value = vivi_register_state_peek (state, 2);
+      if (value == NULL || value->integer < 0)
+	return FALSE;
+      if (!vivi_register_state_pop (state, value->integer + 2))
+	return FALSE;
+      vivi_register_state_push (state, 1);
+      return TRUE;
+    case SWFDEC_AS_ACTION_CALL_METHOD:
+    case SWFDEC_AS_ACTION_NEW_METHOD:
+      value = vivi_register_state_peek (state, 3);
+      if (value == NULL || value->integer < 0)
+	return FALSE;
+      if (!vivi_register_state_pop (state, value->integer + 3))
+	return FALSE;
+      vivi_register_state_push (state, 1);
+      return TRUE;
+    case SWFDEC_AS_ACTION_INIT_ARRAY:
+    case SWFDEC_AS_ACTION_INIT_OBJECT:
+      value = vivi_register_state_peek (state, 1);
+      if (value == NULL || value->integer < 0)
+	return FALSE;
+      n = value->integer * (action == SWFDEC_AS_ACTION_INIT_OBJECT ? 2 : 1);
+      if (!vivi_register_state_pop (state, n + 1))
+	return FALSE;
+      vivi_register_state_push (state, 1);
+      return TRUE;
+    case SWFDEC_AS_ACTION_JUMP:
+      state->branched = TRUE;
+      if (!vivi_register_state_merge (state, 
+	    vivi_code_asm_jump_get_label (VIVI_CODE_ASM_JUMP (code))))
+	return FALSE;
+      g_array_free (state->stack, TRUE);
+      state->stack = NULL;
+      return TRUE;
+    case SWFDEC_AS_ACTION_IF:
+      state->branched = TRUE;
+      if (!vivi_register_state_pop (state, 1))
+	return FALSE;
+      return vivi_register_state_merge (state, 
+	  vivi_code_asm_if_get_label (VIVI_CODE_ASM_IF (code)));
+    case SWFDEC_AS_ACTION_RETURN:
+    case SWFDEC_AS_ACTION_THROW:
+      g_array_free (state->stack, TRUE);
+      state->stack = NULL;
+      return TRUE;
+    /* these access variables by name or change the scope */
+    case SWFDEC_AS_ACTION_WITH:
+    case SWFDEC_AS_ACTION_TRY:
+    case SWFDEC_AS_ACTION_SET_TARGET:
+    case SWFDEC_AS_ACTION_SET_TARGET2:
+    case SWFDEC_AS_ACTION_GET_PROPERTY:
+    case SWFDEC_AS_ACTION_SET_PROPERTY:
+    case SWFDEC_AS_ACTION_CLONE_SPRITE:
+    case SWFDEC_AS_ACTION_REMOVE_SPRITE:
+    case SWFDEC_AS_ACTION_START_DRAG:
+    case SWFDEC_AS_ACTION_CALL:
+    case SWFDEC_AS_ACTION_GOTO_FRAME2:
+    case SWFDEC_AS_ACTION_GET_URL2:
+    case SWFDEC_AS_ACTION_ENUMERATE:
+    case SWFDEC_AS_ACTION_WAIT_FOR_FRAME:
+    case SWFDEC_AS_ACTION_WAIT_FOR_FRAME2:
+    case SWFDEC_AS_ACTION_CONSTANT_POOL:
+    case SWFDEC_AS_ACTION_DEFINE_FUNCTION:
+    case SWFDEC_AS_ACTION_DEFINE_FUNCTION2:
+      return FALSE;
+    default:
+      break;
+  }
+
+  vivi_code_assembler_get_stack_change (code, &add, &remove);
+  if (add < 0 || !vivi_register_state_pop (state, remove))
+    return FALSE;
+  vivi_register_state_push (state, add);
+  return TRUE;
+}
+
+static gboolean
+vivi_code_assembler_can_allocate (const char *name)
+{
+  static const char *special[] = { "this", "arguments", "super", "_global", 
+    "_root", "_parent" };
+  guint i;
+
+  if (strpbrk (name, "/:.") != NULL ||
+      g_ascii_strncasecmp (name, "_level", 6) == 0)
+    return FALSE;
+  for (i = 0; i < G_N_ELEMENTS (special); i++) {
+    if (g_ascii_strcasecmp (name, special[i]) == 0)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static void
+vivi_code_assembler_check_case (gpointer namep, gpointer varp, gpointer variables)
+{
+  ViviVariable *var = varp;
+  GList *walk, *list;
+
+  /* Flash 6 and older don't care about case, so don't touch variables 
+   * that are accessed in different spellings */
+  list = g_hash_table_get_values (variables);
+  for (walk = list; walk; walk = walk->next) {
+    ViviVariable *other = walk->data;
+    if (other != var && g_ascii_strcasecmp (other->name, var->name) == 0)
+      var->pinned = TRUE;
+  }
+  g_list_free (list);
+}
+
+/* replaces the accesses to var with accesses to its register */
+static void
+vivi_code_assembler_use_register (ViviCodeAssembler *assembler, 
+    ViviVariable *var, GArray *removals)
+{
+  ViviCodeAsm *codes[3];
+  ViviAccess *access;
+  guint i, j, n;
+
+  for (i = 0; i < var->accesses->len; i++) {
+    access = &g_array_index (var->accesses, ViviAccess, i);
+    for (j = 0; j < assembler->codes->len; j++) {
+      if (g_ptr_array_index (assembler->codes, j) == access->code)
+	break;
+    }
+    g_assert (j < assembler->codes->len);
+    n = 0;
+    switch (access->type) {
+      case VIVI_ACCESS_GET:
+	codes[n++] = vivi_code_asm_pop_new ();
+	codes[n] = vivi_code_asm_push_new ();
+	vivi_code_asm_push_add_register (VIVI_CODE_ASM_PUSH (codes[n]), var->reg);
+	n++;
+	break;
+      case VIVI_ACCESS_SET:
+      case VIVI_ACCESS_DEFINE:
+	if (vivi_code_asm_code_get_action (VIVI_CODE_ASM_CODE (access->code)) ==
+	    SWFDEC_AS_ACTION_DEFINE_LOCAL2) {
+	  /* registers start out undefined already */
+	  codes[n++] = vivi_code_asm_pop_new ();
+	  break;
+	}
+	codes[n++] = vivi_code_asm_store_new (var->reg);
+	codes[n++] = vivi_code_asm_pop_new ();
+	codes[n++] = vivi_code_asm_pop_new ();
+	break;
+      default:
+	g_assert_not_reached ();
+    }
+    /* The name is only needed for popping it again. If it is still in the 
+     * push that created it, the pop can be left out as well. */
+    if (access->type != VIVI_ACCESS_GET && access->push) {
+      g_array_append_val (removals, *access);
+      n--;
+      g_object_unref (codes[n]);
+    }
+    vivi_code_assembler_replace_code (assembler, j, n, codes);
+  }
+}
+
+static int
+vivi_code_assembler_compare_removals (gconstpointer a, gconstpointer b)
+{
+  const ViviAccess *ra = a;
+  const ViviAccess *rb = b;
+
+  if (ra->push != rb->push)
+    return ra->push < rb->push ? -1 : 1;
+  return (int) rb->index - (int) ra->index;
+}
+
+static int
+vivi_code_assembler_compare_variables (gconstpointer a, gconstpointer b)
+{
+  const ViviVariable *va = a;
+  const ViviVariable *vb = b;
+
+  return strcmp (va->name, vb->name);
+}
+
+static void
+vivi_code_assembler_allocate_function (ViviCodeAssembler *assembler, guint i)
+{
+  ViviCodeAsmFunction2 *fun = g_ptr_array_index (assembler->codes, i);
+  ViviRegisterState state = { assembler, NULL, NULL, NULL, NULL, FALSE };
+  ViviVariable *var;
+  GArray *removals;
+  GList *walk, *list;
+  guint j, end, reg;
+  gboolean ok = TRUE;
+
+  end = vivi_code_assembler_get_function_end (assembler, i);
+  if (end >= assembler->codes->len)
+    return;
+  state.stack = g_array_new (FALSE, FALSE, sizeof (ViviStackValue));
+  state.labels = g_hash_table_new_full (g_direct_hash, g_direct_equal, 
+      NULL, vivi_stack_free);
+  state.seen = g_hash_table_new (g_direct_hash, g_direct_equal);
+  state.variables = g_hash_table_new_full (g_str_hash, g_str_equal, 
+      NULL, vivi_variable_free);
+  for (j = i + 1; j < end && ok; j++) {
+    ok = vivi_register_state_simulate (&state, j);
+  }
+  if (state.stack)
+    g_array_free (state.stack, TRUE);
+  if (!ok)
+    goto out;
+
+  for (j = 0; j < vivi_code_asm_function2_get_n_arguments (fun); j++) {
+    if (vivi_code_asm_function2_get_argument_preload (fun, j))
+      continue;
+    var = vivi_register_state_get_variable (&state, 
+	vivi_code_asm_function2_get_argument_name (fun, j));
+    /* arguments are set before the function runs */
+    var->defined = TRUE;
+  }
+  g_hash_table_foreach (state.variables, vivi_code_assembler_check_case, 
+      state.variables);
+
+  /* register 0 is used by the compiler for temporary values */
+  reg = MAX (vivi_code_asm_function2_get_n_registers (fun), 1);
+  removals = g_array_new (FALSE, FALSE, sizeof (ViviAccess));
+  /* sort so the output doesn't depend on the hash table */
+  list = g_list_sort (g_hash_table_get_values (state.variables), 
+      vivi_code_assembler_compare_variables);
+  for (walk = list; walk && reg < 256; walk = walk->next) {
+    var = walk->data;
+    if (!var->defined || var->pinned || var->accesses->len == 0 ||
+	!vivi_code_assembler_can_allocate (var->name))
+      continue;
+    var->reg = reg++;
+    vivi_code_assembler_use_register (assembler, var, removals);
+    for (j = 0; j < vivi_code_asm_function2_get_n_arguments (fun); j++) {
+      if (strcmp (vivi_code_asm_function2_get_argument_name (fun, j), var->name) == 0 &&
+	  vivi_code_asm_function2_get_argument_preload (fun, j) == 0)
+	vivi_code_asm_function2_set_argument_preload (fun, j, var->reg);
+    }
+  }
+  g_list_free (list);
+  vivi_code_asm_function2_set_n_registers (fun, 
+      MAX (reg, vivi_code_asm_function2_get_n_registers (fun)));
+  /* remove names from the pushes starting with the last one, so the indexes
+   * stay valid */
+  g_array_sort (removals, vivi_code_assembler_compare_removals);
+  for (j = 0; j < removals->len; j++) {
+    ViviAccess *access = &g_array_index (removals, ViviAccess, j);
+    vivi_code_asm_push_remove_value (access->push, access->index);
+  }
+  g_array_free (removals, TRUE);
+
+out:
+  g_hash_table_destroy (state.variables);
+  g_hash_table_destroy (state.seen);
+  g_hash_table_destroy (state.labels);
+}
+
+/**
+ * vivi_code_assembler_allocate_registers:
+ * @assembler: the assembler to optimize
+ *
+ * Makes functions defined with DefineFunction2 keep their local variables
+ * and arguments in registers instead of looking them up by name. This is only
+ * done for functions that don't define functions themselves and don't 
+ * access variables in ways that can't be determined at compile time. Local
+ * variables are only moved if they are declared before the first branch of 
+ * the function and not accessed before that, as until then their name may 
+ * refer to a variable further up the scope chain.
+ **/
+void
+vivi_code_assembler_allocate_registers (ViviCodeAssembler *assembler)
+{
+  guint i;
+
+  g_return_if_fail (VIVI_IS_CODE_ASSEMBLER (assembler));
+
+  for (i = 0; i < assembler->codes->len; i++) {
+    if (VIVI_IS_CODE_ASM_FUNCTION2 (g_ptr_array_index (assembler->codes, i)))
+      vivi_code_assembler_allocate_function (assembler, i);
+  }
+}
+
 SwfdecScript *
 vivi_code_assembler_assemble_script (ViviCodeAssembler *assembler,
     guint version, GError **error)
@@ -73,6 +73,9 @@ ViviCodeValue *		vivi_code_assembler_pop_argument	(ViviCodeAssembler *	assembler
 gboolean		vivi_code_assembler_pool		(ViviCodeAssembler *	assembler);
 void			vivi_code_assembler_merge_push		(ViviCodeAssembler *	assembler,
 								 guint			max_depth);
+void			vivi_code_assembler_fold_constants	(ViviCodeAssembler *	assembler);
+void			vivi_code_assembler_remove_dead_stores	(ViviCodeAssembler *	assembler);
+void			vivi_code_assembler_allocate_registers	(ViviCodeAssembler *	assembler);
 
 SwfdecScript *		vivi_code_assembler_assemble_script	(ViviCodeAssembler *	assembler,
 								 guint			version,